@@ -186,6 +186,149 @@ typedef struct SacnCommonCallbacks
  */
 #define SACN_NETINT_CONFIG_DEFAULT_INIT {NULL, 0, false, SACN_SEND_SOCKET_CONFIG_DEFAULT_INIT}
 
+/**
+ * This enum defines the scheduling policy applied to a library thread once it starts.
+ */
+typedef enum
+{
+  /** Leave the thread with the platform's default policy and the compile-time priority option. */
+  kSacnThreadSchedDefault,
+  /** The platform's normal time-sharing policy (SCHED_OTHER on POSIX). */
+  kSacnThreadSchedOther,
+  /** Real-time first-in, first-out scheduling (SCHED_FIFO on POSIX). */
+  kSacnThreadSchedFifo,
+  /** Real-time round-robin scheduling (SCHED_RR on POSIX). */
+  kSacnThreadSchedRoundRobin
+} sacn_thread_sched_policy_t;
+
+/** Runtime configuration for one kind of library thread (receive threads or source tick threads). */
+typedef struct SacnThreadConfig
+{
+  /** The number of threads to start, or 0 for the default. Can't exceed #SACN_RECEIVER_MAX_THREADS for receive threads
+      or #SACN_SOURCE_MAX_TICK_THREADS for source tick threads. */
+  unsigned int num_threads;
+  /** The stack size of each thread, or 0 for the compile-time option. */
+  unsigned int stack_size;
+  /** The scheduling policy to apply to each thread. */
+  sacn_thread_sched_policy_t sched_policy;
+  /** The priority to use with sched_policy (sched_priority on POSIX, a SetThreadPriority() value on Windows). Ignored
+      if sched_policy is #kSacnThreadSchedDefault. */
+  int priority;
+  /** Optional. The CPU to pin each thread to, indexed by thread. If there are fewer entries than threads, they are
+      reused in order. An entry of -1 leaves that thread unpinned. If this is null, no threads are pinned. */
+  const int* cpus;
+  /** Size of cpus array. */
+  size_t num_cpus;
+} SacnThreadConfig;
+
+/** Threading configuration to give the sACN library at initialization. */
+typedef struct SacnThreadingConfig
+{
+  SacnThreadConfig receive_threads;     /**< Configuration for the receive threads. */
+  SacnThreadConfig source_tick_threads; /**< Configuration for the threads that transmit thread-based sources. */
+} SacnThreadingConfig;
+
+/**
+ * Default values for initializing a SacnThreadConfig.
+ */
+#define SACN_THREAD_CONFIG_DEFAULT_VALUES 0, 0, kSacnThreadSchedDefault, 0, NULL, 0
+
+/**
+ * Initializes the members of a SacnThreadConfig to defaults.
+ */
+#define SACN_THREAD_CONFIG_DEFAULT_INIT {SACN_THREAD_CONFIG_DEFAULT_VALUES}
+
+/**
+ * Default values for initializing a SacnThreadingConfig.
+ */
+#define SACN_THREADING_CONFIG_DEFAULT_VALUES SACN_THREAD_CONFIG_DEFAULT_INIT, SACN_THREAD_CONFIG_DEFAULT_INIT
+
+/**
+ * Initializes the members of a SacnThreadingConfig to defaults.
+ */
+#define SACN_THREADING_CONFIG_DEFAULT_INIT {SACN_THREADING_CONFIG_DEFAULT_VALUES}
+
+/** The workload to size the library's buffers and pools for. See sacn_reserve(). */
+typedef struct SacnReserveConfig
+{
+  /** The number of receivers and merge receivers (i.e. universes being received) expected at once. */
+  size_t receivers;
+  /** The number of remote sources expected on each universe being received. */
+  size_t sources_per_universe;
+  /** The number of universes each local source is expected to transmit, and each remote source to advertise in
+      universe discovery. */
+  size_t universes;
+  /** The number of network interfaces expected to be in use. */
+  size_t netints;
+  /** The number of local sources expected at once. */
+  size_t sources;
+  /** The number of unicast destinations expected on each local source universe. */
+  size_t unicast_dests;
+} SacnReserveConfig;
+
+/**
+ * Default values for initializing a SacnReserveConfig.
+ */
+#define SACN_RESERVE_CONFIG_DEFAULT_VALUES 0, 0, 0, 0, 0, 0
+
+/**
+ * Initializes the members of a SacnReserveConfig to defaults.
+ */
+#define SACN_RESERVE_CONFIG_DEFAULT_INIT {SACN_RESERVE_CONFIG_DEFAULT_VALUES}
+
+/** One pool of a memory arena, holding blocks of a single size. See sacn_set_mem_arena_pools(). */
+typedef struct SacnMemArenaPool
+{
+  /** The size of each block in the pool, in bytes. Rounded up to a multiple of 16. */
+  size_t block_size;
+  /** The number of blocks in the pool. */
+  size_t num_blocks;
+} SacnMemArenaPool;
+
+/** The memory used by one of the library's modules. See sacn_get_memory_stats(). */
+typedef struct SacnModuleMemoryStats
+{
+  /** The bytes taken up by the module's pools, rb-tree nodes and buffers, counted as each pool's capacity times the
+      size of its items. In static memory mode, this is the size of the module's compile-time pools. */
+  size_t bytes_allocated;
+  /** The number of objects (receivers, sources, etc.) the module's pools can hold. In static memory mode, these are
+      the compile-time limits. Objects allocated individually count as one each. */
+  size_t pool_capacity;
+  /** The number of objects currently in use from the module's pools. */
+  size_t pool_in_use;
+  /** The number of rb-tree nodes the module's node pools can hold. */
+  size_t rb_node_capacity;
+  /** The number of rb-tree nodes currently in use by the module. */
+  size_t rb_nodes_in_use;
+} SacnModuleMemoryStats;
+
+/** The memory used by each of the library's modules. See sacn_get_memory_stats(). */
+typedef struct SacnMemoryStats
+{
+  SacnModuleMemoryStats receiver;        /**< The receiver module, including the remote source handles. */
+  SacnModuleMemoryStats merge_receiver;  /**< The merge receiver module. */
+  SacnModuleMemoryStats dmx_merger;      /**< The DMX merger module. */
+  SacnModuleMemoryStats source;          /**< The source module. */
+  SacnModuleMemoryStats source_detector; /**< The source detector module. */
+  SacnModuleMemoryStats source_loss;     /**< The termination sets used to detect source loss. */
+  /** The number of receive threads, each with its own notification buffers. See sacn_get_thread_memory_stats(). */
+  unsigned int num_threads;
+} SacnMemoryStats;
+
+/** The sizes in bytes of one receive thread's notification buffers. See sacn_get_thread_memory_stats(). */
+typedef struct SacnThreadMemoryStats
+{
+  size_t universe_data;         /**< The universe data notification. */
+  size_t sources_lost;          /**< The sources lost notifications, including their lists of lost sources. */
+  size_t sampling_started;      /**< The sampling period started notifications. */
+  size_t sampling_ended;        /**< The sampling period ended notifications. */
+  size_t source_pap_lost;       /**< The per-address priority lost notification. */
+  size_t source_limit_exceeded; /**< The source limit exceeded notification. */
+  size_t status_lists;          /**< The source status lists used to detect source loss. */
+  size_t to_erase;              /**< The list of tracked sources to remove. */
+  size_t merged_data;           /**< The merge receiver's merged data notification. */
+} SacnThreadMemoryStats;
+
 /** A mask of desired sACN features. See "sACN feature masks". */
 typedef uint32_t sacn_features_t;
 
@@ -222,9 +365,21 @@ etcpal_error_t sacn_init_features_with_cb(const EtcPalLogParams*     log_params,
                                           const SacnNetintConfig*    sys_netint_config,
                                           sacn_features_t            features,
                                           const SacnCommonCallbacks* callbacks);
+etcpal_error_t sacn_init_features_with_config(const EtcPalLogParams*     log_params,
+                                              const SacnNetintConfig*    sys_netint_config,
+                                              sacn_features_t            features,
+                                              const SacnCommonCallbacks* callbacks,
+                                              const SacnThreadingConfig* threading_config);
 void           sacn_deinit(void);
 void           sacn_deinit_features(sacn_features_t features);
 
+etcpal_error_t sacn_reserve(const SacnReserveConfig* config);
+etcpal_error_t sacn_set_mem_arena(void* block, size_t size);
+etcpal_error_t sacn_set_mem_arena_pools(void* block, size_t size, const SacnMemArenaPool* pools, size_t num_pools);
+size_t         sacn_get_buffer_growth_count(void);
+etcpal_error_t sacn_get_memory_stats(SacnMemoryStats* stats);
+etcpal_error_t sacn_get_thread_memory_stats(unsigned int thread_index, SacnThreadMemoryStats* stats);
+
 sacn_remote_source_t sacn_get_remote_source_handle(const EtcPalUuid* source_cid);
 etcpal_error_t       sacn_get_remote_source_cid(sacn_remote_source_t source_handle, EtcPalUuid* source_cid);
 
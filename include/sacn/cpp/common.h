@@ -126,6 +126,9 @@ struct LibrarySettings
   /** Configuration for send sockets (e.g. configurable sockopts). */
   SacnSendSocketConfig send_socket_config{SACN_SEND_SOCKET_CONFIG_DEFAULT_VALUES};
 
+  /** Number, stack size, scheduling policy and CPU affinity of the receive and source tick threads. */
+  SacnThreadingConfig threading_config{SACN_THREADING_CONFIG_DEFAULT_VALUES};
+
   /** Sets default settings. */
   LibrarySettings() = default;
 };
@@ -186,7 +189,8 @@ inline etcpal::Error Init(sacn_features_t features = SACN_FEATURES_ALL, const Li
   netint_config.send_socket_config = settings.send_socket_config;
 
   auto callbacks = internal::GetCommonCallbacks(settings.notify_handler);
-  return sacn_init_features_with_cb(nullptr, &netint_config, features, settings.notify_handler ? &callbacks : nullptr);
+  return sacn_init_features_with_config(nullptr, &netint_config, features,
+                                        settings.notify_handler ? &callbacks : nullptr, &settings.threading_config);
 }
 
 /**
@@ -218,8 +222,8 @@ inline etcpal::Error Init(const EtcPalLogParams* log_params,
   netint_config.send_socket_config = settings.send_socket_config;
 
   auto callbacks = internal::GetCommonCallbacks(settings.notify_handler);
-  return sacn_init_features_with_cb(log_params, &netint_config, features,
-                                    settings.notify_handler ? &callbacks : nullptr);
+  return sacn_init_features_with_config(log_params, &netint_config, features,
+                                        settings.notify_handler ? &callbacks : nullptr, &settings.threading_config);
 }
 
 /**
@@ -255,8 +259,8 @@ inline etcpal::Error Init(const EtcPalLogParams* log_params,
     netint_config.no_netints = true;
 
   auto callbacks = internal::GetCommonCallbacks(settings.notify_handler);
-  return sacn_init_features_with_cb(log_params, &netint_config, features,
-                                    settings.notify_handler ? &callbacks : nullptr);
+  return sacn_init_features_with_config(log_params, &netint_config, features,
+                                        settings.notify_handler ? &callbacks : nullptr, &settings.threading_config);
 }
 
 /**
@@ -289,8 +293,8 @@ inline etcpal::Error Init(const EtcPalLogParams*           log_params,
   netint_config.send_socket_config = settings.send_socket_config;
 
   auto callbacks = internal::GetCommonCallbacks(settings.notify_handler);
-  return sacn_init_features_with_cb(log_params, &netint_config, features,
-                                    settings.notify_handler ? &callbacks : nullptr);
+  return sacn_init_features_with_config(log_params, &netint_config, features,
+                                        settings.notify_handler ? &callbacks : nullptr, &settings.threading_config);
 }
 
 /**
@@ -322,7 +326,8 @@ inline etcpal::Error Init(std::vector<SacnMcastInterface>& sys_netints,
   netint_config.send_socket_config = settings.send_socket_config;
 
   auto callbacks = internal::GetCommonCallbacks(settings.notify_handler);
-  return sacn_init_features_with_cb(nullptr, &netint_config, features, settings.notify_handler ? &callbacks : nullptr);
+  return sacn_init_features_with_config(nullptr, &netint_config, features,
+                                        settings.notify_handler ? &callbacks : nullptr, &settings.threading_config);
 }
 
 /**
@@ -357,8 +362,8 @@ inline etcpal::Error Init(const etcpal::Logger&  logger,
     netint_config.no_netints = true;
 
   auto callbacks = internal::GetCommonCallbacks(settings.notify_handler);
-  return sacn_init_features_with_cb(&logger.log_params(), &netint_config, features,
-                                    settings.notify_handler ? &callbacks : nullptr);
+  return sacn_init_features_with_config(&logger.log_params(), &netint_config, features,
+                                        settings.notify_handler ? &callbacks : nullptr, &settings.threading_config);
 }
 
 /**
@@ -387,8 +392,8 @@ inline etcpal::Error Init(const etcpal::Logger& logger, sacn_features_t features
   netint_config.send_socket_config = settings.send_socket_config;
 
   auto callbacks = internal::GetCommonCallbacks(settings.notify_handler);
-  return sacn_init_features_with_cb(&logger.log_params(), &netint_config, features,
-                                    settings.notify_handler ? &callbacks : nullptr);
+  return sacn_init_features_with_config(&logger.log_params(), &netint_config, features,
+                                        settings.notify_handler ? &callbacks : nullptr, &settings.threading_config);
 }
 
 /**
@@ -420,8 +425,8 @@ inline etcpal::Error Init(const etcpal::Logger&            logger,
   netint_config.send_socket_config = settings.send_socket_config;
 
   auto callbacks = internal::GetCommonCallbacks(settings.notify_handler);
-  return sacn_init_features_with_cb(&logger.log_params(), &netint_config, features,
-                                    settings.notify_handler ? &callbacks : nullptr);
+  return sacn_init_features_with_config(&logger.log_params(), &netint_config, features,
+                                        settings.notify_handler ? &callbacks : nullptr, &settings.threading_config);
 }
 
 /**
@@ -440,6 +445,110 @@ inline void Deinit(sacn_features_t features = SACN_FEATURES_ALL)
   sacn_deinit_features(features);
 }
 
+/**
+ * @ingroup sacn_cpp_common
+ * @brief Reserve capacity in the sACN library's buffers and pools for an expected workload.
+ *
+ * Wraps sacn_reserve(). Call this before Init() so that the library's buffers are sized for the workload up front.
+ *
+ * @param[in] config The expected workload.
+ * @return etcpal::Error::Ok(): Capacity reserved successfully.
+ * @return Errors from sacn_reserve().
+ */
+inline etcpal::Error Reserve(const SacnReserveConfig& config)
+{
+  return sacn_reserve(&config);
+}
+
+/**
+ * @ingroup sacn_cpp_common
+ * @brief Provide the block of memory that the sACN library allocates from.
+ *
+ * Wraps sacn_set_mem_arena(). Only available if #SACN_MEM_ARENA is enabled. Call this before Init(), and keep the
+ * block valid until Deinit().
+ *
+ * @param[in] block The memory for the library to allocate from, or nullptr to clear the current block.
+ * @param[in] size The size of the block in bytes.
+ * @return etcpal::Error::Ok(): Block set successfully.
+ * @return Errors from sacn_set_mem_arena().
+ */
+inline etcpal::Error SetMemArena(void* block, size_t size)
+{
+  return sacn_set_mem_arena(block, size);
+}
+
+/**
+ * @ingroup sacn_cpp_common
+ * @brief Provide the block of memory that the sACN library allocates from, carved into the given pools.
+ *
+ * Wraps sacn_set_mem_arena_pools(). Only available if #SACN_MEM_ARENA is enabled. Call this before Init(), and keep
+ * the block valid until Deinit().
+ *
+ * @param[in] block The memory for the library to allocate from.
+ * @param[in] size The size of the block in bytes.
+ * @param[in] pools The pools to carve the block into, in increasing order of block size.
+ * @return etcpal::Error::Ok(): Block set successfully.
+ * @return Errors from sacn_set_mem_arena_pools().
+ */
+inline etcpal::Error SetMemArenaPools(void* block, size_t size, const std::vector<SacnMemArenaPool>& pools)
+{
+  return sacn_set_mem_arena_pools(block, size, pools.data(), pools.size());
+}
+
+/**
+ * @ingroup sacn_cpp_common
+ * @brief Get the number of times one of the library's buffers has had to grow at runtime.
+ *
+ * Wraps sacn_get_buffer_growth_count().
+ *
+ * @return The number of buffer growth events so far.
+ */
+inline size_t GetBufferGrowthCount()
+{
+  return sacn_get_buffer_growth_count();
+}
+
+/**
+ * @ingroup sacn_cpp_common
+ * @brief Get the memory used by each of the sACN library's modules.
+ *
+ * Wraps sacn_get_memory_stats().
+ *
+ * @return The memory used by each module, if there was no error.
+ * @return Errors from sacn_get_memory_stats().
+ */
+inline etcpal::Expected<SacnMemoryStats> GetMemoryStats()
+{
+  SacnMemoryStats stats{};
+  etcpal_error_t  error = sacn_get_memory_stats(&stats);
+
+  if (error == kEtcPalErrOk)
+    return stats;
+
+  return error;
+}
+
+/**
+ * @ingroup sacn_cpp_common
+ * @brief Get the sizes of one receive thread's notification buffers.
+ *
+ * Wraps sacn_get_thread_memory_stats().
+ *
+ * @param[in] thread_index The index of the receive thread.
+ * @return The size in bytes of each of the thread's notification buffers, if there was no error.
+ * @return Errors from sacn_get_thread_memory_stats().
+ */
+inline etcpal::Expected<SacnThreadMemoryStats> GetThreadMemoryStats(unsigned int thread_index)
+{
+  SacnThreadMemoryStats stats{};
+  etcpal_error_t        error = sacn_get_thread_memory_stats(thread_index, &stats);
+
+  if (error == kEtcPalErrOk)
+    return stats;
+
+  return error;
+}
+
 /**
  * @ingroup sacn_cpp_common
  * @brief Converts a remote source CID to the corresponding handle, or #kSacnRemoteSourceInvalid if not found.
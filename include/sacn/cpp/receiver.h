@@ -272,10 +272,13 @@ public:
   etcpal::Error                              ChangeFootprint(const SacnRecvUniverseSubrange& new_footprint);
   etcpal::Error ChangeUniverseAndFootprint(uint16_t new_universe_id, const SacnRecvUniverseSubrange& new_footprint);
   std::vector<EtcPalMcastNetintId> GetNetworkInterfaces();
+  etcpal::Expected<SacnRecvSourceTiming> GetSourceTiming(sacn_remote_source_t source) const;
 
   // Lesser used functions.  These apply to all instances of this class.
   static void     SetExpiredWait(uint32_t wait_ms);
   static uint32_t GetExpiredWait();
+  static uint64_t GetNumDiscardedPackets();
+  static uint64_t GetTimeNs();
 
   static etcpal::Error ResetNetworking(McastMode mcast_mode);
   static etcpal::Error ResetNetworking(std::vector<SacnMcastInterface>& netints);
@@ -627,6 +630,25 @@ inline std::vector<EtcPalMcastNetintId> Receiver::GetNetworkInterfaces()
   return netints;
 }
 
+/**
+ * @brief Get the timing statistics this receiver has collected for one of its sources.
+ *
+ * The statistics are only collected if #SACN_RECEIVER_ENABLE_TIMESTAMPS is enabled.
+ *
+ * @param[in] source Handle to the source.
+ * @return The source's jitter and latency histograms, or an error code if the receiver isn't tracking the source or
+ *         timestamps are disabled.
+ */
+inline etcpal::Expected<SacnRecvSourceTiming> Receiver::GetSourceTiming(sacn_remote_source_t source) const
+{
+  SacnRecvSourceTiming result;
+  etcpal_error_t       err = sacn_receiver_get_source_timing(handle_.value(), source, &result);
+  if (err == kEtcPalErrOk)
+    return result;
+
+  return err;
+}
+
 /**
  * @brief Set the expired notification wait time.
  *
@@ -655,6 +677,31 @@ inline uint32_t Receiver::GetExpiredWait()
   return sacn_receiver_get_expired_wait();
 }
 
+/**
+ * @brief Get the number of sACN data packets that were discarded because no receiver was listening to their universe.
+ *
+ * On networks without IGMP snooping, receivers can get multicast traffic for many universes they aren't listening
+ * to. Those packets are dropped as soon as they're read, before the library parses them, and counted here.
+ *
+ * @return The number of discarded data packets.
+ */
+inline uint64_t Receiver::GetNumDiscardedPackets()
+{
+  return sacn_receiver_get_num_discarded_packets();
+}
+
+/**
+ * @brief Get the current time on the clock that received packets are timestamped with.
+ *
+ * Compare this to SacnRecvUniverseData::timestamp_ns to find out how long ago a packet arrived.
+ *
+ * @return The current time in nanoseconds. Only differences between two times are meaningful.
+ */
+inline uint64_t Receiver::GetTimeNs()
+{
+  return sacn_receiver_get_time_ns();
+}
+
 /**
  * @brief Resets the underlying network sockets and packet receipt state for all sACN receivers.
  *
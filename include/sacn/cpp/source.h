@@ -222,6 +222,18 @@ public:
                                       const uint8_t* new_priorities,
                                       size_t         new_priorities_size);
 
+  void UpdateUniverses(const SacnSourceUniverseUpdate* updates, size_t num_updates);
+
+  sacn_source_universe_t GetUniverseHandle(uint16_t universe);
+  void                   UpdateUniverse(sacn_source_universe_t universe_handle,
+                                        const uint8_t*         new_levels,
+                                        size_t                 new_levels_size,
+                                        const uint8_t*         new_priorities,
+                                        size_t                 new_priorities_size);
+
+  uint8_t* BeginLevels(uint16_t universe);
+  void     CommitLevels(uint16_t universe, size_t new_levels_size);
+
   std::vector<EtcPalMcastNetintId> GetNetworkInterfaces(uint16_t universe);
 
   constexpr Handle handle() const;
@@ -776,6 +788,97 @@ inline void Source::UpdateLevelsAndPapAndForceSync(uint16_t       universe,
                                                    new_priorities, new_priorities_size);
 }
 
+/**
+ * @brief Copies new DMX levels, and optionally per-address priorities, into the packets of many universes at once.
+ *
+ * Each update has the same effect as calling UpdateLevels() (if it has no priorities) or UpdateLevelsAndPap() for that
+ * universe, but all of them are applied under a single acquisition of the source API's lock. Sorting the updates by
+ * universe ID lets them be matched up with the source's universes in a single pass.
+ *
+ * Updates for universes that aren't on this source, or with sizes larger than #kSacnDmxAddressCount, are skipped.
+ *
+ * @param[in] updates The updates to apply, ideally in ascending order of universe ID.
+ * @param[in] num_updates The size of updates.
+ */
+inline void Source::UpdateUniverses(const SacnSourceUniverseUpdate* updates, size_t num_updates)
+{
+  sacn_source_update_universes(handle_.value(), updates, num_updates);
+}
+
+/**
+ * @brief Gets a handle to a universe, for updating it with UpdateUniverse().
+ *
+ * The handle remains valid until the universe is removed (including by Shutdown()). Once that happens, it will never
+ * refer to another universe, even if the same universe is added again.
+ *
+ * @param[in] universe Universe ID to get a handle to.
+ * @return The universe's handle, or #kSacnSourceUniverseInvalid if the universe wasn't found.
+ */
+inline sacn_source_universe_t Source::GetUniverseHandle(uint16_t universe)
+{
+  return sacn_source_get_universe_handle(handle_.value(), universe);
+}
+
+/**
+ * @brief Copies new DMX levels, and optionally per-address priorities, into a universe's packets by its handle.
+ *
+ * This has the same effect as one entry passed to UpdateUniverses(), but finds the universe directly from the handle
+ * returned by GetUniverseHandle() instead of looking up its universe ID.
+ *
+ * @param[in] universe_handle Handle to the universe to update. Handles to universes that have since been removed are
+ * ignored.
+ * @param[in] new_levels A buffer of DMX levels to copy from. If nullptr, the source will terminate DMX transmission on
+ * this universe without removing it.
+ * @param[in] new_levels_size Size of new_levels. This must be no larger than #kSacnDmxAddressCount.
+ * @param[in] new_priorities A buffer of per-address priorities to copy from, or nullptr to leave the universe's
+ * per-address priorities as they are.
+ * @param[in] new_priorities_size Size of new_priorities. This must be no larger than #kSacnDmxAddressCount.
+ */
+inline void Source::UpdateUniverse(sacn_source_universe_t universe_handle,
+                                   const uint8_t*         new_levels,
+                                   size_t                 new_levels_size,
+                                   const uint8_t*         new_priorities,
+                                   size_t                 new_priorities_size)
+{
+  sacn_source_update_universe(handle_.value(), universe_handle, new_levels, new_levels_size, new_priorities,
+                              new_priorities_size);
+}
+
+/**
+ * @brief Gives the universe's outgoing DMX levels to write into in place.
+ *
+ * This avoids building the levels in a separate buffer first when they can be rendered straight into the outgoing
+ * packet. The returned buffer holds #kSacnDmxAddressCount slots, and starts out holding the levels currently being
+ * sent. Once the new levels have been written, call CommitLevels() to start sending them.
+ *
+ * The source API is not locked while the levels are written, so other source functions can be called in the meantime.
+ * Until the levels are committed, this universe's levels are not sent, so keep the time in between short. Don't update
+ * the universe's levels any other way or remove the universe until they are committed. If this returns nullptr,
+ * CommitLevels() must not be called.
+ *
+ * @param[in] universe Universe to update.
+ * @return A pointer to the universe's outgoing levels, or nullptr if the universe was not found or its levels are
+ * already being written in place.
+ */
+inline uint8_t* Source::BeginLevels(uint16_t universe)
+{
+  return sacn_source_begin_levels(handle_.value(), universe);
+}
+
+/**
+ * @brief Finishes an update started with BeginLevels().
+ *
+ * This has the same effect as calling UpdateLevels() with the levels that were written in place, including zeroing
+ * levels wherever the PAP is 0 and resetting the logic that slows down packet transmission due to inactivity.
+ *
+ * @param[in] universe Universe to update. Must be the universe passed to BeginLevels().
+ * @param[in] new_levels_size The number of levels that were written. This must be no larger than #kSacnDmxAddressCount.
+ */
+inline void Source::CommitLevels(uint16_t universe, size_t new_levels_size)
+{
+  sacn_source_commit_levels(handle_.value(), universe, new_levels_size);
+}
+
 /**
  * @brief Trigger the transmission of sACN packets for all universes of sources that were created with
  * manually_process_source set to true.
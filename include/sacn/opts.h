@@ -78,6 +78,40 @@
 #define SACN_DYNAMIC_MEM SACN_FULL_OS_AVAILABLE_HINT
 #endif
 
+/**
+ * @brief Count the library's heap allocations.
+ *
+ * If defined nonzero, and #SACN_DYNAMIC_MEM is also enabled, every malloc(), calloc(), realloc() and free() made by the
+ * library is counted against the module that made it. This is meant for test builds, which use the counts to check
+ * that the steady-state receive and transmit paths make no heap allocations. Each allocation then costs an extra atomic
+ * increment.
+ */
+#ifndef SACN_TRACK_ALLOCATIONS
+#define SACN_TRACK_ALLOCATIONS 0
+#endif
+
+/**
+ * @brief Allocate from a block of memory provided by the application, instead of the system heap.
+ *
+ * If defined nonzero, and #SACN_DYNAMIC_MEM is also enabled, the library makes no system heap allocations. Before
+ * initializing the library, the application passes it a single block of memory with sacn_set_mem_arena(), which
+ * carves it into fixed pools of power-of-two sized blocks with an equal share of the block each, or with
+ * sacn_set_mem_arena_pools(), which carves it into the pools the application gives. Every allocation the library
+ * makes takes a block from one of these pools, so the block never fragments. Calling sacn_reserve() before
+ * initializing sizes the library's buffers once at initialization, so that they don't grow into larger blocks while
+ * running.
+ *
+ * This gives a build with no heap use, like #SACN_DYNAMIC_MEM set to 0, whose memory footprint and object limits are
+ * chosen at runtime, e.g. from the amount of RAM on the device, rather than at compile time.
+ */
+#ifndef SACN_MEM_ARENA
+#define SACN_MEM_ARENA 0
+#endif
+
+#if SACN_MEM_ARENA && !SACN_DYNAMIC_MEM
+#error "Error: SACN_MEM_ARENA requires SACN_DYNAMIC_MEM."
+#endif
+
 /**
  * @brief Enable message logging from the sACN library.
  *
@@ -180,6 +214,8 @@ bool sacn_assert_verify_fail(const char* exp, const char* file, const char* func
  * @brief The priority of each sACN receiver thread.
  *
  * This is usually only meaningful on real-time systems.
+ *
+ * The application can override this at initialization with SacnThreadConfig.
  */
 #ifndef SACN_RECEIVER_THREAD_PRIORITY
 #define SACN_RECEIVER_THREAD_PRIORITY ETCPAL_THREAD_DEFAULT_PRIORITY
@@ -189,6 +225,8 @@ bool sacn_assert_verify_fail(const char* exp, const char* file, const char* func
  * @brief The stack size of each sACN receiver thread.
  *
  * It's usually only necessary to worry about this on real-time or embedded systems.
+ *
+ * The application can override this at initialization with SacnThreadConfig.
  */
 #ifndef SACN_RECEIVER_THREAD_STACK
 #define SACN_RECEIVER_THREAD_STACK ETCPAL_THREAD_DEFAULT_STACK
@@ -343,10 +381,201 @@ bool sacn_assert_verify_fail(const char* exp, const char* file, const char* func
 #endif
 
 /**
- * @brief Currently unconfigurable; will be configurable in the future.
+ * @brief Determines whether the kernel should steer each universe's traffic to a single receive thread (Linux only).
+ *
+ * If enabled, each receiver is assigned to the receive thread its universe maps to (universe modulo the number of
+ * receive threads) instead of the least loaded thread. The threads' bound sockets form an SO_REUSEPORT group, and an
+ * SO_ATTACH_REUSEPORT_CBPF program steers unicast datagrams to the socket of the thread that owns their universe.
+ * Multicast is delivered to every socket in the group by the kernel, so the per-thread packet filters enabled by
+ * #SACN_RECEIVER_ENABLE_BPF_FILTER drop the other threads' universes. Together, each thread only receives traffic for
+ * its own universes.
+ *
+ * Other processes that bind the sACN port with SO_REUSEPORT as the same user join the same group, which throws the
+ * steering off. Those datagrams still get to the right receiver, but they may go through another thread first.
+ *
+ * Requires #SACN_RECEIVER_ENABLE_SO_REUSEPORT, #SACN_RECEIVER_LIMIT_BIND and #SACN_RECEIVER_ENABLE_BPF_FILTER. This
+ * option is ignored on platforms other than Linux.
+ */
+#ifndef SACN_RECEIVER_ENABLE_REUSEPORT_STEERING
+#define SACN_RECEIVER_ENABLE_REUSEPORT_STEERING 0
+#endif
+
+#if SACN_RECEIVER_ENABLE_REUSEPORT_STEERING && (!SACN_RECEIVER_ENABLE_SO_REUSEPORT || !SACN_RECEIVER_LIMIT_BIND)
+#error "Error: SACN_RECEIVER_ENABLE_REUSEPORT_STEERING requires SO_REUSEPORT and SACN_RECEIVER_LIMIT_BIND."
+#endif
+
+/**
+ * @brief Determines whether sACN should attach a kernel packet filter to its receive sockets (Linux only).
+ *
+ * If enabled, each receive thread attaches a classic BPF program (SO_ATTACH_FILTER) to its bound sockets. The program
+ * drops sACN data packets for universes that none of the thread's receivers are listening to, so they are discarded
+ * by the kernel instead of being copied into user space. Other packets, such as universe discovery and sync, are
+ * passed through. The program is regenerated whenever receivers are added, removed or change universes.
+ *
+ * Defaults to the value of #SACN_RECEIVER_ENABLE_REUSEPORT_STEERING. This option is ignored on platforms other than
+ * Linux.
+ */
+#ifndef SACN_RECEIVER_ENABLE_BPF_FILTER
+#define SACN_RECEIVER_ENABLE_BPF_FILTER SACN_RECEIVER_ENABLE_REUSEPORT_STEERING
+#endif
+
+#if SACN_RECEIVER_ENABLE_REUSEPORT_STEERING && !SACN_RECEIVER_ENABLE_BPF_FILTER
+#error "Error: SACN_RECEIVER_ENABLE_REUSEPORT_STEERING requires SACN_RECEIVER_ENABLE_BPF_FILTER."
+#endif
+
+/**
+ * @brief Determines whether receivers are migrated between receive threads based on their traffic.
+ *
+ * Each receive thread always measures the packets per second and processing time of its receivers. If this is enabled,
+ * once per measurement window the busiest thread hands one of its receivers to the least busy thread when that evens
+ * out the load. The receiver's socket subscriptions move with it.
+ *
+ * Only meaningful with more than one receive thread. Can't be combined with
+ * #SACN_RECEIVER_ENABLE_REUSEPORT_STEERING, which fixes each universe to one thread.
+ */
+#ifndef SACN_RECEIVER_ENABLE_LOAD_BALANCING
+#define SACN_RECEIVER_ENABLE_LOAD_BALANCING 0
+#endif
+
+#if SACN_RECEIVER_ENABLE_LOAD_BALANCING && SACN_RECEIVER_ENABLE_REUSEPORT_STEERING
+#error "Error: SACN_RECEIVER_ENABLE_LOAD_BALANCING can't be combined with SACN_RECEIVER_ENABLE_REUSEPORT_STEERING."
+#endif
+
+/**
+ * @brief Determines whether receive threads read through io_uring instead of polling their sockets (Linux only).
+ *
+ * If enabled, each receive thread sets up an io_uring with a ring of #SACN_RECEIVER_IO_URING_BUFFERS packet buffers
+ * and arms one multishot recvmsg per socket. The kernel receives packets straight into those buffers and queues a
+ * completion for each, so packets are handed to the receivers without a poll and a recvmsg system call apiece.
+ *
+ * Requires Linux 6.0 or later. If io_uring is unavailable, for example on older kernels or when it has been disabled
+ * by the system, the thread falls back to polling. This option is ignored on platforms other than Linux.
+ */
+#ifndef SACN_RECEIVER_ENABLE_IO_URING
+#define SACN_RECEIVER_ENABLE_IO_URING 0
+#endif
+
+/**
+ * @brief The number of packet buffers each receive thread provides to io_uring.
+ *
+ * Packets that arrive while all of these are waiting to be processed are left in the socket's receive buffer until
+ * the thread catches up. Must be a power of two. Only meaningful if #SACN_RECEIVER_ENABLE_IO_URING is enabled.
+ */
+#ifndef SACN_RECEIVER_IO_URING_BUFFERS
+#define SACN_RECEIVER_IO_URING_BUFFERS 64
+#endif
+
+#if SACN_RECEIVER_ENABLE_IO_URING &&                                                     \
+    ((SACN_RECEIVER_IO_URING_BUFFERS < 1) || (SACN_RECEIVER_IO_URING_BUFFERS > 32768) || \
+     (SACN_RECEIVER_IO_URING_BUFFERS & (SACN_RECEIVER_IO_URING_BUFFERS - 1)))
+#error "Error: SACN_RECEIVER_IO_URING_BUFFERS must be a power of two no greater than 32768."
+#endif
+
+/**
+ * @brief Determines whether receive threads read sACN from a memory-mapped packet ring (Linux only).
+ *
+ * Meant for monitoring and analysis applications that listen to a very large number of universes. If enabled, each
+ * receive thread opens an AF_PACKET socket with a TPACKET_V3 receive ring. A kernel packet filter passes only UDP
+ * traffic to the sACN port, and the thread hands those packets to the receivers straight from the ring, without
+ * copying them. The interfaces the receivers use are put into all-multicast mode, so multicast traffic reaches the
+ * ring regardless of how many groups the host has joined. Each thread's ring only passes the universes of that
+ * thread's receivers, on the interfaces they use.
+ *
+ * The receivers' sockets are still created and still join their multicast groups, so that switches keep forwarding
+ * the traffic, but they drop everything they receive.
+ *
+ * Requires the CAP_NET_RAW capability. If the ring can't be set up, the thread falls back to reading its sockets. This
+ * option is ignored on platforms other than Linux, and can't be combined with #SACN_RECEIVER_ENABLE_IO_URING.
+ */
+#ifndef SACN_RECEIVER_ENABLE_PACKET_RING
+#define SACN_RECEIVER_ENABLE_PACKET_RING 0
+#endif
+
+/**
+ * @brief The size of each block in a receive thread's packet ring, in bytes.
+ *
+ * Must be a multiple of 4096. Only meaningful if #SACN_RECEIVER_ENABLE_PACKET_RING is enabled.
+ */
+#ifndef SACN_RECEIVER_PACKET_RING_BLOCK_SIZE
+#define SACN_RECEIVER_PACKET_RING_BLOCK_SIZE 262144
+#endif
+
+/**
+ * @brief The number of blocks in a receive thread's packet ring.
+ *
+ * Only meaningful if #SACN_RECEIVER_ENABLE_PACKET_RING is enabled.
+ */
+#ifndef SACN_RECEIVER_PACKET_RING_BLOCKS
+#define SACN_RECEIVER_PACKET_RING_BLOCKS 16
+#endif
+
+/**
+ * @brief How long the kernel may hold a partly filled block of the packet ring before handing it to the receive
+ *        thread, in milliseconds.
+ *
+ * This bounds the latency the packet ring adds when traffic is light. Only meaningful if
+ * #SACN_RECEIVER_ENABLE_PACKET_RING is enabled.
+ */
+#ifndef SACN_RECEIVER_PACKET_RING_BLOCK_TIMEOUT_MS
+#define SACN_RECEIVER_PACKET_RING_BLOCK_TIMEOUT_MS 2
+#endif
+
+#if SACN_RECEIVER_ENABLE_PACKET_RING && SACN_RECEIVER_ENABLE_IO_URING
+#error "Error: SACN_RECEIVER_ENABLE_PACKET_RING can't be combined with SACN_RECEIVER_ENABLE_IO_URING."
+#endif
+
+#if SACN_RECEIVER_ENABLE_PACKET_RING && \
+    ((SACN_RECEIVER_PACKET_RING_BLOCK_SIZE % 4096) || (SACN_RECEIVER_PACKET_RING_BLOCK_SIZE < 4096))
+#error "Error: SACN_RECEIVER_PACKET_RING_BLOCK_SIZE must be a multiple of 4096."
+#endif
+
+/**
+ * @brief Determines whether receive sockets coalesce datagrams with UDP_GRO (Linux only).
+ *
+ * If enabled, the kernel may merge consecutive datagrams of the same flow into one larger buffer, which the receive
+ * thread reads in one system call and splits back into the individual sACN packets. This cuts the per-packet kernel
+ * overhead when one source sends many universes to the host, e.g. over unicast. Each receive thread's read buffer grows
+ * to 64 KiB.
+ *
+ * Requires Linux 5.0 or later; on older kernels the sockets read one datagram at a time as usual. This option is
+ * ignored on platforms other than Linux, and can't be combined with #SACN_RECEIVER_ENABLE_IO_URING or
+ * #SACN_RECEIVER_ENABLE_PACKET_RING.
+ */
+#ifndef SACN_RECEIVER_ENABLE_UDP_GRO
+#define SACN_RECEIVER_ENABLE_UDP_GRO 0
+#endif
+
+#if SACN_RECEIVER_ENABLE_UDP_GRO && (SACN_RECEIVER_ENABLE_IO_URING || SACN_RECEIVER_ENABLE_PACKET_RING)
+#error "Error: SACN_RECEIVER_ENABLE_UDP_GRO can't be combined with SACN_RECEIVER_ENABLE_IO_URING or the packet ring."
+#endif
+
+/**
+ * @brief Determines whether receivers timestamp incoming packets and keep per-source timing statistics.
+ *
+ * If enabled, each packet's arrival time is passed to the universe data callback in SacnRecvUniverseData::timestamp_ns,
+ * and every tracked source gets histograms of its packets' inter-arrival jitter and of the time from arrival to the
+ * universe data callback (see sacn_receiver_get_source_timing()). On Linux, the arrival time is taken by the kernel
+ * (SO_TIMESTAMPNS); elsewhere it is taken when the receive thread reads the packet.
+ */
+#ifndef SACN_RECEIVER_ENABLE_TIMESTAMPS
+#define SACN_RECEIVER_ENABLE_TIMESTAMPS 0
+#endif
+
+/**
+ * @brief The maximum number of receive threads the application can request at initialization.
+ *
+ * The number of receive threads actually started is chosen at runtime with SacnThreadConfig::num_threads (one by
+ * default), up to this limit. If #SACN_DYNAMIC_MEM is 0, the per-thread buffers are allocated statically for this
+ * many threads. Otherwise they are allocated for the number of threads requested, and this only sizes a few small
+ * internal arrays.
  */
-#undef SACN_RECEIVER_MAX_THREADS
+#ifndef SACN_RECEIVER_MAX_THREADS
+#if SACN_DYNAMIC_MEM
+#define SACN_RECEIVER_MAX_THREADS 64
+#else
 #define SACN_RECEIVER_MAX_THREADS 1
+#endif
+#endif
 
 /**
  * @brief Currently unconfigurable; will be configurable in the future.
@@ -372,6 +601,8 @@ bool sacn_assert_verify_fail(const char* exp, const char* file, const char* func
  * @brief The priority of the sACN source thread.
  *
  * This is usually only meaningful on real-time systems.
+ *
+ * The application can override this at initialization with SacnThreadConfig.
  */
 #ifndef SACN_SOURCE_THREAD_PRIORITY
 #define SACN_SOURCE_THREAD_PRIORITY ETCPAL_THREAD_DEFAULT_PRIORITY
@@ -381,6 +612,8 @@ bool sacn_assert_verify_fail(const char* exp, const char* file, const char* func
  * @brief The stack size of the sACN source thread.
  *
  * It's usually only necessary to worry about this on real-time or embedded systems.
+ *
+ * The application can override this at initialization with SacnThreadConfig.
  */
 #ifndef SACN_SOURCE_THREAD_STACK
 #define SACN_SOURCE_THREAD_STACK ETCPAL_THREAD_DEFAULT_STACK
@@ -395,6 +628,52 @@ bool sacn_assert_verify_fail(const char* exp, const char* file, const char* func
 #define SACN_SOURCE_THREAD_NAME "sACN Source Thread"
 #endif
 
+/**
+ * @brief The number of threads used to transmit the universes of thread-based sources.
+ *
+ * The universes of all thread-based sources are divided into shards, one per thread. Each universe is assigned to the
+ * thread with the fewest universes when it is added, and the shards are rebalanced as universes are removed. The first
+ * thread additionally handles per-source work such as universe discovery.
+ *
+ * Increasing this can improve throughput when sending a very large number of universes on a multi-core system.
+ */
+#ifndef SACN_SOURCE_TICK_THREADS
+#define SACN_SOURCE_TICK_THREADS 1
+#endif
+
+/**
+ * @brief The maximum number of source tick threads the application can request at initialization.
+ *
+ * #SACN_SOURCE_TICK_THREADS threads are started by default. The application can choose a different number at runtime
+ * with SacnThreadConfig::num_threads, up to this limit. Each tick thread has its own send queue, so if
+ * #SACN_DYNAMIC_MEM is 0 this is also the number of statically allocated send queues.
+ */
+#ifndef SACN_SOURCE_MAX_TICK_THREADS
+#if SACN_DYNAMIC_MEM && (SACN_SOURCE_TICK_THREADS < 64)
+#define SACN_SOURCE_MAX_TICK_THREADS 64
+#else
+#define SACN_SOURCE_MAX_TICK_THREADS SACN_SOURCE_TICK_THREADS
+#endif
+#endif
+
+#if SACN_SOURCE_MAX_TICK_THREADS < SACN_SOURCE_TICK_THREADS
+#error "Error: SACN_SOURCE_MAX_TICK_THREADS must be at least SACN_SOURCE_TICK_THREADS."
+#endif
+
+/**
+ * @brief The number of packets each source tick can stage for sending after the source lock is released.
+ *
+ * Each tick copies the packets that are due into a send queue while holding the source lock, then releases the lock
+ * before handing them to the network stack. This keeps API calls such as sacn_source_update_levels() from waiting on
+ * socket sends. There is one queue per tick thread plus one for sacn_source_process_manual().
+ *
+ * This is only meaningful if #SACN_DYNAMIC_MEM is 0; otherwise the queues grow as needed. Universes that don't fit in
+ * the queue are sent while the lock is held.
+ */
+#ifndef SACN_SOURCE_SEND_QUEUE_SIZE
+#define SACN_SOURCE_SEND_QUEUE_SIZE 32
+#endif
+
 /** @cond */
 /* TODO investigate. Windows value was 20 */
 #ifndef SACN_SOURCE_MULTICAST_TTL
@@ -135,6 +135,11 @@ typedef struct SacnRecvUniverseData
    * Pointer to the slot values at the location indicated by slot_range.
    */
   const uint8_t* values;
+  /**
+   * The time the packet arrived, in nanoseconds on the clock of sacn_receiver_get_time_ns(). Only differences between
+   * timestamps are meaningful. Always 0 unless #SACN_RECEIVER_ENABLE_TIMESTAMPS is enabled.
+   */
+  uint64_t timestamp_ns;
 } SacnRecvUniverseData;
 
 /** Information about a remote sACN source being tracked by a receiver. */
@@ -162,6 +167,35 @@ typedef struct SacnLostSource
   bool terminated;
 } SacnLostSource;
 
+/** The number of buckets in a SacnRecvTimingHistogram. */
+#define SACN_RECV_TIMING_HISTOGRAM_BUCKETS 16
+
+/**
+ * A histogram of durations measured by a receiver. Bucket 0 counts durations under 1 microsecond, and bucket n counts
+ * durations of at least 2^(n-1) and under 2^n microseconds. The last bucket also counts all longer durations.
+ */
+typedef struct SacnRecvTimingHistogram
+{
+  /** The number of durations that fell into each bucket. */
+  uint32_t buckets[SACN_RECV_TIMING_HISTOGRAM_BUCKETS];
+  /** The total number of durations measured. */
+  uint32_t count;
+  /** The longest duration measured, in microseconds. */
+  uint32_t max_us;
+} SacnRecvTimingHistogram;
+
+/** Timing statistics for the packets a receiver gets from one source. */
+typedef struct SacnRecvSourceTiming
+{
+  /**
+   * How much the time between consecutive DMX packets from the source changed from one packet to the next. Sources
+   * that only send when their levels change, or slow down to keep-alive rates, show up here as jitter too.
+   */
+  SacnRecvTimingHistogram jitter;
+  /** The time from a packet arriving to the receiver's universe data callback being called for it. */
+  SacnRecvTimingHistogram latency;
+} SacnRecvSourceTiming;
+
 /**
  * @name sACN receiver flags
  * Valid values for the flags member in the SacnReceiverConfig struct.
@@ -380,6 +414,13 @@ size_t sacn_receiver_get_network_interfaces(sacn_receiver_t handle, EtcPalMcastN
 void     sacn_receiver_set_expired_wait(uint32_t wait_ms);
 uint32_t sacn_receiver_get_expired_wait();
 
+uint64_t sacn_receiver_get_num_discarded_packets(void);
+
+uint64_t       sacn_receiver_get_time_ns(void);
+etcpal_error_t sacn_receiver_get_source_timing(sacn_receiver_t       handle,
+                                               sacn_remote_source_t  source,
+                                               SacnRecvSourceTiming* timing);
+
 #ifdef __cplusplus
 }
 #endif
@@ -57,6 +57,11 @@ typedef int sacn_source_t;
 /** An invalid sACN source handle value. */
 static const sacn_source_t kSacnSourceInvalid = -1;
 
+/** A handle to a universe of a sACN source, for updating it without looking it up by universe ID. */
+typedef uint32_t sacn_source_universe_t;
+/** An invalid sACN source universe handle value. */
+static const sacn_source_universe_t kSacnSourceUniverseInvalid = 0;
+
 enum
 {
   /**
@@ -185,6 +190,25 @@ typedef struct SacnSourceUniverseNetintList
   bool no_netints;
 } SacnSourceUniverseNetintList;
 
+/** New data for one universe, for updating many universes of a source at once. */
+typedef struct SacnSourceUniverseUpdate
+{
+  /** The ID of the universe to update. */
+  uint16_t universe;
+
+  /** A buffer of DMX levels to copy from. If NULL, the source will terminate DMX transmission on this universe without
+      removing it. */
+  const uint8_t* levels;
+  /** The size of levels. This must be no larger than #kSacnDmxAddressCount. */
+  size_t levels_size;
+
+  /** A buffer of per-address priorities to copy from, or NULL to leave the universe's per-address priorities as they
+      are. */
+  const uint8_t* priorities;
+  /** The size of priorities. This must be no larger than #kSacnDmxAddressCount. */
+  size_t priorities_size;
+} SacnSourceUniverseUpdate;
+
 etcpal_error_t sacn_source_create(const SacnSourceConfig* config, sacn_source_t* handle);
 void           sacn_source_destroy(sacn_source_t handle);
 
@@ -236,6 +260,18 @@ void sacn_source_update_levels_and_pap_and_force_sync(sacn_source_t  handle,
                                                       size_t         new_levels_size,
                                                       const uint8_t* new_priorities,
                                                       size_t         new_priorities_size);
+void sacn_source_update_universes(sacn_source_t handle, const SacnSourceUniverseUpdate* updates, size_t num_updates);
+
+sacn_source_universe_t sacn_source_get_universe_handle(sacn_source_t handle, uint16_t universe);
+void                   sacn_source_update_universe(sacn_source_t          handle,
+                                                   sacn_source_universe_t universe_handle,
+                                                   const uint8_t*         new_levels,
+                                                   size_t                 new_levels_size,
+                                                   const uint8_t*         new_priorities,
+                                                   size_t                 new_priorities_size);
+
+uint8_t* sacn_source_begin_levels(sacn_source_t handle, uint16_t universe);
+void     sacn_source_commit_levels(sacn_source_t handle, uint16_t universe, size_t new_levels_size);
 
 int sacn_source_process_manual(sacn_source_tick_mode_t tick_mode);
 
@@ -30,6 +30,7 @@
 #include "sacn/private/merge_receiver.h"
 #include "sacn/private/source_detector.h"
 #include "sacn/private/source_detector_state.h"
+#include "sacn/private/util.h"
 
 /***************************** Global variables ******************************/
 
@@ -128,8 +129,6 @@ etcpal_error_t sacn_init_features(const EtcPalLogParams*  log_params,
   return sacn_init_features_with_cb(log_params, sys_netint_config, features, NULL);
 }
 
-// NOLINTBEGIN(readability-function-cognitive-complexity)
-
 /**
  * @brief Initialize specific features of the sACN library.
  *
@@ -154,6 +153,40 @@ etcpal_error_t sacn_init_features_with_cb(const EtcPalLogParams*     log_params,
                                           const SacnNetintConfig*    sys_netint_config,
                                           sacn_features_t            features,
                                           const SacnCommonCallbacks* callbacks)
+{
+  return sacn_init_features_with_config(log_params, sys_netint_config, features, callbacks, NULL);
+}
+
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+/**
+ * @brief Initialize specific features of the sACN library with a threading configuration.
+ *
+ * Do all necessary initialization before other sACN API functions can be called.
+ *
+ * Redundant initialization of features is permitted - the library tracks counters for each feature and expects deinit
+ * to be called the same number of times as init for each feature. The threading configuration only takes effect when
+ * the network features are first initialized; it is ignored by redundant initialization.
+ *
+ * @param[in] log_params A struct used by the library to log messages, or NULL for no logging. If
+ *                       #SACN_LOGGING_ENABLED is 0, this parameter is ignored.
+ * @param[in, out] sys_netint_config Optional. If non-NULL, this is the list of system interfaces the library will be
+ * limited to (with the added option of not allowing any interfaces to be used), and the status codes are filled in.  If
+ * NULL, the library is allowed to use all available system interfaces.
+ * @param[in] features Mask of sACN features to initialize.
+ * @param[in] callbacks Optional. A struct of callback functions for the library to use to notify the application of
+ * events.
+ * @param[in] threading_config Optional. The number, stack size, scheduling policy and CPU affinity of the receive and
+ * source tick threads. If NULL, the compile-time options are used.
+ * @return #kEtcPalErrOk: Initialization successful.
+ * @return #kEtcPalErrInvalid: Invalid parameter provided.
+ * @return #kEtcPalErrSys: An internal library or system call error occurred.
+ */
+etcpal_error_t sacn_init_features_with_config(const EtcPalLogParams*     log_params,
+                                              const SacnNetintConfig*    sys_netint_config,
+                                              sacn_features_t            features,
+                                              const SacnCommonCallbacks* callbacks,
+                                              const SacnThreadingConfig* threading_config)
 {
   sacn_features_t features_to_init = features;
 
@@ -170,6 +203,10 @@ etcpal_error_t sacn_init_features_with_cb(const EtcPalLogParams*     log_params,
       features_to_init = (features_to_init & ~SACN_ALL_NETWORK_FEATURES);
   }
 
+#if SACN_MEM_ARENA
+  bool arena_initted = false;
+#endif  // SACN_MEM_ARENA
+  bool thread_configs_initted = false;
   bool log_params_initted     = false;
   bool etcpal_logging_initted = false;
   bool etcpal_sockets_initted = false;
@@ -219,8 +256,29 @@ etcpal_error_t sacn_init_features_with_cb(const EtcPalLogParams*     log_params,
   }
 
   etcpal_error_t res = kEtcPalErrOk;
-  if ((features_to_init & SACN_ALL_NETWORK_FEATURES) == SACN_ALL_NETWORK_FEATURES)
+
+#if SACN_MEM_ARENA
+  // Every allocation comes from the arena, so it's initialized with the first feature and deinitialized with the last.
+  if ((features_to_init != 0) && (sacn_pool_sacn_state.dmx_merger_feature_init_count == 0) &&
+      (sacn_pool_sacn_state.all_network_features_init_count == 0))
+  {
+    arena_initted = ((res = sacn_arena_init()) == kEtcPalErrOk);
+    if (res == kEtcPalErrNoMem)
+      SACN_LOG_CRIT("No memory arena has been set. Call sacn_set_mem_arena() before initializing the sACN library.");
+    else if (!arena_initted)
+      SACN_LOG_CRIT("FAILED TO INITIALIZE MEMORY ARENA!");
+  }
+#endif
+
+  if ((res == kEtcPalErrOk) && ((features_to_init & SACN_ALL_NETWORK_FEATURES) == SACN_ALL_NETWORK_FEATURES))
   {
+    if (res == kEtcPalErrOk)
+    {
+      thread_configs_initted = ((res = sacn_set_thread_configs(threading_config)) == kEtcPalErrOk);
+      if (!thread_configs_initted)
+        SACN_LOG_ERR("Invalid sACN threading configuration.");
+    }
+
     if (res == kEtcPalErrOk)
       etcpal_logging_initted = ((res = etcpal_init(ETCPAL_FEATURE_LOGGING)) == kEtcPalErrOk);
 
@@ -268,7 +326,8 @@ etcpal_error_t sacn_init_features_with_cb(const EtcPalLogParams*     log_params,
 #if SACN_RECEIVER_ENABLED
     if (res == kEtcPalErrOk)
     {
-      receiver_mem_initted = ((res = sacn_receiver_mem_init(SACN_RECEIVER_MAX_THREADS)) == kEtcPalErrOk);
+      receiver_mem_initted =
+          ((res = sacn_receiver_mem_init(sacn_get_num_configured_threads(kSacnReceiveThread))) == kEtcPalErrOk);
       if (!receiver_mem_initted)
         SACN_LOG_CRIT("FAILED TO INITIALIZE RECEIVER MEMORY!");
     }
@@ -286,7 +345,8 @@ etcpal_error_t sacn_init_features_with_cb(const EtcPalLogParams*     log_params,
 #if SACN_MERGE_RECEIVER_ENABLED
     if (res == kEtcPalErrOk)
     {
-      merge_receiver_mem_initted = ((res = sacn_merge_receiver_mem_init(SACN_RECEIVER_MAX_THREADS)) == kEtcPalErrOk);
+      merge_receiver_mem_initted =
+          ((res = sacn_merge_receiver_mem_init(sacn_get_num_configured_threads(kSacnReceiveThread))) == kEtcPalErrOk);
       if (!merge_receiver_mem_initted)
         SACN_LOG_CRIT("FAILED TO INITIALIZE MERGE RECEIVER MEMORY!");
     }
@@ -457,6 +517,12 @@ etcpal_error_t sacn_init_features_with_cb(const EtcPalLogParams*     log_params,
       etcpal_deinit(ETCPAL_FEATURE_SOCKETS);
     if (etcpal_logging_initted)
       etcpal_deinit(ETCPAL_FEATURE_LOGGING);
+    if (thread_configs_initted)
+      sacn_reset_thread_configs();
+#if SACN_MEM_ARENA
+    if (arena_initted)
+      sacn_arena_deinit();
+#endif  // SACN_MEM_ARENA
     if (log_params_initted)
       sacn_log_params = NULL;
   }
@@ -550,6 +616,7 @@ void sacn_deinit_features(sacn_features_t features)
     etcpal_mutex_destroy(&sacn_receiver_mutex);
 
     etcpal_deinit(ETCPAL_FEATURE_NETINTS | ETCPAL_FEATURE_TIMERS | ETCPAL_FEATURE_SOCKETS | ETCPAL_FEATURE_LOGGING);
+    sacn_reset_thread_configs();
   }
 
   sacn_log_params = NULL;
@@ -564,6 +631,264 @@ void sacn_deinit_features(sacn_features_t features)
   {
     --sacn_pool_sacn_state.all_network_features_init_count;
   }
+
+#if SACN_MEM_ARENA
+  if ((sacn_pool_sacn_state.dmx_merger_feature_init_count == 0) &&
+      (sacn_pool_sacn_state.all_network_features_init_count == 0))
+  {
+    sacn_arena_deinit();
+  }
+#endif  // SACN_MEM_ARENA
+}
+
+/**
+ * @brief Reserve capacity in the library's buffers and pools for an expected workload.
+ *
+ * In dynamic memory mode, the library's buffers grow on demand, and each growth reallocates and copies the buffer on
+ * the thread that needed the room. Call this before sacn_init() to size the buffers and pools up front for the
+ * expected number of receivers, sources, universes, network interfaces and unicast destinations, so that a show
+ * reaching those numbers doesn't grow anything while running. This includes the queues each source tick uses to stage
+ * its packets for sending. Buffers and pools created after the library is initialized (e.g. for a new source) are also
+ * sized using the most recent reservation. Any growth that still happens is counted (see
+ * sacn_get_buffer_growth_count()) and logged at the info level.
+ *
+ * In static memory mode nothing is allocated, so this only checks the reservation against the compile-time limits.
+ *
+ * In dynamic memory mode, at most 16383 remote sources can have handles at once (see
+ * sacn_get_remote_source_handle()), so receivers * sources_per_universe should stay within that. Further sources
+ * can't be given handles, and a warning is logged.
+ *
+ * @param[in] config The expected workload. Zero members use the library's defaults.
+ * @return #kEtcPalErrOk: Reservation recorded.
+ * @return #kEtcPalErrInvalid: Invalid parameter provided.
+ * @return #kEtcPalErrNoMem: In static memory mode, the reservation exceeds the compile-time limits.
+ */
+etcpal_error_t sacn_reserve(const SacnReserveConfig* config)
+{
+  if (!config)
+    return kEtcPalErrInvalid;
+
+#if !SACN_DYNAMIC_MEM
+  if ((config->receivers > SACN_RECEIVER_MAX_UNIVERSES) ||
+      (config->sources_per_universe > SACN_RECEIVER_MAX_SOURCES_PER_UNIVERSE) ||
+      (config->universes > SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE) || (config->netints > SACN_MAX_NETINTS) ||
+      (config->sources > SACN_SOURCE_MAX_SOURCES) ||
+      (config->unicast_dests > SACN_MAX_UNICAST_DESTINATIONS_PER_UNIVERSE))
+  {
+    return kEtcPalErrNoMem;
+  }
+#endif
+
+  sacn_mem_set_reservation(config);
+  return kEtcPalErrOk;
+}
+
+/**
+ * @brief Provide the block of memory that the library allocates from.
+ *
+ * Only available if #SACN_MEM_ARENA is enabled, in which case the library makes no system heap allocations. Instead,
+ * the block is carved into fixed pools here, one per power-of-two block size from 64 bytes up, and every allocation
+ * takes a block from the smallest pool that fits. Once the pools that fit an allocation are used up, operations that
+ * need more memory fail with #kEtcPalErrNoMem.
+ *
+ * Each pool gets an equal share of the block, and there are as many pools as still fit at least one block of the
+ * largest size in their share. A pool of size-byte blocks therefore holds (block size / number of pools) / size blocks,
+ * and only that share of the block is available to allocations of its size. For example, a 1 MiB block is carved into
+ * 11 pools of about 93 KiB each: 1489 blocks of 64 bytes, 744 of 128 bytes, and so on down to a single 64 KiB block,
+ * which is also the largest single allocation the library can make. If the library's allocations don't spread out
+ * that evenly, use sacn_set_mem_arena_pools() to give the size and number of blocks of each pool instead.
+ *
+ * Call sacn_reserve() with the expected workload as well, so that the library's buffers are sized once at
+ * initialization instead of growing into larger blocks.
+ *
+ * Call this before initializing the library. The block must remain valid until the library is deinitialized. It can
+ * be replaced, or cleared by passing NULL, only while the library is deinitialized and nothing is allocated from it.
+ *
+ * @param[in] block The memory for the library to allocate from, or NULL to clear the current block.
+ * @param[in] size The size of the block in bytes.
+ * @return #kEtcPalErrOk: Block set successfully.
+ * @return #kEtcPalErrInvalid: The block is too small to allocate from.
+ * @return #kEtcPalErrBusy: The library is initialized, or memory is still allocated from the current block.
+ * @return #kEtcPalErrNotImpl: #SACN_MEM_ARENA is not enabled.
+ */
+etcpal_error_t sacn_set_mem_arena(void* block, size_t size)
+{
+#if SACN_MEM_ARENA
+  return sacn_arena_set(block, size);
+#else
+  ETCPAL_UNUSED_ARG(block);
+  ETCPAL_UNUSED_ARG(size);
+  return kEtcPalErrNotImpl;
+#endif
+}
+
+/**
+ * @brief Provide the block of memory that the library allocates from, carved into the given pools.
+ *
+ * Like sacn_set_mem_arena(), but the application chooses the pools. Each pool holds exactly num_blocks blocks of
+ * block_size bytes, laid out in the block in the order given, and every allocation takes a block from the pool with
+ * the smallest blocks that fit, or from a larger pool if that one is used up. The largest single allocation the
+ * library can make is the block size of the last pool. Any of the block that's left over is unused.
+ *
+ * @param[in] block The memory for the library to allocate from.
+ * @param[in] size The size of the block in bytes.
+ * @param[in] pools The pools to carve the block into, in increasing order of block size. At most 24 pools.
+ * @param[in] num_pools The number of entries in pools.
+ * @return #kEtcPalErrOk: Block set successfully.
+ * @return #kEtcPalErrInvalid: The pools are out of order, there are too many of them, or they don't fit in the block.
+ * @return #kEtcPalErrBusy: The library is initialized, or memory is still allocated from the current block.
+ * @return #kEtcPalErrNotImpl: #SACN_MEM_ARENA is not enabled.
+ */
+etcpal_error_t sacn_set_mem_arena_pools(void* block, size_t size, const SacnMemArenaPool* pools, size_t num_pools)
+{
+#if SACN_MEM_ARENA
+  return sacn_arena_set_pools(block, size, pools, num_pools);
+#else
+  ETCPAL_UNUSED_ARG(block);
+  ETCPAL_UNUSED_ARG(size);
+  ETCPAL_UNUSED_ARG(pools);
+  ETCPAL_UNUSED_ARG(num_pools);
+  return kEtcPalErrNotImpl;
+#endif
+}
+
+/**
+ * @brief Get the number of times the library has had to grow one of its buffers at runtime.
+ *
+ * Each growth is also logged at the info level with the name of the buffer, which can be used to tune the values
+ * passed to sacn_reserve(). The count is cumulative over the life of the process, and is always 0 in static memory
+ * mode.
+ *
+ * @return The number of buffer growth events.
+ */
+size_t sacn_get_buffer_growth_count(void)
+{
+  return sacn_mem_get_growth_count();
+}
+
+/**
+ * @brief Get the memory used by each of the library's modules.
+ *
+ * Reports, for the receiver, merge receiver, DMX merger, source, source detector and source loss modules, the bytes
+ * taken up by the module's pools and buffers, the capacity and use of the module's pools, and the capacity and use of
+ * its rb-tree nodes. Modules that are disabled or not initialized report zeros. Use sacn_get_thread_memory_stats() to
+ * get the sizes of each receive thread's notification buffers.
+ *
+ * @param[out] stats Filled in with the memory used by each module.
+ * @return #kEtcPalErrOk: Stats retrieved successfully.
+ * @return #kEtcPalErrInvalid: Invalid parameter provided.
+ * @return #kEtcPalErrNotInit: Module not initialized.
+ * @return #kEtcPalErrSys: An internal library or system call error occurred.
+ */
+etcpal_error_t sacn_get_memory_stats(SacnMemoryStats* stats)
+{
+  if (!stats)
+    return kEtcPalErrInvalid;
+
+  if (!sacn_initialized(SACN_FEATURE_DMX_MERGER) && !sacn_initialized(SACN_ALL_NETWORK_FEATURES))
+    return kEtcPalErrNotInit;
+
+  memset(stats, 0, sizeof(SacnMemoryStats));
+
+#if SACN_DMX_MERGER_ENABLED
+  if (sacn_initialized(SACN_FEATURE_DMX_MERGER))
+    sacn_dmx_merger_add_mem_stats(&stats->dmx_merger);
+#endif
+
+  if (!sacn_initialized(SACN_ALL_NETWORK_FEATURES))
+    return kEtcPalErrOk;
+
+  etcpal_error_t result = kEtcPalErrOk;
+
+  if (sacn_receiver_lock())
+  {
+#if SACN_RECEIVER_ENABLED
+    add_receiver_mem_stats(&stats->receiver);
+    add_tracked_source_mem_stats(&stats->receiver);
+    add_remote_source_mem_stats(&stats->receiver);
+    add_sampling_period_netint_mem_stats(&stats->receiver);
+    sacn_source_loss_add_mem_stats(&stats->source_loss);
+#endif
+#if SACN_MERGE_RECEIVER_ENABLED
+    add_merge_receiver_mem_stats(&stats->merge_receiver);
+    add_merge_receiver_source_mem_stats(&stats->merge_receiver);
+#endif
+#if SACN_SOURCE_DETECTOR_ENABLED
+    add_universe_discovery_source_mem_stats(&stats->source_detector);
+#endif
+    stats->num_threads = sacn_mem_get_num_threads();
+    sacn_receiver_unlock();
+  }
+  else
+  {
+    result = kEtcPalErrSys;
+  }
+
+#if SACN_SOURCE_ENABLED
+  if (sacn_source_lock())
+  {
+    add_source_mem_stats(&stats->source);
+    sacn_source_unlock();
+  }
+  else
+  {
+    result = kEtcPalErrSys;
+  }
+#endif
+
+  return result;
+}
+
+/**
+ * @brief Get the sizes of one receive thread's notification buffers.
+ *
+ * Each receive thread has its own set of buffers for the notifications it delivers, which grow in dynamic memory mode
+ * to fit the largest notification seen so far.
+ *
+ * @param[in] thread_index The index of the receive thread, less than the num_threads reported by
+ * sacn_get_memory_stats().
+ * @param[out] stats Filled in with the size in bytes of each of the thread's notification buffers.
+ * @return #kEtcPalErrOk: Stats retrieved successfully.
+ * @return #kEtcPalErrInvalid: Invalid parameter provided.
+ * @return #kEtcPalErrNotInit: Module not initialized.
+ * @return #kEtcPalErrSys: An internal library or system call error occurred.
+ */
+etcpal_error_t sacn_get_thread_memory_stats(unsigned int thread_index, SacnThreadMemoryStats* stats)
+{
+  if (!stats)
+    return kEtcPalErrInvalid;
+
+  if (!sacn_initialized(SACN_ALL_NETWORK_FEATURES))
+    return kEtcPalErrNotInit;
+
+  if (!sacn_receiver_lock())
+    return kEtcPalErrSys;
+
+  etcpal_error_t result = kEtcPalErrOk;
+  if (thread_index < sacn_mem_get_num_threads())
+  {
+    memset(stats, 0, sizeof(SacnThreadMemoryStats));
+#if SACN_RECEIVER_ENABLED
+    stats->universe_data         = get_universe_data_buf_size(thread_index);
+    stats->sources_lost          = get_sources_lost_buf_size(thread_index);
+    stats->sampling_started      = get_sampling_started_buf_size(thread_index);
+    stats->sampling_ended        = get_sampling_ended_buf_size(thread_index);
+    stats->source_pap_lost       = get_source_pap_lost_buf_size(thread_index);
+    stats->source_limit_exceeded = get_source_limit_exceeded_buf_size(thread_index);
+    stats->status_lists          = get_status_lists_buf_size(thread_index);
+    stats->to_erase              = get_to_erase_buf_size(thread_index);
+#endif
+#if SACN_MERGE_RECEIVER_ENABLED
+    stats->merged_data = get_merged_data_buf_size(thread_index);
+#endif
+  }
+  else
+  {
+    result = kEtcPalErrInvalid;
+  }
+
+  sacn_receiver_unlock();
+  return result;
 }
 
 #if SACN_RECEIVER_ENABLED || DOXYGEN
@@ -574,6 +899,11 @@ void sacn_deinit_features(sacn_features_t features)
  * This is a simple conversion from a remote source CID to it's corresponding remote source handle. A handle will be
  * returned only if it is a source that has been discovered by a receiver, merge receiver, or source detector.
  *
+ * In static memory mode, there is a handle for each source the compile-time limits allow. In dynamic memory mode, at
+ * most 16383 remote sources can have handles at once. The first 1024 handles to be in use at once are only reissued
+ * after many other sources have come and gone, but past 7168 sources at once a handle can be reissued to a new source
+ * soon after its old source is lost.
+ *
  * @param[in] source_cid The UUID of the remote source CID.
  * @return The remote source handle, or #kSacnRemoteSourceInvalid if not found.
  */
@@ -18,8 +18,13 @@
  *****************************************************************************/
 
 #include "sacn/dmx_merger.h"
+
+#include <limits.h>
 #include "sacn/private/common.h"
 #include "sacn/private/dmx_merger.h"
+#include "sacn/private/mem/common.h"
+#include "sacn/private/mem/handle_table.h"
+#include "sacn/private/mem/slab.h"
 
 #if SACN_DYNAMIC_MEM
 #include <stdlib.h>
@@ -27,8 +32,23 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleDmxMerger
+
 #if SACN_DMX_MERGER_ENABLED || DOXYGEN
 
+/**************************** Private constants ******************************/
+
+/*
+ * In static memory mode, the most mergers that can have handles at once. In dynamic memory mode, the size of the first
+ * band of handle slots, which is enough for every universe to have both a merger and a sampling merger. Larger bands
+ * are added beyond that if needed.
+ */
+#if SACN_DYNAMIC_MEM
+#define MERGER_HANDLE_SLOTS 0x20000
+#else
+#define MERGER_HANDLE_SLOTS SACN_DMX_MERGER_MAX_MERGERS
+#endif
+
 /****************************** Private macros *******************************/
 
 #define PAP_ACTIVE(source_state)       (!(source_state)->source.using_universe_priority)
@@ -39,15 +59,16 @@
 #define CALC_SRC_PAP(source_state, slot) \
   ((slot < source_state->source.valid_level_count) ? source_state->source.address_priority[slot] : 0)
 
-/* Macros for dynamic vs static allocation. Static allocation is done using etcpal_mempool. */
+/* Macros for dynamic vs static allocation. Dynamic allocation of the objects that come and go with sources is done
+ * using per-type slabs, and static allocation is done using etcpal_mempool. */
 
 #if SACN_DYNAMIC_MEM
-#define ALLOC_SOURCE_STATE()         malloc(sizeof(SourceState))
-#define FREE_SOURCE_STATE(ptr)       free(ptr)
-#define ALLOC_MERGER_STATE()         malloc(sizeof(MergerState))
-#define FREE_MERGER_STATE(ptr)       free(ptr)
-#define ALLOC_DMX_MERGER_RB_NODE()   malloc(sizeof(EtcPalRbNode))
-#define FREE_DMX_MERGER_RB_NODE(ptr) free(ptr)
+#define ALLOC_SOURCE_STATE()         sacn_slab_alloc(&source_state_slab)
+#define FREE_SOURCE_STATE(ptr)       sacn_slab_free(&source_state_slab, ptr)
+#define ALLOC_MERGER_STATE()         SACN_MALLOC(sizeof(MergerState))
+#define FREE_MERGER_STATE(ptr)       SACN_FREE(ptr)
+#define ALLOC_DMX_MERGER_RB_NODE()   sacn_slab_alloc(&rb_node_slab)
+#define FREE_DMX_MERGER_RB_NODE(ptr) sacn_slab_free(&rb_node_slab, ptr)
 #else
 #define ALLOC_SOURCE_STATE()         etcpal_mempool_alloc(sacn_pool_merge_source_states)
 #define FREE_SOURCE_STATE(ptr)       etcpal_mempool_free(sacn_pool_merge_source_states, ptr)
@@ -59,31 +80,31 @@
 
 /**************************** Private variables ******************************/
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+static SacnSlab source_state_slab;
+static SacnSlab rb_node_slab;
+#else
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_merge_source_states,
                       SourceState,
                       (SACN_DMX_MERGER_MAX_SOURCES_PER_MERGER * SACN_DMX_MERGER_MAX_MERGERS));
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_merge_merger_states, MergerState, SACN_DMX_MERGER_MAX_MERGERS);
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_merge_rb_nodes,
                       EtcPalRbNode,
-                      (SACN_DMX_MERGER_MAX_SOURCES_PER_MERGER * SACN_DMX_MERGER_MAX_MERGERS) +
-                          SACN_DMX_MERGER_MAX_MERGERS);
+                      (SACN_DMX_MERGER_MAX_SOURCES_PER_MERGER * SACN_DMX_MERGER_MAX_MERGERS));
+static SacnHandleSlot merger_handle_slots[MERGER_HANDLE_SLOTS];
 #endif
 
-static IntHandleManager merger_handle_mgr;
-static EtcPalRbTree     mergers;
+static SacnHandleTable mergers;
 
 static etcpal_mutex_t sacn_dmx_merger_mutex;
 
 /**************************** Private function declarations ******************************/
 
-static int merger_state_lookup_compare_func(const EtcPalRbTree* self, const void* value_a, const void* value_b);
 static int source_state_lookup_compare_func(const EtcPalRbTree* self, const void* value_a, const void* value_b);
 
 static EtcPalRbNode* dmx_merger_rb_node_alloc_func(void);
 static void          dmx_merger_rb_node_dealloc_func(EtcPalRbNode* node);
 
-static bool merger_handle_in_use(int handle_val, void* cookie);
 static bool source_handle_in_use(int handle_val, void* cookie);
 
 static etcpal_error_t add_source(sacn_dmx_merger_t         merger,
@@ -129,10 +150,10 @@ static void recalculate_pap_active(MergerState* merger);
 static void recalculate_universe_priority(MergerState* merger);
 
 static void free_source_state_lookup_node(const EtcPalRbTree* self, EtcPalRbNode* node);
-static void free_mergers_node(const EtcPalRbTree* self, EtcPalRbNode* node);
+static void free_merger_state(void* merger_state);
 
 static SourceState* construct_source_state(sacn_dmx_merger_source_t handle);
-static MergerState* construct_merger_state(sacn_dmx_merger_t handle, const SacnDmxMergerConfig* config);
+static MergerState* construct_merger_state(const SacnDmxMergerConfig* config);
 
 static bool sacn_dmx_merger_lock();
 static void sacn_dmx_merger_unlock();
@@ -155,7 +176,13 @@ etcpal_error_t sacn_dmx_merger_init(void)
   if ((res == kEtcPalErrOk) && !etcpal_mutex_create(&sacn_dmx_merger_mutex))
     res = kEtcPalErrSys;
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+  if (res == kEtcPalErrOk)
+  {
+    sacn_slab_init(&source_state_slab, SACN_ALLOC_MODULE, sizeof(SourceState), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+    sacn_slab_init(&rb_node_slab, SACN_ALLOC_MODULE, sizeof(EtcPalRbNode), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  }
+#else
   if (res == kEtcPalErrOk)
     res = etcpal_mempool_init(sacn_pool_merge_source_states);
   if (res == kEtcPalErrOk)
@@ -166,9 +193,11 @@ etcpal_error_t sacn_dmx_merger_init(void)
 
   if (res == kEtcPalErrOk)
   {
-    etcpal_rbtree_init(&mergers, merger_state_lookup_compare_func, dmx_merger_rb_node_alloc_func,
-                       dmx_merger_rb_node_dealloc_func);
-    init_int_handle_manager(&merger_handle_mgr, -1, merger_handle_in_use, NULL);
+#if SACN_DYNAMIC_MEM
+    sacn_handle_table_init(&mergers, SACN_ALLOC_MODULE, NULL, MERGER_HANDLE_SLOTS, INT_MAX, 0);
+#else
+    sacn_handle_table_init(&mergers, SACN_ALLOC_MODULE, merger_handle_slots, MERGER_HANDLE_SLOTS, INT_MAX, 0);
+#endif
   }
 
   return res;
@@ -179,13 +208,41 @@ void sacn_dmx_merger_deinit(void)
 {
   if (sacn_dmx_merger_lock())
   {
-    etcpal_rbtree_clear_with_cb(&mergers, free_mergers_node);
+    sacn_handle_table_clear_with_cb(&mergers, free_merger_state);
+    sacn_handle_table_deinit(&mergers);
+#if SACN_DYNAMIC_MEM
+    sacn_slab_deinit(&rb_node_slab);
+    sacn_slab_deinit(&source_state_slab);
+#endif
     sacn_dmx_merger_unlock();
   }
 
   etcpal_mutex_destroy(&sacn_dmx_merger_mutex);
 }
 
+/* Add the DMX Merger module's pool and rb-tree node use to its memory stats. Internal function called from
+ * sacn_get_memory_stats(). */
+void sacn_dmx_merger_add_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+  if (sacn_dmx_merger_lock())
+  {
+#if SACN_DYNAMIC_MEM
+    ADD_OBJECT_STATS(stats, sacn_handle_table_size(&mergers), MergerState);
+    ADD_POOL_STATS(stats, source_state_slab, SourceState);
+    ADD_RB_NODE_POOL_STATS(stats, rb_node_slab);
+#else
+    ADD_POOL_STATS(stats, sacn_pool_merge_merger_states, MergerState);
+    ADD_POOL_STATS(stats, sacn_pool_merge_source_states, SourceState);
+    ADD_RB_NODE_POOL_STATS(stats, sacn_pool_merge_rb_nodes);
+#endif
+    stats->bytes_allocated += mergers.capacity * sizeof(SacnHandleSlot);
+    sacn_dmx_merger_unlock();
+  }
+}
+
 /**
  * @brief Create a new merger instance.
  *
@@ -631,19 +688,6 @@ etcpal_error_t sacn_dmx_merger_remove_pap(sacn_dmx_merger_t merger, sacn_dmx_mer
   return result;
 }
 
-int merger_state_lookup_compare_func(const EtcPalRbTree* self, const void* value_a, const void* value_b)
-{
-  ETCPAL_UNUSED_ARG(self);
-
-  if (!SACN_ASSERT_VERIFY(value_a) || !SACN_ASSERT_VERIFY(value_b))
-    return 0;
-
-  const MergerState* lhs = (const MergerState*)value_a;
-  const MergerState* rhs = (const MergerState*)value_b;
-
-  return (lhs->handle > rhs->handle) - (lhs->handle < rhs->handle);  // Just compare the handles.
-}
-
 int source_state_lookup_compare_func(const EtcPalRbTree* self, const void* value_a, const void* value_b)
 {
   ETCPAL_UNUSED_ARG(self);
@@ -670,13 +714,6 @@ void dmx_merger_rb_node_dealloc_func(EtcPalRbNode* node)
   FREE_DMX_MERGER_RB_NODE(node);
 }
 
-bool merger_handle_in_use(int handle_val, void* cookie)
-{
-  ETCPAL_UNUSED_ARG(cookie);
-
-  return (handle_val == kSacnDmxMergerInvalid) || etcpal_rbtree_find(&mergers, &handle_val);
-}
-
 bool source_handle_in_use(int handle_val, void* cookie)
 {
   if (!SACN_ASSERT_VERIFY(cookie))
@@ -684,7 +721,7 @@ bool source_handle_in_use(int handle_val, void* cookie)
 
   MergerState* merger_state = (MergerState*)cookie;
 
-  return etcpal_rbtree_find(&merger_state->source_state_lookup, &handle_val);
+  return (sacn_handle_index_get(&merger_state->source_index, handle_val) != NULL);
 }
 
 // Needs lock
@@ -742,6 +779,13 @@ etcpal_error_t add_source(sacn_dmx_merger_t         merger,
   {
     state_lookup_insert_result = etcpal_rbtree_insert(&merger_state->source_state_lookup, source_state);
 
+    if (state_lookup_insert_result == kEtcPalErrOk)
+    {
+      state_lookup_insert_result = sacn_handle_index_add(&merger_state->source_index, handle, source_state);
+      if (state_lookup_insert_result != kEtcPalErrOk)
+        etcpal_rbtree_remove(&merger_state->source_state_lookup, source_state);
+    }
+
     if (state_lookup_insert_result != kEtcPalErrOk)
     {
       // Clean up and return the correct error.
@@ -1257,21 +1301,19 @@ void free_source_state_lookup_node(const EtcPalRbTree* self, EtcPalRbNode* node)
   FREE_DMX_MERGER_RB_NODE(node);
 }
 
-void free_mergers_node(const EtcPalRbTree* self, EtcPalRbNode* node)
+void free_merger_state(void* merger_state)
 {
-  ETCPAL_UNUSED_ARG(self);
-
-  if (!SACN_ASSERT_VERIFY(node))
+  if (!SACN_ASSERT_VERIFY(merger_state))
     return;
 
-  MergerState* merger_state = (MergerState*)node->value;
+  MergerState* state = (MergerState*)merger_state;
 
-  // Clear the trees within merger state, using callbacks to free memory.
-  etcpal_rbtree_clear_with_cb(&merger_state->source_state_lookup, free_source_state_lookup_node);
+  // Clear the source lookups within merger state, using callbacks to free memory.
+  etcpal_rbtree_clear_with_cb(&state->source_state_lookup, free_source_state_lookup_node);
+  sacn_handle_index_deinit(&state->source_index);
 
-  // Now free the memory for the merger state and node.
-  FREE_MERGER_STATE(merger_state);
-  FREE_DMX_MERGER_RB_NODE(node);
+  // Now free the memory for the merger state.
+  FREE_MERGER_STATE(state);
 }
 
 SourceState* construct_source_state(sacn_dmx_merger_source_t handle)
@@ -1297,9 +1339,9 @@ SourceState* construct_source_state(sacn_dmx_merger_source_t handle)
   return source_state;
 }
 
-MergerState* construct_merger_state(sacn_dmx_merger_t handle, const SacnDmxMergerConfig* config)
+MergerState* construct_merger_state(const SacnDmxMergerConfig* config)
 {
-  if (!SACN_ASSERT_VERIFY(config) || !SACN_ASSERT_VERIFY(handle != kSacnDmxMergerInvalid))
+  if (!SACN_ASSERT_VERIFY(config))
     return NULL;
 
   if (!SACN_ASSERT_VERIFY(config->levels))
@@ -1319,14 +1361,20 @@ MergerState* construct_merger_state(sacn_dmx_merger_t handle, const SacnDmxMerge
 
   if (merger_state)
   {
-    // Initialize merger state.
-    merger_state->handle = handle;
+    // Initialize merger state. The handle is assigned when the merger is added to the merger table.
+    merger_state->handle = kSacnDmxMergerInvalid;
 
     init_int_handle_manager(&merger_state->source_handle_mgr, kSacnMaxValidSourceHandleValue, source_handle_in_use,
                             merger_state);
 
     etcpal_rbtree_init(&merger_state->source_state_lookup, source_state_lookup_compare_func,
                        dmx_merger_rb_node_alloc_func, dmx_merger_rb_node_dealloc_func);
+#if SACN_DYNAMIC_MEM
+    sacn_handle_index_init(&merger_state->source_index, SACN_ALLOC_MODULE, NULL, 0);
+#else
+    sacn_handle_index_init(&merger_state->source_index, SACN_ALLOC_MODULE, merger_state->source_index_entries,
+                           SACN_DMX_MERGER_SOURCE_INDEX_ENTRIES);
+#endif
 
     merger_state->config = *config;
     memset(merger_state->config.levels, 0, SACN_DMX_MERGER_MAX_SLOTS);
@@ -1383,7 +1431,7 @@ etcpal_error_t lookup_state(sacn_dmx_merger_t        merger,
   SourceState* my_source_state = NULL;
 
   // Look up the merger state.
-  my_merger_state = etcpal_rbtree_find(&mergers, &merger);
+  my_merger_state = sacn_handle_table_get(&mergers, merger);
 
   if (!my_merger_state)
     result = kEtcPalErrNotFound;
@@ -1391,7 +1439,7 @@ etcpal_error_t lookup_state(sacn_dmx_merger_t        merger,
   // Look up the source state.
   if ((result == kEtcPalErrOk) && source_state)
   {
-    my_source_state = etcpal_rbtree_find(&my_merger_state->source_state_lookup, &source);
+    my_source_state = sacn_handle_index_get(&my_merger_state->source_index, source);
 
     if (!my_source_state)
       result = kEtcPalErrNotFound;
@@ -1414,7 +1462,7 @@ size_t get_number_of_mergers()
 
   if (sacn_dmx_merger_lock())
   {
-    result = etcpal_rbtree_size(&mergers);
+    result = sacn_handle_table_size(&mergers);
     sacn_dmx_merger_unlock();
   }
 
@@ -1431,21 +1479,26 @@ etcpal_error_t create_sacn_dmx_merger(const SacnDmxMergerConfig* config, sacn_dm
   etcpal_error_t result       = kEtcPalErrOk;
 
   // Allocate merger state.
-  merger_state = construct_merger_state(get_next_int_handle(&merger_handle_mgr), config);
+  merger_state = construct_merger_state(config);
 
   // Verify there was enough memory.
   if (!merger_state)
     result = kEtcPalErrNoMem;
 
-  // Add to the merger tree and verify success.
+  // Add to the merger table, which assigns the handle, and verify success.
   if (result == kEtcPalErrOk)
   {
-    etcpal_error_t insert_result = etcpal_rbtree_insert(&mergers, merger_state);
+    int            new_handle    = kSacnDmxMergerInvalid;
+    etcpal_error_t insert_result = sacn_handle_table_add(&mergers, merger_state, &new_handle);
 
-    // Verify successful merger tree insertion.
-    if (insert_result != kEtcPalErrOk)
+    // Verify successful merger table insertion.
+    if (insert_result == kEtcPalErrOk)
     {
-      FREE_MERGER_STATE(merger_state);
+      merger_state->handle = new_handle;
+    }
+    else
+    {
+      free_merger_state(merger_state);
 
       if (insert_result == kEtcPalErrNoMem)
         result = kEtcPalErrNoMem;
@@ -1472,24 +1525,15 @@ etcpal_error_t destroy_sacn_dmx_merger(sacn_dmx_merger_t handle)
   // Try to find the merger's state.
   etcpal_error_t result = lookup_state(handle, kSacnDmxMergerSourceInvalid, &merger_state, NULL);
 
-  // Clear the source state lookup tree, using callbacks to free memory.
+  // Remove from merger table, then free the merger state along with its sources.
   if (result == kEtcPalErrOk)
   {
-    if (etcpal_rbtree_clear_with_cb(&merger_state->source_state_lookup, free_source_state_lookup_node) != kEtcPalErrOk)
-    {
-      result = kEtcPalErrSys;
-    }
-  }
-
-  // Remove from merger tree and free.
-  if (result == kEtcPalErrOk)
-  {
-    if (etcpal_rbtree_remove(&mergers, merger_state) != kEtcPalErrOk)
+    if (sacn_handle_table_remove(&mergers, handle) != kEtcPalErrOk)
       result = kEtcPalErrSys;
   }
 
   if (result == kEtcPalErrOk)
-    FREE_MERGER_STATE(merger_state);
+    free_merger_state(merger_state);
 
   return result;
 }
@@ -1533,10 +1577,12 @@ etcpal_error_t remove_sacn_dmx_merger_source(sacn_dmx_merger_t merger, sacn_dmx_
       recalculate_universe_priority(merger_state);
     }
 
-    // Now that the output no longer refers to this source, remove the source from the lookup trees and free its
-    // memory.
-    if (etcpal_rbtree_remove(&merger_state->source_state_lookup, source_being_removed) != kEtcPalErrOk)
+    // Now that the output no longer refers to this source, remove the source from the lookups and free its memory.
+    if ((sacn_handle_index_remove(&merger_state->source_index, source) != kEtcPalErrOk) ||
+        (etcpal_rbtree_remove(&merger_state->source_state_lookup, source_being_removed) != kEtcPalErrOk))
+    {
       result = kEtcPalErrSys;
+    }
   }
 
   if (result == kEtcPalErrOk)
@@ -90,6 +90,8 @@ etcpal_error_t sacn_receiver_mem_init(unsigned int number_of_threads)
 void sacn_receiver_mem_deinit(void)
 {
   deinit_receivers();
+  deinit_sampling_period_netints();
+  deinit_tracked_sources();
   deinit_remote_sources();
 #if SACN_DYNAMIC_MEM
   deinit_source_limit_exceeded_buf();
@@ -182,5 +184,6 @@ void sacn_merge_receiver_mem_deinit(void)
   deinit_merged_data_buf();
 #endif
   deinit_merge_receivers();
+  deinit_merge_receiver_sources();
 }
 #endif  // SACN_MERGE_RECEIVER_ENABLED || DOXYGEN
@@ -0,0 +1,130 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "sacn/private/mem/alloc.h"
+
+#include <stdint.h>
+#include <string.h>
+#include "sacn/private/atomic.h"
+#include "sacn/private/common.h"
+#include "sacn/private/mem/arena.h"
+
+#if SACN_DYNAMIC_MEM && (SACN_TRACK_ALLOCATIONS || SACN_MEM_ARENA)
+#include <stdlib.h>
+
+/****************************** Private macros *******************************/
+
+#if SACN_TRACK_ALLOCATIONS
+
+// The counters are bumped from the receive threads, the source threads and the API threads without a common lock, so
+// they're updated atomically.
+#define COUNT_CALL(module, counter)                            \
+  do                                                           \
+  {                                                            \
+    if (SACN_ASSERT_VERIFY((module) < kSacnNumAllocModules))   \
+      SACN_ATOMIC_INCREMENT_U64(alloc_counts[module].counter); \
+  } while (0)
+
+#else  // SACN_TRACK_ALLOCATIONS
+
+#define COUNT_CALL(module, counter) ETCPAL_UNUSED_ARG(module)
+
+#endif  // SACN_TRACK_ALLOCATIONS
+
+/* With SACN_MEM_ARENA, the memory comes from the application's block rather than the system heap. */
+#if SACN_MEM_ARENA
+#define BACKING_MALLOC(size)       sacn_arena_alloc(size)
+#define BACKING_REALLOC(ptr, size) sacn_arena_realloc(ptr, size)
+#define BACKING_FREE(ptr)          sacn_arena_free(ptr)
+#else
+#define BACKING_MALLOC(size)       malloc(size)        // NOLINT(cppcoreguidelines-no-malloc)
+#define BACKING_REALLOC(ptr, size) realloc(ptr, size)  // NOLINT(cppcoreguidelines-no-malloc)
+#define BACKING_FREE(ptr)          free(ptr)           // NOLINT(cppcoreguidelines-no-malloc)
+#endif
+
+/**************************** Private variables ******************************/
+
+#if SACN_TRACK_ALLOCATIONS
+static SacnAllocCounts alloc_counts[kSacnNumAllocModules];
+#endif
+
+/*************************** Function definitions ****************************/
+
+void* sacn_alloc_malloc(sacn_alloc_module_t module, size_t size)
+{
+  COUNT_CALL(module, allocs);
+  return BACKING_MALLOC(size);
+}
+
+void* sacn_alloc_calloc(sacn_alloc_module_t module, size_t num, size_t size)
+{
+  COUNT_CALL(module, allocs);
+
+  if ((size > 0) && (num > (SIZE_MAX / size)))
+    return NULL;
+
+  void* result = BACKING_MALLOC(num * size);
+  if (result)
+    memset(result, 0, num * size);
+
+  return result;
+}
+
+void* sacn_alloc_realloc(sacn_alloc_module_t module, void* ptr, size_t size)
+{
+  COUNT_CALL(module, reallocs);
+  return BACKING_REALLOC(ptr, size);
+}
+
+void sacn_alloc_free(sacn_alloc_module_t module, void* ptr)
+{
+  if (ptr)
+    COUNT_CALL(module, frees);
+
+  BACKING_FREE(ptr);
+}
+
+#endif  // SACN_DYNAMIC_MEM && (SACN_TRACK_ALLOCATIONS || SACN_MEM_ARENA)
+
+/*
+ * Get the allocation counts for a module. The counts are all zero unless SACN_TRACK_ALLOCATIONS is enabled.
+ */
+void sacn_alloc_get_counts(sacn_alloc_module_t module, SacnAllocCounts* counts)
+{
+  if (!SACN_ASSERT_VERIFY(module < kSacnNumAllocModules) || !SACN_ASSERT_VERIFY(counts))
+    return;
+
+#if SACN_DYNAMIC_MEM && SACN_TRACK_ALLOCATIONS
+  counts->allocs   = SACN_ATOMIC_LOAD_U64(alloc_counts[module].allocs);
+  counts->reallocs = SACN_ATOMIC_LOAD_U64(alloc_counts[module].reallocs);
+  counts->frees    = SACN_ATOMIC_LOAD_U64(alloc_counts[module].frees);
+#else
+  memset(counts, 0, sizeof(SacnAllocCounts));
+#endif
+}
+
+/*
+ * Zero the allocation counts of every module. Only call this while no other thread is using the library.
+ */
+void sacn_alloc_reset_counts(void)
+{
+#if SACN_DYNAMIC_MEM && SACN_TRACK_ALLOCATIONS
+  memset(alloc_counts, 0, sizeof(alloc_counts));
+#endif
+}
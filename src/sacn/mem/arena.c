@@ -0,0 +1,344 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "sacn/private/mem/arena.h"
+
+#include <stdint.h>
+#include <string.h>
+#include "etcpal/mutex.h"
+#include "sacn/private/common.h"
+
+#if SACN_DYNAMIC_MEM
+
+/****************************** Private macros *******************************/
+
+#define ARENA_ALIGNMENT 16
+#define ALIGN_UP(size)  (((size) + (ARENA_ALIGNMENT - 1)) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+// The pools hold blocks of MIN_BLOCK_SIZE, twice that, four times that and so on, one size class per pool.
+#define MIN_BLOCK_SIZE ((size_t)64)
+#define MAX_POOLS      24
+
+#define POOL_BLOCK_SIZE(pool_index) (MIN_BLOCK_SIZE << (pool_index))
+
+/****************************** Private types ********************************/
+
+typedef struct ArenaFreeBlock
+{
+  struct ArenaFreeBlock* next;
+} ArenaFreeBlock;
+
+typedef struct ArenaPool
+{
+  uint8_t*        start;
+  uint8_t*        end;
+  size_t          block_size;
+  ArenaFreeBlock* free_list;  // Starts out in address order, then reuses the most recently freed block first.
+} ArenaPool;
+
+/**************************** Private variables ******************************/
+
+static bool           arena_initted;
+static etcpal_mutex_t arena_mutex;
+
+static ArenaPool      pools[MAX_POOLS];
+static size_t         num_pools;
+static SacnArenaStats arena_stats;
+
+/*********************** Private function prototypes *************************/
+
+static size_t     count_pools(size_t usable);
+static void       carve_pools(void* block, const SacnMemArenaPool* config, size_t num_config);
+static void       carve_pool(ArenaPool* pool, uint8_t* start, size_t block_size, size_t num_blocks);
+static ArenaPool* get_pool(void* ptr);
+
+/*************************** Function definitions ****************************/
+
+/*
+ * Create the arena's lock. Called when the library is initialized, and fails with kEtcPalErrNoMem if no block has been
+ * set to allocate from.
+ */
+etcpal_error_t sacn_arena_init(void)
+{
+  if (!SACN_ASSERT_VERIFY(!arena_initted))
+    return kEtcPalErrSys;
+  if (num_pools == 0)
+    return kEtcPalErrNoMem;
+
+  arena_initted = etcpal_mutex_create(&arena_mutex);
+  return arena_initted ? kEtcPalErrOk : kEtcPalErrSys;
+}
+
+/*
+ * Destroy the arena's lock. Called when the library is deinitialized. The block and its pools stay set.
+ */
+void sacn_arena_deinit(void)
+{
+  if (arena_initted)
+  {
+    etcpal_mutex_destroy(&arena_mutex);
+    arena_initted = false;
+  }
+}
+
+/*
+ * Set the block to allocate from, or clear it if block is NULL. The block is carved into its pools here, one per
+ * power-of-two block size from 64 bytes up, each with an equal share of the block. This is only allowed while the arena
+ * isn't initialized. Fails with kEtcPalErrBusy if it is, or if anything is still allocated from the current block.
+ */
+etcpal_error_t sacn_arena_set(void* block, size_t size)
+{
+  if (arena_initted || (arena_stats.num_blocks > 0))
+    return kEtcPalErrBusy;
+
+  if (!block)
+  {
+    memset(pools, 0, sizeof(pools));
+    num_pools = 0;
+    memset(&arena_stats, 0, sizeof(SacnArenaStats));
+    return kEtcPalErrOk;
+  }
+
+  // Trim the start of the block to the block alignment.
+  uintptr_t start  = (uintptr_t)block;
+  size_t    offset = (size_t)(ALIGN_UP(start) - start);
+  size_t    usable = (size > offset) ? (size - offset) : 0;
+
+  size_t new_num_pools = count_pools(usable);
+  if (new_num_pools == 0)
+    return kEtcPalErrInvalid;
+
+  // Each pool gets an equal share of the block, in order of block size.
+  SacnMemArenaPool config[MAX_POOLS];
+  size_t           share = usable / new_num_pools;
+  for (size_t i = 0; i < new_num_pools; ++i)
+  {
+    config[i].block_size = POOL_BLOCK_SIZE(i);
+    config[i].num_blocks = share / config[i].block_size;
+  }
+
+  carve_pools(block, config, new_num_pools);
+  return kEtcPalErrOk;
+}
+
+/*
+ * Set the block to allocate from, carved into the given pools in order. Block sizes are rounded up to the block
+ * alignment, and must be in increasing order. Like sacn_arena_set(), this is only allowed while the arena isn't
+ * initialized and nothing is allocated from the current block.
+ *
+ * Fails with kEtcPalErrInvalid if the pools are out of order, there are more than MAX_POOLS of them, or they don't fit
+ * in the block.
+ */
+etcpal_error_t sacn_arena_set_pools(void* block, size_t size, const SacnMemArenaPool* config, size_t num_config)
+{
+  if (arena_initted || (arena_stats.num_blocks > 0))
+    return kEtcPalErrBusy;
+  if (!block || !config || (num_config == 0) || (num_config > MAX_POOLS))
+    return kEtcPalErrInvalid;
+
+  uintptr_t start  = (uintptr_t)block;
+  size_t    offset = (size_t)(ALIGN_UP(start) - start);
+  size_t    usable = (size > offset) ? (size - offset) : 0;
+
+  SacnMemArenaPool aligned[MAX_POOLS];
+  size_t           needed = 0;
+  for (size_t i = 0; i < num_config; ++i)
+  {
+    if ((config[i].block_size == 0) || (config[i].block_size > SIZE_MAX - ARENA_ALIGNMENT))
+      return kEtcPalErrInvalid;
+
+    aligned[i].block_size = ALIGN_UP(config[i].block_size);
+    aligned[i].num_blocks = config[i].num_blocks;
+    if ((i > 0) && (aligned[i].block_size <= aligned[i - 1].block_size))
+      return kEtcPalErrInvalid;
+
+    // Checked so that a huge pool can't wrap around and look like it fits.
+    if (aligned[i].num_blocks > ((usable - needed) / aligned[i].block_size))
+      return kEtcPalErrInvalid;
+    needed += aligned[i].num_blocks * aligned[i].block_size;
+  }
+
+  carve_pools(block, aligned, num_config);
+  return kEtcPalErrOk;
+}
+
+/*
+ * Whether there is a block to allocate from.
+ */
+bool sacn_arena_is_set(void)
+{
+  return (num_pools > 0);
+}
+
+/*
+ * Allocate a block of at least size bytes, aligned for any type, from the pool with the smallest blocks that fit. If
+ * that pool is used up, the block comes from the next larger pool with one free. Returns NULL if there isn't one.
+ */
+void* sacn_arena_alloc(size_t size)
+{
+  if (!SACN_ASSERT_VERIFY(arena_initted) || !etcpal_mutex_lock(&arena_mutex))
+    return NULL;
+
+  void* result = NULL;
+  for (size_t i = 0; i < num_pools; ++i)
+  {
+    ArenaPool* pool = &pools[i];
+    if ((pool->block_size >= size) && pool->free_list)
+    {
+      ArenaFreeBlock* free_block = pool->free_list;
+      pool->free_list            = free_block->next;
+
+      arena_stats.in_use += pool->block_size;
+      if (arena_stats.in_use > arena_stats.high_water)
+        arena_stats.high_water = arena_stats.in_use;
+      ++arena_stats.num_blocks;
+
+      result = free_block;
+      break;
+    }
+  }
+
+  etcpal_mutex_unlock(&arena_mutex);
+  return result;
+}
+
+/*
+ * Resize an allocation. It stays in place if its block is already large enough, otherwise the contents are moved to a
+ * larger block. As with realloc(), ptr is left allocated if this fails.
+ */
+void* sacn_arena_realloc(void* ptr, size_t size)
+{
+  if (!ptr)
+    return sacn_arena_alloc(size);
+
+  ArenaPool* pool = get_pool(ptr);
+  if (!SACN_ASSERT_VERIFY(pool))
+    return NULL;
+  if (size <= pool->block_size)
+    return ptr;
+
+  void* new_ptr = sacn_arena_alloc(size);
+  if (new_ptr)
+  {
+    memcpy(new_ptr, ptr, pool->block_size);
+    sacn_arena_free(ptr);
+  }
+
+  return new_ptr;
+}
+
+/*
+ * Return a block to its pool.
+ */
+void sacn_arena_free(void* ptr)
+{
+  if (!ptr)
+    return;
+
+  ArenaPool* pool = get_pool(ptr);
+  if (!SACN_ASSERT_VERIFY(pool) || !SACN_ASSERT_VERIFY(arena_initted) || !etcpal_mutex_lock(&arena_mutex))
+    return;
+
+  ArenaFreeBlock* free_block = (ArenaFreeBlock*)ptr;
+  free_block->next           = pool->free_list;
+  pool->free_list            = free_block;
+
+  arena_stats.in_use -= pool->block_size;
+  --arena_stats.num_blocks;
+
+  etcpal_mutex_unlock(&arena_mutex);
+}
+
+/*
+ * Get the arena's usage. All zero if no block has been set.
+ */
+void sacn_arena_get_stats(SacnArenaStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+  if (arena_initted && etcpal_mutex_lock(&arena_mutex))
+  {
+    *stats = arena_stats;
+    etcpal_mutex_unlock(&arena_mutex);
+  }
+  else
+  {
+    *stats = arena_stats;
+  }
+}
+
+// The most pools for which an equal share of the block still holds at least one block of the largest size.
+size_t count_pools(size_t usable)
+{
+  size_t result = 0;
+  while ((result < MAX_POOLS) && (POOL_BLOCK_SIZE(result) <= (usable / (result + 1))))
+    ++result;
+
+  return result;
+}
+
+// Replaces the current pools with the ones in config, which must fit in the block once it's aligned.
+void carve_pools(void* block, const SacnMemArenaPool* config, size_t num_config)
+{
+  memset(pools, 0, sizeof(pools));
+  memset(&arena_stats, 0, sizeof(SacnArenaStats));
+  num_pools = num_config;
+
+  uint8_t* cursor = (uint8_t*)ALIGN_UP((uintptr_t)block);
+  for (size_t i = 0; i < num_pools; ++i)
+  {
+    carve_pool(&pools[i], cursor, config[i].block_size, config[i].num_blocks);
+    cursor = pools[i].end;
+    arena_stats.size += (size_t)(pools[i].end - pools[i].start);
+  }
+
+  arena_stats.max_alloc_size = pools[num_pools - 1].block_size;
+}
+
+void carve_pool(ArenaPool* pool, uint8_t* start, size_t block_size, size_t num_blocks)
+{
+  pool->start      = start;
+  pool->end        = start + (num_blocks * block_size);
+  pool->block_size = block_size;
+
+  // Link the blocks back to front, so that the lowest addresses are handed out first.
+  pool->free_list = NULL;
+  for (size_t i = num_blocks; i > 0; --i)
+  {
+    ArenaFreeBlock* free_block = (ArenaFreeBlock*)(start + ((i - 1) * block_size));
+    free_block->next           = pool->free_list;
+    pool->free_list            = free_block;
+  }
+}
+
+// The pools don't change while the arena is initialized, so this doesn't need the arena lock.
+ArenaPool* get_pool(void* ptr)
+{
+  for (size_t i = 0; i < num_pools; ++i)
+  {
+    ArenaPool* pool = &pools[i];
+    if (((uint8_t*)ptr >= pool->start) && ((uint8_t*)ptr < pool->end))
+      return ((((uint8_t*)ptr - pool->start) % pool->block_size) == 0) ? pool : NULL;
+  }
+
+  return NULL;
+}
+
+#endif  // SACN_DYNAMIC_MEM
@@ -18,23 +18,82 @@
  *****************************************************************************/
 
 #include "sacn/private/mem/common.h"
+#include "sacn/private/atomic.h"
 
 /**************************** Private variables ******************************/
 
 static unsigned int num_threads;
 
+static SacnReserveConfig reservation;
+
+#if SACN_DYNAMIC_MEM
+// Buffers grow under whichever API lock owns them (or none, for the DMX merger), so this is updated atomically.
+static uint64_t growth_count;
+#endif
+
 /*************************** Function definitions ****************************/
 
 #if SACN_DYNAMIC_MEM
+/*
+ * Get the capacity to grow a buffer to, doubling from its current capacity, or from kSacnInitialCapacity if it hasn't
+ * been allocated yet.
+ */
 size_t sacn_mem_grow_capacity(size_t old_capacity, size_t capacity_requested)
 {
-  size_t capacity = old_capacity;
+  size_t capacity = (old_capacity > 0) ? old_capacity : kSacnInitialCapacity;
   while (capacity < capacity_requested)
     capacity *= 2;
   return capacity;
 }
+
+/*
+ * Record that a buffer had to grow at runtime. These are the realloc() and copy events that sacn_reserve() is meant to
+ * avoid, so they are counted and logged to help tune the reservation.
+ */
+void sacn_mem_note_growth(const char* buffer_name, size_t new_capacity)
+{
+#if !SACN_LOGGING_ENABLED
+  ETCPAL_UNUSED_ARG(buffer_name);
+  ETCPAL_UNUSED_ARG(new_capacity);
+#endif
+
+  SACN_ATOMIC_INCREMENT_U64(growth_count);
+
+  SACN_LOG_INFO("Grew buffer \"%s\" to %lu entries. Consider reserving more capacity with sacn_reserve().",
+                buffer_name ? buffer_name : "", (unsigned long)new_capacity);
+}
 #endif  // SACN_DYNAMIC_MEM
 
+size_t sacn_mem_get_growth_count(void)
+{
+#if SACN_DYNAMIC_MEM
+  return (size_t)SACN_ATOMIC_LOAD_U64(growth_count);
+#else
+  return 0;
+#endif
+}
+
+void sacn_mem_set_reservation(const SacnReserveConfig* config)
+{
+  if (!SACN_ASSERT_VERIFY(config))
+    return;
+
+  reservation = *config;
+}
+
+const SacnReserveConfig* sacn_mem_get_reservation(void)
+{
+  return &reservation;
+}
+
+/*
+ * The initial capacity for a dynamic buffer expected to hold the given number of reserved entries.
+ */
+size_t sacn_mem_reserved_capacity(size_t reserved)
+{
+  return (reserved > kSacnInitialCapacity) ? reserved : kSacnInitialCapacity;
+}
+
 unsigned int sacn_mem_get_num_threads(void)
 {
   return num_threads;
@@ -0,0 +1,258 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "sacn/private/mem/handle_index.h"
+
+#include <string.h>
+#include "sacn/private/common.h"
+#include "sacn/private/mem/common.h"
+
+#if SACN_DYNAMIC_MEM
+#include <stdlib.h>
+#endif
+
+/****************************** Private macros *******************************/
+
+// The entry array is counted against the module that owns the index.
+#define SACN_ALLOC_MODULE (index->module)
+
+#define HOME_ENTRY(index, handle) ((size_t)(handle) & ((index)->capacity - 1))
+#define NEXT_ENTRY(index, i)      (((i) + 1) & ((index)->capacity - 1))
+
+/*********************** Private function prototypes *************************/
+
+static bool   find_entry(const SacnHandleIndex* index, int handle, size_t* entry);
+static void   insert_entry(SacnHandleIndex* index, int handle, void* object);
+static bool   make_room(SacnHandleIndex* index);
+static size_t floor_power_of_two(size_t value);
+
+/*************************** Function definitions ****************************/
+
+/*
+ * Initialize a handle index. static_entries must point to an array of num_static_entries entries in static memory
+ * mode, and must be NULL in dynamic memory mode.
+ */
+void sacn_handle_index_init(SacnHandleIndex*      index,
+                            sacn_alloc_module_t   module,
+                            SacnHandleIndexEntry* static_entries,
+                            size_t                num_static_entries)
+{
+  if (!SACN_ASSERT_VERIFY(index))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  if (!SACN_ASSERT_VERIFY(static_entries == NULL))
+    return;
+#else
+  if (!SACN_ASSERT_VERIFY(static_entries) || !SACN_ASSERT_VERIFY(num_static_entries >= 2))
+    return;
+#endif
+
+  memset(index, 0, sizeof(SacnHandleIndex));
+  index->module = module;
+
+  if (static_entries)
+  {
+    index->entries  = static_entries;
+    index->capacity = floor_power_of_two(num_static_entries);
+    memset(index->entries, 0, index->capacity * sizeof(SacnHandleIndexEntry));
+  }
+  else
+  {
+    index->owns_entries = true;
+  }
+}
+
+/*
+ * Release the index's entry array. The objects in the index are not freed.
+ */
+void sacn_handle_index_deinit(SacnHandleIndex* index)
+{
+  if (!SACN_ASSERT_VERIFY(index))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  if (index->owns_entries && index->entries)
+  {
+    SACN_FREE(index->entries);
+    index->entries  = NULL;
+    index->capacity = 0;
+  }
+#endif
+
+  index->size = 0;
+}
+
+/*
+ * Map a handle to an object. Returns kEtcPalErrExists if the handle is already mapped, or kEtcPalErrNoMem if the
+ * index is full or its entry array couldn't be grown.
+ */
+etcpal_error_t sacn_handle_index_add(SacnHandleIndex* index, int handle, void* object)
+{
+  if (!SACN_ASSERT_VERIFY(index) || !SACN_ASSERT_VERIFY(object))
+    return kEtcPalErrSys;
+
+  size_t entry = 0;
+  if (find_entry(index, handle, &entry))
+    return kEtcPalErrExists;
+
+  if (!make_room(index))
+    return kEtcPalErrNoMem;
+
+  insert_entry(index, handle, object);
+  return kEtcPalErrOk;
+}
+
+/*
+ * Unmap a handle. The object itself is not freed.
+ */
+etcpal_error_t sacn_handle_index_remove(SacnHandleIndex* index, int handle)
+{
+  if (!SACN_ASSERT_VERIFY(index))
+    return kEtcPalErrSys;
+
+  size_t hole = 0;
+  if (!find_entry(index, handle, &hole))
+    return kEtcPalErrNotFound;
+
+  // Shift back any later entries in the probe sequence that could have used the hole, so that no lookup stops short.
+  for (size_t i = NEXT_ENTRY(index, hole); index->entries[i].object; i = NEXT_ENTRY(index, i))
+  {
+    size_t home = HOME_ENTRY(index, index->entries[i].handle);
+    bool   stays = (hole <= i) ? ((hole < home) && (home <= i)) : ((hole < home) || (home <= i));
+    if (!stays)
+    {
+      index->entries[hole] = index->entries[i];
+      hole                 = i;
+    }
+  }
+
+  index->entries[hole].object = NULL;
+  --index->size;
+  return kEtcPalErrOk;
+}
+
+/*
+ * Look up the object mapped to a handle. Returns NULL if the handle isn't mapped.
+ */
+void* sacn_handle_index_get(const SacnHandleIndex* index, int handle)
+{
+  if (!SACN_ASSERT_VERIFY(index))
+    return NULL;
+
+  size_t entry = 0;
+  return find_entry(index, handle, &entry) ? index->entries[entry].object : NULL;
+}
+
+/*
+ * Unmap every handle, keeping the entry array for reuse.
+ */
+void sacn_handle_index_clear(SacnHandleIndex* index)
+{
+  if (!SACN_ASSERT_VERIFY(index))
+    return;
+
+  if (index->entries)
+    memset(index->entries, 0, index->capacity * sizeof(SacnHandleIndexEntry));
+
+  index->size = 0;
+}
+
+/*
+ * Get the number of handles in the index.
+ */
+size_t sacn_handle_index_size(const SacnHandleIndex* index)
+{
+  if (!SACN_ASSERT_VERIFY(index))
+    return 0;
+
+  return index->size;
+}
+
+bool find_entry(const SacnHandleIndex* index, int handle, size_t* entry)
+{
+  if (index->size == 0)
+    return false;
+
+  for (size_t i = HOME_ENTRY(index, handle); index->entries[i].object; i = NEXT_ENTRY(index, i))
+  {
+    if (index->entries[i].handle == handle)
+    {
+      *entry = i;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void insert_entry(SacnHandleIndex* index, int handle, void* object)
+{
+  size_t i = HOME_ENTRY(index, handle);
+  while (index->entries[i].object)
+    i = NEXT_ENTRY(index, i);
+
+  index->entries[i].handle = handle;
+  index->entries[i].object = object;
+  ++index->size;
+}
+
+// Make sure there's room for one more handle, while leaving at least one free entry to end each probe on.
+bool make_room(SacnHandleIndex* index)
+{
+#if SACN_DYNAMIC_MEM
+  if (index->owns_entries)
+  {
+    if ((index->size + 1) * 2 <= index->capacity)
+      return true;
+
+    size_t                new_capacity = (index->capacity > 0) ? (index->capacity * 2) : kSacnInitialCapacity;
+    SacnHandleIndexEntry* old_entries  = index->entries;
+    size_t                old_capacity = index->capacity;
+
+    SacnHandleIndexEntry* new_entries = (SacnHandleIndexEntry*)SACN_CALLOC(new_capacity, sizeof(SacnHandleIndexEntry));
+    if (!new_entries)
+      return false;
+
+    index->entries  = new_entries;
+    index->capacity = new_capacity;
+    index->size     = 0;
+    for (size_t i = 0; i < old_capacity; ++i)
+    {
+      if (old_entries[i].object)
+        insert_entry(index, old_entries[i].handle, old_entries[i].object);
+    }
+
+    SACN_FREE(old_entries);
+    sacn_mem_note_growth("handle index entries", new_capacity);
+    return true;
+  }
+#endif
+
+  return (index->size + 1) < index->capacity;
+}
+
+size_t floor_power_of_two(size_t value)
+{
+  size_t result = 1;
+  while ((result * 2) <= value)
+    result *= 2;
+
+  return result;
+}
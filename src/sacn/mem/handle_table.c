@@ -0,0 +1,377 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "sacn/private/mem/handle_table.h"
+
+#include <string.h>
+#include "sacn/private/common.h"
+#include "sacn/private/mem/common.h"
+
+#if SACN_DYNAMIC_MEM
+#include <stdlib.h>
+#endif
+
+/****************************** Private macros *******************************/
+
+// The slot array is counted against the module that owns the table.
+#define SACN_ALLOC_MODULE (table->module)
+
+#define NO_SLOT ((size_t)-1)
+
+// A band is only added if each of its slots gets at least this many generations.
+#define MIN_BAND_GENERATIONS 2u
+
+/*********************** Private function prototypes *************************/
+
+static void                  plan_bands(SacnHandleTable* table, size_t band_slots, size_t num_handles, bool growable);
+static const SacnHandleBand* get_slot_band(const SacnHandleTable* table, size_t index);
+static const SacnHandleBand* get_handle_band(const SacnHandleTable* table, size_t handle);
+
+static bool take_fresh_slot(SacnHandleTable* table, size_t* index);
+static bool grow_slots(SacnHandleTable* table, size_t capacity_requested, bool at_runtime);
+static void free_slot(SacnHandleTable* table, size_t index);
+
+/*************************** Function definitions ****************************/
+
+/*
+ * Initialize a handle table with handles no greater than max_handle. In static memory mode, static_slots must point to
+ * an array of band_slots slots, which is the most objects the table can map at once. In dynamic memory mode,
+ * static_slots must be NULL, and band_slots is the size of the first band of slots - more bands are added as needed,
+ * while the handle space allows. A freed slot isn't reused until more than min_free_slots slots are free, unless
+ * there are no fresh slots left.
+ */
+void sacn_handle_table_init(SacnHandleTable*    table,
+                            sacn_alloc_module_t module,
+                            SacnHandleSlot*     static_slots,
+                            size_t              band_slots,
+                            int                 max_handle,
+                            size_t              min_free_slots)
+{
+  if (!SACN_ASSERT_VERIFY(table) || !SACN_ASSERT_VERIFY(band_slots > 0) ||
+      !SACN_ASSERT_VERIFY((max_handle >= 0) && (band_slots <= (size_t)max_handle + 1)))
+  {
+    return;
+  }
+
+#if SACN_DYNAMIC_MEM
+  if (!SACN_ASSERT_VERIFY(static_slots == NULL))
+    return;
+#else
+  if (!SACN_ASSERT_VERIFY(static_slots))
+    return;
+#endif
+
+  memset(table, 0, sizeof(SacnHandleTable));
+  table->module         = module;
+  table->min_free_slots = min_free_slots;
+  table->free_head      = NO_SLOT;
+  table->free_tail      = NO_SLOT;
+
+  if (static_slots)
+  {
+    table->slots    = static_slots;
+    table->capacity = band_slots;
+  }
+  else
+  {
+    table->owns_slots = true;
+  }
+
+  plan_bands(table, band_slots, (size_t)max_handle + 1, table->owns_slots);
+}
+
+/*
+ * Release the table's slot array. The objects in the table are not freed.
+ */
+void sacn_handle_table_deinit(SacnHandleTable* table)
+{
+  if (!SACN_ASSERT_VERIFY(table))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  if (table->owns_slots && table->slots)
+    SACN_FREE(table->slots);
+#endif
+
+  table->slots      = NULL;
+  table->capacity   = 0;
+  table->num_slots  = 0;
+  table->num_in_use = 0;
+  table->num_free   = 0;
+  table->free_head  = NO_SLOT;
+  table->free_tail  = NO_SLOT;
+}
+
+/*
+ * Grow the slot array up front so that it can hold at least num_slots objects without allocating.
+ */
+etcpal_error_t sacn_handle_table_reserve(SacnHandleTable* table, size_t num_slots)
+{
+  if (!SACN_ASSERT_VERIFY(table))
+    return kEtcPalErrSys;
+
+  if (num_slots > table->max_slots)
+    num_slots = table->max_slots;
+
+  return grow_slots(table, num_slots, false) ? kEtcPalErrOk : kEtcPalErrNoMem;
+}
+
+/*
+ * Add an object to the table, and get the handle it can be looked up by. Returns kEtcPalErrNoMem if the table is full
+ * or its slot array couldn't be grown.
+ */
+etcpal_error_t sacn_handle_table_add(SacnHandleTable* table, void* object, int* handle)
+{
+  if (!SACN_ASSERT_VERIFY(table) || !SACN_ASSERT_VERIFY(object) || !SACN_ASSERT_VERIFY(handle))
+    return kEtcPalErrSys;
+
+  // Freed slots wait in the queue until enough others have been freed after them, to keep their next handles far from
+  // the ones that were just freed. Once there are no fresh slots left, the oldest is reused regardless.
+  size_t index = NO_SLOT;
+  if ((table->num_free <= table->min_free_slots) && take_fresh_slot(table, &index))
+  {
+    table->slots[index].generation = 0;
+  }
+  else if (table->free_head != NO_SLOT)
+  {
+    index            = table->free_head;
+    table->free_head = table->slots[index].next_free;
+    if (table->free_head == NO_SLOT)
+      table->free_tail = NO_SLOT;
+    --table->num_free;
+  }
+  else
+  {
+    // Only logged once until an object is removed, as callers can keep trying on every packet.
+    if (!table->full_logged)
+    {
+      if (table->num_slots >= table->max_slots)
+        SACN_LOG_WARNING("All %u handles of a handle table are in use.", (unsigned int)table->max_slots);
+      else
+        SACN_LOG_ERR("Couldn't grow a handle table past %u handles.", (unsigned int)table->num_slots);
+
+      table->full_logged = true;
+    }
+
+    return kEtcPalErrNoMem;
+  }
+
+  table->slots[index].object    = object;
+  table->slots[index].next_free = NO_SLOT;
+  ++table->num_in_use;
+
+  const SacnHandleBand* band = get_slot_band(table, index);
+  *handle = (int)(band->first_handle + (table->slots[index].generation * band->num_slots) + (index - band->first_slot));
+  return kEtcPalErrOk;
+}
+
+/*
+ * Remove an object from the table, so that its handle no longer looks it up. The object itself is not freed.
+ */
+etcpal_error_t sacn_handle_table_remove(SacnHandleTable* table, int handle)
+{
+  if (!SACN_ASSERT_VERIFY(table))
+    return kEtcPalErrSys;
+
+  if (!sacn_handle_table_get(table, handle))
+    return kEtcPalErrNotFound;
+
+  const SacnHandleBand* band = get_handle_band(table, (size_t)handle);
+  free_slot(table, band->first_slot + (((size_t)handle - band->first_handle) % band->num_slots));
+  return kEtcPalErrOk;
+}
+
+/*
+ * Look up the object with the given handle. Returns NULL if the handle is invalid or its object has been removed.
+ */
+void* sacn_handle_table_get(const SacnHandleTable* table, int handle)
+{
+  if (!SACN_ASSERT_VERIFY(table) || (handle < 0))
+    return NULL;
+
+  const SacnHandleBand* band = get_handle_band(table, (size_t)handle);
+  if (!band)
+    return NULL;
+
+  size_t offset     = (size_t)handle - band->first_handle;
+  size_t index      = band->first_slot + (offset % band->num_slots);
+  size_t generation = offset / band->num_slots;
+  if ((index >= table->num_slots) || (generation != table->slots[index].generation))
+    return NULL;
+
+  return table->slots[index].object;
+}
+
+/*
+ * Remove every object from the table, passing each one to free_object.
+ */
+void sacn_handle_table_clear_with_cb(SacnHandleTable* table, void (*free_object)(void* object))
+{
+  if (!SACN_ASSERT_VERIFY(table) || !SACN_ASSERT_VERIFY(free_object))
+    return;
+
+  for (size_t index = 0; index < table->num_slots; ++index)
+  {
+    void* object = table->slots[index].object;
+    if (object)
+    {
+      free_slot(table, index);
+      free_object(object);
+    }
+  }
+}
+
+/*
+ * Get the number of objects in the table.
+ */
+size_t sacn_handle_table_size(const SacnHandleTable* table)
+{
+  if (!SACN_ASSERT_VERIFY(table))
+    return 0;
+
+  return table->num_in_use;
+}
+
+/*
+ * Divide the handle space between the bands of slots. A table that can't grow gets one band with all of it. Otherwise
+ * each band takes half of what's left, so that larger bands can still be added, unless that would leave it fewer than
+ * MIN_BAND_GENERATIONS generations, in which case it takes the rest. Once the handles that are left can't give a band
+ * that many generations, the last band gives each of them its own slot, with a single generation, so that the table
+ * can still hold as many objects as the handle space allows.
+ */
+void plan_bands(SacnHandleTable* table, size_t band_slots, size_t num_handles, bool growable)
+{
+  size_t first_slot   = 0;
+  size_t first_handle = 0;
+
+  while ((table->num_bands < SACN_HANDLE_TABLE_MAX_BANDS) && (first_handle < num_handles))
+  {
+    bool   last_band    = ((table->num_bands + 1) == SACN_HANDLE_TABLE_MAX_BANDS);
+    size_t handles_left = num_handles - first_handle;
+    size_t band_handles = handles_left;
+    if (growable && !last_band && ((handles_left / 2) >= (band_slots * MIN_BAND_GENERATIONS)))
+      band_handles = handles_left / 2;
+
+    size_t num_generations = band_handles / band_slots;
+    if (growable && (table->num_bands > 0) && (num_generations < MIN_BAND_GENERATIONS))
+    {
+      band_slots      = handles_left;
+      num_generations = 1;
+      last_band       = true;
+    }
+    else if (num_generations == 0)
+    {
+      break;
+    }
+
+    SacnHandleBand* band  = &table->bands[table->num_bands++];
+    band->first_slot      = first_slot;
+    band->num_slots       = band_slots;
+    band->first_handle    = first_handle;
+    band->num_generations = (unsigned int)num_generations;
+
+    first_slot += band_slots;
+    first_handle += num_generations * band_slots;
+    band_slots *= 2;
+
+    if (!growable || last_band)
+      break;
+  }
+
+  table->max_slots = first_slot;
+}
+
+// Slot indices never reach max_slots, so every slot is in one of the bands.
+const SacnHandleBand* get_slot_band(const SacnHandleTable* table, size_t index)
+{
+  size_t i = 0;
+  while (((i + 1) < table->num_bands) && (index >= table->bands[i + 1].first_slot))
+    ++i;
+
+  return &table->bands[i];
+}
+
+const SacnHandleBand* get_handle_band(const SacnHandleTable* table, size_t handle)
+{
+  for (size_t i = 0; i < table->num_bands; ++i)
+  {
+    const SacnHandleBand* band = &table->bands[i];
+    if (handle < band->first_handle + (band->num_generations * band->num_slots))
+      return band;
+  }
+
+  return NULL;
+}
+
+bool take_fresh_slot(SacnHandleTable* table, size_t* index)
+{
+  if ((table->num_slots >= table->max_slots) || !grow_slots(table, table->num_slots + 1, true))
+    return false;
+
+  *index = table->num_slots++;
+  return true;
+}
+
+bool grow_slots(SacnHandleTable* table, size_t capacity_requested, bool at_runtime)
+{
+  if (capacity_requested <= table->capacity)
+    return true;
+
+#if SACN_DYNAMIC_MEM
+  if (table->owns_slots)
+  {
+    size_t new_capacity = sacn_mem_grow_capacity(table->capacity, capacity_requested);
+    if (new_capacity > table->max_slots)
+      new_capacity = table->max_slots;
+
+    SacnHandleSlot* new_slots = (SacnHandleSlot*)SACN_REALLOC(table->slots, new_capacity * sizeof(SacnHandleSlot));
+    if (new_slots)
+    {
+      table->slots    = new_slots;
+      table->capacity = new_capacity;
+      if (at_runtime)
+        sacn_mem_note_growth("handle slots", new_capacity);
+      return true;
+    }
+  }
+#else
+  ETCPAL_UNUSED_ARG(at_runtime);
+#endif
+
+  return false;
+}
+
+void free_slot(SacnHandleTable* table, size_t index)
+{
+  SacnHandleSlot* slot = &table->slots[index];
+
+  slot->object     = NULL;
+  slot->generation = (slot->generation + 1) % get_slot_band(table, index)->num_generations;
+  slot->next_free  = NO_SLOT;
+
+  if (table->free_tail == NO_SLOT)
+    table->free_head = index;
+  else
+    table->slots[table->free_tail].next_free = index;
+  table->free_tail = index;
+
+  ++table->num_free;
+  --table->num_in_use;
+  table->full_logged = false;
+}
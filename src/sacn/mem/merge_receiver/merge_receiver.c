@@ -34,6 +34,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleMergeReceiver
+
 #if SACN_MERGE_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private constants ******************************/
@@ -51,8 +53,8 @@
 #if SACN_DYNAMIC_MEM
 
 /* Macros for dynamic allocation. */
-#define ALLOC_MERGE_RECEIVER()   malloc(sizeof(SacnMergeReceiver))
-#define FREE_MERGE_RECEIVER(ptr) free(ptr)
+#define ALLOC_MERGE_RECEIVER()   SACN_MALLOC(sizeof(SacnMergeReceiver))
+#define FREE_MERGE_RECEIVER(ptr) SACN_FREE(ptr)
 
 #else  // SACN_DYNAMIC_MEM
 
@@ -115,6 +117,14 @@ etcpal_error_t add_sacn_merge_receiver(sacn_merge_receiver_t          handle,
     merge_receiver->callbacks             = config->callbacks;
     merge_receiver->use_pap               = config->use_pap;
 
+#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
+    merge_receiver->sampling_merger_handle = kSacnDmxMergerInvalid;
+    merge_receiver->source_count_max       = config->source_count_max;
+#if SACN_DYNAMIC_MEM
+    merge_receiver->sampling_bufs = NULL;
+#endif
+#endif
+
     memset(merge_receiver->levels, 0, SACN_DMX_MERGER_MAX_SLOTS);
     memset(merge_receiver->owners, 0, SACN_DMX_MERGER_MAX_SLOTS * sizeof(sacn_dmx_merger_source_t));
 
@@ -177,7 +187,7 @@ int merge_receiver_compare(const EtcPalRbTree* tree, const void* value_a, const
 EtcPalRbNode* merge_receiver_node_alloc(void)
 {
 #if SACN_DYNAMIC_MEM
-  return (EtcPalRbNode*)malloc(sizeof(EtcPalRbNode));
+  return (EtcPalRbNode*)SACN_MALLOC(sizeof(EtcPalRbNode));
 #else
   return etcpal_mempool_alloc(sacn_pool_mergerecv_receiver_rb_nodes);
 #endif
@@ -186,7 +196,7 @@ EtcPalRbNode* merge_receiver_node_alloc(void)
 void merge_receiver_node_dealloc(EtcPalRbNode* node)
 {
 #if SACN_DYNAMIC_MEM
-  free(node);
+  SACN_FREE(node);
 #else
   etcpal_mempool_free(sacn_pool_mergerecv_receiver_rb_nodes, node);
 #endif
@@ -195,8 +205,13 @@ void merge_receiver_node_dealloc(EtcPalRbNode* node)
 void merge_receiver_tree_dealloc(const EtcPalRbTree* self, EtcPalRbNode* node)
 {
   ETCPAL_UNUSED_ARG(self);
-  clear_sacn_merge_receiver_sources((SacnMergeReceiver*)node->value);
-  FREE_MERGE_RECEIVER(node->value);
+  SacnMergeReceiver* merge_receiver = (SacnMergeReceiver*)node->value;
+  clear_sacn_merge_receiver_sources(merge_receiver);
+#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER && SACN_DYNAMIC_MEM
+  if (merge_receiver->sampling_bufs)
+    SACN_FREE(merge_receiver->sampling_bufs);
+#endif
+  FREE_MERGE_RECEIVER(merge_receiver);
   merge_receiver_node_dealloc(node);
 }
 
@@ -233,4 +248,19 @@ void deinit_merge_receivers(void)
   }
 }
 
+// Needs lock
+void add_merge_receiver_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  ADD_OBJECT_STATS(stats, etcpal_rbtree_size(&merge_receivers), SacnMergeReceiver);
+  ADD_RB_NODE_STATS(stats, etcpal_rbtree_size(&merge_receivers));
+#else
+  ADD_POOL_STATS(stats, sacn_pool_mergerecv_receivers, SacnMergeReceiver);
+  ADD_RB_NODE_POOL_STATS(stats, sacn_pool_mergerecv_receiver_rb_nodes);
+#endif
+}
+
 #endif  // SACN_MERGE_RECEIVER_ENABLED || DOXYGEN
@@ -24,13 +24,15 @@
 #include "etcpal/rbtree.h"
 #include "sacn/private/common.h"
 #include "sacn/opts.h"
+#include "sacn/private/mem/common.h"
+#include "sacn/private/mem/slab.h"
 
-#if SACN_DYNAMIC_MEM
-#include <stdlib.h>
-#else
+#if !SACN_DYNAMIC_MEM
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleMergeReceiver
+
 #if SACN_MERGE_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private constants ******************************/
@@ -41,9 +43,9 @@
 
 #if SACN_DYNAMIC_MEM
 
-/* Macros for dynamic allocation. */
-#define ALLOC_MERGE_RECEIVER_SOURCE()   malloc(sizeof(SacnMergeReceiverInternalSource))
-#define FREE_MERGE_RECEIVER_SOURCE(ptr) free(ptr)
+/* Macros for dynamic allocation, which is done using per-type slabs. */
+#define ALLOC_MERGE_RECEIVER_SOURCE()   sacn_slab_alloc(&merge_receiver_source_slab)
+#define FREE_MERGE_RECEIVER_SOURCE(ptr) sacn_slab_free(&merge_receiver_source_slab, ptr)
 
 #else  // SACN_DYNAMIC_MEM
 
@@ -55,10 +57,13 @@
 
 /**************************** Private variables ******************************/
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+static SacnSlab merge_receiver_source_slab;
+static SacnSlab merge_receiver_source_rb_node_slab;
+#else  // SACN_DYNAMIC_MEM
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_mergerecv_sources, SacnMergeReceiverInternalSource, SACN_RECEIVER_TOTAL_MAX_SOURCES);
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_mergerecv_source_rb_nodes, EtcPalRbNode, SACN_MERGE_RECEIVER_SOURCE_MAX_RB_NODES);
-#endif  // !SACN_DYNAMIC_MEM
+#endif  // SACN_DYNAMIC_MEM
 
 /*********************** Private function prototypes *************************/
 
@@ -71,14 +76,49 @@ etcpal_error_t init_merge_receiver_sources(void)
 {
   etcpal_error_t res = kEtcPalErrOk;
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+  sacn_slab_init(&merge_receiver_source_slab, SACN_ALLOC_MODULE, sizeof(SacnMergeReceiverInternalSource),
+                 SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  sacn_slab_init(&merge_receiver_source_rb_node_slab, SACN_ALLOC_MODULE, sizeof(EtcPalRbNode),
+                 SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+
+  const SacnReserveConfig* reserved = sacn_mem_get_reservation();
+  size_t reserved_sources           = reserved->receivers * reserved->sources_per_universe;
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&merge_receiver_source_slab, reserved_sources);
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&merge_receiver_source_rb_node_slab, reserved_sources);
+#else  // SACN_DYNAMIC_MEM
   res |= etcpal_mempool_init(sacn_pool_mergerecv_sources);
   res |= etcpal_mempool_init(sacn_pool_mergerecv_source_rb_nodes);
-#endif  // !SACN_DYNAMIC_MEM
+#endif  // SACN_DYNAMIC_MEM
 
   return res;
 }
 
+void deinit_merge_receiver_sources(void)
+{
+#if SACN_DYNAMIC_MEM
+  sacn_slab_deinit(&merge_receiver_source_rb_node_slab);
+  sacn_slab_deinit(&merge_receiver_source_slab);
+#endif
+}
+
+// Needs lock
+void add_merge_receiver_source_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  ADD_POOL_STATS(stats, merge_receiver_source_slab, SacnMergeReceiverInternalSource);
+  ADD_RB_NODE_POOL_STATS(stats, merge_receiver_source_rb_node_slab);
+#else
+  ADD_POOL_STATS(stats, sacn_pool_mergerecv_sources, SacnMergeReceiverInternalSource);
+  ADD_RB_NODE_POOL_STATS(stats, sacn_pool_mergerecv_source_rb_nodes);
+#endif
+}
+
 // Needs lock
 etcpal_error_t add_sacn_merge_receiver_source(SacnMergeReceiver*          merge_receiver,
                                               const EtcPalSockAddr*       addr,
@@ -177,7 +217,7 @@ void update_merge_receiver_source_info(SacnMergeReceiverInternalSource* info,
 EtcPalRbNode* merge_receiver_source_node_alloc(void)
 {
 #if SACN_DYNAMIC_MEM
-  return (EtcPalRbNode*)malloc(sizeof(EtcPalRbNode));
+  return (EtcPalRbNode*)sacn_slab_alloc(&merge_receiver_source_rb_node_slab);
 #else
   return etcpal_mempool_alloc(sacn_pool_mergerecv_source_rb_nodes);
 #endif
@@ -189,7 +229,7 @@ void merge_receiver_source_node_dealloc(EtcPalRbNode* node)
     return;
 
 #if SACN_DYNAMIC_MEM
-  free(node);
+  sacn_slab_free(&merge_receiver_source_rb_node_slab, node);
 #else
   etcpal_mempool_free(sacn_pool_mergerecv_source_rb_nodes, node);
 #endif
@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleMergeReceiver
+
 #if SACN_MERGE_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -110,17 +112,19 @@ etcpal_error_t init_merged_data_buf(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  sacn_pool_merged_data = calloc(num_threads, sizeof(MergeReceiverMergedDataNotification));
+  sacn_pool_merged_data = SACN_CALLOC(num_threads, sizeof(MergeReceiverMergedDataNotification));
   if (!sacn_pool_merged_data)
     return kEtcPalErrNoMem;
 
+  size_t capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->sources_per_universe);
+
   for (unsigned int i = 0; i < num_threads; ++i)
   {
-    sacn_pool_merged_data[i].active_sources = calloc(kSacnInitialCapacity, sizeof(sacn_remote_source_t));
+    sacn_pool_merged_data[i].active_sources = SACN_CALLOC(capacity, sizeof(sacn_remote_source_t));
     if (!sacn_pool_merged_data[i].active_sources)
       return kEtcPalErrNoMem;
 
-    sacn_pool_merged_data[i].active_sources_capacity = kSacnInitialCapacity;
+    sacn_pool_merged_data[i].active_sources_capacity = capacity;
   }
 #else   // SACN_DYNAMIC_MEM
   ETCPAL_UNUSED_ARG(num_threads);
@@ -138,14 +142,31 @@ void deinit_merged_data_buf(void)
     for (unsigned int i = 0; i < sacn_mem_get_num_threads(); ++i)
     {
       if (sacn_pool_merged_data[i].active_sources)
-        free(sacn_pool_merged_data[i].active_sources);
+        SACN_FREE(sacn_pool_merged_data[i].active_sources);
     }
 
-    free(sacn_pool_merged_data);
+    SACN_FREE(sacn_pool_merged_data);
     sacn_pool_merged_data = NULL;
   }
 }
 
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's merged data notification, or 0 if the thread ID was invalid.
+ */
+// Needs lock
+size_t get_merged_data_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!sacn_pool_merged_data || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  return sizeof(MergeReceiverMergedDataNotification) +
+         (sacn_pool_merged_data[thread_id].active_sources_capacity * sizeof(sacn_remote_source_t));
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(MergeReceiverMergedDataNotification) : 0;
+#endif
+}
+
 #endif  // SACN_MERGE_RECEIVER_ENABLED || DOXYGEN
@@ -22,6 +22,7 @@
 #include <stddef.h>
 #include "etcpal/common.h"
 #include "etcpal/rbtree.h"
+#include "sacn/private/atomic.h"
 #include "sacn/private/common.h"
 #include "sacn/opts.h"
 #include "sacn/private/sockets.h"
@@ -34,40 +35,52 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private constants ******************************/
 
 #define SACN_RECEIVER_MAX_RB_NODES (SACN_RECEIVER_MAX_UNIVERSES * 2)
 
+// One bit per possible universe ID
+#define SUBSCRIBED_UNIVERSES_WORDS ((UINT16_MAX + 1) / 32)
+
+// Marks a universe whose multicast any receive thread may handle.
+#define UNIVERSE_THREAD_NONE UINT8_MAX
+
+#if SACN_RECEIVER_MAX_THREADS >= UNIVERSE_THREAD_NONE
+#error "SACN_RECEIVER_MAX_THREADS is too large for the universe thread table."
+#endif
+
 /****************************** Private macros *******************************/
 
 #if SACN_DYNAMIC_MEM
 
 /* Macros for dynamic allocation. */
-#define ALLOC_RECEIVER() malloc(sizeof(SacnReceiver))
+#define ALLOC_RECEIVER() SACN_MALLOC(sizeof(SacnReceiver))
 
 #if SACN_RECEIVER_SOCKET_PER_NIC
+#define FREE_RECEIVER(ptr)                  \
+  do                                        \
+  {                                         \
+    if (ptr->netints.netints)               \
+    {                                       \
+      SACN_FREE(ptr->sockets.ipv4_sockets); \
+      SACN_FREE(ptr->sockets.ipv6_sockets); \
+      SACN_FREE(ptr->netints.netints);      \
+    }                                       \
+    SACN_FREE(ptr);                         \
+  } while (0)
+#else  // SACN_RECEIVER_SOCKET_PER_NIC
 #define FREE_RECEIVER(ptr)             \
   do                                   \
   {                                    \
     if (ptr->netints.netints)          \
     {                                  \
-      free(ptr->sockets.ipv4_sockets); \
-      free(ptr->sockets.ipv6_sockets); \
-      free(ptr->netints.netints);      \
+      SACN_FREE(ptr->netints.netints); \
     }                                  \
-    free(ptr);                         \
-  } while (0)
-#else  // SACN_RECEIVER_SOCKET_PER_NIC
-#define FREE_RECEIVER(ptr)        \
-  do                              \
-  {                               \
-    if (ptr->netints.netints)     \
-    {                             \
-      free(ptr->netints.netints); \
-    }                             \
-    free(ptr);                    \
+    SACN_FREE(ptr);                    \
   } while (0)
 #endif  // SACN_RECEIVER_SOCKET_PER_NIC
 
@@ -89,11 +102,22 @@ ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_rb_nodes, EtcPalRbNode, SACN_RECEIVER_MAX_R
 static EtcPalRbTree receivers;
 static EtcPalRbTree receivers_by_universe;
 
+// Mirrors the universes in receivers_by_universe so that incoming packets can be screened without the lock. Only
+// written with the lock held.
+static uint32_t subscribed_universes[SUBSCRIBED_UNIVERSES_WORDS];
+
+#if SACN_RECEIVER_MAX_THREADS > 1
+// The receive thread that owns each universe's receiver, so that the other threads can drop their copies of its
+// multicast without the lock. Only written with the lock held.
+static uint8_t universe_threads[UINT16_MAX + 1];
+#endif
+
 /*********************** Private function prototypes *************************/
 
 // Receiver memory management
 static etcpal_error_t insert_receiver_into_maps(SacnReceiver* receiver);
 static void           remove_receiver_from_maps(SacnReceiver* receiver);
+static void           set_universe_subscribed(uint16_t universe, bool subscribed);
 
 // Receiver tree node management
 static int           receiver_compare(const EtcPalRbTree* tree, const void* value_a, const void* value_b);
@@ -177,7 +201,8 @@ etcpal_error_t add_sacn_receiver(sacn_receiver_t                      handle,
 
   receiver->suppress_limit_exceeded_notification = false;
   etcpal_rbtree_init(&receiver->sources, remote_source_compare, tracked_source_node_alloc, tracked_source_node_dealloc);
-  receiver->term_sets = NULL;
+  receiver->inline_sources.num_sources = 0;
+  receiver->term_sets                  = NULL;
 
   receiver->filter_preview_data = ((config->flags & kSacnReceiverOptsFilterPreviewData) != 0);
 
@@ -202,6 +227,8 @@ etcpal_error_t add_sacn_receiver(sacn_receiver_t                      handle,
 
   receiver->ip_supported = config->ip_supported;
 
+  memset(&receiver->load, 0, sizeof(receiver->load));
+
   receiver->next = NULL;
 
   *receiver_state = receiver;
@@ -257,13 +284,77 @@ etcpal_error_t update_receiver_universe(SacnReceiver* receiver, uint16_t new_uni
 
   if (res == kEtcPalErrOk)
   {
+    set_universe_subscribed(receiver->keys.universe, false);
+    set_receiver_universe_thread(receiver->keys.universe, kSacnThreadIdInvalid);
+
     receiver->keys.universe = new_universe;
     res                     = etcpal_rbtree_insert(&receivers_by_universe, receiver);
+
+    if (res == kEtcPalErrOk)
+      set_universe_subscribed(new_universe, true);
   }
 
   return res;
 }
 
+/*
+ * Check whether a receiver might be listening to a universe, without taking the lock. This is meant for discarding
+ * packets for other universes as early as possible - a true result must still be confirmed with
+ * lookup_receiver_by_universe().
+ *
+ * The bitmap is only written with the lock held, but receive threads read it without the lock, so it's read with a
+ * plain volatile load of the aligned word and written with atomic read-modify-writes. A read that races with a
+ * receiver being added, removed, or changed may see the universe's bit either way, which is no different from the
+ * packet arriving just before or after the change.
+ *
+ * [in] universe Universe ID to check.
+ * Returns true if a receiver might be listening to the universe, or false if none is.
+ */
+bool receiver_universe_subscribed(uint16_t universe)
+{
+  return (SACN_ATOMIC_LOAD_U32(subscribed_universes[universe / 32u]) & (1u << (universe % 32u))) != 0;
+}
+
+/*
+ * Record which receive thread handles a universe's multicast. Needs lock.
+ *
+ * [in] universe Universe ID to update.
+ * [in] thread_id Thread that now owns the universe's receiver, or kSacnThreadIdInvalid if no thread does.
+ */
+void set_receiver_universe_thread(uint16_t universe, sacn_thread_id_t thread_id)
+{
+#if SACN_RECEIVER_MAX_THREADS > 1
+  SACN_ATOMIC_STORE_U8(universe_threads[universe],
+                       (thread_id < SACN_RECEIVER_MAX_THREADS) ? thread_id : UNIVERSE_THREAD_NONE);
+#else
+  ETCPAL_UNUSED_ARG(universe);
+  ETCPAL_UNUSED_ARG(thread_id);
+#endif
+}
+
+/*
+ * Check whether a universe's multicast belongs to a different receive thread, without taking the lock. Every thread's
+ * sockets can get a copy of the same multicast packet, and only the owning thread should handle it.
+ *
+ * Like receiver_universe_subscribed(), a read that races with a receiver being moved may see either thread. While a
+ * receiver is between threads, no thread owns its universe, and the sequence check drops the extra copies.
+ *
+ * [in] universe Universe ID to check.
+ * [in] thread_id Thread that received the packet.
+ * Returns true if another thread owns the universe, or false if this thread or no thread does.
+ */
+bool receiver_universe_owned_elsewhere(uint16_t universe, sacn_thread_id_t thread_id)
+{
+#if SACN_RECEIVER_MAX_THREADS > 1
+  uint8_t owner = SACN_ATOMIC_LOAD_U8(universe_threads[universe]);
+  return (owner != UNIVERSE_THREAD_NONE) && (owner != thread_id);
+#else
+  ETCPAL_UNUSED_ARG(universe);
+  ETCPAL_UNUSED_ARG(thread_id);
+  return false;
+#endif
+}
+
 void remove_sacn_receiver(SacnReceiver* receiver)
 {
   if (!SACN_ASSERT_VERIFY(receiver))
@@ -280,16 +371,18 @@ etcpal_error_t initialize_receiver_sockets(SacnInternalSocketState* sockets)
 {
 #if SACN_RECEIVER_SOCKET_PER_NIC
 #if SACN_DYNAMIC_MEM
+  size_t capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->netints);
+
   if (!sockets->ipv4_sockets)
   {
-    sockets->ipv4_sockets          = calloc(kSacnInitialCapacity, sizeof(etcpal_socket_t));
-    sockets->ipv4_sockets_capacity = kSacnInitialCapacity;
+    sockets->ipv4_sockets          = SACN_CALLOC(capacity, sizeof(etcpal_socket_t));
+    sockets->ipv4_sockets_capacity = capacity;
   }
 
   if (!sockets->ipv6_sockets)
   {
-    sockets->ipv6_sockets          = calloc(kSacnInitialCapacity, sizeof(etcpal_socket_t));
-    sockets->ipv6_sockets_capacity = kSacnInitialCapacity;
+    sockets->ipv6_sockets          = SACN_CALLOC(capacity, sizeof(etcpal_socket_t));
+    sockets->ipv6_sockets_capacity = capacity;
   }
 
   if (!sockets->ipv4_sockets || !sockets->ipv6_sockets)
@@ -321,7 +414,9 @@ etcpal_error_t insert_receiver_into_maps(SacnReceiver* receiver)
   if (res == kEtcPalErrOk)
   {
     res = etcpal_rbtree_insert(&receivers_by_universe, receiver);
-    if (res != kEtcPalErrOk)
+    if (res == kEtcPalErrOk)
+      set_universe_subscribed(receiver->keys.universe, true);
+    else
       etcpal_rbtree_remove(&receivers, receiver);
   }
   return res;
@@ -337,10 +432,29 @@ void remove_receiver_from_maps(SacnReceiver* receiver)
   if (!SACN_ASSERT_VERIFY(receiver))
     return;
 
-  etcpal_rbtree_remove(&receivers_by_universe, receiver);
+  if (etcpal_rbtree_remove(&receivers_by_universe, receiver) == kEtcPalErrOk)
+  {
+    set_universe_subscribed(receiver->keys.universe, false);
+    set_receiver_universe_thread(receiver->keys.universe, kSacnThreadIdInvalid);
+  }
+
   etcpal_rbtree_remove(&receivers, receiver);
 }
 
+/*
+ * Update a universe's bit in the subscribed universes bitmap. Needs lock.
+ *
+ * [in] universe Universe ID to update.
+ * [in] subscribed Whether a receiver is now listening to the universe.
+ */
+void set_universe_subscribed(uint16_t universe, bool subscribed)
+{
+  if (subscribed)
+    SACN_ATOMIC_OR_U32(subscribed_universes[universe / 32u], (1u << (universe % 32u)));
+  else
+    SACN_ATOMIC_AND_U32(subscribed_universes[universe / 32u], ~(1u << (universe % 32u)));
+}
+
 int receiver_compare(const EtcPalRbTree* tree, const void* value_a, const void* value_b)
 {
   ETCPAL_UNUSED_ARG(tree);
@@ -368,7 +482,7 @@ int receiver_compare_by_universe(const EtcPalRbTree* tree, const void* value_a,
 EtcPalRbNode* receiver_node_alloc(void)
 {
 #if SACN_DYNAMIC_MEM
-  return (EtcPalRbNode*)malloc(sizeof(EtcPalRbNode));
+  return (EtcPalRbNode*)SACN_MALLOC(sizeof(EtcPalRbNode));
 #else
   return etcpal_mempool_alloc(sacn_pool_recv_rb_nodes);
 #endif
@@ -380,7 +494,7 @@ void receiver_node_dealloc(EtcPalRbNode* node)
     return;
 
 #if SACN_DYNAMIC_MEM
-  free(node);
+  SACN_FREE(node);
 #else
   etcpal_mempool_free(sacn_pool_recv_rb_nodes, node);
 #endif
@@ -418,6 +532,10 @@ etcpal_error_t init_receivers(void)
     etcpal_rbtree_init(&receivers, receiver_compare, receiver_node_alloc, receiver_node_dealloc);
     etcpal_rbtree_init(&receivers_by_universe, receiver_compare_by_universe, receiver_node_alloc,
                        receiver_node_dealloc);
+    memset(subscribed_universes, 0, sizeof(subscribed_universes));
+#if SACN_RECEIVER_MAX_THREADS > 1
+    memset(universe_threads, UNIVERSE_THREAD_NONE, sizeof(universe_threads));
+#endif
   }
 
   return res;
@@ -427,6 +545,25 @@ void deinit_receivers(void)
 {
   etcpal_rbtree_clear_with_cb(&receivers, universe_tree_dealloc);
   etcpal_rbtree_clear(&receivers_by_universe);
+  memset(subscribed_universes, 0, sizeof(subscribed_universes));
+#if SACN_RECEIVER_MAX_THREADS > 1
+  memset(universe_threads, UNIVERSE_THREAD_NONE, sizeof(universe_threads));
+#endif
+}
+
+// Needs lock
+void add_receiver_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  ADD_OBJECT_STATS(stats, etcpal_rbtree_size(&receivers), SacnReceiver);
+  ADD_RB_NODE_STATS(stats, etcpal_rbtree_size(&receivers) + etcpal_rbtree_size(&receivers_by_universe));
+#else
+  ADD_POOL_STATS(stats, sacn_pool_recv_receivers, SacnReceiver);
+  ADD_RB_NODE_POOL_STATS(stats, sacn_pool_recv_rb_nodes);
+#endif
 }
 
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
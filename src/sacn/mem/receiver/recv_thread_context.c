@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -50,6 +52,10 @@ static etcpal_error_t init_recv_thread_context_entry(SacnRecvThreadContext* cont
 // Dynamic memory deinitialization
 static void deinit_recv_thread_context_entry(SacnRecvThreadContext* context);
 
+#if SACN_DYNAMIC_MEM
+static size_t get_reserved_socket_count(const SacnReserveConfig* reserve);
+#endif
+
 // Utilities
 bool remove_socket_group_req(SocketGroupReq* reqs, size_t* num_reqs, etcpal_socket_t sock, const EtcPalGroupReq* group);
 
@@ -345,7 +351,7 @@ etcpal_error_t init_recv_thread_context_buf(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  sacn_pool_recv_thread_context = calloc(num_threads, sizeof(SacnRecvThreadContext));
+  sacn_pool_recv_thread_context = SACN_CALLOC(num_threads, sizeof(SacnRecvThreadContext));
   if (!sacn_pool_recv_thread_context)
     return kEtcPalErrNoMem;
 #else   // SACN_DYNAMIC_MEM
@@ -363,6 +369,26 @@ etcpal_error_t init_recv_thread_context_buf(unsigned int num_threads)
   return kEtcPalErrOk;
 }
 
+#if SACN_DYNAMIC_MEM
+/*
+ * The number of sockets a thread needs if all of the reserved receivers end up on it. Like
+ * SACN_RECEIVER_MAX_SOCKET_REFS, each socket is shared by up to SACN_RECEIVER_MAX_SUBS_PER_SOCKET receivers, and there
+ * is one for each IP type (and network interface, if SACN_RECEIVER_SOCKET_PER_NIC is enabled).
+ */
+size_t get_reserved_socket_count(const SacnReserveConfig* reserve)
+{
+  if (reserve->receivers == 0)
+    return 0;
+
+  size_t sockets = (((reserve->receivers - 1) / SACN_RECEIVER_MAX_SUBS_PER_SOCKET) + 1) * 2;
+#if SACN_RECEIVER_SOCKET_PER_NIC
+  if (reserve->netints > 0)
+    sockets *= reserve->netints;
+#endif
+  return sockets;
+}
+#endif  // SACN_DYNAMIC_MEM
+
 etcpal_error_t init_recv_thread_context_entry(SacnRecvThreadContext* context, sacn_thread_id_t thread_id)
 {
   if (!SACN_ASSERT_VERIFY(context))
@@ -371,25 +397,30 @@ etcpal_error_t init_recv_thread_context_entry(SacnRecvThreadContext* context, sa
   context->thread_id = thread_id;
 
 #if SACN_DYNAMIC_MEM
-  context->dead_sockets = calloc(kSacnInitialCapacity, sizeof(ReceiveSocket));
+  const SacnReserveConfig* reserve             = sacn_mem_get_reservation();
+  size_t                   sockets_capacity    = sacn_mem_reserved_capacity(get_reserved_socket_count(reserve));
+  size_t                   subscribes_capacity = sacn_mem_reserved_capacity(reserve->receivers * reserve->netints);
+
+  // Every socket the thread has open can be closed at once, so the dead sockets need as much room as the sockets.
+  context->dead_sockets = SACN_CALLOC(sockets_capacity, sizeof(ReceiveSocket));
   if (!context->dead_sockets)
     return kEtcPalErrNoMem;
-  context->dead_sockets_capacity = kSacnInitialCapacity;
+  context->dead_sockets_capacity = sockets_capacity;
 
-  context->socket_refs = calloc(kSacnInitialCapacity, sizeof(SocketRef));
+  context->socket_refs = SACN_CALLOC(sockets_capacity, sizeof(SocketRef));
   if (!context->socket_refs)
     return kEtcPalErrNoMem;
-  context->socket_refs_capacity = kSacnInitialCapacity;
+  context->socket_refs_capacity = sockets_capacity;
 
-  context->subscribes = calloc(kSacnInitialCapacity, sizeof(SocketGroupReq));
+  context->subscribes = SACN_CALLOC(subscribes_capacity, sizeof(SocketGroupReq));
   if (!context->subscribes)
     return kEtcPalErrNoMem;
-  context->subscribes_capacity = kSacnInitialCapacity;
+  context->subscribes_capacity = subscribes_capacity;
 
-  context->unsubscribes = calloc(kSacnInitialCapacity, sizeof(SocketGroupReq));
+  context->unsubscribes = SACN_CALLOC(subscribes_capacity, sizeof(SocketGroupReq));
   if (!context->unsubscribes)
     return kEtcPalErrNoMem;
-  context->unsubscribes_capacity = kSacnInitialCapacity;
+  context->unsubscribes_capacity = subscribes_capacity;
 #endif
 
   context->num_dead_sockets = 0;
@@ -403,12 +434,38 @@ etcpal_error_t init_recv_thread_context_entry(SacnRecvThreadContext* context, sa
   context->ipv6_bound = false;
 #endif
 
+#if SACN_RECEIVER_ENABLE_BPF_FILTER
+  context->socket_filter_dirty = false;
+#endif
+
   context->source_detector = NULL;
 
+  context->wakeup_socket  = ETCPAL_SOCKET_INVALID;
+  context->wakeup_pending = false;
+  memset(&context->wakeup_addr, 0, sizeof(context->wakeup_addr));
+
   etcpal_signal_create(&context->deinit_signal);
   context->running                  = false;
   context->poll_context_initialized = false;
+#if SACN_RECEIVER_USE_IO_URING
+  context->uring_initialized = false;
+#endif
+#if SACN_RECEIVER_USE_PACKET_RING
+  context->packet_ring_initialized = false;
+#endif
+#if SACN_RECEIVER_USE_UDP_GRO
+  memset(&context->gro_batch, 0, sizeof(context->gro_batch));
+#endif
   context->periodic_timer_started   = false;
+  context->num_discarded_packets    = 0;
+  context->load_timer_started       = false;
+  context->pending_load_universe    = 0;
+  context->pending_load_us          = 0;
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+  context->pending_latency_source = kSacnRemoteSourceInvalid;
+  context->pending_latency_ns     = 0;
+#endif
+  memset(&context->load, 0, sizeof(context->load));
 
   return kEtcPalErrOk;
 }
@@ -423,7 +480,7 @@ void deinit_recv_thread_context_buf(void)
       deinit_recv_thread_context_entry(&sacn_pool_recv_thread_context[i]);
 
 #if SACN_DYNAMIC_MEM
-    free(sacn_pool_recv_thread_context);
+    SACN_FREE(sacn_pool_recv_thread_context);
     sacn_pool_recv_thread_context = NULL;
 #endif
   }
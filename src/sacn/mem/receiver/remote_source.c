@@ -21,68 +21,79 @@
 
 #include <stddef.h>
 #include "etcpal/common.h"
-#include "etcpal/handle_manager.h"
 #include "etcpal/rbtree.h"
 #include "sacn/private/common.h"
 #include "sacn/opts.h"
 #include "sacn/private/util.h"
+#include "sacn/private/mem/common.h"
+#include "sacn/private/mem/handle_table.h"
+#include "sacn/private/mem/slab.h"
 
-#if SACN_DYNAMIC_MEM
-#include <stdlib.h>
-#else
+#if !SACN_DYNAMIC_MEM
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private constants ******************************/
 
-#define SACN_REMOTE_SOURCES_MAX_RB_NODES ((SACN_RECEIVER_TOTAL_MAX_SOURCES + SACN_SOURCE_DETECTOR_MAX_SOURCES) * 2)
+#define SACN_REMOTE_SOURCES_MAX (SACN_RECEIVER_TOTAL_MAX_SOURCES + SACN_SOURCE_DETECTOR_MAX_SOURCES)
+
+/*
+ * In static memory mode, the most remote sources that can have handles at once. In dynamic memory mode, the size of the
+ * first band of handle slots, whose 31 generations cover half of the 16-bit handle space. Bands of 2048 and 4096 slots
+ * (8 and 2 generations) are added if more sources appear at once, and then a last band of 9215 slots with one
+ * generation each, for at most 16383.
+ */
+#if SACN_DYNAMIC_MEM
+#define SACN_REMOTE_SOURCE_HANDLE_SLOTS 1024
+#else
+#define SACN_REMOTE_SOURCE_HANDLE_SLOTS SACN_REMOTE_SOURCES_MAX
+#endif
+
+/*
+ * How many freed handles must be waiting before the oldest is reissued, so that a source that drops out and comes
+ * back gets a handle its old one can't be confused with.
+ */
+#define SACN_REMOTE_SOURCE_HANDLE_MIN_FREE 256
 
 /****************************** Private macros *******************************/
 
 #if SACN_DYNAMIC_MEM
 
-/* Macros for dynamic allocation. */
-#define ALLOC_REMOTE_SOURCE_HANDLE()   malloc(sizeof(SacnRemoteSourceHandle))
-#define ALLOC_REMOTE_SOURCE_CID()      malloc(sizeof(SacnRemoteSourceCid))
-#define FREE_REMOTE_SOURCE_HANDLE(ptr) free(ptr)
-#define FREE_REMOTE_SOURCE_CID(ptr)    free(ptr)
+/* Macros for dynamic allocation, which is done using per-type slabs. */
+#define ALLOC_REMOTE_SOURCE_HANDLE()   sacn_slab_alloc(&remote_source_handle_slab)
+#define FREE_REMOTE_SOURCE_HANDLE(ptr) sacn_slab_free(&remote_source_handle_slab, ptr)
 
 #else  // SACN_DYNAMIC_MEM
 
 /* Macros for static allocation, which is done using etcpal_mempool. */
 #define ALLOC_REMOTE_SOURCE_HANDLE()   etcpal_mempool_alloc(sacn_pool_recv_remote_source_handles)
-#define ALLOC_REMOTE_SOURCE_CID()      etcpal_mempool_alloc(sacn_pool_recv_remote_source_cids)
 #define FREE_REMOTE_SOURCE_HANDLE(ptr) etcpal_mempool_free(sacn_pool_recv_remote_source_handles, ptr)
-#define FREE_REMOTE_SOURCE_CID(ptr)    etcpal_mempool_free(sacn_pool_recv_remote_source_cids, ptr)
 
 #endif  // SACN_DYNAMIC_MEM
 
 /**************************** Private variables ******************************/
 
-#if !SACN_DYNAMIC_MEM
-ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_remote_source_handles,
-                      SacnRemoteSourceHandle,
-                      SACN_RECEIVER_TOTAL_MAX_SOURCES + SACN_SOURCE_DETECTOR_MAX_SOURCES);
-ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_remote_source_cids,
-                      SacnRemoteSourceCid,
-                      SACN_RECEIVER_TOTAL_MAX_SOURCES + SACN_SOURCE_DETECTOR_MAX_SOURCES);
-ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_remote_source_rb_nodes, EtcPalRbNode, SACN_REMOTE_SOURCES_MAX_RB_NODES);
-#endif  // !SACN_DYNAMIC_MEM
-
-static EtcPalRbTree remote_source_handles;
-static EtcPalRbTree remote_source_cids;
+#if SACN_DYNAMIC_MEM
+static SacnSlab remote_source_handle_slab;
+static SacnSlab remote_source_rb_node_slab;
+#else  // SACN_DYNAMIC_MEM
+ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_remote_source_handles, SacnRemoteSourceHandle, SACN_REMOTE_SOURCES_MAX);
+ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_remote_source_rb_nodes, EtcPalRbNode, SACN_REMOTE_SOURCES_MAX);
+static SacnHandleSlot remote_source_handle_slots[SACN_REMOTE_SOURCE_HANDLE_SLOTS];
+#endif  // SACN_DYNAMIC_MEM
 
-static IntHandleManager remote_source_handle_manager;
+static EtcPalRbTree    remote_source_handles;  // By CID
+static SacnHandleTable remote_source_table;    // By handle
 
 /*********************** Private function prototypes *************************/
 
-static int  uuid_compare(const EtcPalRbTree* tree, const void* value_a, const void* value_b);
-static bool remote_source_handle_in_use(int handle_val, void* cookie);
+static int uuid_compare(const EtcPalRbTree* tree, const void* value_a, const void* value_b);
 
 static void          remote_source_handle_tree_dealloc(const EtcPalRbTree* self, EtcPalRbNode* node);
-static void          remote_source_cid_tree_dealloc(const EtcPalRbTree* self, EtcPalRbNode* node);
 static EtcPalRbNode* remote_source_node_alloc(void);
 static void          remote_source_node_dealloc(EtcPalRbNode* node);
 
@@ -92,21 +103,31 @@ etcpal_error_t init_remote_sources(void)
 {
   etcpal_error_t res = kEtcPalErrOk;
 
-  init_int_handle_manager(&remote_source_handle_manager, kSacnMaxValidSourceHandleValue, remote_source_handle_in_use,
-                          NULL);
-
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+  sacn_slab_init(&remote_source_handle_slab, SACN_ALLOC_MODULE, sizeof(SacnRemoteSourceHandle),
+                 SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  sacn_slab_init(&remote_source_rb_node_slab, SACN_ALLOC_MODULE, sizeof(EtcPalRbNode), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  sacn_handle_table_init(&remote_source_table, SACN_ALLOC_MODULE, NULL, SACN_REMOTE_SOURCE_HANDLE_SLOTS,
+                         kSacnMaxValidSourceHandleValue, SACN_REMOTE_SOURCE_HANDLE_MIN_FREE);
+
+  const SacnReserveConfig* reserved = sacn_mem_get_reservation();
+  size_t reserved_sources           = reserved->receivers * reserved->sources_per_universe;
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&remote_source_handle_slab, reserved_sources);
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&remote_source_rb_node_slab, reserved_sources);
+  if (res == kEtcPalErrOk)
+    res = sacn_handle_table_reserve(&remote_source_table, reserved_sources);
+#else  // SACN_DYNAMIC_MEM
   res |= etcpal_mempool_init(sacn_pool_recv_remote_source_handles);
-  res |= etcpal_mempool_init(sacn_pool_recv_remote_source_cids);
   res |= etcpal_mempool_init(sacn_pool_recv_remote_source_rb_nodes);
-#endif  // !SACN_DYNAMIC_MEM
+  sacn_handle_table_init(&remote_source_table, SACN_ALLOC_MODULE, remote_source_handle_slots,
+                         SACN_REMOTE_SOURCE_HANDLE_SLOTS, kSacnMaxValidSourceHandleValue,
+                         SACN_REMOTE_SOURCE_HANDLE_MIN_FREE);
+#endif  // SACN_DYNAMIC_MEM
 
   if (res == kEtcPalErrOk)
-  {
     etcpal_rbtree_init(&remote_source_handles, uuid_compare, remote_source_node_alloc, remote_source_node_dealloc);
-    etcpal_rbtree_init(&remote_source_cids, remote_source_compare, remote_source_node_alloc,
-                       remote_source_node_dealloc);
-  }
 
   return res;
 }
@@ -114,7 +135,28 @@ etcpal_error_t init_remote_sources(void)
 void deinit_remote_sources(void)
 {
   etcpal_rbtree_clear_with_cb(&remote_source_handles, remote_source_handle_tree_dealloc);
-  etcpal_rbtree_clear_with_cb(&remote_source_cids, remote_source_cid_tree_dealloc);
+  sacn_handle_table_deinit(&remote_source_table);
+
+#if SACN_DYNAMIC_MEM
+  sacn_slab_deinit(&remote_source_rb_node_slab);
+  sacn_slab_deinit(&remote_source_handle_slab);
+#endif
+}
+
+// Needs lock
+void add_remote_source_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  ADD_POOL_STATS(stats, remote_source_handle_slab, SacnRemoteSourceHandle);
+  ADD_RB_NODE_POOL_STATS(stats, remote_source_rb_node_slab);
+#else
+  ADD_POOL_STATS(stats, sacn_pool_recv_remote_source_handles, SacnRemoteSourceHandle);
+  ADD_RB_NODE_POOL_STATS(stats, sacn_pool_recv_remote_source_rb_nodes);
+#endif
+  stats->bytes_allocated += remote_source_table.capacity * sizeof(SacnHandleSlot);
 }
 
 etcpal_error_t add_remote_source_handle(const EtcPalUuid* cid, sacn_remote_source_t* handle)
@@ -128,52 +170,35 @@ etcpal_error_t add_remote_source_handle(const EtcPalUuid* cid, sacn_remote_sourc
 
   if (existing_handle)
   {
-    SacnRemoteSourceCid* existing_cid =
-        (SacnRemoteSourceCid*)etcpal_rbtree_find(&remote_source_cids, &existing_handle->handle);
-    if (SACN_ASSERT_VERIFY(existing_cid))
-      ++existing_cid->refcount;
-    else
-      result = kEtcPalErrSys;
-
+    ++existing_handle->refcount;
     *handle = existing_handle->handle;
   }
   else
   {
     SacnRemoteSourceHandle* new_handle = ALLOC_REMOTE_SOURCE_HANDLE();
-    SacnRemoteSourceCid*    new_cid    = ALLOC_REMOTE_SOURCE_CID();
+    int                     handle_val = -1;
 
-    if (new_handle && new_cid)
+    if (new_handle)
+      result = sacn_handle_table_add(&remote_source_table, new_handle, &handle_val);
+    else
+      result = kEtcPalErrNoMem;
+
+    if (result == kEtcPalErrOk)
     {
-      new_handle->cid    = *cid;
-      new_handle->handle = (sacn_remote_source_t)get_next_int_handle(&remote_source_handle_manager);
-      new_cid->handle    = new_handle->handle;
-      new_cid->cid       = new_handle->cid;
-      new_cid->refcount  = 1;
+      new_handle->cid      = *cid;
+      new_handle->handle   = (sacn_remote_source_t)handle_val;
+      new_handle->refcount = 1;
 
       result = etcpal_rbtree_insert(&remote_source_handles, new_handle);
 
-      if (result == kEtcPalErrOk)
-        result = etcpal_rbtree_insert(&remote_source_cids, new_cid);
-
       if (result == kEtcPalErrOk)
         *handle = new_handle->handle;
-    }
-    else
-    {
-      result = kEtcPalErrNoMem;
+      else
+        sacn_handle_table_remove(&remote_source_table, handle_val);
     }
 
-    if (result != kEtcPalErrOk)
-    {
-      if (new_handle)
-      {
-        etcpal_rbtree_remove(&remote_source_handles, new_handle);
-        FREE_REMOTE_SOURCE_HANDLE(new_handle);
-      }
-
-      if (new_cid)
-        FREE_REMOTE_SOURCE_CID(new_cid);
-    }
+    if ((result != kEtcPalErrOk) && new_handle)
+      FREE_REMOTE_SOURCE_HANDLE(new_handle);
   }
 
   return result;
@@ -201,10 +226,10 @@ const EtcPalUuid* get_remote_source_cid(sacn_remote_source_t handle)
 
   const EtcPalUuid* result = NULL;
 
-  SacnRemoteSourceCid* tree_result = (SacnRemoteSourceCid*)etcpal_rbtree_find(&remote_source_cids, &handle);
+  SacnRemoteSourceHandle* table_result = (SacnRemoteSourceHandle*)sacn_handle_table_get(&remote_source_table, handle);
 
-  if (tree_result)
-    result = &tree_result->cid;
+  if (table_result)
+    result = &table_result->cid;
 
   return result;
 }
@@ -214,33 +239,30 @@ etcpal_error_t remove_remote_source_handle(sacn_remote_source_t handle)
   if (!SACN_ASSERT_VERIFY(handle != kSacnRemoteSourceInvalid))
     return kEtcPalErrSys;
 
-  etcpal_error_t handle_result = kEtcPalErrOk;
-  etcpal_error_t cid_result    = kEtcPalErrOk;
+  etcpal_error_t result = kEtcPalErrOk;
 
-  SacnRemoteSourceCid* existing_cid = (SacnRemoteSourceCid*)etcpal_rbtree_find(&remote_source_cids, &handle);
+  SacnRemoteSourceHandle* existing_handle =
+      (SacnRemoteSourceHandle*)sacn_handle_table_get(&remote_source_table, handle);
 
-  if (existing_cid)
+  if (existing_handle)
   {
-    if (existing_cid->refcount <= 1)
+    if (existing_handle->refcount <= 1)
     {
-      handle_result =
-          etcpal_rbtree_remove_with_cb(&remote_source_handles, &existing_cid->cid, remote_source_handle_tree_dealloc);
-      cid_result = etcpal_rbtree_remove_with_cb(&remote_source_cids, &handle, remote_source_cid_tree_dealloc);
+      sacn_handle_table_remove(&remote_source_table, handle);
+      result = etcpal_rbtree_remove_with_cb(&remote_source_handles, &existing_handle->cid,
+                                            remote_source_handle_tree_dealloc);
     }
     else
     {
-      --existing_cid->refcount;
+      --existing_handle->refcount;
     }
   }
   else
   {
-    cid_result = kEtcPalErrNotFound;
+    result = kEtcPalErrNotFound;
   }
 
-  if (handle_result != kEtcPalErrOk)
-    return handle_result;
-
-  return cid_result;
+  return result;
 }
 
 int remote_source_compare(const EtcPalRbTree* tree, const void* value_a, const void* value_b)
@@ -267,12 +289,6 @@ int uuid_compare(const EtcPalRbTree* tree, const void* value_a, const void* valu
   return ETCPAL_UUID_CMP(lhs, rhs);
 }
 
-bool remote_source_handle_in_use(int handle_val, void* cookie)
-{
-  ETCPAL_UNUSED_ARG(cookie);
-  return (get_remote_source_cid((sacn_remote_source_t)handle_val) != NULL);
-}
-
 /* Helper function for clearing an EtcPalRbTree containing remote source handles. */
 void remote_source_handle_tree_dealloc(const EtcPalRbTree* self, EtcPalRbNode* node)
 {
@@ -285,22 +301,10 @@ void remote_source_handle_tree_dealloc(const EtcPalRbTree* self, EtcPalRbNode* n
   remote_source_node_dealloc(node);
 }
 
-/* Helper function for clearing an EtcPalRbTree containing remote source CIDs. */
-void remote_source_cid_tree_dealloc(const EtcPalRbTree* self, EtcPalRbNode* node)
-{
-  ETCPAL_UNUSED_ARG(self);
-
-  if (!SACN_ASSERT_VERIFY(node))
-    return;
-
-  FREE_REMOTE_SOURCE_CID(node->value);
-  remote_source_node_dealloc(node);
-}
-
 EtcPalRbNode* remote_source_node_alloc(void)
 {
 #if SACN_DYNAMIC_MEM
-  return (EtcPalRbNode*)malloc(sizeof(EtcPalRbNode));
+  return (EtcPalRbNode*)sacn_slab_alloc(&remote_source_rb_node_slab);
 #else
   return etcpal_mempool_alloc(sacn_pool_recv_remote_source_rb_nodes);
 #endif
@@ -312,7 +316,7 @@ void remote_source_node_dealloc(EtcPalRbNode* node)
     return;
 
 #if SACN_DYNAMIC_MEM
-  free(node);
+  sacn_slab_free(&remote_source_rb_node_slab, node);
 #else
   etcpal_mempool_free(sacn_pool_recv_remote_source_rb_nodes, node);
 #endif
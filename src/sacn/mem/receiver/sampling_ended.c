@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /****************************** Private types ********************************/
@@ -98,7 +100,7 @@ etcpal_error_t init_sampling_ended_bufs(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  sacn_pool_sampling_ended = calloc(num_threads, sizeof(SamplingEndedNotificationBuf));
+  sacn_pool_sampling_ended = SACN_CALLOC(num_threads, sizeof(SamplingEndedNotificationBuf));
   if (!sacn_pool_sampling_ended)
     return kEtcPalErrNoMem;
 
@@ -122,11 +124,13 @@ etcpal_error_t init_sampling_ended_buf(SamplingEndedNotificationBuf* sampling_en
   if (!SACN_ASSERT_VERIFY(sampling_ended_buf))
     return kEtcPalErrSys;
 
-  sampling_ended_buf->buf = calloc(kSacnInitialCapacity, sizeof(SamplingEndedNotification));
+  size_t capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->receivers);
+
+  sampling_ended_buf->buf = SACN_CALLOC(capacity, sizeof(SamplingEndedNotification));
   if (!sampling_ended_buf->buf)
     return kEtcPalErrNoMem;
 
-  sampling_ended_buf->buf_capacity = kSacnInitialCapacity;
+  sampling_ended_buf->buf_capacity = capacity;
   return kEtcPalErrOk;
 }
 
@@ -136,7 +140,7 @@ void deinit_sampling_ended_bufs(void)
   {
     for (unsigned int i = 0; i < sacn_mem_get_num_threads(); ++i)
       deinit_sampling_ended_buf(&sacn_pool_sampling_ended[i]);
-    free(sacn_pool_sampling_ended);
+    SACN_FREE(sacn_pool_sampling_ended);
     sacn_pool_sampling_ended = NULL;
   }
 }
@@ -147,9 +151,26 @@ void deinit_sampling_ended_buf(SamplingEndedNotificationBuf* sampling_ended_buf)
     return;
 
   if (sampling_ended_buf->buf)
-    free(sampling_ended_buf->buf);
+    SACN_FREE(sampling_ended_buf->buf);
 }
 
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's sampling period ended notifications, or 0 if the thread ID was invalid.
+ */
+// Needs lock
+size_t get_sampling_ended_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!sacn_pool_sampling_ended || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  const SamplingEndedNotificationBuf* notifications = &sacn_pool_sampling_ended[thread_id];
+  return sizeof(SamplingEndedNotificationBuf) + (notifications->buf_capacity * sizeof(SamplingEndedNotification));
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(SamplingEndedNotificationBuf) : 0;
+#endif
+}
+
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
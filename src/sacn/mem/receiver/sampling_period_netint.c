@@ -25,13 +25,14 @@
 #include "sacn/private/common.h"
 #include "sacn/opts.h"
 #include "sacn/private/mem/common.h"
+#include "sacn/private/mem/slab.h"
 
-#if SACN_DYNAMIC_MEM
-#include <stdlib.h>
-#else
+#if !SACN_DYNAMIC_MEM
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private constants ******************************/
@@ -44,9 +45,9 @@
 
 #if SACN_DYNAMIC_MEM
 
-/* Macros for dynamic allocation. */
-#define ALLOC_SAMPLING_PERIOD_NETINT()   malloc(sizeof(SacnSamplingPeriodNetint))
-#define FREE_SAMPLING_PERIOD_NETINT(ptr) free(ptr)
+/* Macros for dynamic allocation, which is done using per-type slabs. */
+#define ALLOC_SAMPLING_PERIOD_NETINT()   sacn_slab_alloc(&sampling_period_netint_slab)
+#define FREE_SAMPLING_PERIOD_NETINT(ptr) sacn_slab_free(&sampling_period_netint_slab, ptr)
 
 #else  // SACN_DYNAMIC_MEM
 
@@ -58,14 +59,17 @@
 
 /**************************** Private variables ******************************/
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+static SacnSlab sampling_period_netint_slab;
+static SacnSlab sampling_period_netint_rb_node_slab;
+#else  // SACN_DYNAMIC_MEM
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_sampling_period_netints,
                       SacnSamplingPeriodNetint,
                       SACN_MAX_SAMPLING_PERIOD_NETINTS);
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_sampling_period_netint_rb_nodes,
                       EtcPalRbNode,
                       SACN_MAX_SAMPLING_PERIOD_NETINT_RB_NODES);
-#endif  // !SACN_DYNAMIC_MEM
+#endif  // SACN_DYNAMIC_MEM
 
 /*************************** Function definitions ****************************/
 
@@ -73,14 +77,49 @@ etcpal_error_t init_sampling_period_netints(void)
 {
   etcpal_error_t res = kEtcPalErrOk;
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+  sacn_slab_init(&sampling_period_netint_slab, SACN_ALLOC_MODULE, sizeof(SacnSamplingPeriodNetint),
+                 SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  sacn_slab_init(&sampling_period_netint_rb_node_slab, SACN_ALLOC_MODULE, sizeof(EtcPalRbNode),
+                 SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+
+  const SacnReserveConfig* reserved = sacn_mem_get_reservation();
+  size_t reserved_netints           = reserved->receivers * reserved->netints;
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&sampling_period_netint_slab, reserved_netints);
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&sampling_period_netint_rb_node_slab, reserved_netints);
+#else  // SACN_DYNAMIC_MEM
   res |= etcpal_mempool_init(sacn_pool_recv_sampling_period_netints);
   res |= etcpal_mempool_init(sacn_pool_recv_sampling_period_netint_rb_nodes);
-#endif  // !SACN_DYNAMIC_MEM
+#endif  // SACN_DYNAMIC_MEM
 
   return res;
 }
 
+void deinit_sampling_period_netints(void)
+{
+#if SACN_DYNAMIC_MEM
+  sacn_slab_deinit(&sampling_period_netint_rb_node_slab);
+  sacn_slab_deinit(&sampling_period_netint_slab);
+#endif
+}
+
+// Needs lock
+void add_sampling_period_netint_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  ADD_POOL_STATS(stats, sampling_period_netint_slab, SacnSamplingPeriodNetint);
+  ADD_RB_NODE_POOL_STATS(stats, sampling_period_netint_rb_node_slab);
+#else
+  ADD_POOL_STATS(stats, sacn_pool_recv_sampling_period_netints, SacnSamplingPeriodNetint);
+  ADD_RB_NODE_POOL_STATS(stats, sacn_pool_recv_sampling_period_netint_rb_nodes);
+#endif
+}
+
 etcpal_error_t add_sacn_sampling_period_netint(EtcPalRbTree*              tree,
                                                const EtcPalMcastNetintId* netint_id,
                                                bool                       in_future_sampling_period)
@@ -189,7 +228,7 @@ void sampling_period_netint_node_dealloc(EtcPalRbNode* node)
     return;
 
 #if SACN_DYNAMIC_MEM
-  free(node);
+  sacn_slab_free(&sampling_period_netint_rb_node_slab, node);
 #else
   etcpal_mempool_free(sacn_pool_recv_sampling_period_netint_rb_nodes, node);
 #endif
@@ -198,7 +237,7 @@ void sampling_period_netint_node_dealloc(EtcPalRbNode* node)
 EtcPalRbNode* sampling_period_netint_node_alloc(void)
 {
 #if SACN_DYNAMIC_MEM
-  return (EtcPalRbNode*)malloc(sizeof(EtcPalRbNode));
+  return (EtcPalRbNode*)sacn_slab_alloc(&sampling_period_netint_rb_node_slab);
 #else
   return etcpal_mempool_alloc(sacn_pool_recv_sampling_period_netint_rb_nodes);
 #endif
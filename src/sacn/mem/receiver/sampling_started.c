@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /****************************** Private types ********************************/
@@ -98,7 +100,7 @@ etcpal_error_t init_sampling_started_bufs(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  sacn_pool_sampling_started = calloc(num_threads, sizeof(SamplingStartedNotificationBuf));
+  sacn_pool_sampling_started = SACN_CALLOC(num_threads, sizeof(SamplingStartedNotificationBuf));
   if (!sacn_pool_sampling_started)
     return kEtcPalErrNoMem;
 
@@ -122,11 +124,13 @@ etcpal_error_t init_sampling_started_buf(SamplingStartedNotificationBuf* samplin
   if (!SACN_ASSERT_VERIFY(sampling_started_buf))
     return kEtcPalErrSys;
 
-  sampling_started_buf->buf = calloc(kSacnInitialCapacity, sizeof(SamplingStartedNotification));
+  size_t capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->receivers);
+
+  sampling_started_buf->buf = SACN_CALLOC(capacity, sizeof(SamplingStartedNotification));
   if (!sampling_started_buf->buf)
     return kEtcPalErrNoMem;
 
-  sampling_started_buf->buf_capacity = kSacnInitialCapacity;
+  sampling_started_buf->buf_capacity = capacity;
   return kEtcPalErrOk;
 }
 
@@ -136,7 +140,7 @@ void deinit_sampling_started_bufs(void)
   {
     for (unsigned int i = 0; i < sacn_mem_get_num_threads(); ++i)
       deinit_sampling_started_buf(&sacn_pool_sampling_started[i]);
-    free(sacn_pool_sampling_started);
+    SACN_FREE(sacn_pool_sampling_started);
     sacn_pool_sampling_started = NULL;
   }
 }
@@ -147,9 +151,26 @@ void deinit_sampling_started_buf(SamplingStartedNotificationBuf* sampling_starte
     return;
 
   if (sampling_started_buf->buf)
-    free(sampling_started_buf->buf);
+    SACN_FREE(sampling_started_buf->buf);
 }
 
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's sampling period started notifications, or 0 if the thread ID was invalid.
+ */
+// Needs lock
+size_t get_sampling_started_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!sacn_pool_sampling_started || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  const SamplingStartedNotificationBuf* notifications = &sacn_pool_sampling_started[thread_id];
+  return sizeof(SamplingStartedNotificationBuf) + (notifications->buf_capacity * sizeof(SamplingStartedNotification));
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(SamplingStartedNotificationBuf) : 0;
+#endif
+}
+
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
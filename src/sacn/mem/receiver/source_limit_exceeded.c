@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -72,7 +74,7 @@ etcpal_error_t init_source_limit_exceeded_buf(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  source_limit_exceeded = calloc(num_threads, sizeof(SourceLimitExceededNotification));
+  source_limit_exceeded = SACN_CALLOC(num_threads, sizeof(SourceLimitExceededNotification));
   if (!source_limit_exceeded)
     return kEtcPalErrNoMem;
 #else   // SACN_DYNAMIC_MEM
@@ -88,11 +90,27 @@ void deinit_source_limit_exceeded_buf(void)
 {
   if (source_limit_exceeded)
   {
-    free(source_limit_exceeded);
+    SACN_FREE(source_limit_exceeded);
     source_limit_exceeded = NULL;
   }
 }
 
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's source limit exceeded notification, or 0 if the thread ID was invalid.
+ */
+// Needs lock
+size_t get_source_limit_exceeded_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!source_limit_exceeded || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  return sizeof(SourceLimitExceededNotification);
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(SourceLimitExceededNotification) : 0;
+#endif
+}
+
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -73,7 +75,7 @@ etcpal_error_t init_source_pap_lost_buf(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  sacn_pool_source_pap_lost = calloc(num_threads, sizeof(SourcePapLostNotification));
+  sacn_pool_source_pap_lost = SACN_CALLOC(num_threads, sizeof(SourcePapLostNotification));
   if (!sacn_pool_source_pap_lost)
     return kEtcPalErrNoMem;
 #else   // SACN_DYNAMIC_MEM
@@ -89,11 +91,27 @@ void deinit_source_pap_lost_buf(void)
 {
   if (sacn_pool_source_pap_lost)
   {
-    free(sacn_pool_source_pap_lost);
+    SACN_FREE(sacn_pool_source_pap_lost);
     sacn_pool_source_pap_lost = NULL;
   }
 }
 
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's source PAP lost notification, or 0 if the thread ID was invalid.
+ */
+// Needs lock
+size_t get_source_pap_lost_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!sacn_pool_source_pap_lost || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  return sizeof(SourcePapLostNotification);
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(SourcePapLostNotification) : 0;
+#endif
+}
+
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
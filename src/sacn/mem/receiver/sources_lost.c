@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /****************************** Private types ********************************/
@@ -160,7 +162,7 @@ etcpal_error_t init_sources_lost_bufs(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  sacn_pool_sources_lost = calloc(num_threads, sizeof(SourcesLostNotificationBuf));
+  sacn_pool_sources_lost = SACN_CALLOC(num_threads, sizeof(SourcesLostNotificationBuf));
   if (!sacn_pool_sources_lost)
     return kEtcPalErrNoMem;
 
@@ -184,12 +186,14 @@ etcpal_error_t init_sources_lost_buf(SourcesLostNotificationBuf* sources_lost_bu
   if (!SACN_ASSERT_VERIFY(sources_lost_buf))
     return kEtcPalErrSys;
 
-  sources_lost_buf->buf = calloc(kSacnInitialCapacity, sizeof(SourcesLostNotification));
+  size_t capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->receivers);
+
+  sources_lost_buf->buf = SACN_CALLOC(capacity, sizeof(SourcesLostNotification));
   if (!sources_lost_buf->buf)
     return kEtcPalErrNoMem;
 
-  sources_lost_buf->buf_capacity = kSacnInitialCapacity;
-  return init_sources_lost_array(sources_lost_buf->buf, kSacnInitialCapacity);
+  sources_lost_buf->buf_capacity = capacity;
+  return init_sources_lost_array(sources_lost_buf->buf, capacity);
 }
 
 etcpal_error_t init_sources_lost_array(SourcesLostNotification* sources_lost_arr, size_t size)
@@ -197,9 +201,11 @@ etcpal_error_t init_sources_lost_array(SourcesLostNotification* sources_lost_arr
   if (!SACN_ASSERT_VERIFY(sources_lost_arr))
     return kEtcPalErrSys;
 
+  size_t capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->sources_per_universe);
+
   for (SourcesLostNotification* notification = sources_lost_arr; notification < sources_lost_arr + size; ++notification)
   {
-    notification->lost_sources = calloc(kSacnInitialCapacity, sizeof(SacnLostSource));
+    notification->lost_sources = SACN_CALLOC(capacity, sizeof(SacnLostSource));
     if (!notification->lost_sources)
     {
       for (SourcesLostNotification* notif_to_clean = sources_lost_arr; notif_to_clean < notification; ++notif_to_clean)
@@ -207,7 +213,7 @@ etcpal_error_t init_sources_lost_array(SourcesLostNotification* sources_lost_arr
 
       return kEtcPalErrNoMem;
     }
-    notification->lost_sources_capacity = kSacnInitialCapacity;
+    notification->lost_sources_capacity = capacity;
   }
   return kEtcPalErrOk;
 }
@@ -218,7 +224,7 @@ void deinit_sources_lost_bufs(void)
   {
     for (unsigned int i = 0; i < sacn_mem_get_num_threads(); ++i)
       deinit_sources_lost_buf(&sacn_pool_sources_lost[i]);
-    free(sacn_pool_sources_lost);
+    SACN_FREE(sacn_pool_sources_lost);
     sacn_pool_sources_lost = NULL;
   }
 }
@@ -234,7 +240,7 @@ void deinit_sources_lost_buf(SourcesLostNotificationBuf* sources_lost_buf)
     {
       deinit_sources_lost_entry(&sources_lost_buf->buf[i]);
     }
-    free(sources_lost_buf->buf);
+    SACN_FREE(sources_lost_buf->buf);
   }
 }
 
@@ -248,4 +254,27 @@ void deinit_sources_lost_entry(SourcesLostNotification* notification)
 
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's sources lost notifications, including their lists of lost sources, or 0 if
+ * the thread ID was invalid.
+ */
+// Needs lock
+size_t get_sources_lost_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!sacn_pool_sources_lost || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  const SourcesLostNotificationBuf* notifications = &sacn_pool_sources_lost[thread_id];
+
+  size_t size = sizeof(SourcesLostNotificationBuf) + (notifications->buf_capacity * sizeof(SourcesLostNotification));
+  for (size_t i = 0; i < notifications->buf_capacity; ++i)
+    size += notifications->buf[i].lost_sources_capacity * sizeof(SacnLostSource);
+
+  return size;
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(SourcesLostNotificationBuf) : 0;
+#endif
+}
+
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -169,7 +171,7 @@ etcpal_error_t init_status_lists_buf(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  sacn_pool_status_lists = calloc(num_threads, sizeof(SacnSourceStatusLists));
+  sacn_pool_status_lists = SACN_CALLOC(num_threads, sizeof(SacnSourceStatusLists));
   if (!sacn_pool_status_lists)
     return kEtcPalErrNoMem;
 
@@ -195,26 +197,28 @@ etcpal_error_t init_status_lists_entry(SacnSourceStatusLists* lists)
 
   etcpal_error_t res = kEtcPalErrOk;
 
-  lists->offline = calloc(kSacnInitialCapacity, sizeof(SacnLostSourceInternal));
+  size_t capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->sources_per_universe);
+
+  lists->offline = SACN_CALLOC(capacity, sizeof(SacnLostSourceInternal));
   if (lists->offline)
-    lists->offline_capacity = kSacnInitialCapacity;
+    lists->offline_capacity = capacity;
   else
     res = kEtcPalErrNoMem;
 
   if (res == kEtcPalErrOk)
   {
-    lists->online = calloc(kSacnInitialCapacity, sizeof(SacnRemoteSourceInternal));
+    lists->online = SACN_CALLOC(capacity, sizeof(SacnRemoteSourceInternal));
     if (lists->online)
-      lists->online_capacity = kSacnInitialCapacity;
+      lists->online_capacity = capacity;
     else
       res = kEtcPalErrNoMem;
   }
 
   if (res == kEtcPalErrOk)
   {
-    lists->unknown = calloc(kSacnInitialCapacity, sizeof(SacnRemoteSourceInternal));
+    lists->unknown = SACN_CALLOC(capacity, sizeof(SacnRemoteSourceInternal));
     if (lists->unknown)
-      lists->unknown_capacity = kSacnInitialCapacity;
+      lists->unknown_capacity = capacity;
     else
       res = kEtcPalErrNoMem;
   }
@@ -228,7 +232,7 @@ void deinit_status_lists_buf(void)
   {
     for (unsigned int i = 0; i < sacn_mem_get_num_threads(); ++i)
       deinit_status_lists_entry(&sacn_pool_status_lists[i]);
-    free(sacn_pool_status_lists);
+    SACN_FREE(sacn_pool_status_lists);
     sacn_pool_status_lists = NULL;
   }
 }
@@ -245,4 +249,22 @@ void deinit_status_lists_entry(SacnSourceStatusLists* lists)
 
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's source status lists, or 0 if the thread ID was invalid.
+ */
+// Needs lock
+size_t get_status_lists_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!sacn_pool_status_lists || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  const SacnSourceStatusLists* lists = &sacn_pool_status_lists[thread_id];
+  return sizeof(SacnSourceStatusLists) + (lists->offline_capacity * sizeof(SacnLostSourceInternal)) +
+         ((lists->online_capacity + lists->unknown_capacity) * sizeof(SacnRemoteSourceInternal));
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(SacnSourceStatusLists) : 0;
+#endif
+}
+
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
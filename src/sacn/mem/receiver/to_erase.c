@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /****************************** Private types ********************************/
@@ -91,7 +93,7 @@ etcpal_error_t init_to_erase_bufs(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  to_erase = calloc(num_threads, sizeof(ToEraseBuf));
+  to_erase = SACN_CALLOC(num_threads, sizeof(ToEraseBuf));
   if (!to_erase)
     return kEtcPalErrNoMem;
 
@@ -115,11 +117,13 @@ etcpal_error_t init_to_erase_buf(ToEraseBuf* to_erase_buf)
   if (!SACN_ASSERT_VERIFY(to_erase_buf))
     return kEtcPalErrSys;
 
-  to_erase_buf->buf = calloc(kSacnInitialCapacity, sizeof(SacnTrackedSource*));
+  size_t capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->sources_per_universe);
+
+  to_erase_buf->buf = SACN_CALLOC(capacity, sizeof(SacnTrackedSource*));
   if (!to_erase_buf->buf)
     return kEtcPalErrNoMem;
 
-  to_erase_buf->buf_capacity = kSacnInitialCapacity;
+  to_erase_buf->buf_capacity = capacity;
   return kEtcPalErrOk;
 }
 
@@ -129,7 +133,7 @@ void deinit_to_erase_bufs(void)
   {
     for (unsigned int i = 0; i < sacn_mem_get_num_threads(); ++i)
       deinit_to_erase_buf(&to_erase[i]);
-    free(to_erase);
+    SACN_FREE(to_erase);
     to_erase = NULL;
   }
 }
@@ -140,9 +144,25 @@ void deinit_to_erase_buf(ToEraseBuf* to_erase_buf)
     return;
 
   if (to_erase_buf->buf)
-    free(to_erase_buf->buf);
+    SACN_FREE(to_erase_buf->buf);
 }
 
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's list of tracked sources to erase, or 0 if the thread ID was invalid.
+ */
+// Needs lock
+size_t get_to_erase_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!to_erase || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  return sizeof(ToEraseBuf) + (to_erase[thread_id].buf_capacity * sizeof(SacnTrackedSource*));
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(ToEraseBuf) : 0;
+#endif
+}
+
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
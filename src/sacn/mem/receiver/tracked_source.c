@@ -20,19 +20,21 @@
 #include "sacn/private/mem/receiver/tracked_source.h"
 
 #include <stddef.h>
+#include <string.h>
 #include "etcpal/common.h"
 #include "etcpal/rbtree.h"
 #include "sacn/private/common.h"
 #include "sacn/opts.h"
 #include "sacn/private/mem/common.h"
 #include "sacn/private/mem/receiver/remote_source.h"
+#include "sacn/private/mem/slab.h"
 
-#if SACN_DYNAMIC_MEM
-#include <stdlib.h>
-#else
+#if !SACN_DYNAMIC_MEM
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private constants ******************************/
@@ -43,9 +45,9 @@
 
 #if SACN_DYNAMIC_MEM
 
-/* Macros for dynamic allocation. */
-#define ALLOC_TRACKED_SOURCE()   malloc(sizeof(SacnTrackedSource))
-#define FREE_TRACKED_SOURCE(ptr) free(ptr)
+/* Macros for dynamic allocation, which is done using per-type slabs. */
+#define ALLOC_TRACKED_SOURCE()   sacn_slab_alloc(&tracked_source_slab)
+#define FREE_TRACKED_SOURCE(ptr) sacn_slab_free(&tracked_source_slab, ptr)
 
 #else  // SACN_DYNAMIC_MEM
 
@@ -57,14 +59,19 @@
 
 /**************************** Private variables ******************************/
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+static SacnSlab tracked_source_slab;
+static SacnSlab tracked_source_rb_node_slab;
+#else  // SACN_DYNAMIC_MEM
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_tracked_sources, SacnTrackedSource, SACN_RECEIVER_TOTAL_MAX_SOURCES);
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_recv_tracked_source_rb_nodes, EtcPalRbNode, SACN_TRACKED_SOURCE_MAX_RB_NODES);
-#endif  // !SACN_DYNAMIC_MEM
+#endif  // SACN_DYNAMIC_MEM
 
 /*********************** Private function prototypes *************************/
 
-// Tracked source tree node management
+// Inline source table management
+static void add_inline_source(SacnInlineSourceTable* table, SacnTrackedSource* src);
+static void remove_inline_source(SacnInlineSourceTable* table, sacn_remote_source_t handle);
 
 /*************************** Function definitions ****************************/
 
@@ -72,14 +79,47 @@ etcpal_error_t init_tracked_sources(void)
 {
   etcpal_error_t res = kEtcPalErrOk;
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+  sacn_slab_init(&tracked_source_slab, SACN_ALLOC_MODULE, sizeof(SacnTrackedSource), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  sacn_slab_init(&tracked_source_rb_node_slab, SACN_ALLOC_MODULE, sizeof(EtcPalRbNode), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+
+  const SacnReserveConfig* reserved = sacn_mem_get_reservation();
+  size_t reserved_sources           = reserved->receivers * reserved->sources_per_universe;
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&tracked_source_slab, reserved_sources);
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&tracked_source_rb_node_slab, reserved_sources);
+#else  // SACN_DYNAMIC_MEM
   res |= etcpal_mempool_init(sacn_pool_recv_tracked_sources);
   res |= etcpal_mempool_init(sacn_pool_recv_tracked_source_rb_nodes);
-#endif  // !SACN_DYNAMIC_MEM
+#endif  // SACN_DYNAMIC_MEM
 
   return res;
 }
 
+void deinit_tracked_sources(void)
+{
+#if SACN_DYNAMIC_MEM
+  sacn_slab_deinit(&tracked_source_rb_node_slab);
+  sacn_slab_deinit(&tracked_source_slab);
+#endif
+}
+
+// Needs lock
+void add_tracked_source_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  ADD_POOL_STATS(stats, tracked_source_slab, SacnTrackedSource);
+  ADD_RB_NODE_POOL_STATS(stats, tracked_source_rb_node_slab);
+#else
+  ADD_POOL_STATS(stats, sacn_pool_recv_tracked_sources, SacnTrackedSource);
+  ADD_RB_NODE_POOL_STATS(stats, sacn_pool_recv_tracked_source_rb_nodes);
+#endif
+}
+
 etcpal_error_t add_sacn_tracked_source(SacnReceiver*              receiver,
                                        const EtcPalUuid*          sender_cid,
                                        const char*                name,
@@ -134,6 +174,12 @@ etcpal_error_t add_sacn_tracked_source(SacnReceiver*              receiver,
     src->terminated                   = false;
     src->dmx_received_since_last_tick = true;
 
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+    memset(&src->timing, 0, sizeof(src->timing));
+    src->last_arrival_ns  = 0;
+    src->last_interval_ns = 0;
+#endif
+
 #if SACN_ETC_PRIORITY_EXTENSION
     if (receiver->sampling)
     {
@@ -159,6 +205,8 @@ etcpal_error_t add_sacn_tracked_source(SacnReceiver*              receiver,
 #endif
 
     result = etcpal_rbtree_insert(&receiver->sources, src);
+    if (result == kEtcPalErrOk)
+      add_inline_source(&receiver->inline_sources, src);
   }
 
   if (result == kEtcPalErrOk)
@@ -182,6 +230,7 @@ etcpal_error_t clear_receiver_sources(SacnReceiver* receiver)
     return kEtcPalErrSys;
 
   receiver->suppress_limit_exceeded_notification = false;
+  receiver->inline_sources.num_sources           = 0;
   return etcpal_rbtree_clear_with_cb(&receiver->sources, tracked_source_tree_dealloc);
 }
 
@@ -190,9 +239,66 @@ etcpal_error_t remove_receiver_source(SacnReceiver* receiver, sacn_remote_source
   if (!SACN_ASSERT_VERIFY(receiver) || !SACN_ASSERT_VERIFY(handle != kSacnRemoteSourceInvalid))
     return kEtcPalErrSys;
 
+  remove_inline_source(&receiver->inline_sources, handle);
   return etcpal_rbtree_remove_with_cb(&receiver->sources, &handle, tracked_source_tree_dealloc);
 }
 
+/*
+ * Find a source tracked on a receiver. The receiver's inline source table is searched first, and the sources tree only
+ * if it holds sources the table doesn't. A source found in the tree takes any free slot in the table, so sources that
+ * spilled over to the tree move back into the table as others are removed.
+ *
+ * [in,out] receiver Receiver to search.
+ * [in] handle Handle of the source to find.
+ * Returns the source, or NULL if the receiver isn't tracking it.
+ */
+SacnTrackedSource* find_receiver_source(SacnReceiver* receiver, sacn_remote_source_t handle)
+{
+  if (!SACN_ASSERT_VERIFY(receiver))
+    return NULL;
+
+  SacnInlineSourceTable* table = &receiver->inline_sources;
+  for (size_t i = 0; i < table->num_sources; ++i)
+  {
+    if (table->handles[i] == handle)
+      return table->sources[i];
+  }
+
+  if (etcpal_rbtree_size(&receiver->sources) <= table->num_sources)
+    return NULL;
+
+  SacnTrackedSource* src = (SacnTrackedSource*)etcpal_rbtree_find(&receiver->sources, &handle);
+  if (src)
+    add_inline_source(table, src);
+
+  return src;
+}
+
+void add_inline_source(SacnInlineSourceTable* table, SacnTrackedSource* src)
+{
+  if (table->num_sources < SACN_RECEIVER_INLINE_SOURCES)
+  {
+    table->handles[table->num_sources] = src->handle;
+    table->sources[table->num_sources] = src;
+    ++table->num_sources;
+  }
+}
+
+void remove_inline_source(SacnInlineSourceTable* table, sacn_remote_source_t handle)
+{
+  for (size_t i = 0; i < table->num_sources; ++i)
+  {
+    if (table->handles[i] == handle)
+    {
+      // Order doesn't matter, so fill the gap with the last entry.
+      --table->num_sources;
+      table->handles[i] = table->handles[table->num_sources];
+      table->sources[i] = table->sources[table->num_sources];
+      return;
+    }
+  }
+}
+
 /* Helper function for clearing an EtcPalRbTree containing sources. */
 void tracked_source_tree_dealloc(const EtcPalRbTree* self, EtcPalRbNode* node)
 {
@@ -214,7 +320,7 @@ void tracked_source_node_dealloc(EtcPalRbNode* node)
     return;
 
 #if SACN_DYNAMIC_MEM
-  free(node);
+  sacn_slab_free(&tracked_source_rb_node_slab, node);
 #else
   etcpal_mempool_free(sacn_pool_recv_tracked_source_rb_nodes, node);
 #endif
@@ -223,7 +329,7 @@ void tracked_source_node_dealloc(EtcPalRbNode* node)
 EtcPalRbNode* tracked_source_node_alloc(void)
 {
 #if SACN_DYNAMIC_MEM
-  return (EtcPalRbNode*)malloc(sizeof(EtcPalRbNode));
+  return (EtcPalRbNode*)sacn_slab_alloc(&tracked_source_rb_node_slab);
 #else
   return etcpal_mempool_alloc(sacn_pool_recv_tracked_source_rb_nodes);
 #endif
@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -72,7 +74,7 @@ etcpal_error_t init_universe_data_buf(unsigned int num_threads)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  sacn_pool_universe_data = calloc(num_threads, sizeof(UniverseDataNotification));
+  sacn_pool_universe_data = SACN_CALLOC(num_threads, sizeof(UniverseDataNotification));
   if (!sacn_pool_universe_data)
     return kEtcPalErrNoMem;
 #else   // SACN_DYNAMIC_MEM
@@ -87,10 +89,26 @@ void deinit_universe_data_buf(void)
 {
   if (sacn_pool_universe_data)
   {
-    free(sacn_pool_universe_data);
+    SACN_FREE(sacn_pool_universe_data);
     sacn_pool_universe_data = NULL;
   }
 }
 #endif  // SACN_DYNAMIC_MEM
 
+/*
+ * Get the size in bytes of a given thread's universe data notification, or 0 if the thread ID was invalid.
+ */
+// Needs lock
+size_t get_universe_data_buf_size(sacn_thread_id_t thread_id)
+{
+#if SACN_DYNAMIC_MEM
+  if (!sacn_pool_universe_data || (thread_id >= sacn_mem_get_num_threads()))
+    return 0;
+
+  return sizeof(UniverseDataNotification);
+#else
+  return (thread_id < sacn_mem_get_num_threads()) ? sizeof(UniverseDataNotification) : 0;
+#endif
+}
+
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
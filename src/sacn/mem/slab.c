@@ -0,0 +1,210 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "sacn/private/mem/slab.h"
+
+#include <stdint.h>
+#include <string.h>
+#include "sacn/private/common.h"
+
+#if SACN_DYNAMIC_MEM
+#include <stdlib.h>
+
+/****************************** Private types ********************************/
+
+struct SacnSlabChunk
+{
+  SacnSlabChunk* next;
+};
+
+struct SacnSlabItem
+{
+  SacnSlabItem* next;
+};
+
+// Every item and the chunk header are padded to a multiple of this union's size, which keeps the items suitably
+// aligned for any of the library's object types.
+typedef union SacnSlabAlign
+{
+  void*       ptr;
+  uint64_t    u64;
+  double      dbl;
+  long double ldbl;
+  void (*func)(void);
+} SacnSlabAlign;
+
+/****************************** Private macros *******************************/
+
+// Chunks are counted against the module that owns the slab.
+#define SACN_ALLOC_MODULE (slab->module)
+
+#define SLAB_ROUND_UP(size) ((((size) + sizeof(SacnSlabAlign) - 1) / sizeof(SacnSlabAlign)) * sizeof(SacnSlabAlign))
+#define SLAB_CHUNK_HEADER_SIZE SLAB_ROUND_UP(sizeof(SacnSlabChunk))
+
+/*********************** Private function prototypes *************************/
+
+static bool add_chunk(SacnSlab* slab, size_t num_items);
+static void release_chunks(SacnSlab* slab);
+
+/*************************** Function definitions ****************************/
+
+/*
+ * Initialize a slab for items of item_size bytes, grown items_per_chunk items at a time and counted against the given
+ * module. A slab that still holds chunks from a previous initialization keeps them for reuse.
+ */
+void sacn_slab_init(SacnSlab* slab, sacn_alloc_module_t module, size_t item_size, size_t items_per_chunk)
+{
+  if (!SACN_ASSERT_VERIFY(slab) || !SACN_ASSERT_VERIFY(item_size > 0) || !SACN_ASSERT_VERIFY(items_per_chunk > 0))
+    return;
+
+  size_t padded_size = SLAB_ROUND_UP((item_size > sizeof(SacnSlabItem)) ? item_size : sizeof(SacnSlabItem));
+  if (slab->chunks)
+  {
+    if (!SACN_ASSERT_VERIFY(slab->item_size == padded_size))
+      return;
+  }
+  else
+  {
+    memset(slab, 0, sizeof(SacnSlab));
+    slab->module          = module;
+    slab->item_size       = padded_size;
+    slab->items_per_chunk = items_per_chunk;
+  }
+
+  slab->draining         = false;
+  slab->stats.high_water = slab->stats.in_use;
+}
+
+/*
+ * Return the slab's chunks to the system. If items are still outstanding, the chunks are released once the last of
+ * them is freed.
+ */
+void sacn_slab_deinit(SacnSlab* slab)
+{
+  if (!SACN_ASSERT_VERIFY(slab))
+    return;
+
+  if (slab->stats.in_use == 0)
+    release_chunks(slab);
+  else
+    slab->draining = true;
+}
+
+/*
+ * Grow the slab up front so that it can hold at least num_items items in total without allocating from the system.
+ */
+etcpal_error_t sacn_slab_reserve(SacnSlab* slab, size_t num_items)
+{
+  if (!SACN_ASSERT_VERIFY(slab) || !SACN_ASSERT_VERIFY(slab->item_size > 0))
+    return kEtcPalErrSys;
+
+  if ((num_items > slab->stats.capacity) && !add_chunk(slab, num_items - slab->stats.capacity))
+    return kEtcPalErrNoMem;
+
+  return kEtcPalErrOk;
+}
+
+/*
+ * Allocate an item from the slab, growing it by one chunk if its free list is empty. Returns NULL if the system
+ * allocation fails.
+ */
+void* sacn_slab_alloc(SacnSlab* slab)
+{
+  if (!SACN_ASSERT_VERIFY(slab) || !SACN_ASSERT_VERIFY(slab->item_size > 0))
+    return NULL;
+
+  if (!slab->free_list && !add_chunk(slab, slab->items_per_chunk))
+    return NULL;
+
+  SacnSlabItem* item = slab->free_list;
+  slab->free_list    = item->next;
+
+  ++slab->stats.in_use;
+  if (slab->stats.in_use > slab->stats.high_water)
+    slab->stats.high_water = slab->stats.in_use;
+
+  return item;
+}
+
+/*
+ * Return an item to the slab it was allocated from.
+ */
+void sacn_slab_free(SacnSlab* slab, void* item)
+{
+  if (!SACN_ASSERT_VERIFY(slab) || !item || !SACN_ASSERT_VERIFY(slab->stats.in_use > 0))
+    return;
+
+  SacnSlabItem* free_item = (SacnSlabItem*)item;
+  free_item->next         = slab->free_list;
+  slab->free_list         = free_item;
+
+  --slab->stats.in_use;
+  if (slab->draining && (slab->stats.in_use == 0))
+    release_chunks(slab);
+}
+
+void sacn_slab_get_stats(const SacnSlab* slab, SacnSlabStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(slab) || !SACN_ASSERT_VERIFY(stats))
+    return;
+
+  *stats = slab->stats;
+}
+
+bool add_chunk(SacnSlab* slab, size_t num_items)
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  SacnSlabChunk* chunk = (SacnSlabChunk*)SACN_MALLOC(SLAB_CHUNK_HEADER_SIZE + (num_items * slab->item_size));
+  if (!chunk)
+    return false;
+
+  chunk->next  = slab->chunks;
+  slab->chunks = chunk;
+
+  // Thread the new items onto the free list so that they're handed out in address order.
+  uint8_t* items = (uint8_t*)chunk + SLAB_CHUNK_HEADER_SIZE;
+  for (size_t i = num_items; i > 0; --i)
+  {
+    SacnSlabItem* item = (SacnSlabItem*)(void*)(items + ((i - 1) * slab->item_size));
+    item->next         = slab->free_list;
+    slab->free_list    = item;
+  }
+
+  slab->stats.capacity += num_items;
+  ++slab->stats.num_chunks;
+  return true;
+}
+
+void release_chunks(SacnSlab* slab)
+{
+  while (slab->chunks)
+  {
+    SacnSlabChunk* next = slab->chunks->next;
+    SACN_FREE(slab->chunks);  // NOLINT(cppcoreguidelines-no-malloc)
+    slab->chunks = next;
+  }
+
+  slab->free_list        = NULL;
+  slab->stats.capacity   = 0;
+  slab->stats.num_chunks = 0;
+  slab->stats.high_water = 0;
+  slab->draining         = false;
+}
+
+#endif  // SACN_DYNAMIC_MEM
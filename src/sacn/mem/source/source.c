@@ -27,6 +27,7 @@
 #include "sacn/private/sockets.h"
 #include "sacn/private/pdu.h"
 #include "sacn/private/mem/common.h"
+#include "sacn/private/mem/source/source_universe.h"
 
 #if SACN_DYNAMIC_MEM
 #include <stdlib.h>
@@ -34,6 +35,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSource
+
 #if SACN_SOURCE_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -102,18 +105,28 @@ etcpal_error_t add_sacn_source(sacn_source_t handle, const SacnSourceConfig* con
     source->universe_count_max      = config->universe_count_max;
 
     etcpal_timer_start(&source->stats_log_timer, kSacnStatsLogInterval);
-    source->total_tick_count  = 0;
-    source->failed_tick_count = 0;
-
-    source->num_universes = 0;
-    source->num_netints   = 0;
+    source->total_tick_count     = 0;
+    source->failed_tick_count    = 0;
+    source->deferred_send_failed = false;
+
+    source->num_universe_slots      = 0;
+    source->num_free_universe_slots = 0;
+    source->num_universes           = 0;
+    source->num_netints             = 0;
 #if SACN_DYNAMIC_MEM
-    source->universes          = calloc(kSacnInitialCapacity, sizeof(SacnSourceUniverse));
-    source->universes_capacity = source->universes ? kSacnInitialCapacity : 0;
-    source->netints            = calloc(kSacnInitialCapacity, sizeof(SacnSourceNetint));
-    source->netints_capacity   = source->netints ? kSacnInitialCapacity : 0;
-
-    if (!source->universes || !source->netints)
+    size_t universes_capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->universes);
+    size_t netints_capacity   = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->netints);
+
+    source->universe_slots               = SACN_CALLOC(universes_capacity, sizeof(SacnSourceUniverse*));
+    source->universe_slots_capacity      = source->universe_slots ? universes_capacity : 0;
+    source->free_universe_slots          = SACN_CALLOC(universes_capacity, sizeof(uint16_t));
+    source->free_universe_slots_capacity = source->free_universe_slots ? universes_capacity : 0;
+    source->universes                    = SACN_CALLOC(universes_capacity, sizeof(uint16_t));
+    source->universes_capacity           = source->universes ? universes_capacity : 0;
+    source->netints                      = SACN_CALLOC(netints_capacity, sizeof(SacnSourceNetint));
+    source->netints_capacity             = source->netints ? netints_capacity : 0;
+
+    if (!source->universe_slots || !source->free_universe_slots || !source->universes || !source->netints)
       result = kEtcPalErrNoMem;
 #else
     memset(source->universes, 0, sizeof(source->universes));
@@ -127,7 +140,7 @@ etcpal_error_t add_sacn_source(sacn_source_t handle, const SacnSourceConfig* con
   }
   else if (source)
   {
-    CLEAR_BUF(source, universes);
+    clear_source_universe_slots(source);
     CLEAR_BUF(source, netints);
   }
 
@@ -161,7 +174,7 @@ size_t get_num_sources()
 // Needs lock
 void remove_sacn_source(size_t index)
 {
-  CLEAR_BUF(&sacn_pool_source_mem.sources[index], universes);
+  clear_source_universe_slots(&sacn_pool_source_mem.sources[index]);
   CLEAR_BUF(&sacn_pool_source_mem.sources[index], netints);
 
   REMOVE_AT_INDEX((&sacn_pool_source_mem), SacnSource, sources, index);
@@ -190,8 +203,9 @@ etcpal_error_t init_sources(void)
 {
   etcpal_error_t res = kEtcPalErrOk;
 #if SACN_DYNAMIC_MEM
-  sacn_pool_source_mem.sources          = calloc(kSacnInitialCapacity, sizeof(SacnSource));
-  sacn_pool_source_mem.sources_capacity = sacn_pool_source_mem.sources ? kSacnInitialCapacity : 0;
+  size_t sources_capacity               = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->sources);
+  sacn_pool_source_mem.sources          = SACN_CALLOC(sources_capacity, sizeof(SacnSource));
+  sacn_pool_source_mem.sources_capacity = sacn_pool_source_mem.sources ? sources_capacity : 0;
   if (!sacn_pool_source_mem.sources)
     res = kEtcPalErrNoMem;
 #else   // SACN_DYNAMIC_MEM
@@ -214,13 +228,7 @@ void deinit_sources(void)
     {
       for (size_t i = 0; i < sacn_pool_source_mem.num_sources; ++i)
       {
-        for (size_t j = 0; j < sacn_pool_source_mem.sources[i].num_universes; ++j)
-        {
-          CLEAR_BUF(&sacn_pool_source_mem.sources[i].universes[j].netints, netints);
-          CLEAR_BUF(&sacn_pool_source_mem.sources[i].universes[j], unicast_dests);
-        }
-
-        CLEAR_BUF(&sacn_pool_source_mem.sources[i], universes);
+        clear_source_universe_slots(&sacn_pool_source_mem.sources[i]);
         CLEAR_BUF(&sacn_pool_source_mem.sources[i], netints);
       }
 
@@ -238,4 +246,31 @@ void deinit_sources(void)
   }
 }
 
+// Needs lock
+void add_source_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+  // The sources and each source's universe slots are the module's pools.
+#if SACN_DYNAMIC_MEM
+  stats->pool_capacity += sacn_pool_source_mem.sources_capacity;
+  ADD_BUF_STATS(stats, &sacn_pool_source_mem, sources);
+  for (size_t i = 0; i < sacn_pool_source_mem.num_sources; ++i)
+  {
+    const SacnSource* source = &sacn_pool_source_mem.sources[i];
+    stats->pool_capacity += source->num_universe_slots;
+    ADD_BUF_STATS(stats, source, netints);
+    add_source_universe_mem_stats(stats, source);
+  }
+#else
+  stats->pool_capacity += SACN_SOURCE_MAX_SOURCES * (1 + SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE);
+  stats->bytes_allocated += sizeof(sacn_pool_source_mem.sources);
+#endif
+
+  stats->pool_in_use += sacn_pool_source_mem.num_sources;
+  for (size_t i = 0; i < sacn_pool_source_mem.num_sources; ++i)
+    stats->pool_in_use += sacn_pool_source_mem.sources[i].num_universes;
+}
+
 #endif  // SACN_SOURCE_ENABLED || DOXYGEN
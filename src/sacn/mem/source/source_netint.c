@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSource
+
 #if SACN_SOURCE_ENABLED || DOXYGEN
 
 /*********************** Private function prototypes *************************/
@@ -36,8 +36,16 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSource
+
 #if SACN_SOURCE_ENABLED || DOXYGEN
 
+/*********************** Private function prototypes *************************/
+
+static etcpal_error_t         take_universe_slot(SacnSource* source, uint16_t* slot);
+static void                   release_universe_slot(SacnSource* source, uint16_t slot);
+static sacn_source_universe_t next_universe_handle(sacn_source_universe_t handle);
+
 /*************************** Function definitions ****************************/
 
 // Needs lock
@@ -62,30 +70,52 @@ etcpal_error_t add_sacn_source_universe(SacnSource*                     source,
 
   SacnSourceUniverse* universe     = NULL;
   size_t              insert_index = 0;
+  uint16_t            slot         = 0;
   if (result == kEtcPalErrOk)
   {
-    CHECK_ROOM_FOR_ONE_MORE(source, universes, SacnSourceUniverse, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE,
-                            kEtcPalErrNoMem);
+    CHECK_ROOM_FOR_ONE_MORE(source, universes, uint16_t, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE, kEtcPalErrNoMem);
+    result = take_universe_slot(source, &slot);
+  }
 
+  if (result == kEtcPalErrOk)
+  {
     // The send loop iterates the universe array in reverse in order to enable easy removal from the array if needed. In
     // order to send the universes from lowest to highest (see SACN-308), the universes array must be sorted from
-    // highest to lowest. This must be factored in when constructing universe discovery packets.
-    while ((insert_index < source->num_universes) && (source->universes[insert_index].universe_id > config->universe))
-      ++insert_index;
+    // highest to lowest. This must be factored in when constructing universe discovery packets. Only slot numbers are
+    // moved here - the universes themselves stay where they are.
+    bool found   = false;
+    insert_index = get_source_universe_index(source, config->universe, &found);
 
     if (insert_index < source->num_universes)
     {
       memmove(&source->universes[insert_index + 1], &source->universes[insert_index],
-              (source->num_universes - insert_index) * sizeof(SacnSourceUniverse));
+              (source->num_universes - insert_index) * sizeof(uint16_t));
     }
 
-    universe = &source->universes[insert_index];
+    source->universes[insert_index] = slot;
+
+    universe = SACN_SOURCE_UNIVERSE_SLOT(source, slot);
+
+    // The slot's handle and unicast destination and PAP buffers outlive the universes stored in it.
+    sacn_source_universe_t handle = universe->handle;
+#if SACN_DYNAMIC_MEM
+    SacnUnicastDestination* unicast_dests          = universe->unicast_dests;
+    size_t                  unicast_dests_capacity = universe->unicast_dests_capacity;
+#if SACN_ETC_PRIORITY_EXTENSION
+    uint8_t* pap_send_buf = universe->pap_send_buf;
+#endif
+#endif
+
     memset(universe, 0, sizeof(SacnSourceUniverse));
 
+    universe->slot   = slot;
+    universe->handle = handle;
+
     universe->universe_id = config->universe;
 
     universe->termination_state     = kNotTerminating;
     universe->num_terminations_sent = 0;
+    universe->termination_complete  = false;
 
     universe->priority      = config->priority;
     universe->sync_universe = config->sync_universe;
@@ -97,11 +127,19 @@ etcpal_error_t add_sacn_source_universe(SacnSource*                     source,
                             config->universe, config->sync_universe, config->send_preview);
     universe->has_level_data        = false;
     universe->levels_sent_this_tick = false;
+    universe->levels_leased         = false;
 
 #if SACN_ETC_PRIORITY_EXTENSION
     universe->pap_packets_sent_before_suppression = 0;
-    init_sacn_data_send_buf(universe->pap_send_buf, kSacnStartcodePriority, &source->cid, source->name,
-                            config->priority, config->universe, config->sync_universe, config->send_preview);
+#if SACN_DYNAMIC_MEM
+    universe->pap_send_buf             = pap_send_buf;  // Otherwise allocated by init_source_universe_pap().
+    universe->pap_alloc_failure_logged = false;
+    if (universe->pap_send_buf)
+#endif
+    {
+      init_sacn_data_send_buf(universe->pap_send_buf, kSacnStartcodePriority, &source->cid, source->name,
+                              config->priority, config->universe, config->sync_universe, config->send_preview);
+    }
     universe->has_pap_data       = false;
     universe->pap_sent_this_tick = false;
 #endif
@@ -111,22 +149,22 @@ etcpal_error_t add_sacn_source_universe(SacnSource*                     source,
 
     universe->send_unicast_only = config->send_unicast_only;
 
+    // Most universes have no unicast destinations, so the buffer isn't allocated until the first one is added.
     universe->num_unicast_dests = 0;
 #if SACN_DYNAMIC_MEM
-    universe->unicast_dests          = calloc(kSacnInitialCapacity, sizeof(SacnUnicastDestination));
-    universe->unicast_dests_capacity = universe->unicast_dests ? kSacnInitialCapacity : 0;
-
-    if (!universe->unicast_dests)
-      result = kEtcPalErrNoMem;
+    universe->unicast_dests          = unicast_dests;
+    universe->unicast_dests_capacity = unicast_dests_capacity;
 
     universe->last_send_error = kEtcPalErrOk;
 
     universe->netints.netints          = NULL;
     universe->netints.netints_capacity = 0;
-#else
-    memset(universe->unicast_dests, 0, sizeof(universe->unicast_dests));
 #endif
     universe->netints.num_netints = 0;
+
+    universe->tick_thread          = 0;
+    universe->shard_index          = 0;
+    universe->tick_thread_assigned = false;
   }
 
   for (size_t i = 0; (result == kEtcPalErrOk) && (i < config->num_unicast_destinations); ++i)
@@ -148,13 +186,14 @@ etcpal_error_t add_sacn_source_universe(SacnSource*                     source,
   else if (universe)
   {
     CLEAR_BUF(&universe->netints, netints);
-    CLEAR_BUF(universe, unicast_dests);
+    universe->num_unicast_dests = 0;
+    release_universe_slot(source, slot);
 
     // Undo the previous memory shift so that a valid universe isn't lost
     if (insert_index < source->num_universes)
     {
       memmove(&source->universes[insert_index], &source->universes[insert_index + 1],
-              (source->num_universes - insert_index) * sizeof(SacnSourceUniverse));
+              (source->num_universes - insert_index) * sizeof(uint16_t));
     }
   }
 
@@ -163,6 +202,33 @@ etcpal_error_t add_sacn_source_universe(SacnSource*                     source,
   return result;
 }
 
+#if SACN_ETC_PRIORITY_EXTENSION
+// Needs lock
+// Makes sure the universe's PAP send buffer is ready for its first PAP. With dynamic memory, the buffer is allocated
+// here, so universes that never send PAP don't carry one.
+etcpal_error_t init_source_universe_pap(const SacnSource* source, SacnSourceUniverse* universe)
+{
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
+    return kEtcPalErrSys;
+
+#if SACN_DYNAMIC_MEM
+  if (!universe->pap_send_buf)
+  {
+    universe->pap_send_buf = SACN_CALLOC(kSacnDataPacketMtu, 1);
+    if (!universe->pap_send_buf)
+      return kEtcPalErrNoMem;
+
+    init_sacn_data_send_buf(universe->pap_send_buf, kSacnStartcodePriority, &source->cid, source->name,
+                            universe->priority, universe->universe_id, universe->sync_universe,
+                            universe->send_preview);
+    universe->pap_send_buf[SACN_SEQ_OFFSET] = universe->next_seq_num;
+  }
+#endif
+
+  return kEtcPalErrOk;
+}
+#endif  // SACN_ETC_PRIORITY_EXTENSION
+
 // Needs lock
 etcpal_error_t lookup_source_and_universe(sacn_source_t        source,
                                           uint16_t             universe,
@@ -191,39 +257,211 @@ etcpal_error_t lookup_universe(SacnSource* source, uint16_t universe, SacnSource
 
   bool   found    = false;
   size_t index    = get_source_universe_index(source, universe, &found);
-  *universe_state = found ? &source->universes[index] : NULL;
+  *universe_state = found ? SACN_SOURCE_UNIVERSE_AT(source, index) : NULL;
+  return found ? kEtcPalErrOk : kEtcPalErrNotFound;
+}
+
+// Needs lock
+// Like lookup_universe(), but for looking up a series of universes. The cursor must start at source->num_universes.
+// When the universes are looked up in ascending order, this merges the lookups into one pass over the universes array.
+// Out-of-order lookups fall back to a binary search, and the merge resumes from there.
+etcpal_error_t lookup_next_universe(SacnSource*          source,
+                                    uint16_t             universe,
+                                    size_t*              cursor,
+                                    SacnSourceUniverse** universe_state)
+{
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(cursor) || !SACN_ASSERT_VERIFY(universe_state) ||
+      !SACN_ASSERT_VERIFY(*cursor <= source->num_universes))
+  {
+    return kEtcPalErrSys;
+  }
+
+  // The universes array is sorted highest to lowest, so ascending lookups walk it from the end. Every universe before
+  // the cursor is a candidate.
+  if ((*cursor > 0) && (SACN_SOURCE_UNIVERSE_AT(source, *cursor - 1)->universe_id <= universe))
+  {
+    while ((*cursor > 0) && (SACN_SOURCE_UNIVERSE_AT(source, *cursor - 1)->universe_id < universe))
+      --(*cursor);
+  }
+  else
+  {
+    bool   found = false;
+    size_t index = get_source_universe_index(source, universe, &found);
+    *cursor      = found ? (index + 1) : index;
+  }
+
+  bool found      = (*cursor > 0) && (SACN_SOURCE_UNIVERSE_AT(source, *cursor - 1)->universe_id == universe);
+  *universe_state = found ? SACN_SOURCE_UNIVERSE_AT(source, *cursor - 1) : NULL;
+  return found ? kEtcPalErrOk : kEtcPalErrNotFound;
+}
+
+// Needs lock
+etcpal_error_t lookup_universe_by_handle(SacnSource*            source,
+                                         sacn_source_universe_t handle,
+                                         SacnSourceUniverse**   universe_state)
+{
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe_state))
+    return kEtcPalErrSys;
+
+  size_t              slot     = (size_t)(handle & 0xffffu);
+  SacnSourceUniverse* universe = (slot < source->num_universe_slots) ? SACN_SOURCE_UNIVERSE_SLOT(source, slot) : NULL;
+
+  // A free slot's handle has already moved on to the next generation, so it never matches one that was handed out.
+  bool found      = (handle != kSacnSourceUniverseInvalid) && universe && (universe->handle == handle);
+  *universe_state = found ? universe : NULL;
   return found ? kEtcPalErrOk : kEtcPalErrNotFound;
 }
 
 // Needs lock
 void remove_sacn_source_universe(SacnSource* source, size_t index)
+{
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(index < source->num_universes))
+    return;
+
+  SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_AT(source, index);
+
+  // The unicast destination buffer stays with the slot for the next universe that uses it.
+  universe->num_unicast_dests = 0;
+  CLEAR_BUF(&universe->netints, netints);
+
+  release_universe_slot(source, source->universes[index]);
+  REMOVE_AT_INDEX(source, uint16_t, universes, index);
+}
+
+// Needs lock
+void clear_source_universe_slots(SacnSource* source)
 {
   if (!SACN_ASSERT_VERIFY(source))
     return;
 
-  CLEAR_BUF(&source->universes[index], unicast_dests);
-  CLEAR_BUF(&source->universes[index].netints, netints);
-  REMOVE_AT_INDEX(source, SacnSourceUniverse, universes, index);
+  for (size_t i = 0; i < source->num_universe_slots; ++i)
+  {
+    SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_SLOT(source, i);
+    CLEAR_BUF(&universe->netints, netints);
+    CLEAR_BUF(universe, unicast_dests);
+#if SACN_DYNAMIC_MEM
+#if SACN_ETC_PRIORITY_EXTENSION
+    if (universe->pap_send_buf)
+      SACN_FREE(universe->pap_send_buf);
+#endif
+    SACN_FREE(universe);
+#endif
+  }
+
+  CLEAR_BUF(source, universe_slots);
+  CLEAR_BUF(source, free_universe_slots);
+  CLEAR_BUF(source, universes);
+}
+
+#if SACN_DYNAMIC_MEM
+// Needs lock
+// Adds the bytes taken up by a source's universe slots to its module's memory stats, including each universe's buffers.
+// A universe's PAP send buffer only counts once it has been allocated.
+void add_source_universe_mem_stats(SacnModuleMemoryStats* stats, const SacnSource* source)
+{
+  if (!SACN_ASSERT_VERIFY(stats) || !SACN_ASSERT_VERIFY(source))
+    return;
+
+  ADD_BUF_STATS(stats, source, universe_slots);
+  ADD_BUF_STATS(stats, source, free_universe_slots);
+  ADD_BUF_STATS(stats, source, universes);
+
+  for (size_t i = 0; i < source->num_universe_slots; ++i)
+  {
+    const SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_SLOT(source, i);
+    stats->bytes_allocated += sizeof(SacnSourceUniverse);
+    ADD_BUF_STATS(stats, universe, unicast_dests);
+    ADD_BUF_STATS(stats, &universe->netints, netints);
+#if SACN_ETC_PRIORITY_EXTENSION
+    if (SACN_SOURCE_UNIVERSE_HAS_PAP_BUF(universe))
+      stats->bytes_allocated += kSacnDataPacketMtu;
+#endif
+  }
 }
+#endif  // SACN_DYNAMIC_MEM
 
 // Needs lock
+// Returns the index of the universe if found, otherwise the index it would be inserted at.
 size_t get_source_universe_index(SacnSource* source, uint16_t universe, bool* found)
 {
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(found))
     return 0;
 
-  *found       = false;
-  size_t index = 0;
-
-  while (!(*found) && (index < source->num_universes))
+  // The universes array is sorted highest to lowest - find the first universe that isn't higher than this one.
+  size_t low  = 0;
+  size_t high = source->num_universes;
+  while (low < high)
   {
-    if (source->universes[index].universe_id == universe)
-      *found = true;
+    size_t mid = low + ((high - low) / 2);
+    if (SACN_SOURCE_UNIVERSE_AT(source, mid)->universe_id > universe)
+      low = mid + 1;
     else
-      ++index;
+      high = mid;
   }
 
-  return index;
+  *found = (low < source->num_universes) && (SACN_SOURCE_UNIVERSE_AT(source, low)->universe_id == universe);
+  return low;
+}
+
+// Needs lock
+etcpal_error_t take_universe_slot(SacnSource* source, uint16_t* slot)
+{
+  if (source->num_free_universe_slots > 0)
+  {
+    --source->num_free_universe_slots;
+    *slot = source->free_universe_slots[source->num_free_universe_slots];
+    return kEtcPalErrOk;
+  }
+
+  // Make sure there will always be room to free this slot later.
+  CHECK_CAPACITY(source, source->num_universe_slots + 1, free_universe_slots, uint16_t,
+                 SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE, kEtcPalErrNoMem);
+
+#if SACN_DYNAMIC_MEM
+  CHECK_ROOM_FOR_ONE_MORE(source, universe_slots, SacnSourceUniverse*, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE,
+                          kEtcPalErrNoMem);
+
+  // Each slot is allocated separately so that it never moves when the slot array grows.
+  SacnSourceUniverse* new_slot = SACN_CALLOC(1, sizeof(SacnSourceUniverse));
+  if (!new_slot)
+    return kEtcPalErrNoMem;
+
+  source->universe_slots[source->num_universe_slots] = new_slot;
+#else
+  CHECK_ROOM_FOR_ONE_MORE(source, universe_slots, SacnSourceUniverse, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE,
+                          kEtcPalErrNoMem);
+  memset(&source->universe_slots[source->num_universe_slots], 0, sizeof(SacnSourceUniverse));
+#endif
+
+  *slot = (uint16_t)source->num_universe_slots;
+  ++source->num_universe_slots;
+
+  SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_SLOT(source, *slot);
+  universe->slot               = *slot;
+  universe->handle             = next_universe_handle(*slot);
+
+  return kEtcPalErrOk;
+}
+
+// Needs lock
+void release_universe_slot(SacnSource* source, uint16_t slot)
+{
+  // Invalidate any handles to the universe that was in this slot.
+  SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_SLOT(source, slot);
+  universe->handle             = next_universe_handle(universe->handle);
+
+  source->free_universe_slots[source->num_free_universe_slots] = slot;
+  ++source->num_free_universe_slots;
+}
+
+// The low 16 bits of a universe handle are the slot, and the high 16 bits are the slot's generation, which is never 0.
+sacn_source_universe_t next_universe_handle(sacn_source_universe_t handle)
+{
+  uint16_t generation = (uint16_t)((handle >> 16) + 1u);
+  if (generation == 0)
+    generation = 1;
+
+  return ((sacn_source_universe_t)generation << 16) | (handle & 0xffffu);
 }
 
 #endif  // SACN_SOURCE_ENABLED || DOXYGEN
@@ -32,6 +32,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSource
+
 #if SACN_SOURCE_ENABLED || DOXYGEN
 
 /*************************** Function definitions ****************************/
@@ -44,6 +46,16 @@ etcpal_error_t add_sacn_unicast_dest(SacnSourceUniverse*      universe,
   if (!SACN_ASSERT_VERIFY(universe) || !SACN_ASSERT_VERIFY(addr) || !SACN_ASSERT_VERIFY(dest_state))
     return kEtcPalErrSys;
 
+#if SACN_DYNAMIC_MEM
+  // The buffer isn't allocated until the first destination is added, at which point it's sized for the reservation.
+  if (universe->unicast_dests_capacity == 0)
+  {
+    size_t reserved_capacity = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->unicast_dests);
+    CHECK_CAPACITY(universe, reserved_capacity, unicast_dests, SacnUnicastDestination,
+                   SACN_MAX_UNICAST_DESTINATIONS_PER_UNIVERSE, kEtcPalErrNoMem);
+  }
+#endif
+
   CHECK_ROOM_FOR_ONE_MORE(universe, unicast_dests, SacnUnicastDestination, SACN_MAX_UNICAST_DESTINATIONS_PER_UNIVERSE,
                           kEtcPalErrNoMem);
 
@@ -34,6 +34,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSourceDetector
+
 #if SACN_SOURCE_DETECTOR_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -105,8 +107,8 @@ void remove_sacn_source_detector()
   {
 #if SACN_DYNAMIC_MEM
 #if SACN_RECEIVER_SOCKET_PER_NIC
-    free(source_detector.sockets.ipv4_sockets);
-    free(source_detector.sockets.ipv6_sockets);
+    SACN_FREE(source_detector.sockets.ipv4_sockets);
+    SACN_FREE(source_detector.sockets.ipv6_sockets);
 #endif
 
     CLEAR_BUF(&source_detector.netints, netints);
@@ -33,6 +33,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSourceDetector
+
 #if SACN_SOURCE_DETECTOR_ENABLED || DOXYGEN
 
 // Suppress strncpy() warning on Windows/MSVC.
@@ -62,7 +64,7 @@ etcpal_error_t add_sacn_source_detector_expired_source(SourceDetectorSourceExpir
 #if SACN_DYNAMIC_MEM
   if (!source_expired->expired_sources)
   {
-    source_expired->expired_sources = calloc(kSacnInitialCapacity, sizeof(SourceDetectorExpiredSource));
+    source_expired->expired_sources = SACN_CALLOC(kSacnInitialCapacity, sizeof(SourceDetectorExpiredSource));
     if (source_expired->expired_sources)
       source_expired->expired_sources_capacity = kSacnInitialCapacity;
     else
@@ -26,6 +26,7 @@
 #include "sacn/opts.h"
 #include "sacn/private/mem/common.h"
 #include "sacn/private/mem/receiver/remote_source.h"
+#include "sacn/private/mem/slab.h"
 
 #if SACN_DYNAMIC_MEM
 #include <stdlib.h>
@@ -33,6 +34,8 @@
 #include "etcpal/mempool.h"
 #endif
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSourceDetector
+
 #if SACN_SOURCE_DETECTOR_ENABLED || DOXYGEN
 
 // Suppress strncpy() warning on Windows/MSVC.
@@ -48,9 +51,9 @@
 
 #if SACN_DYNAMIC_MEM
 
-/* Macros for dynamic allocation. */
-#define ALLOC_UNIVERSE_DISCOVERY_SOURCE()   malloc(sizeof(SacnUniverseDiscoverySource))
-#define FREE_UNIVERSE_DISCOVERY_SOURCE(ptr) free(ptr)
+/* Macros for dynamic allocation, which is done using per-type slabs. */
+#define ALLOC_UNIVERSE_DISCOVERY_SOURCE()   sacn_slab_alloc(&universe_discovery_source_slab)
+#define FREE_UNIVERSE_DISCOVERY_SOURCE(ptr) sacn_slab_free(&universe_discovery_source_slab, ptr)
 
 #else  // SACN_DYNAMIC_MEM
 
@@ -62,10 +65,13 @@
 
 /**************************** Private variables ******************************/
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+static SacnSlab universe_discovery_source_slab;
+static SacnSlab universe_discovery_source_rb_node_slab;
+#else  // SACN_DYNAMIC_MEM
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_srcdetect_sources, SacnUniverseDiscoverySource, SACN_SOURCE_DETECTOR_MAX_SOURCES);
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_srcdetect_rb_nodes, EtcPalRbNode, SACN_UNIVERSE_DISCOVERY_SOURCE_MAX_RB_NODES);
-#endif  // !SACN_DYNAMIC_MEM
+#endif  // SACN_DYNAMIC_MEM
 
 static EtcPalRbTree universe_discovery_sources;
 
@@ -84,7 +90,12 @@ etcpal_error_t init_universe_discovery_sources(void)
 {
   etcpal_error_t res = kEtcPalErrOk;
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+  sacn_slab_init(&universe_discovery_source_slab, SACN_ALLOC_MODULE, sizeof(SacnUniverseDiscoverySource),
+                 SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  sacn_slab_init(&universe_discovery_source_rb_node_slab, SACN_ALLOC_MODULE, sizeof(EtcPalRbNode),
+                 SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+#else
   res |= etcpal_mempool_init(sacn_pool_srcdetect_sources);
   res |= etcpal_mempool_init(sacn_pool_srcdetect_rb_nodes);
 #endif
@@ -101,6 +112,26 @@ etcpal_error_t init_universe_discovery_sources(void)
 void deinit_universe_discovery_sources(void)
 {
   etcpal_rbtree_clear_with_cb(&universe_discovery_sources, universe_discovery_sources_tree_dealloc);
+
+#if SACN_DYNAMIC_MEM
+  sacn_slab_deinit(&universe_discovery_source_rb_node_slab);
+  sacn_slab_deinit(&universe_discovery_source_slab);
+#endif
+}
+
+// Needs lock
+void add_universe_discovery_source_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  ADD_POOL_STATS(stats, universe_discovery_source_slab, SacnUniverseDiscoverySource);
+  ADD_RB_NODE_POOL_STATS(stats, universe_discovery_source_rb_node_slab);
+#else
+  ADD_POOL_STATS(stats, sacn_pool_srcdetect_sources, SacnUniverseDiscoverySource);
+  ADD_RB_NODE_POOL_STATS(stats, sacn_pool_srcdetect_rb_nodes);
+#endif
 }
 
 etcpal_error_t add_sacn_universe_discovery_source(const EtcPalUuid*             cid,
@@ -142,8 +173,9 @@ etcpal_error_t add_sacn_universe_discovery_source(const EtcPalUuid*
     src->last_notified_universe_count                  = 0;
     src->suppress_universe_limit_exceeded_notification = false;
 #if SACN_DYNAMIC_MEM
-    src->universes          = calloc(kSacnInitialCapacity, sizeof(uint16_t));
-    src->universes_capacity = src->universes ? kSacnInitialCapacity : 0;
+    size_t capacity         = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->universes);
+    src->universes          = SACN_CALLOC(capacity, sizeof(uint16_t));
+    src->universes_capacity = src->universes ? capacity : 0;
 
     if (!src->universes)
       result = kEtcPalErrNoMem;
@@ -274,7 +306,7 @@ void universe_discovery_sources_tree_dealloc(const EtcPalRbTree* self, EtcPalRbN
 EtcPalRbNode* universe_discovery_source_node_alloc(void)
 {
 #if SACN_DYNAMIC_MEM
-  return (EtcPalRbNode*)malloc(sizeof(EtcPalRbNode));
+  return (EtcPalRbNode*)sacn_slab_alloc(&universe_discovery_source_rb_node_slab);
 #else
   return etcpal_mempool_alloc(sacn_pool_srcdetect_rb_nodes);
 #endif
@@ -286,7 +318,7 @@ void universe_discovery_source_node_dealloc(EtcPalRbNode* node)
     return;
 
 #if SACN_DYNAMIC_MEM
-  free(node);
+  sacn_slab_free(&universe_discovery_source_rb_node_slab, node);
 #else
   etcpal_mempool_free(sacn_pool_srcdetect_rb_nodes, node);
 #endif
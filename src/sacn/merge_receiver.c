@@ -27,6 +27,8 @@
 #include "sacn/private/util.h"
 #include "sacn/private/merge_receiver.h"
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleMergeReceiver
+
 #if SACN_MERGE_RECEIVER_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -39,6 +41,11 @@ static etcpal_mutex_t merge_receiver_cb_mutex;
 static bool merge_receiver_cb_lock();
 static void merge_receiver_cb_unlock();
 
+#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
+static sacn_dmx_merger_t get_sampling_merger(SacnMergeReceiver* merge_receiver);
+static void              release_sampling_merger(SacnMergeReceiver* merge_receiver);
+#endif
+
 /*************************** Function definitions ****************************/
 
 /**************************************************************************************************
@@ -158,25 +165,10 @@ etcpal_error_t sacn_merge_receiver_create(const SacnMergeReceiverConfig* config,
         result                               = create_sacn_dmx_merger(&merger_config, &merger_handle);
       }
 
+      // The sampling merger isn't created until the first source is seen in a sampling period.
       if (result == kEtcPalErrOk)
         merge_receiver->merger_handle = merger_handle;
 
-#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
-      sacn_dmx_merger_t sampling_merger_handle = kSacnDmxMergerInvalid;
-      if (result == kEtcPalErrOk)
-      {
-        SacnDmxMergerConfig sampling_merger_config    = SACN_DMX_MERGER_CONFIG_INIT;
-        sampling_merger_config.levels                 = merge_receiver->sampling_levels;
-        sampling_merger_config.per_address_priorities = merge_receiver->sampling_priorities;
-        sampling_merger_config.owners                 = merge_receiver->sampling_owners;
-        sampling_merger_config.source_count_max       = config->source_count_max;
-        result = create_sacn_dmx_merger(&sampling_merger_config, &sampling_merger_handle);
-      }
-
-      if (result == kEtcPalErrOk)
-        merge_receiver->sampling_merger_handle = sampling_merger_handle;
-#endif
-
       if (result != kEtcPalErrOk)
       {
         if (receiver_handle != kSacnReceiverInvalid)
@@ -187,10 +179,6 @@ etcpal_error_t sacn_merge_receiver_create(const SacnMergeReceiverConfig* config,
 
         if (merger_handle != kSacnDmxMergerInvalid)
           destroy_sacn_dmx_merger(merger_handle);
-#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
-        if (sampling_merger_handle != kSacnDmxMergerInvalid)
-          destroy_sacn_dmx_merger(sampling_merger_handle);
-#endif
       }
 
       sacn_receiver_unlock();
@@ -241,7 +229,7 @@ etcpal_error_t sacn_merge_receiver_destroy(sacn_merge_receiver_t handle)
           destroy_sacn_receiver((sacn_receiver_t)handle);
           destroy_sacn_dmx_merger(merge_receiver->merger_handle);
 #if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
-          destroy_sacn_dmx_merger(merge_receiver->sampling_merger_handle);
+          release_sampling_merger(merge_receiver);
 #endif
           remove_sacn_merge_receiver(handle);
         }
@@ -355,7 +343,12 @@ etcpal_error_t sacn_merge_receiver_change_universe(sacn_merge_receiver_t handle,
       }
 
       if (result == kEtcPalErrOk)
+      {
         clear_sacn_merge_receiver_sources(merge_receiver);
+#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
+        release_sampling_merger(merge_receiver);
+#endif
+      }
 
       sacn_receiver_unlock();
     }
@@ -490,7 +483,7 @@ etcpal_error_t sacn_merge_receiver_reset_networking_per_receiver(
   SacnReceiverNetintList* receiver_netint_lists = NULL;
   if (result == kEtcPalErrOk)
   {
-    receiver_netint_lists = calloc(num_per_receiver_netint_lists, sizeof(SacnReceiverNetintList));
+    receiver_netint_lists = SACN_CALLOC(num_per_receiver_netint_lists, sizeof(SacnReceiverNetintList));
 
     if (!receiver_netint_lists)
       result = kEtcPalErrNoMem;
@@ -516,7 +509,7 @@ etcpal_error_t sacn_merge_receiver_reset_networking_per_receiver(
 
 #if SACN_DYNAMIC_MEM
   if (receiver_netint_lists)
-    free(receiver_netint_lists);
+    SACN_FREE(receiver_netint_lists);
 #endif
 
   return result;
@@ -635,7 +628,7 @@ void merge_receiver_universe_data(sacn_receiver_t             receiver_handle,
 #if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
         bool              sampling = universe_data->is_sampling;
         sacn_dmx_merger_t merger_handle =
-            sampling ? merge_receiver->sampling_merger_handle : merge_receiver->merger_handle;
+            sampling ? get_sampling_merger(merge_receiver) : merge_receiver->merger_handle;
 #else
         bool              sampling      = merge_receiver->sampling;
         sacn_dmx_merger_t merger_handle = merge_receiver->merger_handle;
@@ -645,7 +638,7 @@ void merge_receiver_universe_data(sacn_receiver_t             receiver_handle,
         {
           update_merge_receiver_source_info(source, source_addr, source_info, universe_data);
         }
-        else
+        else if (merger_handle != kSacnDmxMergerInvalid)  // Otherwise try again with the source's next packet.
         {
           add_sacn_dmx_merger_source_with_handle(merger_handle, merger_source_handle);
 
@@ -924,6 +917,11 @@ void merge_receiver_sampling_ended(sacn_receiver_t handle, uint16_t universe, sa
           source->sampling = false;
         }
 
+#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
+        // Every source has moved to the output merger, so the sampling merger isn't needed until the next period.
+        release_sampling_merger(merge_receiver);
+#endif
+
         if (merged_data_notification && (etcpal_rbtree_size(&merge_receiver->sources) > 0))
         {
           if (SACN_ASSERT_VERIFY(SACN_MERGE_RECEIVER_MAX_SLOTS <= SACN_DMX_MERGER_MAX_SLOTS) &&
@@ -1110,6 +1108,67 @@ void merge_receiver_source_limit_exceeded(sacn_receiver_t handle, uint16_t unive
   }
 }
 
+#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
+// Needs lock
+// Gets the merge receiver's sampling merger, creating it if this is the first source of the sampling period. Returns
+// kSacnDmxMergerInvalid if it couldn't be created.
+sacn_dmx_merger_t get_sampling_merger(SacnMergeReceiver* merge_receiver)
+{
+  if (merge_receiver->sampling_merger_handle != kSacnDmxMergerInvalid)
+    return merge_receiver->sampling_merger_handle;
+
+#if SACN_DYNAMIC_MEM
+  SacnMergeReceiverSamplingBufs* bufs = merge_receiver->sampling_bufs;
+  if (!bufs)
+  {
+    bufs = SACN_MALLOC(sizeof(SacnMergeReceiverSamplingBufs));
+    if (!bufs)
+    {
+      SACN_LOG_ERR("Could not allocate memory for merge receiver sampling merger!");
+      return kSacnDmxMergerInvalid;
+    }
+
+    merge_receiver->sampling_bufs = bufs;
+  }
+#else
+  SacnMergeReceiverSamplingBufs* bufs = &merge_receiver->sampling_bufs;
+#endif
+
+  SacnDmxMergerConfig sampling_merger_config    = SACN_DMX_MERGER_CONFIG_INIT;
+  sampling_merger_config.levels                 = bufs->levels;
+  sampling_merger_config.per_address_priorities = bufs->priorities;
+  sampling_merger_config.owners                 = bufs->owners;
+  sampling_merger_config.source_count_max       = merge_receiver->source_count_max;
+
+  sacn_dmx_merger_t sampling_merger_handle = kSacnDmxMergerInvalid;
+  if (create_sacn_dmx_merger(&sampling_merger_config, &sampling_merger_handle) == kEtcPalErrOk)
+    merge_receiver->sampling_merger_handle = sampling_merger_handle;
+  else
+    SACN_LOG_ERR("Could not create merge receiver sampling merger!");
+
+  return merge_receiver->sampling_merger_handle;
+}
+
+// Needs lock
+// Destroys the merge receiver's sampling merger, if it has one, and frees its buffers.
+void release_sampling_merger(SacnMergeReceiver* merge_receiver)
+{
+  if (merge_receiver->sampling_merger_handle != kSacnDmxMergerInvalid)
+  {
+    destroy_sacn_dmx_merger(merge_receiver->sampling_merger_handle);
+    merge_receiver->sampling_merger_handle = kSacnDmxMergerInvalid;
+  }
+
+#if SACN_DYNAMIC_MEM
+  if (merge_receiver->sampling_bufs)
+  {
+    SACN_FREE(merge_receiver->sampling_bufs);
+    merge_receiver->sampling_bufs = NULL;
+  }
+#endif
+}
+#endif  // SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
+
 bool merge_receiver_cb_lock()
 {
   return etcpal_mutex_lock(&merge_receiver_cb_mutex);
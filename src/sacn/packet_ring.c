@@ -0,0 +1,423 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+/*
+ * The AF_PACKET receive backend used by the receive threads on Linux when SACN_RECEIVER_ENABLE_PACKET_RING is enabled.
+ * Each thread owns one ring, which is only ever touched from that thread.
+ *
+ * The kernel fills the ring's blocks with frames and hands each block over once it is full or has timed out. The
+ * thread then walks the block's frames in place, and gives the block back once the last frame has been processed.
+ * The socket is in cooked mode, so frames start at the IP header whatever the link type.
+ *
+ * A packet socket can only be bound to one interface or to all of them, so the ring is bound to all of them, and its
+ * filter picks out the interfaces and universes of its thread's receivers. Every thread's ring gets its own copy of
+ * each frame that passes the kernel, and the filters are what keep a universe's traffic out of the rings of the
+ * threads that don't own it.
+ */
+
+#include "sacn/private/packet_ring.h"
+
+#if SACN_RECEIVER_USE_PACKET_RING
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <linux/filter.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include "etcpal/pack.h"
+#include "sacn/private/mem/common.h"
+#include "sacn/private/util.h"
+
+/****************************** Private macros *******************************/
+
+// Frames are variable-length in TPACKET_V3, but the kernel still wants a nominal frame size that divides the blocks.
+#define PACKET_RING_FRAME_SIZE 2048u
+#define PACKET_RING_FRAMES \
+  ((SACN_RECEIVER_PACKET_RING_BLOCK_SIZE / PACKET_RING_FRAME_SIZE) * SACN_RECEIVER_PACKET_RING_BLOCKS)
+#define PACKET_RING_MAP_SIZE ((size_t)SACN_RECEIVER_PACKET_RING_BLOCK_SIZE * SACN_RECEIVER_PACKET_RING_BLOCKS)
+
+#define IPV4_MIN_HEADER_SIZE 20u
+#define IPV6_HEADER_SIZE     40u
+#define UDP_HEADER_SIZE      8u
+#define IP_PROTO_UDP         17u
+
+/*********************** Private function prototypes *************************/
+
+static etcpal_error_t             errno_to_error(int err);
+static struct tpacket_block_desc* get_block(const SacnPacketRing* ring, unsigned int index);
+static bool                       contains_netint(const unsigned int* netints, size_t num_netints, unsigned int netint);
+static int                        set_allmulti(int fd, unsigned int ifindex, int action);
+
+/*************************** Function definitions ****************************/
+
+/*
+ * Opens the thread's packet socket, attaches the given filter and maps its receive ring. The ring starts out on no
+ * interfaces - see sacn_packet_ring_set_netints().
+ *
+ * [out] ring The ring to initialize.
+ * [in] filter The classic BPF program that selects the frames to receive. See sacn_build_ring_filter().
+ * [in] filter_len Number of instructions in filter.
+ * Returns kEtcPalErrOk on success, kEtcPalErrPerm if the process doesn't have CAP_NET_RAW, or another error code on
+ * other failures.
+ */
+etcpal_error_t sacn_packet_ring_init(SacnPacketRing* ring, const SacnBpfInsn* filter, size_t filter_len)
+{
+  if (!SACN_ASSERT_VERIFY(ring) || !SACN_ASSERT_VERIFY(filter) || !SACN_ASSERT_VERIFY(filter_len > 0))
+    return kEtcPalErrSys;
+
+  memset(ring, 0, sizeof(SacnPacketRing));
+
+  // Nothing is received until the socket is bound to a protocol, which happens once the filter is in place.
+  ring->fd = socket(AF_PACKET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+  if (ring->fd < 0)
+    return errno_to_error(errno);
+
+  int version = TPACKET_V3;
+  int one     = 1;
+
+  struct tpacket_req3 req;
+  memset(&req, 0, sizeof(req));
+  req.tp_block_size     = SACN_RECEIVER_PACKET_RING_BLOCK_SIZE;
+  req.tp_block_nr       = SACN_RECEIVER_PACKET_RING_BLOCKS;
+  req.tp_frame_size     = PACKET_RING_FRAME_SIZE;
+  req.tp_frame_nr       = PACKET_RING_FRAMES;
+  req.tp_retire_blk_tov = SACN_RECEIVER_PACKET_RING_BLOCK_TIMEOUT_MS;
+
+  int res = setsockopt(ring->fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version));
+  if ((res == 0) && (sacn_packet_ring_set_filter(ring, filter, filter_len) != kEtcPalErrOk))
+    res = -1;
+  if (res == 0)
+    res = setsockopt(ring->fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req));
+
+  // Leave out this host's own transmissions. Older kernels don't have this option, so those frames are skipped while
+  // parsing instead.
+  if (res == 0)
+    setsockopt(ring->fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &one, sizeof(one));
+
+  if (res == 0)
+  {
+    void* map = mmap(NULL, PACKET_RING_MAP_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, 0);
+    if (map == MAP_FAILED)
+    {
+      res = -1;
+    }
+    else
+    {
+      ring->map      = (uint8_t*)map;
+      ring->map_size = PACKET_RING_MAP_SIZE;
+    }
+  }
+
+  if (res == 0)
+  {
+    struct sockaddr_ll addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sll_family   = AF_PACKET;
+    addr.sll_protocol = htons(ETH_P_ALL);
+    addr.sll_ifindex  = 0;  // All interfaces - the filter picks out the ones in use.
+    res               = bind(ring->fd, (struct sockaddr*)&addr, sizeof(addr));
+  }
+
+  if (res != 0)
+  {
+    etcpal_error_t err = errno_to_error(errno);
+    sacn_packet_ring_deinit(ring);
+    return err;
+  }
+
+  return kEtcPalErrOk;
+}
+
+/*
+ * Unmaps the ring and closes its socket, which also takes its interfaces back out of all-multicast mode.
+ *
+ * [in,out] ring The ring to deinitialize.
+ */
+void sacn_packet_ring_deinit(SacnPacketRing* ring)
+{
+  if (!SACN_ASSERT_VERIFY(ring))
+    return;
+
+  if (ring->map)
+    munmap(ring->map, ring->map_size);
+  if (ring->fd >= 0)
+    close(ring->fd);
+#if SACN_DYNAMIC_MEM
+  if (ring->netints)
+    SACN_FREE(ring->netints);
+#endif
+
+  memset(ring, 0, sizeof(SacnPacketRing));
+  ring->fd = -1;
+}
+
+/*
+ * Sets the interfaces the ring receives on. Interfaces that are new to the ring are put into all-multicast mode for as
+ * long as they are in use, so multicast for every group reaches the ring, not just the groups the host has joined.
+ * Interfaces that are no longer used are taken back out of it. The ring's filter must then be rebuilt from the ring's
+ * netints, as the socket itself is bound to all interfaces.
+ *
+ * [in,out] ring The thread's ring.
+ * [in] netints Indexes of the interfaces, without duplicates.
+ * [in] num_netints Number of entries in netints.
+ * Returns kEtcPalErrOk on success, or an error code if an interface couldn't be put into all-multicast mode. The ring
+ * keeps the interfaces that could be.
+ */
+etcpal_error_t sacn_packet_ring_set_netints(SacnPacketRing* ring, const unsigned int* netints, size_t num_netints)
+{
+  if (!SACN_ASSERT_VERIFY(ring) || !SACN_ASSERT_VERIFY(netints || (num_netints == 0)))
+    return kEtcPalErrSys;
+
+  CHECK_CAPACITY(ring, num_netints, netints, unsigned int, SACN_MAX_NETINTS, kEtcPalErrNoMem);
+
+  size_t num_kept = 0;
+  for (size_t i = 0; i < ring->num_netints; ++i)
+  {
+    if (contains_netint(netints, num_netints, ring->netints[i]))
+      ring->netints[num_kept++] = ring->netints[i];
+    else
+      set_allmulti(ring->fd, ring->netints[i], PACKET_DROP_MEMBERSHIP);
+  }
+  ring->num_netints = num_kept;
+
+  etcpal_error_t res = kEtcPalErrOk;
+  for (const unsigned int* netint = netints; netint < netints + num_netints; ++netint)
+  {
+    if (contains_netint(ring->netints, num_kept, *netint))
+      continue;
+
+    int err = set_allmulti(ring->fd, *netint, PACKET_ADD_MEMBERSHIP);
+    if (err == 0)
+      ring->netints[ring->num_netints++] = *netint;
+    else
+      res = errno_to_error(err);
+  }
+
+  return res;
+}
+
+/*
+ * Replaces the ring's filter. The kernel swaps the filter in one step, so no frames get through unfiltered.
+ *
+ * [in,out] ring The thread's ring.
+ * [in] filter The classic BPF program that selects the frames to receive. See sacn_build_ring_filter().
+ * [in] filter_len Number of instructions in filter.
+ * Returns kEtcPalErrOk on success, or an error code if the kernel rejected the filter.
+ */
+etcpal_error_t sacn_packet_ring_set_filter(SacnPacketRing* ring, const SacnBpfInsn* filter, size_t filter_len)
+{
+  if (!SACN_ASSERT_VERIFY(ring) || !SACN_ASSERT_VERIFY(filter) || !SACN_ASSERT_VERIFY(filter_len > 0))
+    return kEtcPalErrSys;
+
+  struct sock_fprog prog;
+  prog.len    = (unsigned short)filter_len;
+  prog.filter = (struct sock_filter*)filter;
+
+  if (setsockopt(ring->fd, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog)) != 0)
+    return errno_to_error(errno);
+
+  return kEtcPalErrOk;
+}
+
+/*
+ * Gets the next sACN packet from the ring, if the kernel has handed over any more. Blocks are given back to the kernel
+ * as they are finished with, so the packet data stays valid until the next call.
+ *
+ * [in,out] ring The thread's ring.
+ * [out] read_result Filled in with the packet, pointing into the ring.
+ * Returns true if a packet was found, or false if the ring is empty for now. Wait for the ring's socket to become
+ * readable before trying again.
+ */
+bool sacn_packet_ring_next(SacnPacketRing* ring, SacnReadResult* read_result)
+{
+  if (!SACN_ASSERT_VERIFY(ring) || !SACN_ASSERT_VERIFY(read_result))
+    return false;
+
+  while (true)
+  {
+    struct tpacket_block_desc* block = get_block(ring, ring->current_block);
+    if (!ring->in_block)
+    {
+      if (!(__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER))
+        return false;
+
+      ring->in_block    = true;
+      ring->next_frame  = (uint8_t*)block + block->hdr.bh1.offset_to_first_pkt;
+      ring->frames_left = block->hdr.bh1.num_pkts;
+    }
+
+    if (ring->frames_left == 0)
+    {
+      __atomic_store_n(&block->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+      ring->in_block      = false;
+      ring->current_block = (ring->current_block + 1) % SACN_RECEIVER_PACKET_RING_BLOCKS;
+      continue;
+    }
+
+    const struct tpacket3_hdr* frame = (const struct tpacket3_hdr*)ring->next_frame;
+    ring->next_frame += frame->tp_next_offset;
+    --ring->frames_left;
+
+    if (sacn_packet_ring_parse_frame(frame, read_result))
+      return true;
+  }
+}
+
+etcpal_error_t errno_to_error(int err)
+{
+  switch (err)
+  {
+    case EPERM:
+    case EACCES:
+      return kEtcPalErrPerm;
+    case ENOMEM:
+      return kEtcPalErrNoMem;
+    case EAFNOSUPPORT:
+    case ENOPROTOOPT:
+    case EINVAL:
+      return kEtcPalErrNotImpl;
+    default:
+      return kEtcPalErrSys;
+  }
+}
+
+struct tpacket_block_desc* get_block(const SacnPacketRing* ring, unsigned int index)
+{
+  return (struct tpacket_block_desc*)(ring->map + ((size_t)index * SACN_RECEIVER_PACKET_RING_BLOCK_SIZE));
+}
+
+bool contains_netint(const unsigned int* netints, size_t num_netints, unsigned int netint)
+{
+  for (size_t i = 0; i < num_netints; ++i)
+  {
+    if (netints[i] == netint)
+      return true;
+  }
+  return false;
+}
+
+// Returns 0 on success, or the errno value on failure.
+int set_allmulti(int fd, unsigned int ifindex, int action)
+{
+  struct packet_mreq mreq;
+  memset(&mreq, 0, sizeof(mreq));
+  mreq.mr_ifindex = (int)ifindex;
+  mreq.mr_type    = PACKET_MR_ALLMULTI;
+
+  return (setsockopt(fd, SOL_PACKET, action, &mreq, sizeof(mreq)) == 0) ? 0 : errno;
+}
+
+/*
+ * Finds the UDP payload of a frame, along with its source address and the interface it came in on. The kernel filter
+ * has already checked the interface and the destination port, but everything else is validated here.
+ *
+ * Only frames addressed to this host are used - not this host's own transmissions, nor frames for other hosts that
+ * reach the socket while an interface is promiscuous. VLAN-tagged frames are skipped as well, whether the tag is still
+ * in the frame or has been stripped into the frame's metadata: they are the parent interface's copy, and the VLAN
+ * interface gets its own untagged copy if it exists.
+ *
+ * [in] frame The frame, as the kernel placed it in the ring.
+ * [out] read_result Filled in with the packet, pointing into the frame.
+ * Returns true if the frame holds an sACN packet, or false if it should be skipped.
+ */
+bool sacn_packet_ring_parse_frame(const struct tpacket3_hdr* frame, SacnReadResult* read_result)
+{
+  if (!SACN_ASSERT_VERIFY(frame) || !SACN_ASSERT_VERIFY(read_result))
+    return false;
+
+  const struct sockaddr_ll* link =
+      (const struct sockaddr_ll*)((const uint8_t*)frame + TPACKET_ALIGN(sizeof(struct tpacket3_hdr)));
+  switch (link->sll_pkttype)
+  {
+    case PACKET_HOST:
+    case PACKET_BROADCAST:
+    case PACKET_MULTICAST:
+      break;
+    default:
+      return false;
+  }
+
+  if ((frame->tp_status & TP_STATUS_VLAN_VALID) || (frame->tp_snaplen < frame->tp_len) ||
+      (frame->tp_net < frame->tp_mac) || ((uint32_t)(frame->tp_net - frame->tp_mac) > frame->tp_snaplen))
+  {
+    return false;
+  }
+
+  const uint8_t* ip     = (const uint8_t*)frame + frame->tp_net;
+  size_t         ip_len = frame->tp_snaplen - (size_t)(frame->tp_net - frame->tp_mac);
+
+  const uint8_t* udp     = NULL;
+  size_t         udp_len = 0;
+  if ((link->sll_protocol == htons(ETH_P_IP)) && (ip_len >= IPV4_MIN_HEADER_SIZE) && ((ip[0] >> 4) == 4))
+  {
+    size_t header_len = (size_t)(ip[0] & 0x0f) * 4u;
+    size_t total_len  = etcpal_unpack_u16b(&ip[2]);
+    if ((header_len < IPV4_MIN_HEADER_SIZE) || (total_len > ip_len) || (total_len < header_len + UDP_HEADER_SIZE) ||
+        (ip[9] != IP_PROTO_UDP) || (etcpal_unpack_u16b(&ip[6]) & 0x3fff))  // Fragments are skipped.
+    {
+      return false;
+    }
+
+    ETCPAL_IP_SET_V4_ADDRESS(&read_result->from_addr.ip, etcpal_unpack_u32b(&ip[12]));
+    read_result->netint.ip_type = kEtcPalIpTypeV4;
+    udp                         = ip + header_len;
+    udp_len                     = total_len - header_len;
+  }
+  else if ((link->sll_protocol == htons(ETH_P_IPV6)) && (ip_len >= IPV6_HEADER_SIZE + UDP_HEADER_SIZE) &&
+           ((ip[0] >> 4) == 6))
+  {
+    size_t payload_len = etcpal_unpack_u16b(&ip[4]);
+    if ((ip[6] != IP_PROTO_UDP) || (payload_len > ip_len - IPV6_HEADER_SIZE) || (payload_len < UDP_HEADER_SIZE))
+      return false;
+
+    ETCPAL_IP_SET_V6_ADDRESS(&read_result->from_addr.ip, &ip[8]);
+    read_result->netint.ip_type = kEtcPalIpTypeV6;
+    udp                         = ip + IPV6_HEADER_SIZE;
+    udp_len                     = payload_len;
+  }
+  else
+  {
+    return false;  // Not IP, or still VLAN-tagged.
+  }
+
+  size_t datagram_len = etcpal_unpack_u16b(&udp[4]);
+  if ((etcpal_unpack_u16b(&udp[2]) != kSacnPort) || (datagram_len < UDP_HEADER_SIZE) || (datagram_len > udp_len))
+    return false;
+
+  read_result->from_addr.port = etcpal_unpack_u16b(&udp[0]);
+  read_result->netint.index   = (unsigned int)link->sll_ifindex;
+  read_result->data           = (uint8_t*)udp + UDP_HEADER_SIZE;
+  read_result->data_len       = datagram_len - UDP_HEADER_SIZE;
+
+  // Every thread's ring gets its own copy of every frame, unicast or not.
+  read_result->copied_to_all_threads = true;
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+  read_result->timestamp_ns =
+      sacn_receive_time_from_realtime_ns(((uint64_t)frame->tp_sec * 1000000000u) + frame->tp_nsec);
+#else
+  read_result->timestamp_ns = 0;
+#endif
+  return true;
+}
+
+#endif  // SACN_RECEIVER_USE_PACKET_RING
@@ -84,6 +84,20 @@ bool parse_sacn_data_packet(const uint8_t*        buf,
   return true;
 }
 
+// Reads just the universe from a data packet's framing layer, without validating the rest of the packet.
+bool peek_sacn_data_packet_universe(const uint8_t* buf, size_t buflen, uint16_t* universe)
+{
+  if (!SACN_ASSERT_VERIFY(buf) || !SACN_ASSERT_VERIFY(universe))
+    return false;
+
+  // Check the buffer size
+  if (buflen < kSacnDataPacketMinSize)
+    return false;
+
+  *universe = etcpal_unpack_u16b(&buf[75]);
+  return true;
+}
+
 bool parse_framing_layer_vector(const uint8_t* buf, size_t buflen, uint32_t* vector)
 {
   if (!SACN_ASSERT_VERIFY(buf) || !SACN_ASSERT_VERIFY(vector))
@@ -375,6 +389,7 @@ void update_send_buf_data(uint8_t*                   send_buf,
   // Update the size/count fields for the new data size (slot count)
   SET_DATA_SLOT_COUNT(send_buf, new_data_size);
 
-  // Copy data into the send buffer immediately after the start code
-  memcpy(&send_buf[SACN_DATA_HEADER_SIZE], new_data, new_data_size);
+  // Copy data into the send buffer immediately after the start code, unless it was written there in place
+  if (new_data != &send_buf[SACN_DATA_HEADER_SIZE])
+    memcpy(&send_buf[SACN_DATA_HEADER_SIZE], new_data, new_data_size);
 }
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+/**
+ * @file sacn/private/atomic.h
+ * @brief Relaxed atomic operations used internally by the sACN library
+ *
+ * These are for counters and flags that are read outside the lock that guards their writes. They
+ * carry no ordering guarantees beyond the variable itself.
+ *
+ * Loads of 8 and 32-bit values are plain volatile reads, which every supported target performs in a
+ * single access as long as the variable is naturally aligned. Read-modify-write operations and
+ * 64-bit loads use the compiler's atomics (GCC and Clang's __atomic builtins, or MSVC's Interlocked
+ * intrinsics), then C11 <stdatomic.h>. As a last resort they fall back to plain volatile accesses,
+ * which are only safe for a variable with a single writer at a time, and may tear 64-bit loads on
+ * 32-bit targets.
+ */
+
+#ifndef SACN_PRIVATE_ATOMIC_H_
+#define SACN_PRIVATE_ATOMIC_H_
+
+#include <stdint.h>
+
+#define SACN_ATOMIC_LOAD_U8(var)       (*(const volatile uint8_t*)&(var))
+#define SACN_ATOMIC_STORE_U8(var, val) (*(volatile uint8_t*)&(var) = (uint8_t)(val))
+#define SACN_ATOMIC_LOAD_U32(var)      (*(const volatile uint32_t*)&(var))
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SACN_ATOMIC_OR_U32(var, bits)  __atomic_fetch_or(&(var), (bits), __ATOMIC_RELAXED)
+#define SACN_ATOMIC_AND_U32(var, bits) __atomic_fetch_and(&(var), (bits), __ATOMIC_RELAXED)
+#define SACN_ATOMIC_INCREMENT_U64(var) __atomic_add_fetch(&(var), 1, __ATOMIC_RELAXED)
+#define SACN_ATOMIC_LOAD_U64(var)      __atomic_load_n(&(var), __ATOMIC_RELAXED)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+
+#define SACN_ATOMIC_OR_U32(var, bits)  _InterlockedOr((volatile long*)&(var), (long)(bits))
+#define SACN_ATOMIC_AND_U32(var, bits) _InterlockedAnd((volatile long*)&(var), (long)(bits))
+#define SACN_ATOMIC_INCREMENT_U64(var) _InterlockedIncrement64((volatile __int64*)&(var))
+#ifdef _WIN64
+#define SACN_ATOMIC_LOAD_U64(var) (*(const volatile uint64_t*)&(var))
+#else
+#define SACN_ATOMIC_LOAD_U64(var) ((uint64_t)_InterlockedCompareExchange64((volatile __int64*)&(var), 0, 0))
+#endif
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+
+#define SACN_ATOMIC_OR_U32(var, bits) \
+  atomic_fetch_or_explicit((volatile _Atomic uint32_t*)&(var), (bits), memory_order_relaxed)
+#define SACN_ATOMIC_AND_U32(var, bits) \
+  atomic_fetch_and_explicit((volatile _Atomic uint32_t*)&(var), (bits), memory_order_relaxed)
+#define SACN_ATOMIC_INCREMENT_U64(var) \
+  atomic_fetch_add_explicit((volatile _Atomic uint64_t*)&(var), 1, memory_order_relaxed)
+#define SACN_ATOMIC_LOAD_U64(var) atomic_load_explicit((volatile _Atomic uint64_t*)&(var), memory_order_relaxed)
+#else
+#define SACN_ATOMIC_OR_U32(var, bits)  (*(volatile uint32_t*)&(var) |= (uint32_t)(bits))
+#define SACN_ATOMIC_AND_U32(var, bits) (*(volatile uint32_t*)&(var) &= (uint32_t)(bits))
+#define SACN_ATOMIC_INCREMENT_U64(var) (++*(volatile uint64_t*)&(var))
+#define SACN_ATOMIC_LOAD_U64(var)      (*(const volatile uint64_t*)&(var))
+#endif
+
+#endif /* SACN_PRIVATE_ATOMIC_H_ */
@@ -88,6 +88,45 @@ enum
   ((((SACN_RECEIVER_MAX_UNIVERSES - 1) / SACN_RECEIVER_MAX_SUBS_PER_SOCKET) + 1) * 2)
 #endif
 
+/* Kernel packet filtering and SO_REUSEPORT steering are only implemented on Linux. */
+#if SACN_RECEIVER_ENABLE_BPF_FILTER && defined(__linux__)
+#define SACN_RECEIVER_USE_BPF_FILTER 1
+#else
+#define SACN_RECEIVER_USE_BPF_FILTER 0
+#endif
+
+#if SACN_RECEIVER_ENABLE_REUSEPORT_STEERING && defined(__linux__)
+#define SACN_RECEIVER_USE_REUSEPORT_STEERING 1
+#else
+#define SACN_RECEIVER_USE_REUSEPORT_STEERING 0
+#endif
+
+#if SACN_RECEIVER_ENABLE_IO_URING && defined(__linux__)
+#define SACN_RECEIVER_USE_IO_URING 1
+#else
+#define SACN_RECEIVER_USE_IO_URING 0
+#endif
+
+#if SACN_RECEIVER_ENABLE_PACKET_RING && defined(__linux__)
+#define SACN_RECEIVER_USE_PACKET_RING 1
+#else
+#define SACN_RECEIVER_USE_PACKET_RING 0
+#endif
+
+#if SACN_RECEIVER_ENABLE_UDP_GRO && defined(__linux__)
+#define SACN_RECEIVER_USE_UDP_GRO 1
+#define SACN_RECEIVER_RECV_BUF_SIZE 65535  // Room for a full coalesced read
+#else
+#define SACN_RECEIVER_USE_UDP_GRO 0
+#define SACN_RECEIVER_RECV_BUF_SIZE kSacnMtu
+#endif
+
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS && defined(__linux__)
+#define SACN_RECEIVER_USE_KERNEL_TIMESTAMPS 1
+#else
+#define SACN_RECEIVER_USE_KERNEL_TIMESTAMPS 0
+#endif
+
 typedef unsigned int          sacn_thread_id_t;
 static const sacn_thread_id_t kSacnThreadIdInvalid = UINT_MAX;
 
@@ -178,6 +217,16 @@ static const sacn_thread_id_t kSacnThreadIdInvalid = UINT_MAX;
 #define SACN_FEATURES_ALL_BUT(mask) (((uint32_t)SACN_FEATURES_ALL) & ((uint32_t)(~((uint32_t)(mask)))))
 #define SACN_ALL_NETWORK_FEATURES   SACN_FEATURES_ALL_BUT(SACN_FEATURE_DMX_MERGER)
 
+/*
+ * The cache line size assumed when budgeting the hot fields of the structs used on the receive path, and a
+ * C99-compatible compile-time check to keep those layouts honest. name must be unique within the translation unit.
+ *
+ * These structs are allocated with the default alignment, not on cache line boundaries, so fields spanning n lines'
+ * worth of bytes can touch n + 1 lines. The budgets bound the hot footprint; they don't place it on a line.
+ */
+#define SACN_CACHE_LINE_SIZE           64
+#define SACN_STATIC_ASSERT(expr, name) typedef char sacn_static_assert_##name[(expr) ? 1 : -1]
+
 /******************************************************************************
  * Logging
  *****************************************************************************/
@@ -451,43 +500,78 @@ typedef struct SacnReceiverKeys
   uint16_t        universe;
 } SacnReceiverKeys;
 
-/* An sACN universe to which we are currently listening. */
-typedef struct SacnReceiver SacnReceiver;
-struct SacnReceiver
+/*
+ * Receive load, used to balance receivers across threads. Packets and processing time accumulate over a stats window,
+ * then are converted to per-second rates. Always accessed under the receiver lock.
+ */
+typedef struct SacnReceiveLoad
 {
-  // Identification
-  SacnReceiverKeys keys;  // This must be the first member.
-  sacn_thread_id_t thread_id;
+  uint32_t window_packets;
+  uint32_t window_processing_us;
+  uint32_t packets_per_sec;
+  uint32_t processing_us_per_sec;
+} SacnReceiveLoad;
 
-  // Sockets / network interface info
-  SacnInternalSocketState sockets;
-  /* Array of network interfaces on which to listen to the specified universe. */
-  SacnInternalNetintArray netints;
-
-  // State tracking
-  bool         sampling;
-  bool         notified_sampling_started;
-  EtcPalTimer  sample_timer;
-  EtcPalRbTree sampling_period_netints;
+/* The number of sources a receiver can look up without searching its sources tree. */
+#define SACN_RECEIVER_INLINE_SOURCES 4
 
-  bool            suppress_limit_exceeded_notification;
-  EtcPalRbTree    sources;    // The sources being tracked on this universe.
-  TerminationSet* term_sets;  // Source loss tracking
+/*
+ * The first sources tracked on a receiver, searched linearly before falling back to the receiver's sources tree. Most
+ * universes only have a handful of sources, so this saves the tree search on most packets. Every source in the table is
+ * also in the tree, which stays the owner of the sources and is used to iterate them.
+ */
+typedef struct SacnInlineSourceTable
+{
+  sacn_remote_source_t      handles[SACN_RECEIVER_INLINE_SOURCES];
+  size_t                    num_sources;
+  struct SacnTrackedSource* sources[SACN_RECEIVER_INLINE_SOURCES];
+} SacnInlineSourceTable;
 
-  // Option flags
-  bool filter_preview_data;
+/* An sACN universe to which we are currently listening. */
+typedef struct SacnReceiver SacnReceiver;
+/*
+ * The members are ordered by how often the receive path touches them. Everything handle_sacn_data_packet() reads or
+ * writes to look up a known source and update its state comes first, within the first 2 * SACN_CACHE_LINE_SIZE bytes.
+ * The callbacks and footprint it copies into the universe data notification come next, and data only used by the
+ * tick, the API or on new sources lives after that. The layout is checked in receiver_state.c.
+ */
+struct SacnReceiver
+{
+  // Per-packet lookup and state
+  SacnReceiverKeys      keys;  // This must be the first member.
+  bool                  sampling;
+  bool                  filter_preview_data;
+  bool                  suppress_limit_exceeded_notification;
+  SacnReceiveLoad       load;  // The traffic this receiver puts on its thread.
+  SacnInlineSourceTable inline_sources;
+  EtcPalRbTree          sampling_period_netints;
 
   // Configured callbacks
   SacnReceiverCallbacks         api_callbacks;
   SacnReceiverInternalCallbacks internal_callbacks;
 
+  /* The footprint within the universe to monitor. TODO: WIP, not 100% implemented yet. */
+  SacnRecvUniverseSubrange footprint;
+
+  /* The sources being tracked on this universe. Per-packet lookups only search it once inline_sources is full. */
+  EtcPalRbTree sources;
+
   /* The maximum number of sources this universe will listen to.  May be #kSacnReceiverInfiniteSources.
    * When configured to use static memory, this parameter is only used if it's less than
    * #SACN_RECEIVER_MAX_SOURCES_PER_UNIVERSE -- otherwise #SACN_RECEIVER_MAX_SOURCES_PER_UNIVERSE is used instead. */
   size_t source_count_max;
 
-  /* The footprint within the universe to monitor. TODO: WIP, not 100% implemented yet. */
-  SacnRecvUniverseSubrange footprint;
+  sacn_thread_id_t thread_id;
+
+  // Sockets / network interface info
+  SacnInternalSocketState sockets;
+  /* Array of network interfaces on which to listen to the specified universe. */
+  SacnInternalNetintArray netints;
+
+  // Sampling period and source loss tracking
+  bool            notified_sampling_started;
+  EtcPalTimer     sample_timer;
+  TerminationSet* term_sets;
 
   /* What IP networking the receiver will support. */
   sacn_ip_support_t ip_supported;
@@ -516,37 +600,47 @@ typedef enum
 } sacn_recv_state_t;
 #endif
 
-/* An sACN source that is being tracked on a given universe. */
+/*
+ * An sACN source that is being tracked on a given universe. The fields every packet from the source touches come first
+ * and end with packet_timer, within the first SACN_CACHE_LINE_SIZE bytes. With timestamps enabled, each packet also
+ * records into one bucket of each timing histogram, which follow right after. The name is only read by the tick and
+ * PAP-lost notifications, so it's kept at the end, out of the way.
+ */
 typedef struct SacnTrackedSource
 {
   sacn_remote_source_t handle;  // This must be the first member of this struct.
-  char                 name[kSacnSourceNameMaxLen];
+  uint8_t              seq;
+  bool                 terminated;
+  bool                 dmx_received_since_last_tick;
   EtcPalMcastNetintId  netint;
 
-  EtcPalTimer packet_timer;
-  uint8_t     seq;
-  bool        terminated;
-  bool        dmx_received_since_last_tick;
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+  uint64_t last_arrival_ns;   // Of the last DMX packet
+  uint64_t last_interval_ns;  // Between the last two DMX packets
+#endif
 
 #if SACN_ETC_PRIORITY_EXTENSION
   sacn_recv_state_t recv_state;
   /* pap stands for Per-Address Priority. */
   EtcPalTimer pap_timer;
 #endif
+
+  EtcPalTimer packet_timer;  // This must be the last of the per-packet fields.
+
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+  SacnRecvSourceTiming timing;
+#endif
+
+  char name[kSacnSourceNameMaxLen];
 } SacnTrackedSource;
 
+/* A remote source's handle, looked up by CID in a tree and by handle in a handle table. */
 typedef struct SacnRemoteSourceHandle
 {
   EtcPalUuid           cid;  // This must be the first member of this struct.
   sacn_remote_source_t handle;
-} SacnRemoteSourceHandle;
-
-typedef struct SacnRemoteSourceCid
-{
-  sacn_remote_source_t handle;  // This must be the first member of this struct.
-  EtcPalUuid           cid;
   size_t               refcount;
-} SacnRemoteSourceCid;
+} SacnRemoteSourceHandle;
 
 typedef enum
 {
@@ -663,6 +757,97 @@ typedef struct SocketGroupReq
   EtcPalGroupReq  group;  /* The interface and group address to join or leave. */
 } SocketGroupReq;
 
+#if SACN_RECEIVER_USE_IO_URING
+/* The most handles a receive thread's io_uring watches at once: its sockets, ones still being cancelled, and the
+ * wakeup handle. */
+#define SACN_URING_MAX_SOCKETS (SACN_RECEIVER_MAX_SOCKET_REFS + (SACN_RECEIVER_MAX_UNIVERSES * 2) + 1)
+
+/* A socket or wakeup handle an io_uring has a request on. See uring.c. */
+typedef struct SacnUringSocket
+{
+  int      fd;
+  uint32_t generation;  // Bumped each time the slot is reused, so an earlier handle's completions are told apart.
+  bool     in_use;
+  bool     wakeup;
+  bool     armed;        // A request is outstanding.
+  bool     needs_arm;    // Arming failed, and is retried on the next wait.
+  bool     removed;      // Being cancelled. The slot is freed when the request's last completion arrives.
+  bool     polling;      // Fell back to polling for readiness after repeated receive errors.
+  uint8_t  recv_errors;  // Receive errors since the last packet.
+} SacnUringSocket;
+
+/* A receive thread's io_uring, mapped from the kernel, and the packet buffers it provides to it. See uring.c. */
+typedef struct SacnUring
+{
+  int fd;
+
+  void*  rings;  // The submission and completion queue rings, which share one mapping.
+  size_t rings_size;
+  void*  sqes;
+  size_t sqes_size;
+
+  unsigned* sq_head;
+  unsigned* sq_tail;
+  unsigned* sq_array;
+  unsigned  sq_mask;
+  unsigned  sq_entries;
+
+  unsigned* cq_head;
+  unsigned* cq_tail;
+  void*     cqes;
+  unsigned  cq_mask;
+
+  // The provided buffer ring, followed by the buffers it hands out.
+  uint8_t* buf_mem;
+  size_t   buf_mem_size;
+  uint8_t* bufs;
+  uint16_t buf_ring_tail;
+
+  // The buffer of the packet last returned, which goes back to the kernel on the next wait.
+  bool     holding_buf;
+  uint16_t held_buf;
+
+  // The handles the ring has requests on. Requests refer to their slot, so slots are reused but never moved.
+  SACN_DECLARE_BUF(SacnUringSocket, sockets, SACN_URING_MAX_SOCKETS);
+  size_t num_sockets;
+  bool   arm_pending;
+} SacnUring;
+#endif
+
+#if SACN_RECEIVER_USE_UDP_GRO
+/* The rest of a UDP_GRO read, which holds several datagrams of the same size from the same source. */
+typedef struct SacnGroBatch
+{
+  uint8_t*            next;
+  size_t              remaining;
+  size_t              segment_size;
+  EtcPalSockAddr      from_addr;
+  EtcPalMcastNetintId netint;
+  uint64_t            timestamp_ns;
+  bool                copied_to_all_threads;
+} SacnGroBatch;
+#endif
+
+#if SACN_RECEIVER_USE_PACKET_RING
+/* A receive thread's AF_PACKET socket and the TPACKET_V3 ring mapped from it. See packet_ring.c. */
+typedef struct SacnPacketRing
+{
+  int      fd;
+  uint8_t* map;
+  size_t   map_size;
+
+  // The interfaces the ring receives on, each of which it has put into all-multicast mode.
+  SACN_DECLARE_BUF(unsigned int, netints, SACN_MAX_NETINTS);
+  size_t num_netints;
+
+  // The block being read and the next frame in it. in_block is false until the kernel has handed the block over.
+  unsigned int current_block;
+  bool         in_block;
+  uint8_t*     next_frame;
+  uint32_t     frames_left;
+} SacnPacketRing;
+#endif
+
 /* Holds the discrete data used by each receiver thread. */
 typedef struct SacnRecvThreadContext
 {
@@ -698,12 +883,56 @@ typedef struct SacnRecvThreadContext
   bool ipv6_bound;
 #endif
 
+#if SACN_RECEIVER_ENABLE_BPF_FILTER || SACN_RECEIVER_ENABLE_PACKET_RING
+  // Set when the thread's set of universes or interfaces may have changed, so the kernel filters on its sockets or its
+  // packet ring must be regenerated.
+  bool socket_filter_dirty;
+#endif
+
+  // Wakes the thread out of its poll when socket operations are queued for it. Created and closed by the thread.
+  // wakeup_pending coalesces wakeups until the thread next applies its queued operations.
+  etcpal_socket_t wakeup_socket;
+  EtcPalSockAddr  wakeup_addr;  // The loopback address of wakeup_socket, on platforms without eventfd.
+  bool            wakeup_pending;
+
   // This section is only touched from the thread, outside the lock.
   EtcPalPollContext poll_context;
   bool              poll_context_initialized;
-  uint8_t           recv_buf[kSacnMtu];
+#if SACN_RECEIVER_USE_IO_URING
+  // Takes the place of the poll context for reading when the kernel supports it.
+  SacnUring uring;
+  bool      uring_initialized;
+#endif
+#if SACN_RECEIVER_USE_PACKET_RING
+  // Read in place of the thread's sockets when it can be set up. Its socket is waited on through the poll context.
+  SacnPacketRing packet_ring;
+  bool           packet_ring_initialized;
+#endif
+  uint8_t           recv_buf[SACN_RECEIVER_RECV_BUF_SIZE];
+#if SACN_RECEIVER_USE_UDP_GRO
+  // The datagrams of a coalesced read in recv_buf that sacn_read() hasn't handed out yet.
+  SacnGroBatch gro_batch;
+#endif
   EtcPalTimer       periodic_timer;
   bool              periodic_timer_started;
+
+  // Data packets dropped before parsing because no receiver is listening to their universe. Accessed with relaxed
+  // atomics, since the API reads it while the thread is counting.
+  uint64_t num_discarded_packets;
+
+  // The total load of the thread's receivers as of their last stats window, under the receiver lock.
+  SacnReceiveLoad load;
+  EtcPalTimer     load_timer;
+  bool            load_timer_started;
+  // Time spent on the last data packet, credited to its receiver the next time the thread holds the receiver lock.
+  uint16_t pending_load_universe;
+  uint32_t pending_load_us;
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+  // Arrival-to-callback latency of the last universe data notification, credited to its source along with the load.
+  uint16_t             pending_latency_universe;
+  sacn_remote_source_t pending_latency_source;
+  uint64_t             pending_latency_ns;
+#endif
 } SacnRecvThreadContext;
 
 /******************************************************************************
@@ -720,6 +949,16 @@ typedef struct SacnMergeReceiverInternalSource
   uint8_t              universe_priority;
 } SacnMergeReceiverInternalSource;
 
+#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
+// The DMX merger requires the buffer size to be SACN_DMX_MERGER_MAX_SLOTS.
+typedef struct SacnMergeReceiverSamplingBufs
+{
+  uint8_t                  levels[SACN_DMX_MERGER_MAX_SLOTS];
+  uint8_t                  priorities[SACN_DMX_MERGER_MAX_SLOTS];
+  sacn_dmx_merger_source_t owners[SACN_DMX_MERGER_MAX_SLOTS];
+} SacnMergeReceiverSamplingBufs;
+#endif
+
 typedef struct SacnMergeReceiver
 {
   sacn_merge_receiver_t      merge_receiver_handle;  // This must be the first struct member.
@@ -734,10 +973,15 @@ typedef struct SacnMergeReceiver
   sacn_dmx_merger_source_t owners[SACN_DMX_MERGER_MAX_SLOTS];
 
 #if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
-  sacn_dmx_merger_t        sampling_merger_handle;
-  uint8_t                  sampling_levels[SACN_DMX_MERGER_MAX_SLOTS];
-  uint8_t                  sampling_priorities[SACN_DMX_MERGER_MAX_SLOTS];
-  sacn_dmx_merger_source_t sampling_owners[SACN_DMX_MERGER_MAX_SLOTS];
+  // The sampling merger only exists while sources are in a sampling period. It's created for the first one, and
+  // destroyed when the sampling period ends.
+  sacn_dmx_merger_t sampling_merger_handle;
+  int               source_count_max;
+#if SACN_DYNAMIC_MEM
+  SacnMergeReceiverSamplingBufs* sampling_bufs;  // Allocated along with the sampling merger.
+#else
+  SacnMergeReceiverSamplingBufs sampling_bufs;
+#endif
 #endif
 
   EtcPalRbTree sources;
@@ -793,6 +1037,7 @@ typedef struct SacnSourceUniverse
 
   sacn_termination_state_t termination_state;
   int                      num_terminations_sent;
+  bool                     termination_complete;  // Set by the tick, cleaned up once the source lock is taken
 
   uint8_t  priority;
   uint16_t sync_universe;
@@ -805,14 +1050,20 @@ typedef struct SacnSourceUniverse
   uint8_t     level_send_buf[kSacnDataPacketMtu];
   bool        has_level_data;
   bool        levels_sent_this_tick;
+  bool        levels_leased;  // The application is writing levels into level_send_buf - they aren't sent until then
 
 #if SACN_ETC_PRIORITY_EXTENSION
-  // Start code 0xDD state
+  // Start code 0xDD state. With dynamic memory, the send buffer is only allocated once the universe has PAP to send.
   int         pap_packets_sent_before_suppression;
   EtcPalTimer pap_keep_alive_timer;
-  uint8_t     pap_send_buf[kSacnDataPacketMtu];
-  bool        has_pap_data;
-  bool        pap_sent_this_tick;
+#if SACN_DYNAMIC_MEM
+  uint8_t* pap_send_buf;
+  bool     pap_alloc_failure_logged;  // Updates are dropped while pap_send_buf can't be allocated, but only logged once
+#else
+  uint8_t pap_send_buf[kSacnDataPacketMtu];
+#endif
+  bool has_pap_data;
+  bool pap_sent_this_tick;
 #endif
 
   bool other_sent_this_tick;
@@ -825,8 +1076,33 @@ typedef struct SacnSourceUniverse
   etcpal_error_t last_send_error;
 
   SacnInternalNetintArray netints;
+
+  // The tick thread whose shard this universe belongs to (thread-based sources only), and its position in the shard.
+  unsigned int tick_thread;
+  size_t       shard_index;
+  bool         tick_thread_assigned;
+
+  // The slot this universe is stored in, and the handle the application can use to reach it directly. The handle's
+  // generation changes each time the slot is reused, so handles to removed universes are never valid again.
+  uint16_t               slot;
+  sacn_source_universe_t handle;
 } SacnSourceUniverse;
 
+// Gets a universe by its slot, or by its index in the sorted universes array.
+#if SACN_DYNAMIC_MEM
+#define SACN_SOURCE_UNIVERSE_SLOT(source, slot_index) ((source)->universe_slots[slot_index])
+#else
+#define SACN_SOURCE_UNIVERSE_SLOT(source, slot_index) (&(source)->universe_slots[slot_index])
+#endif
+#define SACN_SOURCE_UNIVERSE_AT(source, index) SACN_SOURCE_UNIVERSE_SLOT(source, (source)->universes[index])
+
+// Whether a universe's PAP send buffer has been allocated.
+#if SACN_DYNAMIC_MEM
+#define SACN_SOURCE_UNIVERSE_HAS_PAP_BUF(universe) ((universe)->pap_send_buf != NULL)
+#else
+#define SACN_SOURCE_UNIVERSE_HAS_PAP_BUF(universe) true
+#endif
+
 typedef struct SacnSource
 {
   sacn_source_t handle;  // This must be the first struct member.
@@ -836,7 +1112,17 @@ typedef struct SacnSource
 
   bool terminating;  // If in the process of terminating all universes and removing this source.
 
-  SACN_DECLARE_SOURCE_BUF(SacnSourceUniverse, universes, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE);
+  // Universes are stored in stable slots, so adding or removing one never moves the others. Slots are reused rather
+  // than freed when universes are removed. The universes array holds the slot of each universe, sorted by universe ID.
+#if SACN_DYNAMIC_MEM
+  SACN_DECLARE_SOURCE_BUF(SacnSourceUniverse*, universe_slots, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE);
+#else
+  SACN_DECLARE_SOURCE_BUF(SacnSourceUniverse, universe_slots, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE);
+#endif
+  size_t num_universe_slots;
+  SACN_DECLARE_SOURCE_BUF(uint16_t, free_universe_slots, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE);
+  size_t num_free_universe_slots;
+  SACN_DECLARE_SOURCE_BUF(uint16_t, universes, SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE);
   size_t            num_universes;
   size_t            num_active_universes;  // Number of universes to include in universe discovery packets.
   EtcPalTimer       universe_discovery_timer;
@@ -846,9 +1132,10 @@ typedef struct SacnSource
   int               pap_keep_alive_interval;
   size_t            universe_count_max;
 
-  EtcPalTimer stats_log_timer;    // Maintains a repeating interval, at the end of which statistics are logged
-  int         total_tick_count;   // The total number of ticks this interval
-  int         failed_tick_count;  // The number of ticks this interval that failed at least one send
+  EtcPalTimer stats_log_timer;       // Maintains a repeating interval, at the end of which statistics are logged
+  int         total_tick_count;      // The total number of ticks this interval
+  int         failed_tick_count;     // The number of ticks this interval that failed at least one send
+  bool        deferred_send_failed;  // Set when a send made outside this source's tick fails, consumed by the stats log
 
   // This is the set of unique netints used by all universes of this source, to be used when transmitting universe
   // discovery packets.
@@ -29,7 +29,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "sacn/dmx_merger.h"
+#include "sacn/private/common.h"
 #include "sacn/private/util.h"
+#include "sacn/private/mem/handle_index.h"
 #include "etcpal/handle_manager.h"
 #include "etcpal/rbtree.h"
 
@@ -37,6 +39,12 @@
 extern "C" {
 #endif
 
+/*
+ * In static memory mode, each merger's source index is backed by an array of entries within the merger state. Twice
+ * the source count keeps lookups short and always leaves a free entry.
+ */
+#define SACN_DMX_MERGER_SOURCE_INDEX_ENTRIES (SACN_DMX_MERGER_MAX_SOURCES_PER_MERGER * 2)
+
 typedef struct SourceState
 {
   sacn_dmx_merger_source_t handle;  // This must be the first struct member.
@@ -49,9 +57,14 @@ typedef struct MergerState
 {
   sacn_dmx_merger_t   handle;  // This must be the first struct member.
   IntHandleManager    source_handle_mgr;
-  EtcPalRbTree        source_state_lookup;
+  EtcPalRbTree        source_state_lookup;  // Owns the sources, in the handle order that merging iterates them in.
+  SacnHandleIndex     source_index;         // Looks up sources by handle.
   SacnDmxMergerConfig config;
 
+#if !SACN_DYNAMIC_MEM && SACN_DMX_MERGER_ENABLED
+  SacnHandleIndexEntry source_index_entries[SACN_DMX_MERGER_SOURCE_INDEX_ENTRIES];
+#endif
+
 #if !SACN_DMX_MERGER_DISABLE_INTERNAL_PAP_BUFFER
   /* If a merger config is passed in with per_address_priorities set to NULL, config.per_address_priorities will be set
    * to point to this so that the winning priorities can still be tracked. */
@@ -67,6 +80,7 @@ typedef struct MergerState
 
 etcpal_error_t sacn_dmx_merger_init();
 void           sacn_dmx_merger_deinit(void);
+void           sacn_dmx_merger_add_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t lookup_state(sacn_dmx_merger_t        merger,
                             sacn_dmx_merger_source_t source,
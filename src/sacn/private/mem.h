@@ -56,7 +56,12 @@
 #include "sacn/private/mem/source_detector/source_detector.h"
 #include "sacn/private/mem/source_detector/source_detector_expired_source.h"
 #include "sacn/private/mem/source_detector/universe_discovery_source.h"
+#include "sacn/private/mem/alloc.h"
+#include "sacn/private/mem/arena.h"
 #include "sacn/private/mem/common.h"
+#include "sacn/private/mem/handle_index.h"
+#include "sacn/private/mem/handle_table.h"
+#include "sacn/private/mem/slab.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#ifndef SACN_PRIVATE_ALLOC_MEM_H_
+#define SACN_PRIVATE_ALLOC_MEM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sacn/opts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * All of the library's heap allocations go through the SACN_MALLOC(), SACN_CALLOC(), SACN_REALLOC() and SACN_FREE()
+ * macros. Each source file that uses them defines SACN_ALLOC_MODULE as the module its allocations are counted against.
+ *
+ * If SACN_TRACK_ALLOCATIONS is enabled, every call is counted per module, so that tests can check that the library's
+ * steady-state paths stay off the heap. If SACN_MEM_ARENA is enabled, every call is served from the block set with
+ * sacn_set_mem_arena() instead of the system heap. Otherwise the macros go straight to the stdlib.h functions.
+ */
+
+typedef enum
+{
+  kSacnAllocModuleReceiver,
+  kSacnAllocModuleMergeReceiver,
+  kSacnAllocModuleSource,
+  kSacnAllocModuleSourceDetector,
+  kSacnAllocModuleDmxMerger,
+  kSacnAllocModuleSourceLoss,
+  kSacnAllocModuleSockets,
+  kSacnNumAllocModules
+} sacn_alloc_module_t;
+
+typedef struct SacnAllocCounts
+{
+  uint64_t allocs;    // Calls to malloc() and calloc().
+  uint64_t reallocs;  // Calls to realloc().
+  uint64_t frees;     // Calls to free() with a non-null pointer.
+} SacnAllocCounts;
+
+#if SACN_DYNAMIC_MEM && (SACN_TRACK_ALLOCATIONS || SACN_MEM_ARENA)
+
+#define SACN_MALLOC(size)       sacn_alloc_malloc(SACN_ALLOC_MODULE, size)
+#define SACN_CALLOC(num, size)  sacn_alloc_calloc(SACN_ALLOC_MODULE, num, size)
+#define SACN_REALLOC(ptr, size) sacn_alloc_realloc(SACN_ALLOC_MODULE, ptr, size)
+#define SACN_FREE(ptr)          sacn_alloc_free(SACN_ALLOC_MODULE, ptr)
+
+void* sacn_alloc_malloc(sacn_alloc_module_t module, size_t size);
+void* sacn_alloc_calloc(sacn_alloc_module_t module, size_t num, size_t size);
+void* sacn_alloc_realloc(sacn_alloc_module_t module, void* ptr, size_t size);
+void  sacn_alloc_free(sacn_alloc_module_t module, void* ptr);
+
+#else  // SACN_DYNAMIC_MEM && (SACN_TRACK_ALLOCATIONS || SACN_MEM_ARENA)
+
+#define SACN_MALLOC(size)       malloc(size)
+#define SACN_CALLOC(num, size)  calloc(num, size)
+#define SACN_REALLOC(ptr, size) realloc(ptr, size)
+#define SACN_FREE(ptr)          free(ptr)
+
+#endif  // SACN_DYNAMIC_MEM && (SACN_TRACK_ALLOCATIONS || SACN_MEM_ARENA)
+
+void sacn_alloc_get_counts(sacn_alloc_module_t module, SacnAllocCounts* counts);
+void sacn_alloc_reset_counts(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SACN_PRIVATE_ALLOC_MEM_H_ */
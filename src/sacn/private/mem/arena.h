@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#ifndef SACN_PRIVATE_ARENA_MEM_H_
+#define SACN_PRIVATE_ARENA_MEM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "etcpal/error.h"
+#include "sacn/common.h"
+#include "sacn/opts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SACN_DYNAMIC_MEM
+
+/*
+ * An allocator over a single block of memory provided by the application. If SACN_MEM_ARENA is enabled, it serves
+ * SACN_MALLOC(), SACN_CALLOC(), SACN_REALLOC() and SACN_FREE() in place of the system heap.
+ *
+ * When the block is set, it is carved into fixed pools, each holding blocks of one size. The application can give the
+ * size and number of blocks of each pool with sacn_arena_set_pools(). Otherwise sacn_arena_set() gives each
+ * power-of-two block size from 64 bytes up an equal share of the block, up to the largest size that still fits its
+ * share. Each allocation takes a free block from the pool with the smallest blocks that fit, or from a larger pool if
+ * that one is used up, so the block never fragments and every allocation and free is O(1) in the number of
+ * allocations. A realloc that still fits its block stays in place.
+ *
+ * The arena's lock is created and destroyed along with the library, by sacn_arena_init() and sacn_arena_deinit(),
+ * since the library allocates from several threads under different module locks. The block can only be set or
+ * cleared while the arena isn't initialized.
+ */
+
+typedef struct SacnArenaStats
+{
+  size_t size;            // The bytes carved into pools.
+  size_t max_alloc_size;  // The block size of the largest pool.
+  size_t in_use;          // Bytes currently allocated, counted in whole blocks.
+  size_t high_water;      // The most bytes allocated at once since the block was set.
+  size_t num_blocks;      // Blocks currently allocated.
+} SacnArenaStats;
+
+etcpal_error_t sacn_arena_init(void);
+void           sacn_arena_deinit(void);
+
+etcpal_error_t sacn_arena_set(void* block, size_t size);
+etcpal_error_t sacn_arena_set_pools(void* block, size_t size, const SacnMemArenaPool* config, size_t num_config);
+bool           sacn_arena_is_set(void);
+
+void* sacn_arena_alloc(size_t size);
+void* sacn_arena_realloc(void* ptr, size_t size);
+void  sacn_arena_free(void* ptr);
+
+void sacn_arena_get_stats(SacnArenaStats* stats);
+
+#endif  // SACN_DYNAMIC_MEM
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SACN_PRIVATE_ARENA_MEM_H_ */
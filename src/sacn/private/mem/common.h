@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include "sacn/private/common.h"
 #include "sacn/opts.h"
+#include "sacn/private/mem/alloc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,29 +36,31 @@ extern "C" {
   do                              \
   {                               \
     if ((ptr)->buf_name)          \
-      free((ptr)->buf_name);      \
+      SACN_FREE((ptr)->buf_name); \
     (ptr)->buf_name       = NULL; \
     (ptr)->num_##buf_name = 0;    \
   } while (0)
 // NOLINTEND(cppcoreguidelines-no-malloc)
 
-#define CHECK_CAPACITY(container, size_requested, buffer, buffer_type, max_static, failure_return_value)        \
-  do                                                                                                            \
-  {                                                                                                             \
-    if (size_requested > container->buffer##_capacity)                                                          \
-    {                                                                                                           \
-      size_t       new_capacity = sacn_mem_grow_capacity(container->buffer##_capacity, size_requested);         \
-      buffer_type* new_##buffer = (buffer_type*)realloc(container->buffer, new_capacity * sizeof(buffer_type)); \
-      if (new_##buffer)                                                                                         \
-      {                                                                                                         \
-        container->buffer            = new_##buffer;                                                            \
-        container->buffer##_capacity = new_capacity;                                                            \
-      }                                                                                                         \
-      else                                                                                                      \
-      {                                                                                                         \
-        return failure_return_value;                                                                            \
-      }                                                                                                         \
-    }                                                                                                           \
+#define CHECK_CAPACITY(container, size_requested, buffer, buffer_type, max_static, failure_return_value)             \
+  do                                                                                                                 \
+  {                                                                                                                  \
+    if (size_requested > container->buffer##_capacity)                                                               \
+    {                                                                                                                \
+      size_t       new_capacity = sacn_mem_grow_capacity(container->buffer##_capacity, size_requested);              \
+      buffer_type* new_##buffer = (buffer_type*)SACN_REALLOC(container->buffer, new_capacity * sizeof(buffer_type)); \
+      if (new_##buffer)                                                                                              \
+      {                                                                                                              \
+        if (container->buffer##_capacity > 0)                                                                        \
+          sacn_mem_note_growth(#buffer, new_capacity);                                                               \
+        container->buffer            = new_##buffer;                                                                 \
+        container->buffer##_capacity = new_capacity;                                                                 \
+      }                                                                                                              \
+      else                                                                                                           \
+      {                                                                                                              \
+        return failure_return_value;                                                                                 \
+      }                                                                                                              \
+    }                                                                                                                \
   } while (0)
 
 #define CHECK_ROOM_FOR_ONE_MORE(container, buffer, buffer_type, max_static, failure_return_value) \
@@ -102,7 +105,70 @@ enum
     }                                                                   \
   } while (0)
 
+/*
+ * Add a pool's capacity and use to a module's memory stats, either as objects or as rb-tree nodes, along with the bytes
+ * its capacity takes up at item_size bytes per item. In dynamic memory mode the pool is a SacnSlab, otherwise it's the
+ * name of an etcpal_mempool.
+ */
+#if SACN_DYNAMIC_MEM
+#define ADD_POOL_STATS_TO(capacity_total, in_use_total, bytes_total, pool, item_size) \
+  do                                                                                  \
+  {                                                                                   \
+    SacnSlabStats slab_stats;                                                         \
+    sacn_slab_get_stats(&(pool), &slab_stats);                                        \
+    (capacity_total) += slab_stats.capacity;                                          \
+    (in_use_total) += slab_stats.in_use;                                              \
+    (bytes_total) += slab_stats.capacity * (item_size);                               \
+  } while (0)
+#else
+#define ADD_POOL_STATS_TO(capacity_total, in_use_total, bytes_total, pool, item_size) \
+  do                                                                                  \
+  {                                                                                   \
+    (capacity_total) += etcpal_mempool_size(pool);                                    \
+    (in_use_total) += etcpal_mempool_used(pool);                                      \
+    (bytes_total) += etcpal_mempool_size(pool) * (item_size);                         \
+  } while (0)
+#endif
+
+#define ADD_POOL_STATS(stats, pool, item_type) \
+  ADD_POOL_STATS_TO((stats)->pool_capacity, (stats)->pool_in_use, (stats)->bytes_allocated, pool, sizeof(item_type))
+#define ADD_RB_NODE_POOL_STATS(stats, pool)                                                              \
+  ADD_POOL_STATS_TO((stats)->rb_node_capacity, (stats)->rb_nodes_in_use, (stats)->bytes_allocated, pool, \
+                    sizeof(EtcPalRbNode))
+
+/* Objects and rb-tree nodes allocated individually rather than from a pool are both capacity and in use. */
+#define ADD_OBJECT_STATS(stats, count, object_type)            \
+  do                                                           \
+  {                                                            \
+    (stats)->pool_capacity += (count);                         \
+    (stats)->pool_in_use += (count);                           \
+    (stats)->bytes_allocated += (count) * sizeof(object_type); \
+  } while (0)
+#define ADD_RB_NODE_STATS(stats, count)                         \
+  do                                                            \
+  {                                                             \
+    (stats)->rb_node_capacity += (count);                       \
+    (stats)->rb_nodes_in_use += (count);                        \
+    (stats)->bytes_allocated += (count) * sizeof(EtcPalRbNode); \
+  } while (0)
+
+/* Add the bytes a dynamic buffer's capacity takes up to a module's memory stats. A cleared buffer takes up none. */
+#if SACN_DYNAMIC_MEM
+#define ADD_BUF_STATS(stats, container, buffer)                                                  \
+  do                                                                                             \
+  {                                                                                              \
+    if ((container)->buffer)                                                                     \
+      (stats)->bytes_allocated += (container)->buffer##_capacity * sizeof(*(container)->buffer); \
+  } while (0)
+#endif
+
 size_t sacn_mem_grow_capacity(size_t old_capacity, size_t capacity_requested);
+void   sacn_mem_note_growth(const char* buffer_name, size_t new_capacity);
+size_t sacn_mem_get_growth_count(void);
+
+void                     sacn_mem_set_reservation(const SacnReserveConfig* config);
+const SacnReserveConfig* sacn_mem_get_reservation(void);
+size_t                   sacn_mem_reserved_capacity(size_t reserved);
 
 unsigned int sacn_mem_get_num_threads(void);
 void         sacn_mem_set_num_threads(unsigned int number_of_threads);
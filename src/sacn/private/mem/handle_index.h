@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#ifndef SACN_PRIVATE_HANDLE_INDEX_MEM_H_
+#define SACN_PRIVATE_HANDLE_INDEX_MEM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "etcpal/error.h"
+#include "sacn/opts.h"
+#include "sacn/private/mem/alloc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Maps handles chosen by the caller to objects, for objects whose handles can't come from a SacnHandleTable (e.g. DMX
+ * merger sources that are given the handles of remote sources). This is an open-addressed hash table with linear
+ * probing, indexed by the low bits of the handle. Handles that are handed out sequentially or from a handle table
+ * rarely collide, so a lookup is usually a single array load.
+ *
+ * In dynamic memory mode the entry array starts empty and is doubled as needed to keep it at most half full.
+ * Otherwise, the caller provides an array of entries. It should hold twice the number of objects to be mapped, so that
+ * there is always a free entry to end a probe on.
+ *
+ * A handle index is not thread-safe; it must be protected by the same lock as the objects it maps.
+ */
+
+typedef struct SacnHandleIndexEntry
+{
+  int   handle;
+  void* object;  // NULL while the entry is free.
+} SacnHandleIndexEntry;
+
+typedef struct SacnHandleIndex
+{
+  sacn_alloc_module_t   module;  // The module the entry array is counted against.
+  SacnHandleIndexEntry* entries;
+  size_t                capacity;  // Always a power of two, or 0 before the first dynamic allocation.
+  size_t                size;
+  bool                  owns_entries;
+} SacnHandleIndex;
+
+void sacn_handle_index_init(SacnHandleIndex*      index,
+                            sacn_alloc_module_t   module,
+                            SacnHandleIndexEntry* static_entries,
+                            size_t                num_static_entries);
+void sacn_handle_index_deinit(SacnHandleIndex* index);
+
+etcpal_error_t sacn_handle_index_add(SacnHandleIndex* index, int handle, void* object);
+etcpal_error_t sacn_handle_index_remove(SacnHandleIndex* index, int handle);
+void*          sacn_handle_index_get(const SacnHandleIndex* index, int handle);
+void           sacn_handle_index_clear(SacnHandleIndex* index);
+
+size_t sacn_handle_index_size(const SacnHandleIndex* index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SACN_PRIVATE_HANDLE_INDEX_MEM_H_ */
@@ -0,0 +1,111 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#ifndef SACN_PRIVATE_HANDLE_TABLE_MEM_H_
+#define SACN_PRIVATE_HANDLE_TABLE_MEM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "etcpal/error.h"
+#include "sacn/opts.h"
+#include "sacn/private/mem/alloc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Maps handles to objects in O(1), in place of handing out handles with an IntHandleManager and looking them up in an
+ * rb-tree. Each object is given a slot, and its handle encodes the slot index along with the slot's generation. The
+ * slots are divided into bands, each of which owns a contiguous range of the handle space:
+ *
+ *   handle = band.first_handle + (generation * band.num_slots) + (index - band.first_slot)
+ *
+ * A slot's generation is bumped each time it is freed, so a stale handle to a freed object doesn't match the slot's
+ * next occupant until the slot's band runs out of generations and wraps around. Free slots are reused oldest first,
+ * and only once more than min_free_slots slots are waiting to be reused - until then, a fresh slot is used if there is
+ * one. So a handle isn't reissued until its slot has been freed num_generations times, with at least min_free_slots
+ * other frees in between each time.
+ *
+ * In static memory mode, the caller provides an array of band_slots slots, which form a single band spanning the whole
+ * handle space. In dynamic memory mode, the first band has band_slots slots and half of the handle space. Each further
+ * band doubles the number of slots and takes half of the handle space that is left, for as long as that leaves each
+ * of its slots at least two generations. The last band then takes the rest of the handle space with one slot per
+ * handle, so the table can map as many objects at once as there are handles, but that band's handles are reissued
+ * with only min_free_slots frees in between. The slot array starts empty and grows as needed.
+ *
+ * A handle table is not thread-safe; it must be protected by the same lock as the objects it maps.
+ */
+
+#define SACN_HANDLE_TABLE_MAX_BANDS 4
+
+typedef struct SacnHandleSlot
+{
+  void*        object;      // NULL while the slot is free.
+  size_t       next_free;   // The next slot in the free list, while this one is free.
+  unsigned int generation;  // Bumped each time the slot is freed.
+} SacnHandleSlot;
+
+typedef struct SacnHandleBand
+{
+  size_t       first_slot;
+  size_t       num_slots;
+  size_t       first_handle;
+  unsigned int num_generations;
+} SacnHandleBand;
+
+typedef struct SacnHandleTable
+{
+  sacn_alloc_module_t module;  // The module the slot array is counted against.
+  SacnHandleSlot*     slots;
+  size_t              capacity;   // The number of slots in the slot array.
+  size_t              num_slots;  // The number of slots that have ever been used.
+  size_t              max_slots;  // The most slots the table can have - the total of its bands.
+  SacnHandleBand      bands[SACN_HANDLE_TABLE_MAX_BANDS];
+  size_t              num_bands;
+  size_t              min_free_slots;  // How many slots must be waiting to be reused before the oldest one is.
+  size_t              free_head;
+  size_t              free_tail;
+  size_t              num_free;
+  size_t              num_in_use;
+  bool                owns_slots;
+  bool                full_logged;  // Whether a failure to add has been logged since the last removal.
+} SacnHandleTable;
+
+void           sacn_handle_table_init(SacnHandleTable*    table,
+                                      sacn_alloc_module_t module,
+                                      SacnHandleSlot*     static_slots,
+                                      size_t              band_slots,
+                                      int                 max_handle,
+                                      size_t              min_free_slots);
+void           sacn_handle_table_deinit(SacnHandleTable* table);
+etcpal_error_t sacn_handle_table_reserve(SacnHandleTable* table, size_t num_slots);
+
+etcpal_error_t sacn_handle_table_add(SacnHandleTable* table, void* object, int* handle);
+etcpal_error_t sacn_handle_table_remove(SacnHandleTable* table, int handle);
+void*          sacn_handle_table_get(const SacnHandleTable* table, int handle);
+void           sacn_handle_table_clear_with_cb(SacnHandleTable* table, void (*free_object)(void* object));
+
+size_t sacn_handle_table_size(const SacnHandleTable* table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SACN_PRIVATE_HANDLE_TABLE_MEM_H_ */
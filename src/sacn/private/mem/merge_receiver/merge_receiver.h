@@ -31,6 +31,7 @@ extern "C" {
 
 etcpal_error_t init_merge_receivers(void);
 void           deinit_merge_receivers(void);
+void           add_merge_receiver_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t add_sacn_merge_receiver(sacn_merge_receiver_t          handle,
                                        const SacnMergeReceiverConfig* config,
@@ -30,6 +30,8 @@ extern "C" {
 #endif
 
 etcpal_error_t init_merge_receiver_sources(void);
+void           deinit_merge_receiver_sources(void);
+void           add_merge_receiver_source_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t add_sacn_merge_receiver_source(SacnMergeReceiver*          merge_receiver,
                                               const EtcPalSockAddr*       addr,
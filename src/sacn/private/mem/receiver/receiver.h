@@ -31,6 +31,7 @@ extern "C" {
 
 etcpal_error_t init_receivers(void);
 void           deinit_receivers(void);
+void           add_receiver_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t add_sacn_receiver(sacn_receiver_t                      handle,
                                  const SacnReceiverConfig*            config,
@@ -39,6 +40,9 @@ etcpal_error_t add_sacn_receiver(sacn_receiver_t                      handle,
                                  SacnReceiver**                       receiver_state);
 etcpal_error_t lookup_receiver(sacn_receiver_t handle, SacnReceiver** receiver_state);
 etcpal_error_t lookup_receiver_by_universe(uint16_t universe, SacnReceiver** receiver_state);
+bool           receiver_universe_subscribed(uint16_t universe);
+void           set_receiver_universe_thread(uint16_t universe, sacn_thread_id_t thread_id);
+bool           receiver_universe_owned_elsewhere(uint16_t universe, sacn_thread_id_t thread_id);
 SacnReceiver*  get_first_receiver(EtcPalRbIter* iterator);
 SacnReceiver*  get_next_receiver(EtcPalRbIter* iterator);
 etcpal_error_t update_receiver_universe(SacnReceiver* receiver, uint16_t new_universe);
@@ -31,6 +31,7 @@ extern "C" {
 
 etcpal_error_t init_remote_sources(void);
 void           deinit_remote_sources(void);
+void           add_remote_source_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t       add_remote_source_handle(const EtcPalUuid* cid, sacn_remote_source_t* handle);
 sacn_remote_source_t get_remote_source_handle(const EtcPalUuid* source_cid);
@@ -35,6 +35,8 @@ void           deinit_sampling_ended_bufs(void);
 // This is processed in the periodic timeout processing, so there are multiple per thread.
 SamplingEndedNotification* get_sampling_ended_buffer(sacn_thread_id_t thread_id, size_t size);
 
+size_t get_sampling_ended_buf_size(sacn_thread_id_t thread_id);
+
 #ifdef __cplusplus
 }
 #endif
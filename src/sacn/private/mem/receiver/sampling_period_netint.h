@@ -30,6 +30,8 @@ extern "C" {
 #endif
 
 etcpal_error_t init_sampling_period_netints(void);
+void           deinit_sampling_period_netints(void);
+void           add_sampling_period_netint_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t add_sacn_sampling_period_netint(EtcPalRbTree*              tree,
                                                const EtcPalMcastNetintId* netint_id,
@@ -35,6 +35,8 @@ void           deinit_source_pap_lost_buf(void);
 // This is processed from the context of receiving data, so there is only one per thread.
 SourcePapLostNotification* get_source_pap_lost(sacn_thread_id_t thread_id);
 
+size_t get_source_pap_lost_buf_size(sacn_thread_id_t thread_id);
+
 #ifdef __cplusplus
 }
 #endif
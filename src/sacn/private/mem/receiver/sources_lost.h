@@ -35,6 +35,8 @@ void           deinit_sources_lost_bufs(void);
 // This is processed in the periodic timeout processing, so there are multiple per thread.
 SourcesLostNotification* get_sources_lost_buffer(sacn_thread_id_t thread_id, size_t size);
 
+size_t get_sources_lost_buf_size(sacn_thread_id_t thread_id);
+
 bool add_lost_source(SourcesLostNotification* notification,
                      sacn_remote_source_t     handle,
                      const EtcPalUuid*        cid,
@@ -34,6 +34,8 @@ void           deinit_status_lists_buf(void);
 
 SacnSourceStatusLists* get_status_lists(sacn_thread_id_t thread_id);
 
+size_t get_status_lists_buf_size(sacn_thread_id_t thread_id);
+
 bool add_offline_source(SacnSourceStatusLists* lists, sacn_remote_source_t handle, const char* name, bool terminated);
 bool add_online_source(SacnSourceStatusLists* lists, sacn_remote_source_t handle, const char* name);
 bool add_unknown_source(SacnSourceStatusLists* lists, sacn_remote_source_t handle, const char* name);
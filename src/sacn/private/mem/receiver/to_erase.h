@@ -34,6 +34,8 @@ void           deinit_to_erase_bufs(void);
 
 SacnTrackedSource** get_to_erase_buffer(sacn_thread_id_t thread_id, size_t size);
 
+size_t get_to_erase_buf_size(sacn_thread_id_t thread_id);
+
 #ifdef __cplusplus
 }
 #endif
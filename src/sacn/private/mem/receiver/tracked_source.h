@@ -30,6 +30,8 @@ extern "C" {
 #endif
 
 etcpal_error_t init_tracked_sources(void);
+void           deinit_tracked_sources(void);
+void           add_tracked_source_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t add_sacn_tracked_source(SacnReceiver*              receiver,
                                        const EtcPalUuid*          sender_cid,
@@ -38,8 +40,9 @@ etcpal_error_t add_sacn_tracked_source(SacnReceiver*              receiver,
                                        uint8_t                    seq_num,
                                        uint8_t                    first_start_code,
                                        SacnTrackedSource**        tracked_source_state);
-etcpal_error_t clear_receiver_sources(SacnReceiver* receiver);
-etcpal_error_t remove_receiver_source(SacnReceiver* receiver, sacn_remote_source_t handle);
+etcpal_error_t     clear_receiver_sources(SacnReceiver* receiver);
+etcpal_error_t     remove_receiver_source(SacnReceiver* receiver, sacn_remote_source_t handle);
+SacnTrackedSource* find_receiver_source(SacnReceiver* receiver, sacn_remote_source_t handle);
 
 void tracked_source_tree_dealloc(const EtcPalRbTree* self, EtcPalRbNode* node);
 
@@ -35,6 +35,8 @@ void           deinit_universe_data_buf(void);
 // This is processed from the context of receiving data, so there is only one per thread.
 UniverseDataNotification* get_universe_data(sacn_thread_id_t thread_id);
 
+size_t get_universe_data_buf_size(sacn_thread_id_t thread_id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,85 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#ifndef SACN_PRIVATE_SLAB_MEM_H_
+#define SACN_PRIVATE_SLAB_MEM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "etcpal/error.h"
+#include "sacn/opts.h"
+#include "sacn/private/mem/alloc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SACN_DYNAMIC_MEM
+
+/*
+ * Fixed-size object allocator used in place of malloc()/free() for the rb-tree nodes and tracked-state objects that
+ * come and go while the library runs. Each slab serves one object type and grows by allocating chunks of
+ * items_per_chunk items from the system. Freed items go on a free list for reuse, and chunks are only returned to the
+ * system when the slab is deinitialized, so once a slab has grown to its high-water mark it makes no further system
+ * allocations.
+ *
+ * A slab is not thread-safe; it must be protected by the same lock as the data structures that use it.
+ */
+
+#define SACN_SLAB_DEFAULT_CHUNK_ITEMS 16
+
+typedef struct SacnSlabChunk SacnSlabChunk;
+typedef struct SacnSlabItem  SacnSlabItem;
+
+typedef struct SacnSlabStats
+{
+  size_t in_use;      // Items currently allocated from the slab.
+  size_t high_water;  // The greatest number of items allocated at once since the slab was initialized.
+  size_t capacity;    // The number of items the slab's chunks can hold.
+  size_t num_chunks;  // The number of chunks currently allocated from the system.
+} SacnSlabStats;
+
+typedef struct SacnSlab
+{
+  sacn_alloc_module_t module;  // The module the slab's chunks are counted against.
+  size_t              item_size;
+  size_t              items_per_chunk;
+  SacnSlabChunk*      chunks;
+  SacnSlabItem*       free_list;
+  SacnSlabStats       stats;
+  // Deinitialized while items were outstanding - release the chunks when the last is freed.
+  bool                draining;
+} SacnSlab;
+
+void           sacn_slab_init(SacnSlab* slab, sacn_alloc_module_t module, size_t item_size, size_t items_per_chunk);
+void           sacn_slab_deinit(SacnSlab* slab);
+etcpal_error_t sacn_slab_reserve(SacnSlab* slab, size_t num_items);
+
+void* sacn_slab_alloc(SacnSlab* slab);
+void  sacn_slab_free(SacnSlab* slab, void* item);
+
+void sacn_slab_get_stats(const SacnSlab* slab, SacnSlabStats* stats);
+
+#endif  // SACN_DYNAMIC_MEM
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SACN_PRIVATE_SLAB_MEM_H_ */
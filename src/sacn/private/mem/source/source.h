@@ -31,6 +31,7 @@ extern "C" {
 
 etcpal_error_t init_sources(void);
 void           deinit_sources(void);
+void           add_source_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t add_sacn_source(sacn_source_t handle, const SacnSourceConfig* config, SacnSource** source_state);
 etcpal_error_t lookup_source(sacn_source_t handle, SacnSource** source_state);
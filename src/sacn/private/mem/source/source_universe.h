@@ -33,12 +33,26 @@ etcpal_error_t add_sacn_source_universe(SacnSource*                     source,
                                         const SacnSourceUniverseConfig* config,
                                         const SacnNetintConfig*         netint_config,
                                         SacnSourceUniverse**            universe_state);
+#if SACN_ETC_PRIORITY_EXTENSION
+etcpal_error_t init_source_universe_pap(const SacnSource* source, SacnSourceUniverse* universe);
+#endif
 etcpal_error_t lookup_source_and_universe(sacn_source_t        source,
                                           uint16_t             universe,
                                           SacnSource**         source_state,
                                           SacnSourceUniverse** universe_state);
 etcpal_error_t lookup_universe(SacnSource* source, uint16_t universe, SacnSourceUniverse** universe_state);
+etcpal_error_t lookup_next_universe(SacnSource*          source,
+                                    uint16_t             universe,
+                                    size_t*              cursor,
+                                    SacnSourceUniverse** universe_state);
+etcpal_error_t lookup_universe_by_handle(SacnSource*            source,
+                                         sacn_source_universe_t handle,
+                                         SacnSourceUniverse**   universe_state);
 void           remove_sacn_source_universe(SacnSource* source, size_t index);
+void           clear_source_universe_slots(SacnSource* source);
+#if SACN_DYNAMIC_MEM
+void add_source_universe_mem_stats(SacnModuleMemoryStats* stats, const SacnSource* source);
+#endif
 
 size_t get_source_universe_index(SacnSource* source, uint16_t universe, bool* found);
 
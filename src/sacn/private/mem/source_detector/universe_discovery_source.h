@@ -31,6 +31,7 @@ extern "C" {
 
 etcpal_error_t init_universe_discovery_sources(void);
 void           deinit_universe_discovery_sources(void);
+void           add_universe_discovery_source_mem_stats(SacnModuleMemoryStats* stats);
 
 etcpal_error_t               add_sacn_universe_discovery_source(const EtcPalUuid*             cid,
                                                                 const char*                   name,
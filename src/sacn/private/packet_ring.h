@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#ifndef SACN_PRIVATE_PACKET_RING_H_
+#define SACN_PRIVATE_PACKET_RING_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "sacn/private/common.h"
+#include "sacn/private/sockets.h"
+#include "sacn/opts.h"
+
+#if SACN_RECEIVER_USE_PACKET_RING
+#include <linux/if_packet.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SACN_RECEIVER_USE_PACKET_RING
+
+etcpal_error_t sacn_packet_ring_init(SacnPacketRing* ring, const SacnBpfInsn* filter, size_t filter_len);
+void           sacn_packet_ring_deinit(SacnPacketRing* ring);
+
+etcpal_error_t sacn_packet_ring_set_netints(SacnPacketRing* ring, const unsigned int* netints, size_t num_netints);
+etcpal_error_t sacn_packet_ring_set_filter(SacnPacketRing* ring, const SacnBpfInsn* filter, size_t filter_len);
+
+bool sacn_packet_ring_next(SacnPacketRing* ring, SacnReadResult* read_result);
+bool sacn_packet_ring_parse_frame(const struct tpacket3_hdr* frame, SacnReadResult* read_result);
+
+#endif  // SACN_RECEIVER_USE_PACKET_RING
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SACN_PRIVATE_PACKET_RING_H_ */
@@ -52,6 +52,7 @@ extern "C" {
 #define SACN_PRI_OFFSET        108
 #define SACN_SEQ_OFFSET        111
 #define SACN_OPTS_OFFSET       112
+#define SACN_UNIVERSE_OFFSET   113
 #define SACN_START_CODE_OFFSET 125
 
 #define SACN_ROOT_VECTOR_OFFSET                  ACN_UDP_PREAMBLE_SIZE + 2
@@ -118,6 +119,7 @@ bool parse_sacn_data_packet(const uint8_t*        buf,
                             SacnRemoteSource*     source_info,
                             bool*                 terminated,
                             SacnRecvUniverseData* universe_data);
+bool peek_sacn_data_packet_universe(const uint8_t* buf, size_t buflen, uint16_t* universe);
 bool parse_framing_layer_vector(const uint8_t* buf, size_t buflen, uint32_t* vector);
 bool parse_sacn_universe_discovery_layer(const uint8_t*  buf,
                                          size_t          buflen,
@@ -24,7 +24,12 @@
 
 enum
 {
-  kSacnPeriodicInterval = 120
+  kSacnPeriodicInterval = 120,
+
+  /* How often receive load rates are recalculated (and receivers possibly rebalanced) */
+  kSacnLoadStatsInterval = 1000,
+  /* A thread must spend at least this long per second on packets before its receivers are rebalanced */
+  kSacnMinRebalanceLoadUs = 10000
 };
 
 #ifdef __cplusplus
@@ -38,6 +43,7 @@ sacn_receiver_t get_next_receiver_handle();
 size_t          get_receiver_netints(const SacnReceiver* receiver, EtcPalMcastNetintId* netints, size_t netints_size);
 void            set_expired_wait(uint32_t wait_ms);
 uint32_t        get_expired_wait();
+uint64_t        get_num_discarded_packets(void);
 etcpal_error_t  clear_term_sets_and_sources(SacnReceiver* receiver);
 etcpal_error_t  assign_receiver_to_thread(SacnReceiver* receiver);
 etcpal_error_t  assign_source_detector_to_thread(SacnSourceDetector* detector);
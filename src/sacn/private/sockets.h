@@ -27,6 +27,11 @@
 #include "sacn/private/common.h"
 #include "sacn/opts.h"
 
+#if SACN_RECEIVER_USE_UDP_GRO || SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+#include <sys/socket.h>
+#include <time.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -37,6 +42,10 @@ typedef struct SacnReadResult
   size_t              data_len;
   EtcPalSockAddr      from_addr;
   EtcPalMcastNetintId netint;
+  uint64_t            timestamp_ns;  // See sacn_get_receive_time_ns(). 0 unless SACN_RECEIVER_ENABLE_TIMESTAMPS is set.
+  // Whether every receive thread can get its own copy of this packet: multicast, or any frame read from a packet ring.
+  // Only the thread that owns the packet's universe handles these. False if the destination isn't known.
+  bool copied_to_all_threads;
 } SacnReadResult;
 
 typedef struct SacnSocketsSysNetints
@@ -45,6 +54,79 @@ typedef struct SacnSocketsSysNetints
   size_t num_sys_netints;
 } SacnSocketsSysNetints;
 
+/* One classic BPF instruction, laid out like Linux's struct sock_filter. */
+typedef struct SacnBpfInsn
+{
+  uint16_t code;
+  uint8_t  jt;
+  uint8_t  jf;
+  uint32_t k;
+} SacnBpfInsn;
+
+/* An inclusive range of universe IDs. */
+typedef struct SacnUniverseRange
+{
+  uint16_t first;
+  uint16_t last;
+} SacnUniverseRange;
+
+#define SACN_BPF_LD_IMM    0x00u
+#define SACN_BPF_LD_W_ABS  0x20u
+#define SACN_BPF_LD_H_ABS  0x28u
+#define SACN_BPF_LD_B_ABS  0x30u
+#define SACN_BPF_LD_W_IND  0x40u
+#define SACN_BPF_LD_H_IND  0x48u
+#define SACN_BPF_LDX_IMM   0x01u
+#define SACN_BPF_LDX_B_MSH 0xb1u
+#define SACN_BPF_AND_K     0x54u
+#define SACN_BPF_JA        0x05u
+#define SACN_BPF_JEQ_K     0x15u
+#define SACN_BPF_JGT_K     0x25u
+#define SACN_BPF_JGE_K     0x35u
+#define SACN_BPF_JSET_K    0x45u
+#define SACN_BPF_RET_K     0x06u
+#define SACN_BPF_MOD_K     0x94u
+#define SACN_BPF_MAX_INSNS 4096u
+#define SACN_BPF_ACCEPT    0xffffffffu
+#define SACN_BPF_REJECT    0u
+
+// Loading from this offset gives the index of the interface the packet came in on (SKF_AD_OFF + SKF_AD_IFINDEX).
+#define SACN_BPF_AD_IFINDEX 0xfffff008u
+
+#if SACN_RECEIVER_USE_UDP_GRO
+#define SACN_RECV_GRO_CONTROL_SIZE CMSG_SPACE(sizeof(int))
+#else
+#define SACN_RECV_GRO_CONTROL_SIZE 0
+#endif
+#if SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+#define SACN_RECV_TIMESTAMP_CONTROL_SIZE CMSG_SPACE(sizeof(struct timespec))
+#else
+#define SACN_RECV_TIMESTAMP_CONTROL_SIZE 0
+#endif
+
+// Room for the ancillary data read along with each packet: the packet info, plus the UDP_GRO segment size and the
+// kernel timestamp when those are enabled.
+#define SACN_RECV_CONTROL_SIZE \
+  (ETCPAL_MAX_CONTROL_SIZE_PKTINFO + SACN_RECV_GRO_CONTROL_SIZE + SACN_RECV_TIMESTAMP_CONTROL_SIZE)
+
+// Socket filters on UDP sockets see the packet starting at the UDP header.
+#define SACN_BPF_UDP_HEADER_SIZE 8u
+
+// Number of instructions sacn_build_universe_filter() needs for a given number of universe ranges.
+#define SACN_UNIVERSE_FILTER_SIZE(num_ranges) (4u + (5u * (num_ranges)) + 1u)
+
+// Number of instructions sacn_build_steering_filter() needs for a given number of receive threads.
+#define SACN_STEERING_FILTER_SIZE(num_threads) (6u + (2u * (num_threads)) + 1u)
+
+// Number of instructions sacn_build_ring_filter() needs for a given number of interfaces and universe ranges.
+#define SACN_RING_FILTER_SIZE(num_netints, num_ranges) ((2u + (num_netints)) + 21u + (5u * (num_ranges)) + 1u)
+
+// The most interfaces a packet ring filter can match, as the interface checks jump over each other.
+#define SACN_RING_FILTER_MAX_NETINTS 255u
+
+// The receive thread that owns a universe when SACN_RECEIVER_ENABLE_REUSEPORT_STEERING is enabled.
+#define SACN_STEERED_THREAD(universe, num_threads) ((sacn_thread_id_t)((universe) % (num_threads)))
+
 typedef enum
 {
   kReceiver,
@@ -99,11 +181,40 @@ void           sacn_remove_receiver_socket(sacn_thread_id_t               thread
                                            sacn_socket_cleanup_behavior_t cleanup_behavior);
 
 // Functions to be called from the receive thread
+etcpal_error_t sacn_init_thread_uring(SacnRecvThreadContext* recv_thread_context);
+void           sacn_deinit_thread_uring(SacnRecvThreadContext* recv_thread_context);
+etcpal_error_t sacn_init_thread_packet_ring(SacnRecvThreadContext* recv_thread_context);
+void           sacn_deinit_thread_packet_ring(SacnRecvThreadContext* recv_thread_context);
+etcpal_error_t sacn_init_thread_wakeup(SacnRecvThreadContext* recv_thread_context);
+void           sacn_deinit_thread_wakeup(SacnRecvThreadContext* recv_thread_context);
 void           sacn_add_pending_sockets(SacnRecvThreadContext* recv_thread_context);
 void           sacn_cleanup_dead_sockets(SacnRecvThreadContext* recv_thread_context);
 void           sacn_subscribe_sockets(SacnRecvThreadContext* recv_thread_context);
 void           sacn_unsubscribe_sockets(SacnRecvThreadContext* recv_thread_context);
+void           sacn_update_socket_filters(SacnRecvThreadContext* recv_thread_context);
 etcpal_error_t sacn_read(SacnRecvThreadContext* recv_thread_context, SacnReadResult* read_result);
+#if SACN_RECEIVER_USE_UDP_GRO
+void sacn_start_gro_batch(SacnGroBatch* batch, const EtcPalMsgHdr* msg, SacnReadResult* read_result);
+bool sacn_next_gro_segment(SacnGroBatch* batch, SacnReadResult* read_result);
+#endif
+
+void sacn_wake_receive_thread(SacnRecvThreadContext* recv_thread_context);
+
+size_t sacn_build_universe_filter(const SacnUniverseRange* ranges,
+                                  size_t                   num_ranges,
+                                  SacnBpfInsn*             insns,
+                                  size_t                   max_insns);
+size_t sacn_build_steering_filter(const sacn_thread_id_t* group_threads,
+                                  size_t                  group_size,
+                                  unsigned int            num_threads,
+                                  SacnBpfInsn*            insns,
+                                  size_t                  max_insns);
+size_t sacn_build_ring_filter(const unsigned int*      netints,
+                              size_t                   num_netints,
+                              const SacnUniverseRange* ranges,
+                              size_t                   num_ranges,
+                              SacnBpfInsn*             insns,
+                              size_t                   max_insns);
 
 // Source sending functions
 etcpal_error_t sacn_send_multicast(uint16_t                   universe_id,
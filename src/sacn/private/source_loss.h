@@ -45,6 +45,7 @@ extern "C" {
 
 etcpal_error_t sacn_source_loss_init(void);
 void           sacn_source_loss_deinit(void);
+void           sacn_source_loss_add_mem_stats(SacnModuleMemoryStats* stats);
 
 void           mark_sources_online(uint16_t                        universe,
                                    const SacnRemoteSourceInternal* online_sources,
@@ -55,7 +55,16 @@ etcpal_error_t sacn_source_state_init(void);
 void           sacn_source_state_deinit(void);
 
 int take_lock_and_process_sources(sacn_process_sources_behavior_t behavior, sacn_source_tick_mode_t tick_mode);
+int take_lock_and_process_tick_thread(unsigned int thread_index, sacn_source_tick_mode_t tick_mode);
 etcpal_error_t initialize_source_thread();
+etcpal_error_t assign_universe_to_tick_thread(SacnSource* source, SacnSourceUniverse* universe);
+void           refresh_tick_thread_shards(void);
+bool           lock_source_send_queues(void);
+void           unlock_source_send_queues(void);
+bool           lock_source_universe_shard(const SacnSourceUniverse* universe);
+void           unlock_source_universe_shard(const SacnSourceUniverse* universe);
+bool           lock_all_source_shards(void);
+void           unlock_all_source_shards(void);
 sacn_source_t  get_next_source_handle();
 void           update_levels_and_or_pap(SacnSource*                source,
                                         SacnSourceUniverse*        universe,
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#ifndef SACN_PRIVATE_URING_H_
+#define SACN_PRIVATE_URING_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "etcpal/socket.h"
+#include "sacn/private/common.h"
+#include "sacn/opts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SACN_RECEIVER_USE_IO_URING
+
+typedef enum
+{
+  kSacnUringPacket,    // A packet was received on a socket.
+  kSacnUringWakeup,    // The wakeup handle became readable.
+  kSacnUringReadable,  // A socket that fell back to polling became readable. Read it with recvmsg().
+  kSacnUringError      // A socket's receive failed. It has been re-armed.
+} sacn_uring_event_t;
+
+typedef struct SacnUringEvent
+{
+  sacn_uring_event_t type;
+  etcpal_socket_t    socket;
+  // For packets: buf, buflen, name, control and flags are filled in. buf points into one of the ring's buffers, which
+  // stays valid until the next call to sacn_uring_wait().
+  EtcPalMsgHdr   msg;
+  etcpal_error_t err;  // For errors.
+} SacnUringEvent;
+
+etcpal_error_t sacn_uring_init(SacnUring* ring);
+void           sacn_uring_deinit(SacnUring* ring);
+
+etcpal_error_t sacn_uring_add_socket(SacnUring* ring, etcpal_socket_t socket);
+etcpal_error_t sacn_uring_add_wakeup(SacnUring* ring, etcpal_socket_t wakeup);
+void           sacn_uring_remove(SacnUring* ring, etcpal_socket_t socket);
+
+etcpal_error_t sacn_uring_wait(SacnUring* ring, SacnUringEvent* event, int timeout_ms);
+
+#endif  // SACN_RECEIVER_USE_IO_URING
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SACN_PRIVATE_URING_H_ */
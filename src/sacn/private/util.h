@@ -26,6 +26,8 @@
 #define SACN_PRIVATE_UTIL_H_
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "etcpal/thread.h"
 #include "sacn/common.h"
 
 #ifdef __cplusplus
@@ -35,6 +37,25 @@ extern "C" {
 bool supports_ipv4(sacn_ip_support_t support);
 bool supports_ipv6(sacn_ip_support_t support);
 
+uint32_t sacn_get_time_us(void);
+uint64_t sacn_get_receive_time_ns(void);
+#if defined(__unix__) || defined(__APPLE__)
+uint64_t sacn_receive_time_from_realtime_ns(uint64_t realtime_ns);
+#endif
+
+/* The kinds of library thread that can be configured at initialization. */
+typedef enum
+{
+  kSacnReceiveThread,
+  kSacnSourceTickThread
+} sacn_thread_type_t;
+
+etcpal_error_t sacn_set_thread_configs(const SacnThreadingConfig* config);
+void           sacn_reset_thread_configs(void);
+unsigned int   sacn_get_num_configured_threads(sacn_thread_type_t type);
+void           sacn_get_thread_params(sacn_thread_type_t type, EtcPalThreadParams* params);
+void           sacn_apply_thread_config(sacn_thread_type_t type, unsigned int thread_index);
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,7 @@
 #include "sacn/private/mem.h"
 #include "sacn/private/receiver.h"
 #include "sacn/private/receiver_state.h"
+#include "sacn/private/util.h"
 
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
@@ -595,6 +596,105 @@ uint32_t sacn_receiver_get_expired_wait()
   return res;
 }
 
+/**
+ * @brief Get the number of sACN data packets that were discarded because no receiver was listening to their universe.
+ *
+ * On networks without IGMP snooping, receivers can get multicast traffic for many universes they aren't listening
+ * to. Those packets are dropped as soon as they're read, before the library parses them, and counted here. The count
+ * covers all receive threads since the library was initialized.
+ *
+ * @return The number of discarded data packets.
+ */
+uint64_t sacn_receiver_get_num_discarded_packets(void)
+{
+  uint64_t res = 0;
+
+  if (!sacn_initialized(SACN_ALL_NETWORK_FEATURES))
+    return res;
+
+  if (sacn_receiver_lock())
+  {
+    res = get_num_discarded_packets();
+    sacn_receiver_unlock();
+  }
+  return res;
+}
+
+/**
+ * @brief Get the current time on the clock that received packets are timestamped with.
+ *
+ * Compare this to SacnRecvUniverseData::timestamp_ns to find out how long ago a packet arrived, e.g. in the universe
+ * data callback. On Linux and other Unix-like platforms this is the system's real-time clock.
+ *
+ * @return The current time in nanoseconds. Only differences between two times are meaningful.
+ */
+uint64_t sacn_receiver_get_time_ns(void)
+{
+  return sacn_get_receive_time_ns();
+}
+
+/**
+ * @brief Get the timing statistics a receiver has collected for one of its sources.
+ *
+ * The statistics cover every packet from the source since the receiver started tracking it. They're only collected if
+ * #SACN_RECEIVER_ENABLE_TIMESTAMPS is enabled.
+ *
+ * @param[in] handle Handle to the receiver that is tracking the source.
+ * @param[in] source Handle to the source.
+ * @param[out] timing Filled in with the source's timing statistics.
+ * @return #kEtcPalErrOk: Statistics retrieved successfully.
+ * @return #kEtcPalErrInvalid: Invalid parameter provided.
+ * @return #kEtcPalErrNotInit: Module not initialized.
+ * @return #kEtcPalErrNotFound: Handle does not correspond to a valid receiver, or the receiver isn't tracking the
+ *                              source.
+ * @return #kEtcPalErrNotImpl: #SACN_RECEIVER_ENABLE_TIMESTAMPS is disabled.
+ * @return #kEtcPalErrSys: An internal library or system call error occurred.
+ */
+etcpal_error_t sacn_receiver_get_source_timing(sacn_receiver_t       handle,
+                                               sacn_remote_source_t  source,
+                                               SacnRecvSourceTiming* timing)
+{
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+  etcpal_error_t res = kEtcPalErrOk;
+
+  if (!sacn_initialized(SACN_ALL_NETWORK_FEATURES))
+    res = kEtcPalErrNotInit;
+  else if ((source == kSacnRemoteSourceInvalid) || (timing == NULL))
+    res = kEtcPalErrInvalid;
+
+  if (res == kEtcPalErrOk)
+  {
+    if (sacn_receiver_lock())
+    {
+      SacnReceiver* receiver = NULL;
+      res                    = lookup_receiver(handle, &receiver);
+
+      if (res == kEtcPalErrOk)
+      {
+        const SacnTrackedSource* src = find_receiver_source(receiver, source);
+        if (src)
+          *timing = src->timing;
+        else
+          res = kEtcPalErrNotFound;
+      }
+
+      sacn_receiver_unlock();
+    }
+    else
+    {
+      res = kEtcPalErrSys;
+    }
+  }
+
+  return res;
+#else   // SACN_RECEIVER_ENABLE_TIMESTAMPS
+  ETCPAL_UNUSED_ARG(handle);
+  ETCPAL_UNUSED_ARG(source);
+  ETCPAL_UNUSED_ARG(timing);
+  return kEtcPalErrNotImpl;
+#endif  // SACN_RECEIVER_ENABLE_TIMESTAMPS
+}
+
 /**************************************************************************************************
  * Private functions
  *************************************************************************************************/
@@ -681,8 +781,14 @@ etcpal_error_t change_sacn_receiver_universe(sacn_receiver_t handle, uint16_t ne
   // Update the receiver's socket and subscription.
   if (res == kEtcPalErrOk)
   {
+#if SACN_RECEIVER_USE_REUSEPORT_STEERING
+    // The new universe may be owned by a different thread, so reassign the receiver along with its sockets.
+    remove_receiver_from_thread(receiver);
+    res = assign_receiver_to_thread(receiver);
+#else
     remove_receiver_sockets(receiver, kQueueSocketCleanup);
     res = add_receiver_sockets(receiver);
+#endif
   }
 
   // Begin the sampling period.
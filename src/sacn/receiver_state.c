@@ -20,8 +20,10 @@
 #include "sacn/private/common.h"
 
 #include <limits.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include "sacn/private/atomic.h"
 #include "sacn/private/source_loss.h"
 #include "sacn/private/mem.h"
 #include "sacn/private/pdu.h"
@@ -36,12 +38,9 @@
 #include "etcpal/pack.h"
 #include "etcpal/timer.h"
 
-#if SACN_RECEIVER_ENABLED && !DOXYGEN  // No Doxygen needed here
-
-/***************************** Private constants *****************************/
+#define SACN_ALLOC_MODULE kSacnAllocModuleReceiver
 
-static const EtcPalThreadParams kReceiverThreadParams = {SACN_RECEIVER_THREAD_PRIORITY, SACN_RECEIVER_THREAD_STACK,
-                                                         SACN_RECEIVER_THREAD_NAME, NULL};
+#if SACN_RECEIVER_ENABLED && !DOXYGEN  // No Doxygen needed here
 
 /****************************** Private types ********************************/
 
@@ -55,6 +54,28 @@ typedef struct PeriodicCallbacks
   size_t                             num_sampling_ended;
 } PeriodicCallbacks;
 
+// handle_sacn_data_packet() relies on these to keep its per-packet cache misses down. If one fires, reorder the struct
+// rather than relaxing the check. They budget bytes from the start of each struct, not whole cache lines - see
+// SACN_CACHE_LINE_SIZE.
+SACN_STATIC_ASSERT(offsetof(SacnTrackedSource, packet_timer) + sizeof(EtcPalTimer) <= SACN_CACHE_LINE_SIZE,
+                   tracked_source_hot_fields_within_budget);
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+SACN_STATIC_ASSERT(offsetof(SacnTrackedSource, last_interval_ns) < offsetof(SacnTrackedSource, packet_timer),
+                   tracked_source_arrival_times_are_hot_fields);
+SACN_STATIC_ASSERT(offsetof(SacnTrackedSource, timing) > offsetof(SacnTrackedSource, packet_timer),
+                   tracked_source_timing_follows_hot_fields);
+SACN_STATIC_ASSERT(offsetof(SacnTrackedSource, name) > offsetof(SacnTrackedSource, timing),
+                   tracked_source_name_follows_timing);
+#endif
+SACN_STATIC_ASSERT(offsetof(SacnTrackedSource, name) > offsetof(SacnTrackedSource, packet_timer),
+                   tracked_source_name_follows_hot_fields);
+SACN_STATIC_ASSERT(offsetof(SacnReceiver, sampling_period_netints) + sizeof(EtcPalRbTree) <= 2 * SACN_CACHE_LINE_SIZE,
+                   receiver_hot_fields_within_budget);
+SACN_STATIC_ASSERT(offsetof(SacnReceiver, internal_callbacks) + sizeof(SacnUniverseDataInternalCallback) -
+                           offsetof(SacnReceiver, api_callbacks) <=
+                       SACN_CACHE_LINE_SIZE,
+                   receiver_universe_data_callbacks_within_budget);
+
 /**************************** Private variables ******************************/
 
 static uint32_t expired_wait;
@@ -88,7 +109,7 @@ static void           remove_sockets(sacn_thread_id_t               thread_id,
 
 // Receiving incoming data
 static void handle_incoming(SacnRecvThreadContext* context, const SacnReadResult* read_result);
-static void handle_sacn_data_packet(sacn_thread_id_t       thread_id,
+static void handle_sacn_data_packet(SacnRecvThreadContext* context,
                                     const AcnRootLayerPdu* rlp,
                                     const SacnReadResult*  read_result);
 static void handle_sacn_extended_packet(SacnRecvThreadContext* context,
@@ -119,6 +140,21 @@ static void deliver_receive_callbacks(const EtcPalSockAddr*            from_addr
                                       SourcePapLostNotification*       source_pap_lost,
                                       UniverseDataNotification*        universe_data);
 
+static etcpal_error_t add_receiver_to_thread(SacnReceiver* receiver, SacnRecvThreadContext* context);
+
+// Receive load tracking
+static void credit_pending_load(SacnRecvThreadContext* recv_thread_context);
+static void update_receive_load(SacnRecvThreadContext* recv_thread_context);
+#if SACN_RECEIVER_ENABLE_LOAD_BALANCING
+static void rebalance_receivers(SacnRecvThreadContext* recv_thread_context);
+#endif
+
+// Receive timing
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+static void record_dmx_arrival(SacnTrackedSource* src, uint64_t timestamp_ns);
+static void record_duration(SacnRecvTimingHistogram* histogram, uint64_t duration_ns);
+#endif
+
 // Process periodic timeout functionality
 static void process_receivers(SacnRecvThreadContext* recv_thread_context);
 static void process_receiver_sources(sacn_thread_id_t         thread_id,
@@ -154,6 +190,7 @@ void sacn_receiver_state_deinit(void)
       if (thread_context && thread_context->running)
       {
         etcpal_signal_post(&thread_context->deinit_signal);
+        sacn_wake_receive_thread(thread_context);
         threads_ids_to_deinit[num_threads_to_deinit]     = thread_context->thread_id;
         threads_handles_to_deinit[num_threads_to_deinit] = &thread_context->thread_handle;
         ++num_threads_to_deinit;
@@ -209,6 +246,21 @@ uint32_t get_expired_wait()
   return expired_wait;
 }
 
+// Totals the data packets each receive thread has dropped for universes no receiver is listening to. The counters are
+// read while their threads are still incrementing them, hence the atomic load.
+uint64_t get_num_discarded_packets(void)
+{
+  uint64_t total = 0;
+  for (sacn_thread_id_t thread_id = 0; thread_id < sacn_mem_get_num_threads(); ++thread_id)
+  {
+    SacnRecvThreadContext* context = get_recv_thread_context(thread_id);
+    if (SACN_ASSERT_VERIFY(context))
+      total += SACN_ATOMIC_LOAD_U64(context->num_discarded_packets);
+  }
+
+  return total;
+}
+
 etcpal_error_t clear_term_sets_and_sources(SacnReceiver* receiver)
 {
   if (!SACN_ASSERT_VERIFY(receiver))
@@ -233,6 +285,14 @@ etcpal_error_t assign_receiver_to_thread(SacnReceiver* receiver)
 
   SacnRecvThreadContext* assigned_thread = NULL;
 
+#if SACN_RECEIVER_USE_REUSEPORT_STEERING
+  // The kernel steers each universe's traffic to the thread that owns it, so the receiver has to live there.
+  if (SACN_ASSERT_VERIFY(sacn_mem_get_num_threads() > 0))
+  {
+    receiver->thread_id = SACN_STEERED_THREAD(receiver->keys.universe, sacn_mem_get_num_threads());
+    assigned_thread     = get_recv_thread_context(receiver->thread_id);
+  }
+#else
   // Assign this receiver to the thread with the lowest number of receivers currently
   for (unsigned int i = 0; i < sacn_mem_get_num_threads(); ++i)
   {
@@ -246,15 +306,28 @@ etcpal_error_t assign_receiver_to_thread(SacnReceiver* receiver)
       }
     }
   }
+#endif
 
   if (!SACN_ASSERT_VERIFY(assigned_thread))
     return kEtcPalErrSys;
 
+  return add_receiver_to_thread(receiver, assigned_thread);
+}
+
+/*
+ * Create the receiver's sockets on the given thread, start the thread if needed, and add the receiver to its list.
+ *
+ * [in,out] receiver Receiver instance to add. Its thread_id must already identify the context.
+ * [in,out] context Context of the thread to add the receiver to.
+ * Returns error code indicating the result of the operations.
+ */
+etcpal_error_t add_receiver_to_thread(SacnReceiver* receiver, SacnRecvThreadContext* context)
+{
   etcpal_error_t res = add_receiver_sockets(receiver);
 
-  if ((res == kEtcPalErrOk) && !assigned_thread->running)
+  if ((res == kEtcPalErrOk) && !context->running)
   {
-    res = start_receiver_thread(assigned_thread);
+    res = start_receiver_thread(context);
     if (res != kEtcPalErrOk)
     {
       remove_receiver_sockets(receiver, kPerformAllSocketCleanupNow);  // Thread not running, don't queue the cleanup.
@@ -264,7 +337,8 @@ etcpal_error_t assign_receiver_to_thread(SacnReceiver* receiver)
   if (res == kEtcPalErrOk)
   {
     // Append the receiver to the thread list
-    add_receiver_to_list(assigned_thread, receiver);
+    add_receiver_to_list(context, receiver);
+    set_receiver_universe_thread(receiver->keys.universe, context->thread_id);
   }
 
   return res;
@@ -319,6 +393,7 @@ void remove_receiver_from_thread(SacnReceiver* receiver)
   {
     remove_receiver_sockets(receiver, (context->running ? kQueueSocketCleanup : kPerformAllSocketCleanupNow));
     remove_receiver_from_list(context, receiver);
+    set_receiver_universe_thread(receiver->keys.universe, kSacnThreadIdInvalid);
   }
 }
 
@@ -488,6 +563,9 @@ void read_network_and_process(SacnRecvThreadContext* context)
 
   if (sacn_receiver_lock())
   {
+    // Everything queued so far is applied below, so anything queued after this needs a new wakeup.
+    context->wakeup_pending = false;
+
     // Unsubscribe before subscribing to avoid surpassing the subscription limit for a socket.
     sacn_unsubscribe_sockets(context);
     sacn_subscribe_sockets(context);
@@ -495,6 +573,7 @@ void read_network_and_process(SacnRecvThreadContext* context)
     // Also clean up dead sockets first to keep the polling socket count down.
     sacn_cleanup_dead_sockets(context);
     sacn_add_pending_sockets(context);
+    sacn_update_socket_filters(context);
 
     sacn_receiver_unlock();
   }
@@ -589,9 +668,12 @@ etcpal_error_t start_receiver_thread(SacnRecvThreadContext* recv_thread_context)
   if (!SACN_ASSERT_VERIFY(recv_thread_context))
     return kEtcPalErrSys;
 
+  EtcPalThreadParams thread_params;
+  sacn_get_thread_params(kSacnReceiveThread, &thread_params);
+
   recv_thread_context->running                = true;
   recv_thread_context->periodic_timer_started = false;
-  etcpal_error_t create_res = etcpal_thread_create(&recv_thread_context->thread_handle, &kReceiverThreadParams,
+  etcpal_error_t create_res = etcpal_thread_create(&recv_thread_context->thread_handle, &thread_params,
                                                    sacn_receive_thread, recv_thread_context);
   if (create_res != kEtcPalErrOk)
   {
@@ -611,14 +693,44 @@ void sacn_receive_thread(void* arg)
 
   SacnRecvThreadContext* context = (SacnRecvThreadContext*)arg;
 
+  sacn_apply_thread_config(kSacnReceiveThread, context->thread_id);
+
   // Create the poll context
   etcpal_error_t poll_init_res = kEtcPalErrSys;
   if (sacn_receiver_lock())
   {
     poll_init_res = etcpal_poll_context_init(&context->poll_context);
     if (poll_init_res == kEtcPalErrOk)
+    {
       context->poll_context_initialized = true;
 
+#if SACN_RECEIVER_USE_IO_URING
+      etcpal_error_t uring_res = sacn_init_thread_uring(context);
+      if (uring_res != kEtcPalErrOk)
+      {
+        SACN_LOG_INFO("Couldn't set up io_uring for the sACN receive thread: '%s'. Falling back to polling.",
+                      etcpal_strerror(uring_res));
+      }
+#endif
+#if SACN_RECEIVER_USE_PACKET_RING
+      etcpal_error_t ring_res = sacn_init_thread_packet_ring(context);
+      if (ring_res != kEtcPalErrOk)
+      {
+        SACN_LOG_INFO("Couldn't set up a packet ring for the sACN receive thread: '%s'. Falling back to reading its "
+                      "sockets.",
+                      etcpal_strerror(ring_res));
+      }
+#endif
+
+      etcpal_error_t wakeup_res = sacn_init_thread_wakeup(context);
+      if (wakeup_res != kEtcPalErrOk)
+      {
+        SACN_LOG_WARNING("Couldn't create a wakeup handle for the sACN receive thread: '%s'. Receiver changes will be "
+                         "applied at the next read timeout.",
+                         etcpal_strerror(wakeup_res));
+      }
+    }
+
     sacn_receiver_unlock();
   }
 
@@ -636,6 +748,10 @@ void sacn_receive_thread(void* arg)
   // Destroy the poll context
   if (sacn_receiver_lock())
   {
+    sacn_deinit_thread_wakeup(context);
+    sacn_deinit_thread_uring(context);
+    sacn_deinit_thread_packet_ring(context);
+
     etcpal_poll_context_deinit(&context->poll_context);
     context->poll_context_initialized = false;
 
@@ -786,7 +902,7 @@ void handle_incoming(SacnRecvThreadContext* context, const SacnReadResult* read_
   while (acn_parse_root_layer_pdu(preamble.rlp_block, preamble.rlp_block_len, &rlp, &lpdu))
   {
     if (rlp.vector == ACN_VECTOR_ROOT_E131_DATA)
-      handle_sacn_data_packet(context->thread_id, &rlp, read_result);
+      handle_sacn_data_packet(context, &rlp, read_result);
     else if (rlp.vector == ACN_VECTOR_ROOT_E131_EXTENDED)
       handle_sacn_extended_packet(context, rlp.pdata, rlp.data_len, &rlp.sender_cid, &read_result->from_addr);
   }
@@ -795,21 +911,44 @@ void handle_incoming(SacnRecvThreadContext* context, const SacnReadResult* read_
 /*
  * Handle an sACN Data packet that has been unpacked from a Root Layer PDU.
  *
- * [in] thread_id ID for the thread in which the data packet was received.
+ * [in,out] context Context for the thread in which the data packet was received.
  * [in] rlp->pdata Buffer containing the data packet.
  * [in] rlp->data_len Size of buffer.
  * [in] rlp->sender_cid CID from which the data was received.
  * [in] read_result->from_addr Network address from which the data was received.
  * [in] read_result->netint ID of network interface on which the data was received.
  */
-void handle_sacn_data_packet(sacn_thread_id_t thread_id, const AcnRootLayerPdu* rlp, const SacnReadResult* read_result)
+void handle_sacn_data_packet(SacnRecvThreadContext* context,
+                             const AcnRootLayerPdu* rlp,
+                             const SacnReadResult*  read_result)
 {
-  if (!SACN_ASSERT_VERIFY(thread_id != kSacnThreadIdInvalid) || !SACN_ASSERT_VERIFY(rlp) ||
-      !SACN_ASSERT_VERIFY(rlp->pdata) || !SACN_ASSERT_VERIFY(read_result))
+  if (!SACN_ASSERT_VERIFY(context) || !SACN_ASSERT_VERIFY(context->thread_id != kSacnThreadIdInvalid) ||
+      !SACN_ASSERT_VERIFY(rlp) || !SACN_ASSERT_VERIFY(rlp->pdata) || !SACN_ASSERT_VERIFY(read_result))
   {
     return;
   }
 
+  // On a shared network, much of the incoming multicast can be for universes no receiver is listening to. Drop those
+  // before taking any locks or parsing the rest of the packet. Packets too short to peek at are left for the full parse
+  // to reject.
+  uint16_t universe = 0;
+  if (peek_sacn_data_packet_universe(rlp->pdata, rlp->data_len, &universe))
+  {
+    if (!receiver_universe_subscribed(universe))
+    {
+      SACN_ATOMIC_INCREMENT_U64(context->num_discarded_packets);
+      return;
+    }
+
+    // Every receive thread can get a copy of the same multicast packet. Only the thread that owns the universe's
+    // receiver handles it, so that it isn't counted, merged, or notified more than once. Unicast only reaches one
+    // socket, so it's handled by whichever thread it arrives on.
+    if (read_result->copied_to_all_threads && receiver_universe_owned_elsewhere(universe, context->thread_id))
+      return;
+  }
+
+  uint32_t         start_us  = sacn_get_time_us();
+  sacn_thread_id_t thread_id = context->thread_id;
   if (receiver_cb_lock())
   {
     UniverseDataNotification*        universe_data         = get_universe_data(thread_id);
@@ -843,6 +982,8 @@ void handle_sacn_data_packet(sacn_thread_id_t thread_id, const AcnRootLayerPdu*
       return;
     }
 
+    universe_data->universe_data.timestamp_ns = read_result->timestamp_ns;
+
     // Ignore kSacnStartcodePriority packets if SACN_ETC_PRIORITY_EXTENSION is disabled.
 #if !SACN_ETC_PRIORITY_EXTENSION
     if (universe_data->universe_data.start_code == kSacnStartcodePriority)
@@ -852,8 +993,11 @@ void handle_sacn_data_packet(sacn_thread_id_t thread_id, const AcnRootLayerPdu*
     }
 #endif
 
+    bool counted = false;
     if (sacn_receiver_lock())
     {
+      credit_pending_load(context);
+
       SacnReceiver* receiver = NULL;
       if (lookup_receiver_by_universe(universe_data->universe_data.universe_id, &receiver) != kEtcPalErrOk)
       {
@@ -863,6 +1007,9 @@ void handle_sacn_data_packet(sacn_thread_id_t thread_id, const AcnRootLayerPdu*
         return;
       }
 
+      ++receiver->load.window_packets;
+      counted = true;
+
       SacnSamplingPeriodNetint* sp_netint =
           etcpal_rbtree_find(&receiver->sampling_period_netints, &read_result->netint);
 
@@ -876,8 +1023,7 @@ void handle_sacn_data_packet(sacn_thread_id_t thread_id, const AcnRootLayerPdu*
 
       bool notify                       = false;
       universe_data->source_info.handle = get_remote_source_handle(&rlp->sender_cid);
-      SacnTrackedSource* src =
-          (SacnTrackedSource*)etcpal_rbtree_find(&receiver->sources, &universe_data->source_info.handle);
+      SacnTrackedSource* src            = find_receiver_source(receiver, universe_data->source_info.handle);
       if (src)
       {
         // We only associate a source with one netint, so packets received on other netints should be dropped
@@ -948,6 +1094,11 @@ void handle_sacn_data_packet(sacn_thread_id_t thread_id, const AcnRootLayerPdu*
 
       if (src)
       {
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+        if (universe_data->universe_data.start_code == kSacnStartcodeDmx)
+          record_dmx_arrival(src, read_result->timestamp_ns);
+#endif
+
         if (universe_data->universe_data.preview && receiver->filter_preview_data)
           notify = false;
 
@@ -971,12 +1122,32 @@ void handle_sacn_data_packet(sacn_thread_id_t thread_id, const AcnRootLayerPdu*
       sacn_receiver_unlock();
     }
 
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+    // Like the load, this is credited the next time the thread has the receiver lock.
+    if ((universe_data->receiver_handle != kSacnReceiverInvalid) && (read_result->timestamp_ns != 0))
+    {
+      uint64_t now_ns     = sacn_get_receive_time_ns();
+      uint64_t arrival_ns = read_result->timestamp_ns;
+
+      context->pending_latency_universe = universe_data->universe_data.universe_id;
+      context->pending_latency_source   = universe_data->source_info.handle;
+      context->pending_latency_ns       = (now_ns > arrival_ns) ? (now_ns - arrival_ns) : 0;
+    }
+#endif
+
     // Deliver callbacks if applicable.
     deliver_receive_callbacks(&read_result->from_addr, &universe_data->source_info,
                               universe_data->universe_data.universe_id, source_limit_exceeded, source_pap_lost,
                               universe_data);
 
     receiver_cb_unlock();
+
+    // Crediting this now would mean taking the receiver lock again, so it waits for the next time the thread has it.
+    if (counted)
+    {
+      context->pending_load_universe = universe;
+      context->pending_load_us       = sacn_get_time_us() - start_us;
+    }
   }
 }
 
@@ -1384,6 +1555,8 @@ void process_receivers(SacnRecvThreadContext* recv_thread_context)
         process_receiver_sources(recv_thread_context->thread_id, receiver, &sources_lost[num_sources_lost++]);
       }
 
+      update_receive_load(recv_thread_context);
+
       sacn_receiver_unlock();
     }
 
@@ -1401,6 +1574,207 @@ void process_receivers(SacnRecvThreadContext* recv_thread_context)
   }
 }
 
+/*
+ * Credits the time the thread spent on its last data packet to that packet's receiver, if it still exists.
+ *
+ * Needs receiver lock.
+ */
+void credit_pending_load(SacnRecvThreadContext* recv_thread_context)
+{
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+  if (recv_thread_context->pending_latency_source != kSacnRemoteSourceInvalid)
+  {
+    SacnReceiver* receiver = NULL;
+    if (lookup_receiver_by_universe(recv_thread_context->pending_latency_universe, &receiver) == kEtcPalErrOk)
+    {
+      SacnTrackedSource* src = find_receiver_source(receiver, recv_thread_context->pending_latency_source);
+      if (src)
+        record_duration(&src->timing.latency, recv_thread_context->pending_latency_ns);
+    }
+
+    recv_thread_context->pending_latency_source = kSacnRemoteSourceInvalid;
+  }
+#endif
+
+  if (recv_thread_context->pending_load_us == 0)
+    return;
+
+  SacnReceiver* receiver = NULL;
+  if (lookup_receiver_by_universe(recv_thread_context->pending_load_universe, &receiver) == kEtcPalErrOk)
+    receiver->load.window_processing_us += recv_thread_context->pending_load_us;
+
+  recv_thread_context->pending_load_us = 0;
+}
+
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+/*
+ * Adds the change in the time between a source's DMX packets to its jitter histogram.
+ *
+ * Needs receiver lock.
+ */
+void record_dmx_arrival(SacnTrackedSource* src, uint64_t timestamp_ns)
+{
+  if ((timestamp_ns == 0) || (timestamp_ns < src->last_arrival_ns))
+    return;  // Not timestamped, or the clock has been set back.
+
+  if (src->last_arrival_ns != 0)
+  {
+    uint64_t interval_ns = timestamp_ns - src->last_arrival_ns;
+    if (src->last_interval_ns != 0)
+    {
+      record_duration(&src->timing.jitter, (interval_ns > src->last_interval_ns)
+                                               ? (interval_ns - src->last_interval_ns)
+                                               : (src->last_interval_ns - interval_ns));
+    }
+    src->last_interval_ns = interval_ns;
+  }
+
+  src->last_arrival_ns = timestamp_ns;
+}
+
+// Counts a duration in the histogram bucket for its power-of-two range of microseconds.
+void record_duration(SacnRecvTimingHistogram* histogram, uint64_t duration_ns)
+{
+  uint64_t duration_us = duration_ns / 1000u;
+
+  size_t bucket = 0;
+  while ((bucket < (SACN_RECV_TIMING_HISTOGRAM_BUCKETS - 1)) && (duration_us >= (UINT64_C(1) << bucket)))
+    ++bucket;
+
+  ++histogram->buckets[bucket];
+  ++histogram->count;
+  if (duration_us > histogram->max_us)
+    histogram->max_us = (duration_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)duration_us;
+}
+#endif  // SACN_RECEIVER_ENABLE_TIMESTAMPS
+
+/*
+ * At the end of each stats window, converts the thread's receivers' packet counts and processing times to rates, totals
+ * them for the thread, and rebalances if enabled.
+ *
+ * Needs receiver lock.
+ */
+void update_receive_load(SacnRecvThreadContext* recv_thread_context)
+{
+  if (!recv_thread_context->load_timer_started)
+  {
+    etcpal_timer_start(&recv_thread_context->load_timer, kSacnLoadStatsInterval);
+    recv_thread_context->load_timer_started = true;
+    return;
+  }
+
+  if (!etcpal_timer_is_expired(&recv_thread_context->load_timer))
+    return;
+
+  credit_pending_load(recv_thread_context);
+
+  uint32_t elapsed_ms = etcpal_timer_elapsed(&recv_thread_context->load_timer);
+  if (elapsed_ms == 0)
+    elapsed_ms = 1;
+
+  memset(&recv_thread_context->load, 0, sizeof(recv_thread_context->load));
+  for (SacnReceiver* receiver = recv_thread_context->receivers; receiver; receiver = receiver->next)
+  {
+    receiver->load.packets_per_sec       = (uint32_t)(((uint64_t)receiver->load.window_packets * 1000u) / elapsed_ms);
+    receiver->load.processing_us_per_sec =
+        (uint32_t)(((uint64_t)receiver->load.window_processing_us * 1000u) / elapsed_ms);
+    receiver->load.window_packets       = 0;
+    receiver->load.window_processing_us = 0;
+
+    recv_thread_context->load.packets_per_sec += receiver->load.packets_per_sec;
+    recv_thread_context->load.processing_us_per_sec += receiver->load.processing_us_per_sec;
+  }
+
+  etcpal_timer_reset(&recv_thread_context->load_timer);
+
+#if SACN_RECEIVER_ENABLE_LOAD_BALANCING
+  rebalance_receivers(recv_thread_context);
+#endif
+}
+
+#if SACN_RECEIVER_ENABLE_LOAD_BALANCING
+/*
+ * If this is the busiest receive thread, moves the one receiver to the least busy thread that best evens out the two.
+ * Only one receiver moves per stats window, so each move is measured before the next.
+ *
+ * Needs receiver lock.
+ */
+void rebalance_receivers(SacnRecvThreadContext* recv_thread_context)
+{
+  SacnRecvThreadContext* busiest    = NULL;
+  SacnRecvThreadContext* least_busy = NULL;
+  for (sacn_thread_id_t thread_id = 0; thread_id < sacn_mem_get_num_threads(); ++thread_id)
+  {
+    SacnRecvThreadContext* context = get_recv_thread_context(thread_id);
+    if (!context)
+      continue;
+
+    if (!busiest || (context->load.processing_us_per_sec > busiest->load.processing_us_per_sec))
+      busiest = context;
+    if (!least_busy || (context->load.processing_us_per_sec < least_busy->load.processing_us_per_sec))
+      least_busy = context;
+  }
+
+  // Each thread rebalances its own receivers, since their rates are freshest when its window ends.
+  if ((busiest != recv_thread_context) || (least_busy == busiest) ||
+      (busiest->load.processing_us_per_sec < kSacnMinRebalanceLoadUs))
+  {
+    return;
+  }
+
+  // Moving a receiver with load L changes the gap between the two threads from G to |G - 2L|, so the best candidate
+  // has L closest to G / 2. Anything with L >= G would only swap which thread is busier.
+  uint32_t      gap      = busiest->load.processing_us_per_sec - least_busy->load.processing_us_per_sec;
+  SacnReceiver* to_move  = NULL;
+  uint32_t      best_gap = gap;
+  for (SacnReceiver* receiver = busiest->receivers; receiver; receiver = receiver->next)
+  {
+    uint32_t load = receiver->load.processing_us_per_sec;
+    if ((load == 0) || (load >= gap))
+      continue;
+
+    uint32_t new_gap = (gap > 2 * load) ? (gap - 2 * load) : (2 * load - gap);
+    if (new_gap < best_gap)
+    {
+      best_gap = new_gap;
+      to_move  = receiver;
+    }
+  }
+
+  if (!to_move)
+    return;
+
+  SACN_LOG_DEBUG("Moving sACN receiver for universe %u from receive thread %u to %u to balance load.",
+                 to_move->keys.universe, busiest->thread_id, least_busy->thread_id);
+
+  // The old thread drops the old sockets through its queue, and the new thread subscribes the new ones through its own.
+  remove_receiver_from_thread(to_move);
+  to_move->thread_id = least_busy->thread_id;
+  etcpal_error_t res = add_receiver_to_thread(to_move, least_busy);
+  if (res == kEtcPalErrOk)
+  {
+    // Account for the move right away, so the next window's rebalance doesn't act on stale totals.
+    busiest->load.processing_us_per_sec -= to_move->load.processing_us_per_sec;
+    busiest->load.packets_per_sec -= to_move->load.packets_per_sec;
+    least_busy->load.processing_us_per_sec += to_move->load.processing_us_per_sec;
+    least_busy->load.packets_per_sec += to_move->load.packets_per_sec;
+    return;
+  }
+
+  // Roll back to the original thread so the receiver keeps its subscriptions. Its load stays where it was.
+  SACN_LOG_WARNING("Couldn't move sACN receiver for universe %u to receive thread %u: '%s'. Returning it to thread %u.",
+                   to_move->keys.universe, least_busy->thread_id, etcpal_strerror(res), busiest->thread_id);
+
+  to_move->thread_id = busiest->thread_id;
+  res                = add_receiver_to_thread(to_move, busiest);
+  if (res != kEtcPalErrOk)
+  {
+    SACN_LOG_ERR("Couldn't return sACN receiver for universe %u to receive thread %u: '%s'", to_move->keys.universe,
+                 busiest->thread_id, etcpal_strerror(res));
+  }
+}
+#endif  // SACN_RECEIVER_ENABLE_LOAD_BALANCING
+
 void process_receiver_sources(sacn_thread_id_t thread_id, SacnReceiver* receiver, SourcesLostNotification* sources_lost)
 {
   if (!SACN_ASSERT_VERIFY(thread_id != kSacnThreadIdInvalid) || !SACN_ASSERT_VERIFY(receiver) ||
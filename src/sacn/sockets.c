@@ -37,6 +37,9 @@
 #include "sacn/private/mem.h"
 #include "sacn/opts.h"
 #include "sacn/private/pdu.h"
+#include "sacn/private/uring.h"
+#include "sacn/private/packet_ring.h"
+#include "sacn/private/util.h"
 
 #if SACN_DYNAMIC_MEM
 #include <stdlib.h>
@@ -45,17 +48,73 @@
 #endif
 
 #include <stdio.h>
+#include <string.h>
+
+#if SACN_RECEIVER_USE_BPF_FILTER || SACN_RECEIVER_USE_PACKET_RING
+#include <errno.h>
+#include <sys/socket.h>
+#include <linux/filter.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+#if SACN_RECEIVER_USE_UDP_GRO || SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+#include <errno.h>
+#include <sys/socket.h>
+#endif
+
+#if SACN_RECEIVER_USE_UDP_GRO
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#endif
+
+#if SACN_RECEIVER_USE_REUSEPORT_STEERING && !defined(SO_ATTACH_REUSEPORT_CBPF)
+#define SO_ATTACH_REUSEPORT_CBPF 51
+#endif
 
 #ifndef DOXYGEN  // No Doxygen needed here
 
 /****************************** Private macros *******************************/
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSockets
+
 #ifdef _MSC_VER
 #define SACN_SPRINTF __pragma(warning(suppress : 4996)) sprintf
 #else
 #define SACN_SPRINTF sprintf
 #endif
 
+#if SACN_RECEIVER_ENABLED && SACN_RECEIVER_USE_BPF_FILTER
+#define SACN_USE_SOCKET_FILTER 1
+#else
+#define SACN_USE_SOCKET_FILTER 0
+#endif
+
+#if SACN_RECEIVER_ENABLED && SACN_RECEIVER_USE_REUSEPORT_STEERING
+#define SACN_USE_REUSEPORT_STEERING 1
+#else
+#define SACN_USE_REUSEPORT_STEERING 0
+#endif
+
+// Socket filter layout: a four-instruction header followed by a binary search tree over the universe ranges.
+#define UNIVERSE_FILTER_TREE_SIZE(num_ranges) ((5u * (num_ranges)) + 1u)
+
+// The most interfaces a thread's packet ring can be on at once.
+#if SACN_DYNAMIC_MEM
+#define PACKET_RING_MAX_NETINTS SACN_RING_FILTER_MAX_NETINTS
+#else
+#define PACKET_RING_MAX_NETINTS SACN_MAX_NETINTS
+#endif
+
 /****************************** Private types ********************************/
 
 typedef struct MulticastSendSocket
@@ -70,6 +129,19 @@ typedef struct SysNetintList
   size_t num_netints;
 } SysNetintList;
 
+#if SACN_USE_REUSEPORT_STEERING
+/*
+ * The bound receive sockets for one IP type, mirroring the order of the kernel's SO_REUSEPORT group. Each thread binds
+ * one socket, plus possibly a replacement while the old one waits to be closed.
+ */
+typedef struct ReuseportGroup
+{
+  etcpal_socket_t  sockets[SACN_RECEIVER_MAX_THREADS * 2];
+  sacn_thread_id_t threads[SACN_RECEIVER_MAX_THREADS * 2];
+  size_t           num_sockets;
+} ReuseportGroup;
+#endif
+
 /**************************** Private variables ******************************/
 
 #if SACN_DYNAMIC_MEM
@@ -85,6 +157,11 @@ static etcpal_socket_t       ipv6_unicast_send_socket = ETCPAL_SOCKET_INVALID;
 
 static SacnCommonCallbacks sacn_common_callbacks = {0};
 
+#if SACN_USE_REUSEPORT_STEERING
+static ReuseportGroup ipv4_reuseport_group;
+static ReuseportGroup ipv6_reuseport_group;
+#endif
+
 /*********************** Private function prototypes *************************/
 
 static etcpal_error_t sockets_init(const SacnNetintConfig* netint_config, sacn_networking_type_t net_type);
@@ -138,6 +215,26 @@ static etcpal_error_t create_receive_socket(etcpal_iptype_t       ip_type,
                                             bool                  set_sockopts,
                                             ReceiveSocket*        socket);
 static void           poll_add_socket(SacnRecvThreadContext* recv_thread_context, ReceiveSocket* socket);
+#if SACN_RECEIVER_USE_PACKET_RING
+static void           attach_drop_filter(etcpal_socket_t socket);
+#endif
+static etcpal_error_t add_to_thread_poll(SacnRecvThreadContext* context, etcpal_socket_t socket, bool wakeup);
+static SacnBpfInsn*   emit_universe_filter_tree(const SacnUniverseRange* ranges, size_t num_ranges, SacnBpfInsn* insn);
+#if SACN_USE_REUSEPORT_STEERING
+static void           add_to_reuseport_group(const ReceiveSocket* socket, sacn_thread_id_t thread_id);
+static void           remove_from_reuseport_group(const ReceiveSocket* socket);
+static void           update_reuseport_steering(ReuseportGroup* group);
+#endif
+#if SACN_USE_SOCKET_FILTER || SACN_RECEIVER_USE_PACKET_RING
+static size_t         get_thread_universe_ranges(const SacnRecvThreadContext* recv_thread_context,
+                                                 SacnUniverseRange*           ranges);
+#endif
+#if SACN_RECEIVER_USE_PACKET_RING
+static void           update_packet_ring(SacnRecvThreadContext* recv_thread_context);
+static size_t         get_thread_netints(const SacnRecvThreadContext* recv_thread_context,
+                                         unsigned int*                netints,
+                                         size_t                       max_netints);
+#endif
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 static etcpal_error_t queue_subscription(SacnRecvThreadContext*     recv_thread_context,
                                          etcpal_socket_t            sock,
@@ -159,6 +256,29 @@ static void           unsubscribe_socket_ref(SacnRecvThreadContext*         recv
 static void           cleanup_receive_socket(SacnRecvThreadContext*         context,
                                              const ReceiveSocket*           socket,
                                              sacn_socket_cleanup_behavior_t cleanup_behavior);
+static void           close_thread_wakeup(etcpal_socket_t wakeup);
+static void           drain_thread_wakeup(etcpal_socket_t wakeup);
+static void           remove_from_thread_poll(SacnRecvThreadContext* context, etcpal_socket_t socket);
+static int            read_socket(SacnRecvThreadContext* recv_thread_context,
+                                  etcpal_socket_t        socket,
+                                  SacnReadResult*        read_result);
+static int            get_read_result(SacnRecvThreadContext* recv_thread_context,
+                                      etcpal_socket_t        socket,
+                                      EtcPalMsgHdr*          msg,
+                                      int                    recv_res,
+                                      SacnReadResult*        read_result);
+#if SACN_RECEIVER_USE_IO_URING
+static etcpal_error_t read_uring(SacnRecvThreadContext* recv_thread_context, SacnReadResult* read_result);
+#endif
+#if SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+static uint64_t get_kernel_timestamp(const EtcPalMsgHdr* msg);
+#endif
+#if SACN_RECEIVER_USE_UDP_GRO
+static size_t get_gro_segment_size(const EtcPalMsgHdr* msg);
+#endif
+#if SACN_RECEIVER_USE_PACKET_RING
+static etcpal_error_t read_packet_ring(SacnRecvThreadContext* recv_thread_context, SacnReadResult* read_result);
+#endif
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
 static etcpal_error_t subscribe_on_single_interface(etcpal_socket_t sock, const EtcPalGroupReq* group);
 static etcpal_error_t unsubscribe_on_single_interface(etcpal_socket_t sock, const EtcPalGroupReq* group);
@@ -168,7 +288,7 @@ static etcpal_error_t send_unicast(const uint8_t*      send_buf,
                                    etcpal_error_t*     last_send_error);
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 static EtcPalSockAddr get_bind_address(etcpal_iptype_t ip_type);
-static bool           get_netint_id(EtcPalMsgHdr* msg, EtcPalMcastNetintId* netint_id);
+static bool           get_packet_info(EtcPalMsgHdr* msg, EtcPalMcastNetintId* netint_id, bool* multicast);
 #endif  // SACN_RECEIVER_ENABLED || DOXYGEN
 
 static etcpal_error_t init_sys_netint_list(SysNetintList* netint_list);
@@ -187,6 +307,10 @@ etcpal_error_t sacn_sockets_init(const SacnNetintConfig* netint_config, const Sa
   memset(&receiver_sys_netints, 0, sizeof(receiver_sys_netints));
   memset(&source_detector_sys_netints, 0, sizeof(source_detector_sys_netints));
   memset(&source_sys_netints, 0, sizeof(source_sys_netints));
+#if SACN_USE_REUSEPORT_STEERING
+  memset(&ipv4_reuseport_group, 0, sizeof(ipv4_reuseport_group));
+  memset(&ipv6_reuseport_group, 0, sizeof(ipv6_reuseport_group));
+#endif
 
   etcpal_error_t res = (netint_config && !netints_valid(netint_config->netints, netint_config->num_netints))
                            ? kEtcPalErrInvalid
@@ -269,8 +393,13 @@ void cleanup_receive_socket(SacnRecvThreadContext*         context,
   switch (cleanup_behavior)
   {
     case kPerformAllSocketCleanupNow:
-      if (context->poll_context_initialized && socket->polling)
-        etcpal_poll_remove_socket(&context->poll_context, socket->handle);
+      if (socket->polling)
+        remove_from_thread_poll(context, socket->handle);
+
+#if SACN_USE_REUSEPORT_STEERING
+      if (socket->bound)
+        remove_from_reuseport_group(socket);
+#endif
 
       etcpal_close(socket->handle);
 
@@ -289,6 +418,9 @@ void cleanup_receive_socket(SacnRecvThreadContext*         context,
           if (etcpal_bind(successor->socket.handle, &recv_any) == kEtcPalErrOk)
           {
             mark_socket_ref_bound(context, successor_index);
+#if SACN_USE_REUSEPORT_STEERING
+            add_to_reuseport_group(&successor->socket, context->thread_id);
+#endif
 
             if (!successor->pending)
               poll_add_socket(context, &successor->socket);
@@ -435,9 +567,17 @@ EtcPalSockAddr get_bind_address(etcpal_iptype_t ip_type)
   return recv_any;
 }
 
-bool get_netint_id(EtcPalMsgHdr* msg, EtcPalMcastNetintId* netint_id)
+/*
+ * Reads the PKTINFO control message of a received packet, if there is one.
+ *
+ * [in] msg The message header the packet was read with.
+ * [out] netint_id Filled in with the interface the packet came in on.
+ * [out] multicast Filled in with whether the packet was sent to a multicast group.
+ * Returns true if the packet info was found, or false if the outputs were left untouched.
+ */
+bool get_packet_info(EtcPalMsgHdr* msg, EtcPalMcastNetintId* netint_id, bool* multicast)
 {
-  if (!SACN_ASSERT_VERIFY(msg) || !SACN_ASSERT_VERIFY(netint_id))
+  if (!SACN_ASSERT_VERIFY(msg) || !SACN_ASSERT_VERIFY(netint_id) || !SACN_ASSERT_VERIFY(multicast))
     return false;
 
   EtcPalCMsgHdr cmsg          = {0};
@@ -455,6 +595,7 @@ bool get_netint_id(EtcPalMsgHdr* msg, EtcPalMcastNetintId* netint_id)
   {
     netint_id->index   = pktinfo.ifindex;
     netint_id->ip_type = pktinfo.addr.type;
+    *multicast         = etcpal_ip_is_multicast(&pktinfo.addr);
   }
 
   return pktinfo_found;
@@ -696,6 +837,26 @@ etcpal_error_t create_receive_socket(etcpal_iptype_t       ip_type,
       }
 #endif  // SACN_RECEIVER_ENABLE_SO_RCVBUF
 
+#if SACN_RECEIVER_USE_UDP_GRO
+      if (res == kEtcPalErrOk)
+      {
+        // Not fatal - the socket just reads one datagram at a time without it.
+        intval = 1;
+        if (setsockopt(new_sock, SOL_UDP, UDP_GRO, &intval, sizeof intval) != 0)
+          SACN_LOG_INFO("Couldn't enable UDP_GRO on an sACN receive socket: '%s'", strerror(errno));
+      }
+#endif  // SACN_RECEIVER_USE_UDP_GRO
+
+#if SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+      if (res == kEtcPalErrOk)
+      {
+        // Not fatal - packets are timestamped when they're read instead.
+        intval = 1;
+        if (setsockopt(new_sock, SOL_SOCKET, SO_TIMESTAMPNS, &intval, sizeof intval) != 0)
+          SACN_LOG_INFO("Couldn't enable SO_TIMESTAMPNS on an sACN receive socket: '%s'", strerror(errno));
+      }
+#endif  // SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+
 #if !SACN_RECEIVER_SOCKET_PER_NIC
       if (res == kEtcPalErrOk)
       {
@@ -744,10 +905,16 @@ void poll_add_socket(SacnRecvThreadContext* recv_thread_context, ReceiveSocket*
   if (!SACN_ASSERT_VERIFY(recv_thread_context) || !SACN_ASSERT_VERIFY(socket))
     return;
 
-  etcpal_error_t add_res = kEtcPalErrNotInit;
-  if (recv_thread_context->poll_context_initialized)
-    add_res = etcpal_poll_add_socket(&recv_thread_context->poll_context, socket->handle, ETCPAL_POLL_IN, NULL);
+#if SACN_RECEIVER_USE_PACKET_RING
+  if (recv_thread_context->packet_ring_initialized)
+  {
+    // The ring gets the traffic - the socket is only kept for its multicast subscriptions.
+    attach_drop_filter(socket->handle);
+    return;
+  }
+#endif
 
+  etcpal_error_t add_res = add_to_thread_poll(recv_thread_context, socket->handle, false);
   if (add_res == kEtcPalErrOk)
   {
     socket->polling = true;
@@ -759,6 +926,36 @@ void poll_add_socket(SacnRecvThreadContext* recv_thread_context, ReceiveSocket*
   }
 }
 
+// Starts watching a socket or the wakeup handle with whatever the thread reads through.
+etcpal_error_t add_to_thread_poll(SacnRecvThreadContext* context, etcpal_socket_t socket, bool wakeup)
+{
+#if SACN_RECEIVER_USE_IO_URING
+  if (context->uring_initialized)
+    return wakeup ? sacn_uring_add_wakeup(&context->uring, socket) : sacn_uring_add_socket(&context->uring, socket);
+#else
+  ETCPAL_UNUSED_ARG(wakeup);
+#endif
+
+  if (!context->poll_context_initialized)
+    return kEtcPalErrNotInit;
+
+  return etcpal_poll_add_socket(&context->poll_context, socket, ETCPAL_POLL_IN, NULL);
+}
+
+#if SACN_RECEIVER_USE_PACKET_RING
+// Makes a receive socket drop everything that arrives on it, so the packets aren't queued up there unread.
+void attach_drop_filter(etcpal_socket_t socket)
+{
+  SacnBpfInsn       drop = {SACN_BPF_RET_K, 0, 0, SACN_BPF_REJECT};
+  struct sock_fprog prog;
+  prog.len    = 1;
+  prog.filter = (struct sock_filter*)&drop;
+
+  if (setsockopt(socket, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof prog) != 0)
+    SACN_LOG_WARNING("Couldn't attach a drop filter to an sACN receive socket: '%s'", strerror(errno));
+}
+#endif
+
 /*
  * Obtains the sACN multicast address for the given universe and IP type.
  *
@@ -866,6 +1063,10 @@ etcpal_error_t sacn_add_receiver_socket(sacn_thread_id_t           thread_id,
       else
       {
         ref = &context->socket_refs[ref_index];
+#if SACN_USE_REUSEPORT_STEERING
+        if (new_socket.bound)
+          add_to_reuseport_group(&new_socket, context->thread_id);
+#endif
       }
     }
   }
@@ -876,6 +1077,10 @@ etcpal_error_t sacn_add_receiver_socket(sacn_thread_id_t           thread_id,
   if (res == kEtcPalErrOk)
   {
     *socket = ref->socket.handle;
+#if SACN_RECEIVER_ENABLE_BPF_FILTER || SACN_RECEIVER_ENABLE_PACKET_RING
+    context->socket_filter_dirty = true;
+#endif
+    sacn_wake_receive_thread(context);
   }
   else
   {
@@ -910,6 +1115,13 @@ void sacn_remove_receiver_socket(sacn_thread_id_t               thread_id,
 
       if (SACN_ASSERT_VERIFY(index >= 0))
         unsubscribe_socket_ref(context, index, universe, netints, num_netints, cleanup_behavior);
+
+#if SACN_RECEIVER_ENABLE_BPF_FILTER || SACN_RECEIVER_ENABLE_PACKET_RING
+      context->socket_filter_dirty = true;
+#endif
+
+      if (cleanup_behavior == kQueueSocketCleanup)
+        sacn_wake_receive_thread(context);
     }
 
     *socket = ETCPAL_SOCKET_INVALID;
@@ -1118,6 +1330,247 @@ void sacn_add_pending_sockets(SacnRecvThreadContext* recv_thread_context)
 
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
+/*
+ * Sets up the io_uring the thread reads through in place of its poll context, if SACN_RECEIVER_ENABLE_IO_URING is
+ * enabled on Linux. Must be called before any sockets or the wakeup handle are added. Needs lock.
+ *
+ * [in,out] recv_thread_context Context representing the thread calling this function.
+ * Returns kEtcPalErrOk on success. On failure, including when io_uring isn't enabled or supported, the thread keeps
+ * using its poll context.
+ */
+etcpal_error_t sacn_init_thread_uring(SacnRecvThreadContext* recv_thread_context)
+{
+#if SACN_RECEIVER_USE_IO_URING
+  if (!SACN_ASSERT_VERIFY(recv_thread_context))
+    return kEtcPalErrSys;
+
+  etcpal_error_t res                     = sacn_uring_init(&recv_thread_context->uring);
+  recv_thread_context->uring_initialized = (res == kEtcPalErrOk);
+  return res;
+#else
+  ETCPAL_UNUSED_ARG(recv_thread_context);
+  return kEtcPalErrNotImpl;
+#endif
+}
+
+/*
+ * Tears down the thread's io_uring, if it has one. Needs lock.
+ *
+ * [in,out] recv_thread_context Context representing the thread calling this function.
+ */
+void sacn_deinit_thread_uring(SacnRecvThreadContext* recv_thread_context)
+{
+#if SACN_RECEIVER_USE_IO_URING
+  if (!SACN_ASSERT_VERIFY(recv_thread_context) || !recv_thread_context->uring_initialized)
+    return;
+
+  sacn_uring_deinit(&recv_thread_context->uring);
+  recv_thread_context->uring_initialized = false;
+#else
+  ETCPAL_UNUSED_ARG(recv_thread_context);
+#endif
+}
+
+/*
+ * Sets up the packet ring the thread reads sACN from in place of its sockets, if SACN_RECEIVER_ENABLE_PACKET_RING is
+ * enabled on Linux. The ring is watched through the thread's poll context, which must already be initialized. Must be
+ * called before any sockets are added. Needs lock.
+ *
+ * [in,out] recv_thread_context Context representing the thread calling this function.
+ * Returns kEtcPalErrOk on success. On failure, including when the process doesn't have CAP_NET_RAW, the thread keeps
+ * reading its sockets.
+ */
+etcpal_error_t sacn_init_thread_packet_ring(SacnRecvThreadContext* recv_thread_context)
+{
+#if SACN_RECEIVER_USE_PACKET_RING
+  if (!SACN_ASSERT_VERIFY(recv_thread_context) || !SACN_ASSERT_VERIFY(recv_thread_context->poll_context_initialized))
+    return kEtcPalErrSys;
+
+  // The ring starts out on no interfaces, and is pointed at its receivers' on the next thread cycle.
+  SacnBpfInsn filter[SACN_RING_FILTER_SIZE(0, 0)];
+  size_t      filter_len = sacn_build_ring_filter(NULL, 0, NULL, 0, filter, SACN_RING_FILTER_SIZE(0, 0));
+  if (!SACN_ASSERT_VERIFY(filter_len > 0))
+    return kEtcPalErrSys;
+
+  SacnPacketRing* ring = &recv_thread_context->packet_ring;
+  etcpal_error_t  res  = sacn_packet_ring_init(ring, filter, filter_len);
+  if (res != kEtcPalErrOk)
+    return res;
+
+  res = etcpal_poll_add_socket(&recv_thread_context->poll_context, ring->fd, ETCPAL_POLL_IN, NULL);
+
+  if (res == kEtcPalErrOk)
+  {
+    recv_thread_context->packet_ring_initialized = true;
+    recv_thread_context->socket_filter_dirty     = true;
+  }
+  else
+  {
+    sacn_packet_ring_deinit(ring);
+  }
+
+  return res;
+#else
+  ETCPAL_UNUSED_ARG(recv_thread_context);
+  return kEtcPalErrNotImpl;
+#endif
+}
+
+/*
+ * Tears down the thread's packet ring, if it has one. Must be called before the thread's poll context is deinitialized.
+ * Needs lock.
+ *
+ * [in,out] recv_thread_context Context representing the thread calling this function.
+ */
+void sacn_deinit_thread_packet_ring(SacnRecvThreadContext* recv_thread_context)
+{
+#if SACN_RECEIVER_USE_PACKET_RING
+  if (!SACN_ASSERT_VERIFY(recv_thread_context) || !recv_thread_context->packet_ring_initialized)
+    return;
+
+  if (recv_thread_context->poll_context_initialized)
+    etcpal_poll_remove_socket(&recv_thread_context->poll_context, recv_thread_context->packet_ring.fd);
+
+  sacn_packet_ring_deinit(&recv_thread_context->packet_ring);
+  recv_thread_context->packet_ring_initialized = false;
+#else
+  ETCPAL_UNUSED_ARG(recv_thread_context);
+#endif
+}
+
+/*
+ * Creates the handle used to wake the thread out of sacn_read() when socket operations are queued for it, and adds it
+ * to the thread's poll context or io_uring. This is an eventfd on Linux and a loopback UDP socket elsewhere. Needs
+ * lock.
+ *
+ * [in,out] recv_thread_context Context representing the thread calling this function. Its poll context must be
+ * initialized.
+ * Returns kEtcPalErrOk on success. On failure, queued operations are picked up when the read times out instead.
+ */
+etcpal_error_t sacn_init_thread_wakeup(SacnRecvThreadContext* recv_thread_context)
+{
+  if (!SACN_ASSERT_VERIFY(recv_thread_context) || !SACN_ASSERT_VERIFY(recv_thread_context->poll_context_initialized))
+    return kEtcPalErrSys;
+
+  etcpal_socket_t wakeup = ETCPAL_SOCKET_INVALID;
+#if defined(__linux__)
+  wakeup             = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  etcpal_error_t res = (wakeup >= 0) ? kEtcPalErrOk : kEtcPalErrSys;
+#else
+  etcpal_error_t res = etcpal_socket(ETCPAL_AF_INET, ETCPAL_SOCK_DGRAM, &wakeup);
+  if (res == kEtcPalErrOk)
+  {
+    EtcPalSockAddr loopback;
+    ETCPAL_IP_SET_V4_ADDRESS(&loopback.ip, 0x7f000001);
+    loopback.port = 0;
+
+    res = etcpal_bind(wakeup, &loopback);
+    if (res == kEtcPalErrOk)
+      res = etcpal_getsockname(wakeup, &recv_thread_context->wakeup_addr);
+    if (res == kEtcPalErrOk)
+      res = etcpal_setblocking(wakeup, false);
+
+    if (res != kEtcPalErrOk)
+      etcpal_close(wakeup);
+  }
+#endif
+
+  if (res == kEtcPalErrOk)
+  {
+    res = add_to_thread_poll(recv_thread_context, wakeup, true);
+    if (res != kEtcPalErrOk)
+      close_thread_wakeup(wakeup);
+  }
+
+  if (res == kEtcPalErrOk)
+  {
+    recv_thread_context->wakeup_socket  = wakeup;
+    recv_thread_context->wakeup_pending = false;
+  }
+
+  return res;
+}
+
+/*
+ * Removes the thread's wakeup handle from its poll context or io_uring and closes it. Needs lock.
+ *
+ * [in,out] recv_thread_context Context representing the thread calling this function.
+ */
+void sacn_deinit_thread_wakeup(SacnRecvThreadContext* recv_thread_context)
+{
+  if (!SACN_ASSERT_VERIFY(recv_thread_context) || (recv_thread_context->wakeup_socket == ETCPAL_SOCKET_INVALID))
+    return;
+
+  remove_from_thread_poll(recv_thread_context, recv_thread_context->wakeup_socket);
+  close_thread_wakeup(recv_thread_context->wakeup_socket);
+  recv_thread_context->wakeup_socket  = ETCPAL_SOCKET_INVALID;
+  recv_thread_context->wakeup_pending = false;
+}
+
+/*
+ * Wakes the thread out of sacn_read() so it applies its queued socket operations right away. Wakeups are coalesced
+ * until the thread clears wakeup_pending. Can be called from any thread. Needs lock.
+ *
+ * [in,out] recv_thread_context Context of the thread to wake.
+ */
+void sacn_wake_receive_thread(SacnRecvThreadContext* recv_thread_context)
+{
+  if (!SACN_ASSERT_VERIFY(recv_thread_context) || recv_thread_context->wakeup_pending ||
+      (recv_thread_context->wakeup_socket == ETCPAL_SOCKET_INVALID))
+  {
+    return;
+  }
+
+#if defined(__linux__)
+  uint64_t increment                  = 1;
+  recv_thread_context->wakeup_pending = (write(recv_thread_context->wakeup_socket, &increment, sizeof(increment)) ==
+                                         (ssize_t)sizeof(increment));
+#else
+  uint8_t wakeup_byte                 = 0;
+  recv_thread_context->wakeup_pending = (etcpal_sendto(recv_thread_context->wakeup_socket, &wakeup_byte, 1, 0,
+                                                       &recv_thread_context->wakeup_addr) == 1);
+#endif
+}
+
+void close_thread_wakeup(etcpal_socket_t wakeup)
+{
+#if defined(__linux__)
+  close(wakeup);
+#else
+  etcpal_close(wakeup);
+#endif
+}
+
+// Consumes all outstanding wakeups. The handle is non-blocking.
+void drain_thread_wakeup(etcpal_socket_t wakeup)
+{
+#if defined(__linux__)
+  uint64_t count = 0;
+  ssize_t  res   = read(wakeup, &count, sizeof(count));  // Reading an eventfd resets its counter.
+  ETCPAL_UNUSED_ARG(res);
+#else
+  uint8_t buf[8];
+  while (etcpal_recv(wakeup, buf, sizeof(buf), 0) > 0)
+  {
+  }
+#endif
+}
+
+// Stops watching a socket or the wakeup handle. Must be called before the handle is closed.
+void remove_from_thread_poll(SacnRecvThreadContext* context, etcpal_socket_t socket)
+{
+#if SACN_RECEIVER_USE_IO_URING
+  if (context->uring_initialized)
+  {
+    sacn_uring_remove(&context->uring, socket);
+    return;
+  }
+#endif
+
+  if (context->poll_context_initialized)
+    etcpal_poll_remove_socket(&context->poll_context, socket);
+}
+
 void sacn_cleanup_dead_sockets(SacnRecvThreadContext* recv_thread_context)
 {
   for (const ReceiveSocket* socket = recv_thread_context->dead_sockets;
@@ -1151,83 +1604,574 @@ void sacn_unsubscribe_sockets(SacnRecvThreadContext* recv_thread_context)
 }
 
 /*
- * Read and process input data for a thread's sockets.
- *
- * Blocks up to SACN_RECEIVER_READ_TIMEOUT_MS waiting for data.
+ * Regenerates the kernel packet filter on the thread's bound sockets, or on its packet ring if it has one, if its set
+ * of universes or interfaces has changed. Does nothing for the sockets unless SACN_RECEIVER_ENABLE_BPF_FILTER is
+ * enabled on Linux.
  *
  * [in,out] recv_thread_context Context representing the thread calling this function.
- * [out] read_result Filled in with the data if the read was successful on a socket.
- *
- * Returns kEtcPalErrOk if the data has been received.
- * Returns kEtcPalErrTimedOut if the function timed out while waiting for data.
- * Returns other error codes on error. In this case, calling code should sleep to prevent the
- * execution thread from spinning constantly when, for example, there are no receivers listening.
  */
-etcpal_error_t sacn_read(SacnRecvThreadContext* recv_thread_context, SacnReadResult* read_result)
+void sacn_update_socket_filters(SacnRecvThreadContext* recv_thread_context)
 {
-#if SACN_RECEIVER_ENABLED
-  if (!SACN_ASSERT_VERIFY(recv_thread_context) || !SACN_ASSERT_VERIFY(read_result))
-    return kEtcPalErrSys;
+#if SACN_RECEIVER_USE_PACKET_RING
+  if (!SACN_ASSERT_VERIFY(recv_thread_context))
+    return;
 
-  EtcPalPollEvent event   = {0};
-  etcpal_error_t poll_res = etcpal_poll_wait(&recv_thread_context->poll_context, &event, SACN_RECEIVER_READ_TIMEOUT_MS);
-  if (poll_res == kEtcPalErrOk)
+  if (recv_thread_context->packet_ring_initialized)
   {
-    if (event.events & ETCPAL_POLL_ERR)
-    {
-      etcpal_poll_remove_socket(&recv_thread_context->poll_context, event.socket);
-      return event.err;
-    }
+    // The sockets drop everything, so only the ring's filter follows the thread's receivers.
+    if (recv_thread_context->socket_filter_dirty)
+      update_packet_ring(recv_thread_context);
+    return;
+  }
+#endif
 
-    if (event.events & ETCPAL_POLL_IN)
-    {
-      uint8_t control_buf[ETCPAL_MAX_CONTROL_SIZE_PKTINFO] = {0};  // Ancillary data
+#if SACN_USE_SOCKET_FILTER
+  if (!SACN_ASSERT_VERIFY(recv_thread_context) || !recv_thread_context->socket_filter_dirty)
+    return;
 
-      EtcPalMsgHdr msg = {{0}};
-      msg.buf          = recv_thread_context->recv_buf;
-      msg.buflen       = kSacnMtu;
-      msg.control      = control_buf;
-      msg.controllen   = ETCPAL_MAX_CONTROL_SIZE_PKTINFO;
+#if SACN_DYNAMIC_MEM
+  size_t             max_ranges = (recv_thread_context->num_receivers > 0) ? recv_thread_context->num_receivers : 1;
+  SacnUniverseRange* ranges     = SACN_CALLOC(max_ranges, sizeof(SacnUniverseRange));
+  SacnBpfInsn*       insns      = SACN_CALLOC(SACN_UNIVERSE_FILTER_SIZE(max_ranges), sizeof(SacnBpfInsn));
+  size_t             max_insns  = SACN_UNIVERSE_FILTER_SIZE(max_ranges);
+  if (!ranges || !insns)
+  {
+    // Leave the filter dirty so this is retried on the next thread cycle.
+    SACN_FREE(ranges);
+    SACN_FREE(insns);
+    return;
+  }
+#else
+  static SacnUniverseRange ranges[SACN_RECEIVER_MAX_UNIVERSES];
+  static SacnBpfInsn       insns[SACN_UNIVERSE_FILTER_SIZE(SACN_RECEIVER_MAX_UNIVERSES)];
+  size_t                   max_insns = SACN_UNIVERSE_FILTER_SIZE(SACN_RECEIVER_MAX_UNIVERSES);
+#endif
 
-      int recv_res = etcpal_recvmsg(event.socket, &msg, 0);
-      if (recv_res > 0)
-      {
-        if (msg.flags & ETCPAL_MSG_TRUNC)
-        {
-          recv_res = kEtcPalErrProtocol;  // No sACN packets should be bigger than kSacnMtu.
-        }
-        else
-        {
-          read_result->from_addr = msg.name;
-          read_result->data_len  = (size_t)recv_res;
-          read_result->data      = recv_thread_context->recv_buf;
+  size_t num_ranges = get_thread_universe_ranges(recv_thread_context, ranges);
+  size_t num_insns  = sacn_build_universe_filter(ranges, num_ranges, insns, max_insns);
 
-          // Obtain the network interface the packet came in on using one of two configured methods
-#if SACN_RECEIVER_SOCKET_PER_NIC
-          if (sacn_receiver_lock())
-          {
-            int index = find_socket_ref_by_handle(recv_thread_context, event.socket);
-
-            if (index >= 0)
-            {
-              read_result->netint.ip_type = recv_thread_context->socket_refs[index].socket.ip_type;
-              read_result->netint.index   = recv_thread_context->socket_refs[index].socket.ifindex;
-            }
-            else
-            {
-              // Data from a socket we just removed (kEtcPalErrNoSockets will not log an error)
-              recv_res = kEtcPalErrNoSockets;
-            }
-
-            sacn_receiver_unlock();
-          }
-#else   // SACN_RECEIVER_SOCKET_PER_NIC
-          if ((msg.flags & ETCPAL_MSG_CTRUNC) || !get_netint_id(&msg, &read_result->netint))
-            recv_res = kEtcPalErrSys;
-#endif  // SACN_RECEIVER_SOCKET_PER_NIC
-        }
+  struct sock_fprog prog;
+  prog.len    = (unsigned short)num_insns;
+  prog.filter = (struct sock_filter*)insns;
+
+  for (const SocketRef* ref = recv_thread_context->socket_refs;
+       ref < recv_thread_context->socket_refs + recv_thread_context->num_socket_refs; ++ref)
+  {
+    if (!ref->socket.bound)
+      continue;  // Sockets that aren't bound never receive anything.
+
+    int res = 0;
+    if (num_insns > 0)
+    {
+      res = setsockopt(ref->socket.handle, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof prog);
+    }
+    else
+    {
+      // Too many universe ranges to express in one program - let everything through instead.
+      int unused = 0;
+      res        = setsockopt(ref->socket.handle, SOL_SOCKET, SO_DETACH_FILTER, &unused, sizeof unused);
+      if ((res != 0) && (errno == ENOENT))
+        res = 0;  // No filter was attached.
+    }
+
+    if (res != 0)
+      SACN_LOG_WARNING("Couldn't update the kernel packet filter on an sACN receive socket: '%s'", strerror(errno));
+  }
+
+  if (num_insns == 0)
+  {
+    SACN_LOG_NOTICE("Receiver thread %u listens to too many universe ranges for a kernel packet filter; all sACN "
+                    "data packets will be passed to the library.",
+                    (unsigned int)recv_thread_context->thread_id);
+  }
+
+  recv_thread_context->socket_filter_dirty = false;
+
+#if SACN_DYNAMIC_MEM
+  SACN_FREE(ranges);
+  SACN_FREE(insns);
+#endif
+#else   // SACN_USE_SOCKET_FILTER
+  ETCPAL_UNUSED_ARG(recv_thread_context);
+#endif  // SACN_USE_SOCKET_FILTER
+}
+
+#if SACN_RECEIVER_USE_PACKET_RING
+/*
+ * Points the thread's packet ring at the interfaces and universes of the thread's receivers. Every thread's ring gets
+ * its own copy of the traffic, so this is what keeps other threads' universes out of it. The filter is left dirty if
+ * this runs out of memory, so it is retried on the next thread cycle. Needs lock.
+ *
+ * [in,out] recv_thread_context Context representing the thread calling this function.
+ */
+void update_packet_ring(SacnRecvThreadContext* recv_thread_context)
+{
+  SacnPacketRing* ring = &recv_thread_context->packet_ring;
+
+  unsigned int   netints[PACKET_RING_MAX_NETINTS];
+  size_t         num_netints = get_thread_netints(recv_thread_context, netints, PACKET_RING_MAX_NETINTS);
+  etcpal_error_t netint_res  = sacn_packet_ring_set_netints(ring, netints, num_netints);
+  if (netint_res == kEtcPalErrNoMem)
+    return;
+  if (netint_res != kEtcPalErrOk)
+  {
+    SACN_LOG_WARNING("Couldn't put a network interface into all-multicast mode for an sACN packet ring: '%s'",
+                     etcpal_strerror(netint_res));
+  }
+
+#if SACN_DYNAMIC_MEM
+  size_t             max_ranges = (recv_thread_context->num_receivers > 0) ? recv_thread_context->num_receivers : 1;
+  size_t             max_insns  = SACN_RING_FILTER_SIZE(ring->num_netints, max_ranges);
+  SacnUniverseRange* ranges     = SACN_CALLOC(max_ranges, sizeof(SacnUniverseRange));
+  SacnBpfInsn*       insns      = SACN_CALLOC(max_insns, sizeof(SacnBpfInsn));
+  if (!ranges || !insns)
+  {
+    SACN_FREE(ranges);
+    SACN_FREE(insns);
+    return;
+  }
+#else
+  static SacnUniverseRange ranges[SACN_RECEIVER_MAX_UNIVERSES];
+  static SacnBpfInsn       insns[SACN_RING_FILTER_SIZE(SACN_MAX_NETINTS, SACN_RECEIVER_MAX_UNIVERSES)];
+  size_t                   max_insns = SACN_RING_FILTER_SIZE(SACN_MAX_NETINTS, SACN_RECEIVER_MAX_UNIVERSES);
+#endif
+
+  size_t num_ranges = get_thread_universe_ranges(recv_thread_context, ranges);
+  size_t num_insns  = sacn_build_ring_filter(ring->netints, ring->num_netints, ranges, num_ranges, insns, max_insns);
+  if (num_insns == 0)
+  {
+    // Too many universe ranges to express in one program - pass every universe instead. The thread still only
+    // processes the universes it owns.
+    static const SacnUniverseRange kAllUniverses = {0, 0xffff};
+    num_insns = sacn_build_ring_filter(ring->netints, ring->num_netints, &kAllUniverses, 1, insns, max_insns);
+
+    SACN_LOG_NOTICE("Receiver thread %u listens to too many universe ranges for a kernel packet filter; all sACN "
+                    "data packets will be passed to the thread.",
+                    (unsigned int)recv_thread_context->thread_id);
+  }
+
+  etcpal_error_t filter_res = sacn_packet_ring_set_filter(ring, insns, num_insns);
+  if (filter_res != kEtcPalErrOk)
+  {
+    SACN_LOG_WARNING("Couldn't update the kernel packet filter on an sACN packet ring: '%s'",
+                     etcpal_strerror(filter_res));
+  }
+
+  recv_thread_context->socket_filter_dirty = false;
+
+#if SACN_DYNAMIC_MEM
+  SACN_FREE(ranges);
+  SACN_FREE(insns);
+#endif
+}
+
+/*
+ * Gathers the interfaces used by the thread's receivers, without duplicates.
+ *
+ * [in] recv_thread_context Context of the thread whose receivers to read.
+ * [out] netints Filled in with the interface indexes.
+ * [in] max_netints Room in netints.
+ * Returns the number of interfaces written.
+ */
+size_t get_thread_netints(const SacnRecvThreadContext* recv_thread_context, unsigned int* netints, size_t max_netints)
+{
+  size_t num_netints = 0;
+  for (const SacnReceiver* receiver = recv_thread_context->receivers; receiver; receiver = receiver->next)
+  {
+    for (const EtcPalMcastNetintId* netint = receiver->netints.netints;
+         netint < receiver->netints.netints + receiver->netints.num_netints; ++netint)
+    {
+      bool found = false;
+      for (size_t i = 0; !found && (i < num_netints); ++i)
+        found = (netints[i] == netint->index);
+
+      if (!found && (num_netints < max_netints))
+        netints[num_netints++] = netint->index;
+    }
+  }
+
+  return num_netints;
+}
+#endif  // SACN_RECEIVER_USE_PACKET_RING
+
+#if SACN_USE_SOCKET_FILTER || SACN_RECEIVER_USE_PACKET_RING
+/*
+ * Gathers the universes of the thread's receivers into sorted, non-overlapping, non-adjacent ranges.
+ *
+ * [in] recv_thread_context Context of the thread whose receivers to read.
+ * [out] ranges Filled in with the ranges. Must have room for one range per receiver.
+ * Returns the number of ranges written.
+ */
+size_t get_thread_universe_ranges(const SacnRecvThreadContext* recv_thread_context, SacnUniverseRange* ranges)
+{
+  size_t num_ranges = 0;
+  for (const SacnReceiver* receiver = recv_thread_context->receivers; receiver; receiver = receiver->next)
+  {
+    uint16_t universe = receiver->keys.universe;
+
+    // Skip the ranges that end more than one universe below this one.
+    size_t index = 0;
+    while ((index < num_ranges) && ((uint32_t)ranges[index].last + 1 < universe))
+      ++index;
+
+    if ((index < num_ranges) && ((uint32_t)universe + 1 >= ranges[index].first))
+    {
+      // The universe is in or next to this range, so widen it and merge with the next range if they now touch.
+      if (universe < ranges[index].first)
+        ranges[index].first = universe;
+      if (universe > ranges[index].last)
+        ranges[index].last = universe;
+
+      if ((index + 1 < num_ranges) && ((uint32_t)ranges[index].last + 1 >= ranges[index + 1].first))
+      {
+        ranges[index].last = ranges[index + 1].last;
+        memmove(&ranges[index + 1], &ranges[index + 2], (num_ranges - index - 2) * sizeof(SacnUniverseRange));
+        --num_ranges;
       }
+    }
+    else
+    {
+      memmove(&ranges[index + 1], &ranges[index], (num_ranges - index) * sizeof(SacnUniverseRange));
+      ranges[index].first = universe;
+      ranges[index].last  = universe;
+      ++num_ranges;
+    }
+  }
+
+  return num_ranges;
+}
+#endif  // SACN_USE_SOCKET_FILTER || SACN_RECEIVER_USE_PACKET_RING
+
+/*
+ * Builds a classic BPF socket filter that passes sACN data packets only for the given universes. Packets that aren't
+ * data packets (e.g. universe discovery and sync) are always passed.
+ *
+ * [in] ranges Universe ranges to pass, sorted in ascending order and not overlapping.
+ * [in] num_ranges Number of entries in ranges.
+ * [out] insns Filled in with the program.
+ * [in] max_insns Room in insns.
+ * Returns the number of instructions written, or 0 if the program doesn't fit in max_insns or in the kernel's limit.
+ */
+size_t sacn_build_universe_filter(const SacnUniverseRange* ranges,
+                                  size_t                   num_ranges,
+                                  SacnBpfInsn*             insns,
+                                  size_t                   max_insns)
+{
+  if (!SACN_ASSERT_VERIFY(ranges || (num_ranges == 0)) || !SACN_ASSERT_VERIFY(insns))
+    return 0;
+
+  size_t num_insns = SACN_UNIVERSE_FILTER_SIZE(num_ranges);
+  if ((num_insns > max_insns) || (num_insns > SACN_BPF_MAX_INSNS))
+    return 0;
+
+  static const SacnBpfInsn kHeader[4] = {
+      {SACN_BPF_LD_W_ABS, 0, 0, SACN_BPF_UDP_HEADER_SIZE + SACN_ROOT_VECTOR_OFFSET},
+      {SACN_BPF_JEQ_K, 1, 0, ACN_VECTOR_ROOT_E131_DATA},
+      {SACN_BPF_RET_K, 0, 0, SACN_BPF_ACCEPT},
+      {SACN_BPF_LD_H_ABS, 0, 0, SACN_BPF_UDP_HEADER_SIZE + SACN_UNIVERSE_OFFSET},
+  };
+  memcpy(insns, kHeader, sizeof kHeader);
+
+  emit_universe_filter_tree(ranges, num_ranges, &insns[4]);
+  return num_insns;
+}
+
+/*
+ * Emits a binary search over the universe ranges. The universe must already be in the accumulator. Each range takes
+ * five instructions and each empty subtree takes one, so the tree is UNIVERSE_FILTER_TREE_SIZE(num_ranges) long.
+ *
+ * Returns a pointer just past the last instruction written.
+ */
+SacnBpfInsn* emit_universe_filter_tree(const SacnUniverseRange* ranges, size_t num_ranges, SacnBpfInsn* insn)
+{
+  if (num_ranges == 0)
+  {
+    SacnBpfInsn reject = {SACN_BPF_RET_K, 0, 0, SACN_BPF_REJECT};
+    *insn++            = reject;
+    return insn;
+  }
+
+  size_t mid = num_ranges / 2;
+
+  // Above this range: jump over the rest of this node and the left subtree. Below it: fall into the left subtree.
+  SacnBpfInsn node[4] = {
+      {SACN_BPF_JGT_K, 0, 1, ranges[mid].last},
+      {SACN_BPF_JA, 0, 0, (uint32_t)(2u + UNIVERSE_FILTER_TREE_SIZE(mid))},
+      {SACN_BPF_JGE_K, 0, 1, ranges[mid].first},
+      {SACN_BPF_RET_K, 0, 0, SACN_BPF_ACCEPT},
+  };
+  memcpy(insn, node, sizeof node);
+  insn += 4;
+
+  insn = emit_universe_filter_tree(ranges, mid, insn);
+  return emit_universe_filter_tree(&ranges[mid + 1], num_ranges - mid - 1, insn);
+}
+
+/*
+ * Builds a classic BPF SO_REUSEPORT program that steers each sACN data packet to the group socket of the receive
+ * thread that owns its universe (see SACN_STEERED_THREAD). Other packets (e.g. universe discovery) go to thread 0,
+ * which runs the source detector.
+ *
+ * [in] group_threads The thread that bound each socket in the reuseport group, in the kernel's order.
+ * [in] group_size Number of entries in group_threads.
+ * [in] num_threads Number of receive threads. Must be greater than 0.
+ * [out] insns Filled in with the program.
+ * [in] max_insns Room in insns.
+ * Returns the number of instructions written, or 0 if the program might not fit in max_insns.
+ */
+size_t sacn_build_steering_filter(const sacn_thread_id_t* group_threads,
+                                  size_t                  group_size,
+                                  unsigned int            num_threads,
+                                  SacnBpfInsn*            insns,
+                                  size_t                  max_insns)
+{
+  if (!SACN_ASSERT_VERIFY(group_threads || (group_size == 0)) || !SACN_ASSERT_VERIFY(num_threads > 0) ||
+      !SACN_ASSERT_VERIFY(insns))
+  {
+    return 0;
+  }
+
+  size_t max_size = SACN_STEERING_FILTER_SIZE(num_threads);
+  if ((max_size > max_insns) || (max_size > SACN_BPF_MAX_INSNS))
+    return 0;
 
+  // Reuseport programs see the packet starting at the UDP payload.
+  SacnBpfInsn header[6] = {
+      {SACN_BPF_LD_W_ABS, 0, 0, SACN_ROOT_VECTOR_OFFSET},
+      {SACN_BPF_JEQ_K, 2, 0, ACN_VECTOR_ROOT_E131_DATA},
+      {SACN_BPF_LD_IMM, 0, 0, 0},
+      {SACN_BPF_JA, 0, 0, 2},
+      {SACN_BPF_LD_H_ABS, 0, 0, SACN_UNIVERSE_OFFSET},
+      {SACN_BPF_MOD_K, 0, 0, num_threads},
+  };
+  memcpy(insns, header, sizeof header);
+
+  SacnBpfInsn* insn = &insns[6];
+  for (sacn_thread_id_t thread_id = 0; thread_id < num_threads; ++thread_id)
+  {
+    // If a thread briefly has two bound sockets while its old one waits to be closed, steer to the newer one.
+    for (size_t i = group_size; i > 0; --i)
+    {
+      if (group_threads[i - 1] == thread_id)
+      {
+        SacnBpfInsn match[2] = {
+            {SACN_BPF_JEQ_K, 0, 1, thread_id},
+            {SACN_BPF_RET_K, 0, 0, (uint32_t)(i - 1)},
+        };
+        memcpy(insn, match, sizeof match);
+        insn += 2;
+        break;
+      }
+    }
+  }
+
+  // No socket for the thread yet - an out-of-range index makes the kernel pick a socket by hash instead.
+  SacnBpfInsn fallback = {SACN_BPF_RET_K, 0, 0, SACN_BPF_ACCEPT};
+  *insn++              = fallback;
+
+  return (size_t)(insn - insns);
+}
+
+/*
+ * Builds the classic BPF program for a receive thread's packet ring, which sees packets starting at the IP header. It
+ * passes IPv4 and IPv6 UDP packets to the sACN port that came in on one of the given interfaces, and of those, sACN
+ * data packets only for the given universes. Other sACN packets (e.g. universe discovery and sync) are always passed.
+ * IPv4 fragments after the first are dropped, as they don't carry the UDP header. IPv6 packets are only matched if UDP
+ * directly follows the fixed header.
+ *
+ * [in] netints Indexes of the interfaces to pass packets from.
+ * [in] num_netints Number of entries in netints. Must be no more than SACN_RING_FILTER_MAX_NETINTS.
+ * [in] ranges Universe ranges to pass, sorted in ascending order and not overlapping.
+ * [in] num_ranges Number of entries in ranges.
+ * [out] insns Filled in with the program.
+ * [in] max_insns Room in insns.
+ * Returns the number of instructions written, or 0 if the program doesn't fit in max_insns or in the kernel's limit.
+ */
+size_t sacn_build_ring_filter(const unsigned int*      netints,
+                              size_t                   num_netints,
+                              const SacnUniverseRange* ranges,
+                              size_t                   num_ranges,
+                              SacnBpfInsn*             insns,
+                              size_t                   max_insns)
+{
+  if (!SACN_ASSERT_VERIFY(netints || (num_netints == 0)) || !SACN_ASSERT_VERIFY(ranges || (num_ranges == 0)) ||
+      !SACN_ASSERT_VERIFY(insns) || (num_netints > SACN_RING_FILTER_MAX_NETINTS))
+  {
+    return 0;
+  }
+
+  size_t num_insns = SACN_RING_FILTER_SIZE(num_netints, num_ranges);
+  if ((num_insns > max_insns) || (num_insns > SACN_BPF_MAX_INSNS))
+    return 0;
+
+  // Interface: each match jumps over the rest of the matches and the reject.
+  SacnBpfInsn* insn        = insns;
+  SacnBpfInsn  load_netint = {SACN_BPF_LD_W_ABS, 0, 0, SACN_BPF_AD_IFINDEX};
+  *insn++                  = load_netint;
+  for (size_t i = 0; i < num_netints; ++i)
+  {
+    SacnBpfInsn match = {SACN_BPF_JEQ_K, (uint8_t)(num_netints - i), 0, netints[i]};
+    *insn++           = match;
+  }
+  SacnBpfInsn reject = {SACN_BPF_RET_K, 0, 0, SACN_BPF_REJECT};
+  *insn++            = reject;
+
+  // Each path that finds the sACN port leaves the size of the IP header in X.
+  static const SacnBpfInsn kPortAndVector[21] = {
+      // IP version
+      {SACN_BPF_LD_B_ABS, 0, 0, 0},
+      {SACN_BPF_AND_K, 0, 0, 0xf0},
+      {SACN_BPF_JEQ_K, 0, 7, 0x40},
+      // IPv4: UDP, not a later fragment, then the destination port after the variable-length header
+      {SACN_BPF_LD_B_ABS, 0, 0, 9},
+      {SACN_BPF_JEQ_K, 0, 11, 17},
+      {SACN_BPF_LD_H_ABS, 0, 0, 6},
+      {SACN_BPF_JSET_K, 9, 0, 0x1fff},
+      {SACN_BPF_LDX_B_MSH, 0, 0, 0},
+      {SACN_BPF_LD_H_IND, 0, 0, 2},
+      {SACN_BPF_JEQ_K, 7, 6, kSacnPort},
+      // IPv6: UDP as the next header, then the destination port after the 40-byte header
+      {SACN_BPF_JEQ_K, 0, 5, 0x60},
+      {SACN_BPF_LDX_IMM, 0, 0, 40},
+      {SACN_BPF_LD_B_ABS, 0, 0, 6},
+      {SACN_BPF_JEQ_K, 0, 2, 17},
+      {SACN_BPF_LD_H_ABS, 0, 0, 42},
+      {SACN_BPF_JEQ_K, 1, 0, kSacnPort},
+      {SACN_BPF_RET_K, 0, 0, SACN_BPF_REJECT},
+      // The sACN payload starts after the IP and UDP headers.
+      {SACN_BPF_LD_W_IND, 0, 0, SACN_BPF_UDP_HEADER_SIZE + SACN_ROOT_VECTOR_OFFSET},
+      {SACN_BPF_JEQ_K, 1, 0, ACN_VECTOR_ROOT_E131_DATA},
+      {SACN_BPF_RET_K, 0, 0, SACN_BPF_ACCEPT},
+      {SACN_BPF_LD_H_IND, 0, 0, SACN_BPF_UDP_HEADER_SIZE + SACN_UNIVERSE_OFFSET},
+  };
+  memcpy(insn, kPortAndVector, sizeof kPortAndVector);
+  insn += 21;
+
+  emit_universe_filter_tree(ranges, num_ranges, insn);
+  return num_insns;
+}
+
+#if SACN_USE_REUSEPORT_STEERING
+
+// Needs lock
+void add_to_reuseport_group(const ReceiveSocket* socket, sacn_thread_id_t thread_id)
+{
+  ReuseportGroup* group = (socket->ip_type == kEtcPalIpTypeV6) ? &ipv6_reuseport_group : &ipv4_reuseport_group;
+
+  // The kernel appends sockets to the group when they are bound.
+  if (group->num_sockets < (SACN_RECEIVER_MAX_THREADS * 2))
+  {
+    group->sockets[group->num_sockets] = socket->handle;
+    group->threads[group->num_sockets] = thread_id;
+    ++group->num_sockets;
+  }
+  else
+  {
+    SACN_LOG_WARNING("Too many bound sACN receive sockets to steer; steering will be inaccurate.");
+  }
+
+  update_reuseport_steering(group);
+}
+
+// Needs lock
+void remove_from_reuseport_group(const ReceiveSocket* socket)
+{
+  ReuseportGroup* group = (socket->ip_type == kEtcPalIpTypeV6) ? &ipv6_reuseport_group : &ipv4_reuseport_group;
+
+  // The kernel fills a closed socket's place in the group with the last socket in the group.
+  for (size_t i = 0; i < group->num_sockets; ++i)
+  {
+    if (group->sockets[i] == socket->handle)
+    {
+      group->sockets[i] = group->sockets[group->num_sockets - 1];
+      group->threads[i] = group->threads[group->num_sockets - 1];
+      --group->num_sockets;
+      break;
+    }
+  }
+
+  update_reuseport_steering(group);
+}
+
+// Needs lock
+void update_reuseport_steering(ReuseportGroup* group)
+{
+  if (group->num_sockets == 0)
+    return;  // The kernel discards the group, along with its program, when the last socket closes.
+
+  SacnBpfInsn insns[SACN_STEERING_FILTER_SIZE(SACN_RECEIVER_MAX_THREADS)];
+  size_t      num_insns = sacn_build_steering_filter(group->threads, group->num_sockets, sacn_mem_get_num_threads(),
+                                                     insns, SACN_STEERING_FILTER_SIZE(SACN_RECEIVER_MAX_THREADS));
+  if (num_insns == 0)
+    return;
+
+  struct sock_fprog prog;
+  prog.len    = (unsigned short)num_insns;
+  prog.filter = (struct sock_filter*)insns;
+
+  // The program belongs to the whole group, so it can be attached through any of its sockets.
+  if (setsockopt(group->sockets[0], SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof prog) != 0)
+  {
+    SACN_LOG_WARNING("Couldn't update the SO_REUSEPORT steering program for sACN receive sockets: '%s'",
+                     strerror(errno));
+  }
+}
+
+#endif  // SACN_USE_REUSEPORT_STEERING
+
+/*
+ * Read and process input data for a thread's sockets.
+ *
+ * Blocks up to SACN_RECEIVER_READ_TIMEOUT_MS waiting for data.
+ *
+ * [in,out] recv_thread_context Context representing the thread calling this function.
+ * [out] read_result Filled in with the data if the read was successful on a socket.
+ *
+ * Returns kEtcPalErrOk if the data has been received.
+ * Returns kEtcPalErrTimedOut if the function timed out or was woken up by sacn_wake_receive_thread() while waiting for
+ * data.
+ * Returns other error codes on error. In this case, calling code should sleep to prevent the
+ * execution thread from spinning constantly when, for example, there are no receivers listening.
+ */
+etcpal_error_t sacn_read(SacnRecvThreadContext* recv_thread_context, SacnReadResult* read_result)
+{
+#if SACN_RECEIVER_ENABLED
+  if (!SACN_ASSERT_VERIFY(recv_thread_context) || !SACN_ASSERT_VERIFY(read_result))
+    return kEtcPalErrSys;
+
+#if SACN_RECEIVER_USE_IO_URING
+  if (recv_thread_context->uring_initialized)
+    return read_uring(recv_thread_context, read_result);
+#endif
+#if SACN_RECEIVER_USE_PACKET_RING
+  if (recv_thread_context->packet_ring_initialized)
+    return read_packet_ring(recv_thread_context, read_result);
+#endif
+#if SACN_RECEIVER_USE_UDP_GRO
+  if (sacn_next_gro_segment(&recv_thread_context->gro_batch, read_result))
+    return kEtcPalErrOk;
+#endif
+
+  EtcPalPollEvent event   = {0};
+  etcpal_error_t poll_res = etcpal_poll_wait(&recv_thread_context->poll_context, &event, SACN_RECEIVER_READ_TIMEOUT_MS);
+  if ((poll_res == kEtcPalErrOk) && (event.socket == recv_thread_context->wakeup_socket))
+  {
+    // Woken up for queued socket operations, which the caller applies before reading again.
+    drain_thread_wakeup(event.socket);
+    return kEtcPalErrTimedOut;
+  }
+
+  if (poll_res == kEtcPalErrOk)
+  {
+    if (event.events & ETCPAL_POLL_ERR)
+    {
+      etcpal_poll_remove_socket(&recv_thread_context->poll_context, event.socket);
+      return event.err;
+    }
+
+    if (event.events & ETCPAL_POLL_IN)
+    {
+      int recv_res = read_socket(recv_thread_context, event.socket, read_result);
       if (recv_res < 0)
       {
         etcpal_poll_remove_socket(&recv_thread_context->poll_context, event.socket);
@@ -1243,6 +2187,260 @@ etcpal_error_t sacn_read(SacnRecvThreadContext* recv_thread_context, SacnReadRes
 #endif  // SACN_RECEIVER_ENABLED
 }
 
+#if SACN_RECEIVER_ENABLED || DOXYGEN
+
+/*
+ * Receives the next packet from a readable socket into the thread's receive buffer. Returns the number of bytes
+ * received, or an error code.
+ */
+int read_socket(SacnRecvThreadContext* recv_thread_context, etcpal_socket_t socket, SacnReadResult* read_result)
+{
+  uint8_t control_buf[SACN_RECV_CONTROL_SIZE] = {0};  // Ancillary data
+
+  EtcPalMsgHdr msg = {{0}};
+  msg.buf          = recv_thread_context->recv_buf;
+  msg.buflen       = SACN_RECEIVER_RECV_BUF_SIZE;
+  msg.control      = control_buf;
+  msg.controllen   = SACN_RECV_CONTROL_SIZE;
+
+  int recv_res = etcpal_recvmsg(socket, &msg, 0);
+  if (recv_res > 0)
+    recv_res = get_read_result(recv_thread_context, socket, &msg, recv_res, read_result);
+#if SACN_RECEIVER_USE_UDP_GRO
+  if (recv_res > 0)
+    sacn_start_gro_batch(&recv_thread_context->gro_batch, &msg, read_result);
+#endif
+
+  return recv_res;
+}
+
+/*
+ * Fills in the read result for a packet of recv_res bytes received into msg on the given socket. Returns recv_res, or
+ * an error code if the packet can't be used.
+ */
+int get_read_result(SacnRecvThreadContext* recv_thread_context,
+                    etcpal_socket_t        socket,
+                    EtcPalMsgHdr*          msg,
+                    int                    recv_res,
+                    SacnReadResult*        read_result)
+{
+  if (msg->flags & ETCPAL_MSG_TRUNC)
+    return kEtcPalErrProtocol;  // No sACN packets should be bigger than kSacnMtu.
+
+  read_result->from_addr             = msg->name;
+  read_result->data_len              = (size_t)recv_res;
+  read_result->data                  = (uint8_t*)msg->buf;
+  read_result->copied_to_all_threads = false;
+#if SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+  read_result->timestamp_ns = get_kernel_timestamp(msg);
+#elif SACN_RECEIVER_ENABLE_TIMESTAMPS
+  read_result->timestamp_ns = sacn_get_receive_time_ns();
+#else
+  read_result->timestamp_ns = 0;
+#endif
+
+  // Obtain the network interface the packet came in on using one of two configured methods. Without PKTINFO, the
+  // destination isn't known either, so copies of a multicast packet on other threads' sockets are left to the sequence
+  // check.
+#if SACN_RECEIVER_SOCKET_PER_NIC
+  if (sacn_receiver_lock())
+  {
+    int index = find_socket_ref_by_handle(recv_thread_context, socket);
+
+    if (index >= 0)
+    {
+      read_result->netint.ip_type = recv_thread_context->socket_refs[index].socket.ip_type;
+      read_result->netint.index   = recv_thread_context->socket_refs[index].socket.ifindex;
+    }
+    else
+    {
+      // Data from a socket we just removed (kEtcPalErrNoSockets will not log an error)
+      recv_res = kEtcPalErrNoSockets;
+    }
+
+    sacn_receiver_unlock();
+  }
+#else   // SACN_RECEIVER_SOCKET_PER_NIC
+  ETCPAL_UNUSED_ARG(recv_thread_context);
+  ETCPAL_UNUSED_ARG(socket);
+
+  if ((msg->flags & ETCPAL_MSG_CTRUNC) ||
+      !get_packet_info(msg, &read_result->netint, &read_result->copied_to_all_threads))
+    recv_res = kEtcPalErrSys;
+#endif  // SACN_RECEIVER_SOCKET_PER_NIC
+
+  return recv_res;
+}
+
+#if SACN_RECEIVER_USE_IO_URING
+/*
+ * The io_uring version of sacn_read(). The packet data is left in the ring's buffer, which the kernel gets back on the
+ * thread's next read.
+ */
+etcpal_error_t read_uring(SacnRecvThreadContext* recv_thread_context, SacnReadResult* read_result)
+{
+  SacnUringEvent event;
+  etcpal_error_t wait_res = sacn_uring_wait(&recv_thread_context->uring, &event, SACN_RECEIVER_READ_TIMEOUT_MS);
+  if (wait_res != kEtcPalErrOk)
+    return wait_res;
+
+  switch (event.type)
+  {
+    case kSacnUringWakeup:
+      // Woken up for queued socket operations, which the caller applies before reading again.
+      drain_thread_wakeup(event.socket);
+      return kEtcPalErrTimedOut;
+    case kSacnUringError:
+      return event.err;
+    case kSacnUringReadable:
+    {
+      int recv_res = read_socket(recv_thread_context, event.socket, read_result);
+      return (recv_res < 0) ? (etcpal_error_t)recv_res : kEtcPalErrOk;
+    }
+    case kSacnUringPacket:
+    default:
+    {
+      int recv_res = get_read_result(recv_thread_context, event.socket, &event.msg, (int)event.msg.buflen, read_result);
+      return (recv_res < 0) ? (etcpal_error_t)recv_res : kEtcPalErrOk;
+    }
+  }
+}
+#endif  // SACN_RECEIVER_USE_IO_URING
+
+#if SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+// Returns the time the kernel received a packet on the clock of sacn_get_receive_time_ns(), or the current time if the
+// kernel didn't timestamp it.
+uint64_t get_kernel_timestamp(const EtcPalMsgHdr* msg)
+{
+  struct msghdr hdr;
+  memset(&hdr, 0, sizeof hdr);
+  hdr.msg_control    = msg->control;
+  hdr.msg_controllen = msg->controllen;
+
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg))
+  {
+    if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_TIMESTAMPNS) &&
+        (cmsg->cmsg_len >= CMSG_LEN(sizeof(struct timespec))))
+    {
+      struct timespec time;
+      memcpy(&time, CMSG_DATA(cmsg), sizeof time);
+      return sacn_receive_time_from_realtime_ns(((uint64_t)time.tv_sec * 1000000000u) + (uint64_t)time.tv_nsec);
+    }
+  }
+
+  return sacn_get_receive_time_ns();
+}
+#endif  // SACN_RECEIVER_USE_KERNEL_TIMESTAMPS
+
+#if SACN_RECEIVER_USE_UDP_GRO
+// Returns the size of the datagrams the kernel coalesced into a read, or 0 if it holds a single datagram.
+size_t get_gro_segment_size(const EtcPalMsgHdr* msg)
+{
+  struct msghdr hdr;
+  memset(&hdr, 0, sizeof hdr);
+  hdr.msg_control    = msg->control;
+  hdr.msg_controllen = msg->controllen;
+
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg))
+  {
+    if ((cmsg->cmsg_level == SOL_UDP) && (cmsg->cmsg_type == UDP_GRO) && (cmsg->cmsg_len >= CMSG_LEN(sizeof(int))))
+    {
+      int segment_size = 0;
+      memcpy(&segment_size, CMSG_DATA(cmsg), sizeof segment_size);
+      return (segment_size > 0) ? (size_t)segment_size : 0;
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * Trims a read result down to the first datagram of a coalesced read, and saves the rest for the following calls to
+ * sacn_read(). Every datagram but the last is segment_size long. Does nothing if the kernel didn't coalesce the read,
+ * i.e. if msg has no UDP_GRO control message.
+ *
+ * [out] batch Filled in with the rest of the read. Must be empty.
+ * [in] msg The message header the read was made with, holding its control messages.
+ * [in,out] read_result The result of the read.
+ */
+void sacn_start_gro_batch(SacnGroBatch* batch, const EtcPalMsgHdr* msg, SacnReadResult* read_result)
+{
+  if (!SACN_ASSERT_VERIFY(batch) || !SACN_ASSERT_VERIFY(msg) || !SACN_ASSERT_VERIFY(read_result))
+    return;
+
+  size_t segment_size = get_gro_segment_size(msg);
+  if ((segment_size == 0) || (read_result->data_len <= segment_size))
+    return;
+
+  batch->next                  = read_result->data + segment_size;
+  batch->remaining             = read_result->data_len - segment_size;
+  batch->segment_size          = segment_size;
+  batch->from_addr             = read_result->from_addr;
+  batch->netint                = read_result->netint;
+  batch->timestamp_ns          = read_result->timestamp_ns;
+  batch->copied_to_all_threads = read_result->copied_to_all_threads;
+  read_result->data_len        = segment_size;
+}
+
+/*
+ * Hands out the next datagram of a coalesced read, if there are any left. The last one may be shorter than the rest.
+ *
+ * [in,out] batch The rest of the read.
+ * [out] read_result Filled in with the datagram.
+ * Returns true if a datagram was handed out, or false if the batch is empty.
+ */
+bool sacn_next_gro_segment(SacnGroBatch* batch, SacnReadResult* read_result)
+{
+  if (!SACN_ASSERT_VERIFY(batch) || !SACN_ASSERT_VERIFY(read_result) || (batch->remaining == 0))
+    return false;
+
+  size_t len = (batch->remaining < batch->segment_size) ? batch->remaining : batch->segment_size;
+
+  read_result->data                  = batch->next;
+  read_result->data_len              = len;
+  read_result->from_addr             = batch->from_addr;
+  read_result->netint                = batch->netint;
+  read_result->timestamp_ns          = batch->timestamp_ns;
+  read_result->copied_to_all_threads = batch->copied_to_all_threads;
+
+  batch->next += len;
+  batch->remaining -= len;
+  return true;
+}
+#endif  // SACN_RECEIVER_USE_UDP_GRO
+
+#if SACN_RECEIVER_USE_PACKET_RING
+/*
+ * The packet ring version of sacn_read(). The packet data is left in the ring, which the kernel gets back once the
+ * thread has moved past it.
+ */
+etcpal_error_t read_packet_ring(SacnRecvThreadContext* recv_thread_context, SacnReadResult* read_result)
+{
+  if (sacn_packet_ring_next(&recv_thread_context->packet_ring, read_result))
+    return kEtcPalErrOk;
+
+  EtcPalPollEvent event   = {0};
+  etcpal_error_t poll_res = etcpal_poll_wait(&recv_thread_context->poll_context, &event, SACN_RECEIVER_READ_TIMEOUT_MS);
+  if (poll_res != kEtcPalErrOk)
+    return poll_res;
+
+  if (event.socket == recv_thread_context->wakeup_socket)
+  {
+    // Woken up for queued socket operations, which the caller applies before reading again.
+    drain_thread_wakeup(event.socket);
+    return kEtcPalErrTimedOut;
+  }
+
+  if (event.events & ETCPAL_POLL_ERR)
+    return event.err;
+
+  return sacn_packet_ring_next(&recv_thread_context->packet_ring, read_result) ? kEtcPalErrOk : kEtcPalErrTimedOut;
+}
+
+#endif  // SACN_RECEIVER_USE_PACKET_RING
+
+#endif  // SACN_RECEIVER_ENABLED || DOXYGEN
+
 etcpal_error_t sacn_send_multicast(uint16_t                   universe_id,
                                    sacn_ip_support_t          ip_supported,
                                    const uint8_t*             send_buf,
@@ -1401,7 +2599,7 @@ etcpal_error_t sockets_init(const SacnNetintConfig* netint_config, sacn_networki
 #if SACN_DYNAMIC_MEM
   if ((res == kEtcPalErrOk) && (net_type == kSource))
   {
-    multicast_send_sockets = calloc(netint_list.num_netints, sizeof(MulticastSendSocket));
+    multicast_send_sockets = SACN_CALLOC(netint_list.num_netints, sizeof(MulticastSendSocket));
     if (multicast_send_sockets)
     {
       for (size_t i = 0; i < netint_list.num_netints; ++i)
@@ -1415,7 +2613,7 @@ etcpal_error_t sockets_init(const SacnNetintConfig* netint_config, sacn_networki
 
   if (res == kEtcPalErrOk)
   {
-    sys_netints->sys_netints = calloc(netint_list.num_netints, sizeof(SacnMcastInterface));
+    sys_netints->sys_netints = SACN_CALLOC(netint_list.num_netints, sizeof(SacnMcastInterface));
     if (sys_netints->sys_netints)
       sys_netints->sys_netints_capacity = netint_list.num_netints;
     else
@@ -1518,7 +2716,7 @@ void clear_source_networking()
 
 #if SACN_DYNAMIC_MEM
   if (multicast_send_sockets)
-    free(multicast_send_sockets);
+    SACN_FREE(multicast_send_sockets);
 
   multicast_send_sockets = NULL;
 #endif
@@ -1763,7 +2961,7 @@ etcpal_error_t sacn_initialize_internal_netints(SacnInternalNetintArray*  intern
   }
   else
   {
-    internal_netints->netints = calloc(num_valid_app_netints, sizeof(EtcPalMcastNetintId));
+    internal_netints->netints = SACN_CALLOC(num_valid_app_netints, sizeof(EtcPalMcastNetintId));
 
     if (!internal_netints->netints)
       result = kEtcPalErrNoMem;
@@ -2009,9 +3207,10 @@ etcpal_error_t init_sys_netint_list(SysNetintList* netint_list)
     return kEtcPalErrSys;
 
 #if SACN_DYNAMIC_MEM
-  netint_list->netints = calloc(kSacnInitialCapacity, sizeof(EtcPalNetintInfo));
+  size_t capacity      = sacn_mem_reserved_capacity(sacn_mem_get_reservation()->netints);
+  netint_list->netints = SACN_CALLOC(capacity, sizeof(EtcPalNetintInfo));
   if (netint_list->netints)
-    netint_list->netints_capacity = kSacnInitialCapacity;
+    netint_list->netints_capacity = capacity;
   else
     return kEtcPalErrNoMem;
 #else
@@ -2027,7 +3226,7 @@ void deinit_sys_netint_list(SysNetintList* netint_list)
 
 #if SACN_DYNAMIC_MEM
   if (netint_list->netints)
-    free(netint_list->netints);
+    SACN_FREE(netint_list->netints);
 #endif
 }
 
@@ -130,10 +130,17 @@ etcpal_error_t sacn_source_create(const SacnSourceConfig* config, sacn_source_t*
       if (!config->manually_process_source)
         result = initialize_source_thread();
 
-      // Initialize the source's state.
+      // Initialize the source's state. This can move the other sources, which the tick threads' shards point to.
       SacnSource* source = NULL;
+      if ((result == kEtcPalErrOk) && !lock_all_source_shards())
+        result = kEtcPalErrSys;
+
       if (result == kEtcPalErrOk)
+      {
         result = add_sacn_source(get_next_source_handle(), config, &source);
+        refresh_tick_thread_shards();
+        unlock_all_source_shards();
+      }
 
       // Initialize the handle on success.
       if (result == kEtcPalErrOk)
@@ -310,12 +317,21 @@ etcpal_error_t sacn_source_add_universe(sacn_source_t                   handle,
 
         if (found)
         {
-          SacnSourceUniverse* existing_universe = &source->universes[index];
+          SacnSourceUniverse* existing_universe = SACN_SOURCE_UNIVERSE_AT(source, index);
 
-          if (existing_universe->termination_state == kTerminatingAndRemoving)
+          if (existing_universe->termination_state != kTerminatingAndRemoving)
+          {
+            result = kEtcPalErrExists;
+          }
+          else if (lock_all_source_shards())
+          {
             finish_source_universe_termination(source, index);  // Remove the old state before adding the new.
+            unlock_all_source_shards();
+          }
           else
-            result = kEtcPalErrExists;
+          {
+            result = kEtcPalErrSys;
+          }
         }
       }
 
@@ -328,6 +344,21 @@ etcpal_error_t sacn_source_add_universe(sacn_source_t                   handle,
       for (size_t i = 0; (result == kEtcPalErrOk) && (i < new_universe->netints.num_netints); ++i)
         result = add_sacn_source_netint(source, &new_universe->netints.netints[i]);
 
+      // Give the universe to one of the tick threads. If its shard has no room, the universe is removed again.
+      if ((result == kEtcPalErrOk) && !source->process_manually)
+      {
+        result = assign_universe_to_tick_thread(source, new_universe);
+        if (result != kEtcPalErrOk)
+        {
+          set_universe_terminating(new_universe, kTerminateAndRemove);
+
+          bool   found = false;
+          size_t index = get_source_universe_index(source, config->universe, &found);
+          if (found)
+            finish_source_universe_termination(source, index);
+        }
+      }
+
       sacn_source_unlock();
     }
     else
@@ -435,6 +466,15 @@ etcpal_error_t sacn_source_add_unicast_destination(sacn_source_t handle, uint16_
       if ((result == kEtcPalErrOk) && (universe_state->termination_state == kTerminatingAndRemoving))
         result = kEtcPalErrNotFound;
 
+      // The universe's tick thread reads its unicast destinations under the shard lock.
+      bool shard_locked = false;
+      if (result == kEtcPalErrOk)
+      {
+        shard_locked = lock_source_universe_shard(universe_state);
+        if (!shard_locked)
+          result = kEtcPalErrSys;
+      }
+
       // Handle the existing unicast destination if there is one.
       if (result == kEtcPalErrOk)
       {
@@ -461,6 +501,9 @@ etcpal_error_t sacn_source_add_unicast_destination(sacn_source_t handle, uint16_
       if (result == kEtcPalErrOk)
         reset_transmission_suppression(source_state, universe_state, kResetLevelAndPap);
 
+      if (shard_locked)
+        unlock_source_universe_shard(universe_state);
+
       sacn_source_unlock();
     }
     else
@@ -493,7 +536,8 @@ void sacn_source_remove_unicast_destination(sacn_source_t handle, uint16_t unive
     SacnSourceUniverse* universe_state = NULL;
     lookup_source_and_universe(handle, universe, &source_state, &universe_state);
 
-    if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving))
+    if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving) &&
+        lock_source_universe_shard(universe_state))
     {
       SacnUnicastDestination* unicast_dest = NULL;
       lookup_unicast_dest(universe_state, dest, &unicast_dest);
@@ -501,6 +545,8 @@ void sacn_source_remove_unicast_destination(sacn_source_t handle, uint16_t unive
       // Initiate termination
       if (unicast_dest && (unicast_dest->termination_state != kTerminatingAndRemoving))
         set_unicast_dest_terminating(unicast_dest, kTerminateAndRemove);
+
+      unlock_source_universe_shard(universe_state);
     }
 
     sacn_source_unlock();
@@ -532,8 +578,12 @@ size_t sacn_source_get_unicast_destinations(sacn_source_t handle,
     SacnSourceUniverse* universe_state = NULL;
     if (lookup_source_and_universe(handle, universe, &source_state, &universe_state) == kEtcPalErrOk)
     {
-      if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving))
+      if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving) &&
+          lock_source_universe_shard(universe_state))
+      {
         total_num_dests = get_source_unicast_dests(universe_state, destinations, destinations_size);
+        unlock_source_universe_shard(universe_state);
+      }
     }
 
     sacn_source_unlock();
@@ -750,6 +800,10 @@ etcpal_error_t sacn_source_send_now(sacn_source_t  handle,
           result = kEtcPalErrNotFound;
       }
 
+      // The send and sequence number state is shared with the universe's tick thread.
+      if ((result == kEtcPalErrOk) && !lock_source_universe_shard(universe_state))
+        result = kEtcPalErrSys;
+
       if (result == kEtcPalErrOk)
       {
         // Initialize send buffer
@@ -768,6 +822,8 @@ etcpal_error_t sacn_source_send_now(sacn_source_t  handle,
           result = universe_state->last_send_error;
 
         increment_sequence_number(universe_state);
+
+        unlock_source_universe_shard(universe_state);
       }
 
       sacn_source_unlock();
@@ -1001,6 +1057,211 @@ void sacn_source_update_levels_and_pap_and_force_sync(sacn_source_t  handle,
   }
 }
 
+/**
+ * @brief Copies new DMX levels, and optionally per-address priorities, into the packets of many universes at once.
+ *
+ * Each update has the same effect as calling sacn_source_update_levels() (if it has no priorities) or
+ * sacn_source_update_levels_and_pap() for that universe, but all of them are applied under a single acquisition of the
+ * source API's lock. This is much cheaper than updating each universe separately when there are many universes,
+ * especially if the updates are sorted by universe ID, which lets them be matched up with the source's universes in a
+ * single pass.
+ *
+ * Updates for universes that aren't on this source, or with sizes larger than #kSacnDmxAddressCount, are skipped.
+ *
+ * @param[in] handle Handle to the source to update.
+ * @param[in] updates The updates to apply, ideally in ascending order of universe ID.
+ * @param[in] num_updates The size of updates.
+ */
+void sacn_source_update_universes(sacn_source_t handle, const SacnSourceUniverseUpdate* updates, size_t num_updates)
+{
+  if (updates && (num_updates > 0) && sacn_source_lock())
+  {
+    SacnSource* source_state = NULL;
+    lookup_source(handle, &source_state);
+
+    size_t cursor = source_state ? source_state->num_universes : 0;
+    for (size_t i = 0; source_state && (i < num_updates); ++i)
+    {
+      const SacnSourceUniverseUpdate* update = &updates[i];
+      if ((update->levels_size > kSacnDmxAddressCount) || (update->priorities_size > kSacnDmxAddressCount))
+        continue;
+
+      SacnSourceUniverse* universe_state = NULL;
+      lookup_next_universe(source_state, update->universe, &cursor, &universe_state);
+
+      if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving))
+      {
+        if (!update->levels)
+        {
+          set_universe_terminating(universe_state, kTerminateWithoutRemoving);
+          disable_pap_data(universe_state);
+        }
+
+        // Do this last.
+        update_levels_and_or_pap(source_state, universe_state, update->levels, update->levels_size,
+                                 update->levels ? update->priorities : NULL, update->priorities_size,
+                                 kDisableForceSync);
+      }
+    }
+
+    sacn_source_unlock();
+  }
+}
+
+/**
+ * @brief Gets a handle to a universe of a source, for updating the universe with sacn_source_update_universe().
+ *
+ * The handle remains valid until the universe is removed (including by sacn_source_destroy()). Once that happens, it
+ * will never refer to another universe, even if the same universe is added again.
+ *
+ * @param[in] handle Handle to the source that owns the universe.
+ * @param[in] universe Universe ID to get a handle to.
+ * @return The universe's handle, or #kSacnSourceUniverseInvalid if the universe wasn't found on this source.
+ */
+sacn_source_universe_t sacn_source_get_universe_handle(sacn_source_t handle, uint16_t universe)
+{
+  sacn_source_universe_t universe_handle = kSacnSourceUniverseInvalid;
+
+  if (sacn_source_lock())
+  {
+    SacnSource*         source_state   = NULL;
+    SacnSourceUniverse* universe_state = NULL;
+    lookup_source_and_universe(handle, universe, &source_state, &universe_state);
+
+    if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving))
+      universe_handle = universe_state->handle;
+
+    sacn_source_unlock();
+  }
+
+  return universe_handle;
+}
+
+/**
+ * @brief Copies new DMX levels, and optionally per-address priorities, into a universe's packets by its handle.
+ *
+ * This has the same effect as one entry passed to sacn_source_update_universes(), but finds the universe directly
+ * from the handle returned by sacn_source_get_universe_handle() instead of looking up its universe ID.
+ *
+ * @param[in] handle Handle to the source that owns the universe.
+ * @param[in] universe_handle Handle to the universe to update. Handles to universes that have since been removed are
+ * ignored.
+ * @param[in] new_levels A buffer of DMX levels to copy from. If NULL, the source will terminate DMX transmission on
+ * this universe without removing it.
+ * @param[in] new_levels_size Size of new_levels. This must be no larger than #kSacnDmxAddressCount.
+ * @param[in] new_priorities A buffer of per-address priorities to copy from, or NULL to leave the universe's
+ * per-address priorities as they are.
+ * @param[in] new_priorities_size Size of new_priorities. This must be no larger than #kSacnDmxAddressCount.
+ */
+void sacn_source_update_universe(sacn_source_t          handle,
+                                 sacn_source_universe_t universe_handle,
+                                 const uint8_t*         new_levels,
+                                 size_t                 new_levels_size,
+                                 const uint8_t*         new_priorities,
+                                 size_t                 new_priorities_size)
+{
+  if ((universe_handle != kSacnSourceUniverseInvalid) && (new_levels_size <= kSacnDmxAddressCount) &&
+      (new_priorities_size <= kSacnDmxAddressCount) && sacn_source_lock())
+  {
+    SacnSource*         source_state   = NULL;
+    SacnSourceUniverse* universe_state = NULL;
+    if (lookup_source(handle, &source_state) == kEtcPalErrOk)
+      lookup_universe_by_handle(source_state, universe_handle, &universe_state);
+
+    if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving))
+    {
+      if (!new_levels)
+      {
+        set_universe_terminating(universe_state, kTerminateWithoutRemoving);
+        disable_pap_data(universe_state);
+      }
+
+      // Do this last.
+      update_levels_and_or_pap(source_state, universe_state, new_levels, new_levels_size,
+                               new_levels ? new_priorities : NULL, new_priorities_size, kDisableForceSync);
+    }
+
+    sacn_source_unlock();
+  }
+}
+
+/**
+ * @brief Gives the application the universe's outgoing DMX levels to write into in place.
+ *
+ * This avoids building the levels in a separate buffer first when the application can render them straight into the
+ * outgoing packet. The returned buffer holds #kSacnDmxAddressCount slots, and starts out holding the levels currently
+ * being sent (with any slots that have a PAP of 0 already zeroed). Once the new levels have been written, call
+ * sacn_source_commit_levels() to start sending them.
+ *
+ * The source API is not locked while the levels are written, so other source functions (and the source's tick
+ * threads) can run in the meantime. Until the levels are committed, this universe's levels are not sent, so keep the
+ * time in between short. Don't update the universe's levels any other way or remove the universe until they are
+ * committed. If this function returns NULL, sacn_source_commit_levels() must not be called.
+ *
+ * @param[in] handle Handle to the source to update.
+ * @param[in] universe Universe to update.
+ * @return A pointer to the universe's outgoing levels, or NULL if the source or universe were not found, or the levels
+ * are already being written in place.
+ */
+uint8_t* sacn_source_begin_levels(sacn_source_t handle, uint16_t universe)
+{
+  uint8_t* levels = NULL;
+
+  if (sacn_source_lock())
+  {
+    SacnSource*         source_state   = NULL;
+    SacnSourceUniverse* universe_state = NULL;
+    lookup_source_and_universe(handle, universe, &source_state, &universe_state);
+
+    // The universe's tick thread stops sending its levels until they are committed.
+    if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving) &&
+        !universe_state->levels_leased && lock_source_universe_shard(universe_state))
+    {
+      universe_state->levels_leased = true;
+      levels                        = &universe_state->level_send_buf[SACN_DATA_HEADER_SIZE];
+
+      unlock_source_universe_shard(universe_state);
+    }
+
+    sacn_source_unlock();
+  }
+
+  return levels;
+}
+
+/**
+ * @brief Finishes an update started with sacn_source_begin_levels().
+ *
+ * This has the same effect as calling sacn_source_update_levels() with the levels that were written in place: levels
+ * are zeroed wherever the PAP is 0, and the logic that slows down packet transmission due to inactivity is reset.
+ *
+ * This must only be called after sacn_source_begin_levels() returned a valid pointer for the same source and universe.
+ *
+ * @param[in] handle Handle to the source to update.
+ * @param[in] universe Universe to update.
+ * @param[in] new_levels_size The number of levels that were written. This must be no larger than #kSacnDmxAddressCount.
+ * If it's 0 or too large, the update is not applied.
+ */
+void sacn_source_commit_levels(sacn_source_t handle, uint16_t universe, size_t new_levels_size)
+{
+  if ((new_levels_size > 0) && (new_levels_size <= kSacnDmxAddressCount) && sacn_source_lock())
+  {
+    SacnSource*         source_state   = NULL;
+    SacnSourceUniverse* universe_state = NULL;
+    lookup_source_and_universe(handle, universe, &source_state, &universe_state);
+
+    // Updating the levels from the send buffer itself ends the lease.
+    if (universe_state && (universe_state->termination_state != kTerminatingAndRemoving) &&
+        universe_state->levels_leased)
+    {
+      update_levels_and_or_pap(source_state, universe_state, &universe_state->level_send_buf[SACN_DATA_HEADER_SIZE],
+                               new_levels_size, NULL, 0, kDisableForceSync);
+    }
+
+    sacn_source_unlock();
+  }
+}
+
 /**
  * @brief Trigger the transmission of sACN packets for all universes of sources that were created with
  * manually_process_source set to true.
@@ -1055,6 +1316,15 @@ etcpal_error_t sacn_source_reset_networking(const SacnNetintConfig* sys_netint_c
   if (!sacn_initialized(SACN_ALL_NETWORK_FEATURES))
     result = kEtcPalErrNotInit;
 
+  // Packets queued by a source tick use the sockets being reset, so wait for them to finish sending.
+  bool send_queues_locked = false;
+  if (result == kEtcPalErrOk)
+  {
+    send_queues_locked = lock_source_send_queues();
+    if (!send_queues_locked)
+      result = kEtcPalErrSys;
+  }
+
   if (result == kEtcPalErrOk)
   {
     if (sacn_source_lock())
@@ -1069,7 +1339,7 @@ etcpal_error_t sacn_source_reset_networking(const SacnNetintConfig* sys_netint_c
           clear_source_netints(source);
 
           for (size_t j = 0; (result == kEtcPalErrOk) && (j < source->num_universes); ++j)
-            result = reset_source_universe_networking(source, &source->universes[j], NULL);
+            result = reset_source_universe_networking(source, SACN_SOURCE_UNIVERSE_AT(source, j), NULL);
         }
         else
         {
@@ -1085,6 +1355,9 @@ etcpal_error_t sacn_source_reset_networking(const SacnNetintConfig* sys_netint_c
     }
   }
 
+  if (send_queues_locked)
+    unlock_source_send_queues();
+
   return result;
 }
 
@@ -1131,6 +1404,15 @@ etcpal_error_t sacn_source_reset_networking_per_universe(const SacnNetintConfig*
   if ((per_universe_netint_lists == NULL) || (num_per_universe_netint_lists == 0))
     result = kEtcPalErrInvalid;
 
+  // Packets queued by a source tick use the sockets being reset, so wait for them to finish sending.
+  bool send_queues_locked = false;
+  if (result == kEtcPalErrOk)
+  {
+    send_queues_locked = lock_source_send_queues();
+    if (!send_queues_locked)
+      result = kEtcPalErrSys;
+  }
+
   if (result == kEtcPalErrOk)
   {
     if (sacn_source_lock())
@@ -1145,13 +1427,14 @@ etcpal_error_t sacn_source_reset_networking_per_universe(const SacnNetintConfig*
           for (size_t j = 0; (result == kEtcPalErrOk) && (j < source->num_universes); ++j)
           {
             // Universes being removed should not be factored into this.
-            if (source->universes[j].termination_state != kTerminatingAndRemoving)
+            const SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_AT(source, j);
+            if (universe->termination_state != kTerminatingAndRemoving)
             {
               ++total_num_universes;
 
               bool found = false;
-              get_per_universe_netint_lists_index(source->handle, source->universes[j].universe_id,
-                                                  per_universe_netint_lists, num_per_universe_netint_lists, &found);
+              get_per_universe_netint_lists_index(source->handle, universe->universe_id, per_universe_netint_lists,
+                                                  num_per_universe_netint_lists, &found);
 
               if (!found)
                 result = kEtcPalErrInvalid;
@@ -1179,24 +1462,25 @@ etcpal_error_t sacn_source_reset_networking_per_universe(const SacnNetintConfig*
 
           for (size_t j = 0; (result == kEtcPalErrOk) && (j < source->num_universes); ++j)
           {
-            if (source->universes[j].termination_state == kTerminatingAndRemoving)
+            SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_AT(source, j);
+            if (universe->termination_state == kTerminatingAndRemoving)
             {
               // Keep the universe netints as they are, but add them to source netints again since it was cleared.
-              for (size_t k = 0; (result == kEtcPalErrOk) && (k < source->universes[j].netints.num_netints); ++k)
-                result = add_sacn_source_netint(source, &source->universes[j].netints.netints[k]);
+              for (size_t k = 0; (result == kEtcPalErrOk) && (k < universe->netints.num_netints); ++k)
+                result = add_sacn_source_netint(source, &universe->netints.netints[k]);
             }
             else
             {
               // Replace the universe netints, then add the new ones to the source netints.
               size_t list_index =
-                  get_per_universe_netint_lists_index(source->handle, source->universes[j].universe_id,
-                                                      per_universe_netint_lists, num_per_universe_netint_lists, NULL);
+                  get_per_universe_netint_lists_index(source->handle, universe->universe_id, per_universe_netint_lists,
+                                                      num_per_universe_netint_lists, NULL);
 
               SacnNetintConfig universe_netint_config = SACN_NETINT_CONFIG_DEFAULT_INIT;
               universe_netint_config.netints          = per_universe_netint_lists[list_index].netints;
               universe_netint_config.num_netints      = per_universe_netint_lists[list_index].num_netints;
               universe_netint_config.no_netints       = per_universe_netint_lists[list_index].no_netints;
-              result = reset_source_universe_networking(source, &source->universes[j], &universe_netint_config);
+              result = reset_source_universe_networking(source, universe, &universe_netint_config);
             }
           }
         }
@@ -1214,6 +1498,9 @@ etcpal_error_t sacn_source_reset_networking_per_universe(const SacnNetintConfig*
     }
   }
 
+  if (send_queues_locked)
+    unlock_source_send_queues();
+
   return result;
 }
 
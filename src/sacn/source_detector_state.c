@@ -23,6 +23,8 @@
 
 #include "sacn/private/source_detector_state.h"
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSourceDetector
+
 #if SACN_SOURCE_DETECTOR_ENABLED || DOXYGEN
 
 /**************************** Private variables ******************************/
@@ -102,7 +104,7 @@ void handle_sacn_universe_discovery_packet(SacnRecvThreadContext* context,
                                               &page.num_universes))
       {
 #if SACN_DYNAMIC_MEM
-        uint16_t* universes = page.num_universes ? calloc(page.num_universes, sizeof(uint16_t)) : NULL;
+        uint16_t* universes = page.num_universes ? SACN_CALLOC(page.num_universes, sizeof(uint16_t)) : NULL;
 #else
         uint16_t universes[SACN_MAX_UNIVERSES_PER_PAGE] = {0};
 #endif
@@ -113,7 +115,7 @@ void handle_sacn_universe_discovery_packet(SacnRecvThreadContext* context,
 
 #if SACN_DYNAMIC_MEM
         if (universes)
-          free(universes);
+          SACN_FREE(universes);
 #endif
       }
       else if (SACN_CAN_LOG(ETCPAL_LOG_WARNING))
@@ -341,7 +343,7 @@ void process_universe_discovery_page(SacnSourceDetector* source_detector, const
 
 #if SACN_DYNAMIC_MEM
             source_updated.sourced_universes =
-                source->num_universes ? calloc(source->num_universes, sizeof(uint16_t)) : NULL;
+                source->num_universes ? SACN_CALLOC(source->num_universes, sizeof(uint16_t)) : NULL;
 
             if (source_updated.sourced_universes)
 #endif
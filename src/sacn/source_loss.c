@@ -23,17 +23,20 @@
 #include "etcpal/mempool.h"
 #include "sacn/private/common.h"
 #include "sacn/private/mem.h"
+#include "sacn/private/mem/slab.h"
 #include "sacn/opts.h"
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSourceLoss
+
 #if SACN_RECEIVER_ENABLED || DOXYGEN
 
 /****************************** Private macros *******************************/
 
 #if SACN_DYNAMIC_MEM
-#define ALLOC_TERM_SET_SOURCE()   malloc(sizeof(TerminationSetSource))
-#define ALLOC_TERM_SET()          malloc(sizeof(TerminationSet))
-#define FREE_TERM_SET_SOURCE(ptr) free(ptr)
-#define FREE_TERM_SET(ptr)        free(ptr)
+#define ALLOC_TERM_SET_SOURCE()   sacn_slab_alloc(&term_set_source_slab)
+#define ALLOC_TERM_SET()          sacn_slab_alloc(&term_set_slab)
+#define FREE_TERM_SET_SOURCE(ptr) sacn_slab_free(&term_set_source_slab, ptr)
+#define FREE_TERM_SET(ptr)        sacn_slab_free(&term_set_slab, ptr)
 #else
 #define ALLOC_TERM_SET_SOURCE()   etcpal_mempool_alloc(sacn_pool_term_set_sources)
 #define ALLOC_TERM_SET()          etcpal_mempool_alloc(sacn_pool_term_sets)
@@ -43,7 +46,11 @@
 
 /**************************** Private variables ******************************/
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+static SacnSlab term_set_source_slab;
+static SacnSlab term_set_slab;
+static SacnSlab rb_node_slab;
+#else
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_term_set_sources, TerminationSetSource, SACN_MAX_TERM_SET_SOURCES);
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_term_sets, TerminationSet, SACN_MAX_TERM_SETS);
 ETCPAL_MEMPOOL_DEFINE(sacn_pool_source_loss_rb_nodes, EtcPalRbNode, SACN_SOURCE_LOSS_MAX_RB_NODES);
@@ -73,7 +80,20 @@ etcpal_error_t sacn_source_loss_init(void)
 {
   etcpal_error_t res = kEtcPalErrOk;
 
-#if !SACN_DYNAMIC_MEM
+#if SACN_DYNAMIC_MEM
+  sacn_slab_init(&term_set_source_slab, SACN_ALLOC_MODULE, sizeof(TerminationSetSource), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  sacn_slab_init(&term_set_slab, SACN_ALLOC_MODULE, sizeof(TerminationSet), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+  sacn_slab_init(&rb_node_slab, SACN_ALLOC_MODULE, sizeof(EtcPalRbNode), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+
+  const SacnReserveConfig* reserved = sacn_mem_get_reservation();
+  size_t reserved_sources           = reserved->receivers * reserved->sources_per_universe;
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&term_set_source_slab, reserved_sources);
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&term_set_slab, reserved->receivers);
+  if (res == kEtcPalErrOk)
+    res = sacn_slab_reserve(&rb_node_slab, reserved_sources);
+#else
   res |= etcpal_mempool_init(sacn_pool_term_set_sources);
   res |= etcpal_mempool_init(sacn_pool_term_sets);
   res |= etcpal_mempool_init(sacn_pool_source_loss_rb_nodes);
@@ -89,7 +109,32 @@ etcpal_error_t sacn_source_loss_init(void)
  */
 void sacn_source_loss_deinit(void)
 {
-  /* Nothing to do here. */
+  // Termination sets are cleared along with their receivers, so the slabs may release their chunks later.
+#if SACN_DYNAMIC_MEM
+  sacn_slab_deinit(&rb_node_slab);
+  sacn_slab_deinit(&term_set_slab);
+  sacn_slab_deinit(&term_set_source_slab);
+#endif
+}
+
+/*
+ * Add the source loss module's pool and rb-tree node use to its memory stats.
+ */
+// Needs lock
+void sacn_source_loss_add_mem_stats(SacnModuleMemoryStats* stats)
+{
+  if (!SACN_ASSERT_VERIFY(stats))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  ADD_POOL_STATS(stats, term_set_source_slab, TerminationSetSource);
+  ADD_POOL_STATS(stats, term_set_slab, TerminationSet);
+  ADD_RB_NODE_POOL_STATS(stats, rb_node_slab);
+#else
+  ADD_POOL_STATS(stats, sacn_pool_term_set_sources, TerminationSetSource);
+  ADD_POOL_STATS(stats, sacn_pool_term_sets, TerminationSet);
+  ADD_RB_NODE_POOL_STATS(stats, sacn_pool_source_loss_rb_nodes);
+#endif
 }
 
 /*
@@ -377,7 +422,7 @@ int term_set_source_compare(const EtcPalRbTree* tree, const void* value_a, const
 EtcPalRbNode* node_alloc(void)
 {
 #if SACN_DYNAMIC_MEM
-  return (EtcPalRbNode*)malloc(sizeof(EtcPalRbNode));
+  return (EtcPalRbNode*)sacn_slab_alloc(&rb_node_slab);
 #else
   return etcpal_mempool_alloc(sacn_pool_source_loss_rb_nodes);
 #endif
@@ -389,7 +434,7 @@ void node_dealloc(EtcPalRbNode* node)
     return;
 
 #if SACN_DYNAMIC_MEM
-  free(node);
+  sacn_slab_free(&rb_node_slab, node);
 #else
   etcpal_mempool_free(sacn_pool_source_loss_rb_nodes, node);
 #endif
@@ -19,6 +19,7 @@
 
 #include "sacn/private/common.h"
 
+#include <limits.h>
 #include "sacn/private/source_loss.h"
 #include "sacn/private/mem.h"
 #include "sacn/private/pdu.h"
@@ -31,6 +32,8 @@
 #include "etcpal/rbtree.h"
 #include "etcpal/timer.h"
 
+#define SACN_ALLOC_MODULE kSacnAllocModuleSource
+
 #if SACN_SOURCE_ENABLED || DOXYGEN
 
 // Suppress strncpy() warning on Windows/MSVC.
@@ -43,38 +46,154 @@
 #define SOURCE_THREAD_INTERVAL                  23
 #define NUM_PRE_SUPPRESSION_PACKETS             4
 #define IS_PART_OF_UNIVERSE_DISCOVERY(universe) (universe->has_level_data && !universe->send_unicast_only)
+#define SEND_QUEUE_MAX_DESTS \
+  (SACN_SOURCE_SEND_QUEUE_SIZE * (SACN_MAX_NETINTS + SACN_MAX_UNICAST_DESTINATIONS_PER_UNIVERSE))
+#define SHARD_MAX_UNIVERSES (SACN_SOURCE_MAX_SOURCES * SACN_SOURCE_MAX_UNIVERSES_PER_SOURCE)
+
+/****************************** Private types ********************************/
+
+// One destination of a queued packet, along with the result of sending to it.
+typedef struct SourceSendDest
+{
+  bool                multicast;
+  EtcPalMcastNetintId netint;           // Multicast only
+  EtcPalIpAddr        addr;             // Unicast only
+  etcpal_error_t      last_send_error;  // Unicast only - copied from the unicast destination, and written back after
+  etcpal_error_t      result;
+} SourceSendDest;
+
+// A copy of a packet that was due this tick, to be sent once the tick's locks are released.
+typedef struct SourceSendPacket
+{
+  sacn_source_t          source_handle;
+  uint16_t               universe_id;      // kSacnDiscoveryUniverse for universe discovery pages
+  sacn_source_universe_t universe_handle;  // kSacnSourceUniverseInvalid for universe discovery pages
+  size_t                 shard_index;      // The universe's position in its tick thread's shard when queued
+  sacn_ip_support_t      ip_supported;
+  size_t                 first_dest;
+  size_t                 num_dests;
+  uint8_t                send_buf[kSacnUniverseDiscoveryPacketMtu];
+} SourceSendPacket;
+
+typedef struct SourceSendQueue
+{
+  etcpal_mutex_t lock;  // Held from queueing until the results are applied. Always taken before any other lock.
+
+  SACN_DECLARE_BUF(SourceSendPacket, packets, SACN_SOURCE_SEND_QUEUE_SIZE);
+  size_t num_packets;
+  SACN_DECLARE_BUF(SourceSendDest, dests, SEND_QUEUE_MAX_DESTS);
+  size_t num_dests;
+} SourceSendQueue;
+
+// A universe in a tick thread's shard. Adding or removing a source moves the sources after it (and with static memory,
+// their universes), so the shards are refreshed whenever that happens.
+typedef struct SourceShardUniverse
+{
+  SacnSource*         source;
+  SacnSourceUniverse* universe;
+  bool                send_failed;  // Counted in the source's stats once the source lock is taken
+} SourceShardUniverse;
+
+// Each tick thread processes the universes in its shard while holding only the shard's lock, so the shards are sent in
+// parallel and an API call only waits on the shard of the universe it changes. A universe's state is written under the
+// source lock and then its shard's lock, and the tick thread reads and writes it under the shard's lock alone.
+// Universes that aren't in a shard (those of manual sources) are covered by the source lock.
+typedef struct SourceTickThread
+{
+  etcpal_thread_t handle;
+  unsigned int    index;
+  etcpal_mutex_t  lock;  // The shard's lock. Always taken after the source lock.
+
+  SACN_DECLARE_BUF(SourceShardUniverse, universes, SHARD_MAX_UNIVERSES);
+  size_t num_universes;
+  bool   cleanup_needed;  // Universes finished terminating or failed to send, which the source lock is needed for
+
+  SourceSendQueue send_queue;
+} SourceTickThread;
 
 /**************************** Private variables ******************************/
 
 static IntHandleManager source_handle_mgr;
 static bool             shutting_down = false;
-static etcpal_thread_t  source_thread_handle;
+static SourceTickThread tick_threads[SACN_SOURCE_MAX_TICK_THREADS];
+static unsigned int     num_tick_thread_slots = 0;  // The number of tick threads configured at initialization.
+static unsigned int     num_tick_threads      = 0;  // The number of tick threads that were successfully started.
 static bool             thread_initialized = false;
+static SourceSendQueue  caller_send_queue;  // Used when sources are processed on the calling thread
+static bool             tick_state_initialized = false;  // Whether the send queues and shards are ready
 
 /*********************** Private function prototypes *************************/
 
 static bool source_handle_in_use(int handle_val, void* cookie);
 
-static etcpal_error_t start_tick_thread();
-static void           stop_tick_thread();
+static etcpal_error_t init_tick_thread(SourceTickThread* thread, unsigned int index, unsigned int num_shards);
+static void           deinit_tick_thread(SourceTickThread* thread);
+static etcpal_error_t start_tick_threads();
+static void           stop_tick_threads();
+static etcpal_error_t add_universe_to_shard(SourceTickThread* thread, SacnSource* source, SacnSourceUniverse* universe);
+static void           remove_universe_from_shard(SacnSourceUniverse* universe);
+static void           unassign_universe_from_tick_thread(SacnSourceUniverse* universe);
+static void           rebalance_tick_threads();
 
 static void sleep_until_time_elapsed(const EtcPalTimer* timer, uint32_t target_elapsed_ms);
 static void source_thread_function(void* arg);
 
-static int  process_sources(sacn_process_sources_behavior_t behavior, sacn_source_tick_mode_t tick_mode);
-static bool process_universe_discovery(SacnSource* source);
-static bool process_universes(SacnSource* source, sacn_source_tick_mode_t tick_mode);
+static etcpal_error_t    init_send_queue(SourceSendQueue* queue, unsigned int num_shards);
+static void              deinit_send_queue(SourceSendQueue* queue);
+static SourceSendQueue*  lock_send_queue(SourceSendQueue* queue);
+static void              unlock_send_queue(SourceSendQueue* queue);
+static SourceSendQueue*  reserve_send_queue(SourceSendQueue* queue, size_t num_packets, size_t num_dests);
+static SourceSendPacket* queue_packet(SourceSendQueue*          queue,
+                                      const SacnSource*         source,
+                                      const SacnSourceUniverse* universe,
+                                      const uint8_t*            send_buf);
+static void queue_multicast_dest(SourceSendQueue* queue, SourceSendPacket* packet, const EtcPalMcastNetintId* netint);
+static void queue_unicast_dest(SourceSendQueue* queue, SourceSendPacket* packet, const SacnUnicastDestination* dest);
+static bool queue_universe_multicast(SourceSendQueue*    queue,
+                                     const SacnSource*   source,
+                                     SacnSourceUniverse* universe,
+                                     const uint8_t*      send_buf);
+static bool queue_universe_unicast(SourceSendQueue*    queue,
+                                   const SacnSource*   source,
+                                   SacnSourceUniverse* universe,
+                                   const uint8_t*      send_buf);
+static void pack_queued_packet(SourceSendPacket* packet, const uint8_t* send_buf);
+static void send_queued_packets(SourceSendQueue* queue);
+static void finish_queued_packets(SourceSendQueue* queue);
+static void finish_shard_packets(SourceTickThread* thread, SourceSendQueue* queue);
+static SacnSourceUniverse* lookup_shard_universe(const SourceTickThread* thread, const SourceSendPacket* packet);
+static void                clean_up_shard(SourceTickThread* thread);
+
+static int  process_sources(sacn_process_sources_behavior_t behavior,
+                            sacn_source_tick_mode_t         tick_mode,
+                            bool                            on_tick_thread,
+                            SourceSendQueue*                queue);
+static bool process_universe_discovery(SacnSource* source, SourceSendQueue* queue);
+static bool process_universes(SacnSource* source, sacn_source_tick_mode_t tick_mode, SourceSendQueue* queue);
+static void process_shard(SourceTickThread* thread, sacn_source_tick_mode_t tick_mode, SourceSendQueue* queue);
+static bool process_universe(SacnSource*             source,
+                             SacnSourceUniverse*     universe,
+                             sacn_source_tick_mode_t tick_mode,
+                             SourceSendQueue*        queue);
 static void process_stats_log(SacnSource* source, bool all_sends_succeeded);
-static bool process_unicast_termination(SacnSource* source, SacnSourceUniverse* universe, bool* terminating);
-static bool process_multicast_termination(SacnSource* source, size_t index, bool unicast_terminating);
+static bool process_unicast_termination(SacnSource*         source,
+                                        SacnSourceUniverse* universe,
+                                        bool*               terminating,
+                                        SourceSendQueue*    queue);
+static bool process_multicast_termination(SacnSource*         source,
+                                          SacnSourceUniverse* universe,
+                                          bool                unicast_terminating,
+                                          SourceSendQueue*    queue);
 static bool transmit_levels_and_pap_when_needed(SacnSource*             source,
                                                 SacnSourceUniverse*     universe,
-                                                sacn_source_tick_mode_t tick_mode);
-static bool send_termination_multicast(const SacnSource* source, SacnSourceUniverse* universe);
+                                                sacn_source_tick_mode_t tick_mode,
+                                                SourceSendQueue*        queue);
+static bool send_termination_multicast(const SacnSource* source, SacnSourceUniverse* universe, SourceSendQueue* queue);
 static bool send_termination_unicast(const SacnSource*       source,
                                      SacnSourceUniverse*     universe,
-                                     SacnUnicastDestination* dest);
-static bool send_universe_discovery(SacnSource* source);
+                                     SacnUnicastDestination* dest,
+                                     SourceSendQueue*        queue);
+static bool send_universe_discovery(SacnSource* source, SourceSendQueue* queue);
 static int  pack_universe_discovery_page(SacnSource* source, size_t* total_universes_processed, uint8_t page_number);
 static void update_levels(SacnSource*                source_state,
                           SacnSourceUniverse*        universe_state,
@@ -100,10 +219,35 @@ static void handle_data_packet_sent(const uint8_t* send_buf, SacnSourceUniverse*
 
 etcpal_error_t sacn_source_state_init(void)
 {
-  shutting_down = false;
+  shutting_down         = false;
+  num_tick_threads      = 0;
+  num_tick_thread_slots = sacn_get_num_configured_threads(kSacnSourceTickThread);
   init_int_handle_manager(&source_handle_mgr, -1, source_handle_in_use, NULL);
 
-  return kEtcPalErrOk;
+  etcpal_error_t result = init_send_queue(&caller_send_queue, 1);
+  if (result == kEtcPalErrOk)
+  {
+    unsigned int num_tick_threads_initialized = 0;
+    while ((result == kEtcPalErrOk) && (num_tick_threads_initialized < num_tick_thread_slots))
+    {
+      result = init_tick_thread(&tick_threads[num_tick_threads_initialized], num_tick_threads_initialized,
+                                num_tick_thread_slots);
+      if (result == kEtcPalErrOk)
+        ++num_tick_threads_initialized;
+    }
+
+    if (result != kEtcPalErrOk)
+    {
+      for (unsigned int i = 0; i < num_tick_threads_initialized; ++i)
+        deinit_tick_thread(&tick_threads[i]);
+
+      deinit_send_queue(&caller_send_queue);
+    }
+  }
+
+  tick_state_initialized = (result == kEtcPalErrOk);
+
+  return result;
 }
 
 void sacn_source_state_deinit(void)
@@ -118,7 +262,17 @@ void sacn_source_state_deinit(void)
   }
 
   if (thread_initted)
-    stop_tick_thread();
+    stop_tick_threads();
+
+  // The tick threads have exited, so nothing else is using the send queues or shards.
+  if (tick_state_initialized)
+  {
+    tick_state_initialized = false;
+
+    deinit_send_queue(&caller_send_queue);
+    for (unsigned int i = 0; i < num_tick_thread_slots; ++i)
+      deinit_tick_thread(&tick_threads[i]);
+  }
 }
 
 bool source_handle_in_use(int handle_val, void* cookie)
@@ -129,29 +283,260 @@ bool source_handle_in_use(int handle_val, void* cookie)
   return (handle_val == kSacnSourceInvalid) || (lookup_source(handle_val, &tmp) == kEtcPalErrOk);
 }
 
+// The shard's share of the reservation is split evenly between the num_shards tick threads.
+etcpal_error_t init_tick_thread(SourceTickThread* thread, unsigned int index, unsigned int num_shards)
+{
+  if (!SACN_ASSERT_VERIFY(thread) || !SACN_ASSERT_VERIFY(num_shards > 0))
+    return kEtcPalErrSys;
+
+  thread->index          = index;
+  thread->num_universes  = 0;
+  thread->cleanup_needed = false;
+
+  if (!etcpal_mutex_create(&thread->lock))
+    return kEtcPalErrSys;
+
+#if SACN_DYNAMIC_MEM
+  const SacnReserveConfig* reserve   = sacn_mem_get_reservation();
+  size_t                   universes = reserve->sources * reserve->universes;
+  size_t                   capacity  = sacn_mem_reserved_capacity((universes + num_shards - 1) / num_shards);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  thread->universes          = SACN_CALLOC(capacity, sizeof(SourceShardUniverse));
+  thread->universes_capacity = thread->universes ? capacity : 0;
+  if (!thread->universes)
+  {
+    etcpal_mutex_destroy(&thread->lock);
+    return kEtcPalErrNoMem;
+  }
+#endif
+
+  etcpal_error_t result = init_send_queue(&thread->send_queue, num_shards);
+  if (result != kEtcPalErrOk)
+  {
+#if SACN_DYNAMIC_MEM
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    SACN_FREE(thread->universes);
+    thread->universes          = NULL;
+    thread->universes_capacity = 0;
+#endif
+    etcpal_mutex_destroy(&thread->lock);
+  }
+
+  return result;
+}
+
+void deinit_tick_thread(SourceTickThread* thread)
+{
+  if (!SACN_ASSERT_VERIFY(thread))
+    return;
+
+  deinit_send_queue(&thread->send_queue);
+
+#if SACN_DYNAMIC_MEM
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  SACN_FREE(thread->universes);
+  thread->universes          = NULL;
+  thread->universes_capacity = 0;
+#endif
+  thread->num_universes  = 0;
+  thread->cleanup_needed = false;
+
+  etcpal_mutex_destroy(&thread->lock);
+}
+
 // Needs lock
-etcpal_error_t start_tick_thread()
+etcpal_error_t start_tick_threads()
 {
-  shutting_down             = false;
-  EtcPalThreadParams params = {SACN_SOURCE_THREAD_PRIORITY, SACN_SOURCE_THREAD_STACK, SACN_SOURCE_THREAD_NAME, NULL};
+  shutting_down    = false;
+  num_tick_threads = 0;
+
+  EtcPalThreadParams params;
+  sacn_get_thread_params(kSacnSourceTickThread, &params);
+
+  etcpal_error_t result = kEtcPalErrOk;
+  for (unsigned int i = 0; (result == kEtcPalErrOk) && (i < num_tick_thread_slots); ++i)
+  {
+    result = etcpal_thread_create(&tick_threads[i].handle, &params, source_thread_function, &tick_threads[i]);
+    if (result == kEtcPalErrOk)
+      ++num_tick_threads;
+  }
 
-  return etcpal_thread_create(&source_thread_handle, &params, source_thread_function, NULL);
+  // If at least one thread started, the universes are simply divided between the threads that are running.
+  if ((result != kEtcPalErrOk) && (num_tick_threads > 0))
+  {
+    SACN_LOG_WARNING("Only %u of %u sACN source tick threads could be started: '%s'", num_tick_threads,
+                     num_tick_thread_slots, etcpal_strerror(result));
+    result = kEtcPalErrOk;
+  }
+
+  return result;
 }
 
 // Takes lock
-void stop_tick_thread()
+void stop_tick_threads()
 {
-  etcpal_thread_t thread_handle;
+  unsigned int num_threads_to_join = 0;
 
   if (sacn_source_lock())
   {
-    shutting_down = true;  // Trigger thread-based sources to terminate
-    thread_handle = source_thread_handle;
+    shutting_down       = true;  // Trigger thread-based sources to terminate
+    num_threads_to_join = num_tick_threads;
     sacn_source_unlock();
   }
 
   // Wait for thread-based sources to terminate (assuming application already cleaned up manual sources)
-  etcpal_thread_join(&thread_handle);
+  for (unsigned int i = 0; i < num_threads_to_join; ++i)
+    etcpal_thread_join(&tick_threads[i].handle);
+}
+
+// Needs lock, takes the lock of the shard the universe is added to
+etcpal_error_t assign_universe_to_tick_thread(SacnSource* source, SacnSourceUniverse* universe)
+{
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe) || !SACN_ASSERT_VERIFY(num_tick_threads > 0) ||
+      !SACN_ASSERT_VERIFY(tick_state_initialized))
+  {
+    return kEtcPalErrSys;
+  }
+
+  // Assign this universe to the thread with the fewest universes currently
+  unsigned int least_loaded = 0;
+  for (unsigned int i = 1; i < num_tick_threads; ++i)
+  {
+    if (tick_threads[i].num_universes < tick_threads[least_loaded].num_universes)
+      least_loaded = i;
+  }
+
+  SourceTickThread* thread = &tick_threads[least_loaded];
+  if (!etcpal_mutex_lock(&thread->lock))
+    return kEtcPalErrSys;
+
+  etcpal_error_t result = add_universe_to_shard(thread, source, universe);
+
+  etcpal_mutex_unlock(&thread->lock);
+
+  return result;
+}
+
+// Needs lock and the shard's lock
+etcpal_error_t add_universe_to_shard(SourceTickThread* thread, SacnSource* source, SacnSourceUniverse* universe)
+{
+  if (!SACN_ASSERT_VERIFY(thread) || !SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
+    return kEtcPalErrSys;
+
+  CHECK_ROOM_FOR_ONE_MORE(thread, universes, SourceShardUniverse, SHARD_MAX_UNIVERSES, kEtcPalErrNoMem);
+
+  SourceShardUniverse* entry = &thread->universes[thread->num_universes];
+  entry->source              = source;
+  entry->universe            = universe;
+  entry->send_failed         = false;
+
+  universe->tick_thread          = thread->index;
+  universe->shard_index          = thread->num_universes;
+  universe->tick_thread_assigned = true;
+  ++thread->num_universes;
+
+  return kEtcPalErrOk;
+}
+
+// Needs lock and the lock of the universe's shard
+void remove_universe_from_shard(SacnSourceUniverse* universe)
+{
+  if (!SACN_ASSERT_VERIFY(universe) || !universe->tick_thread_assigned)
+    return;
+
+  SourceTickThread* thread = &tick_threads[universe->tick_thread];
+  if (SACN_ASSERT_VERIFY(universe->tick_thread < num_tick_threads) &&
+      SACN_ASSERT_VERIFY(universe->shard_index < thread->num_universes) &&
+      SACN_ASSERT_VERIFY(thread->universes[universe->shard_index].universe == universe))
+  {
+    REMOVE_AT_INDEX(thread, SourceShardUniverse, universes, universe->shard_index);
+
+    for (size_t i = universe->shard_index; i < thread->num_universes; ++i)
+      thread->universes[i].universe->shard_index = i;
+  }
+
+  universe->tick_thread_assigned = false;
+}
+
+// Needs lock and every shard's lock
+void unassign_universe_from_tick_thread(SacnSourceUniverse* universe)
+{
+  if (!SACN_ASSERT_VERIFY(universe))
+    return;
+
+  if (universe->tick_thread_assigned)
+  {
+    remove_universe_from_shard(universe);
+
+    // Threads exit as their shards empty during shutdown, so only rebalance while running.
+    if (!shutting_down)
+      rebalance_tick_threads();
+  }
+}
+
+// Needs lock and every shard's lock
+void rebalance_tick_threads()
+{
+  unsigned int least_loaded = 0;
+  unsigned int most_loaded  = 0;
+  for (unsigned int i = 1; i < num_tick_threads; ++i)
+  {
+    if (tick_threads[i].num_universes < tick_threads[least_loaded].num_universes)
+      least_loaded = i;
+    if (tick_threads[i].num_universes > tick_threads[most_loaded].num_universes)
+      most_loaded = i;
+  }
+
+  if ((num_tick_threads == 0) ||
+      (tick_threads[most_loaded].num_universes <= (tick_threads[least_loaded].num_universes + 1)))
+  {
+    return;  // Already balanced
+  }
+
+  // Move the most recently added universe that isn't terminating from the busiest shard to the emptiest one. If there's
+  // no room for it there, it stays where it is.
+  SourceTickThread* from = &tick_threads[most_loaded];
+  for (size_t i = from->num_universes; i > 0; --i)
+  {
+    SourceShardUniverse entry = from->universes[i - 1];
+    if (entry.universe->termination_state == kNotTerminating)
+    {
+      remove_universe_from_shard(entry.universe);
+      if (add_universe_to_shard(&tick_threads[least_loaded], entry.source, entry.universe) == kEtcPalErrOk)
+        tick_threads[least_loaded].universes[entry.universe->shard_index].send_failed = entry.send_failed;
+      else
+        add_universe_to_shard(from, entry.source, entry.universe);
+
+      return;
+    }
+  }
+}
+
+// Needs lock and every shard's lock. Called after sources are added or removed, which can move the other sources (and
+// with static memory, their universes), to point the shards at where they are now.
+void refresh_tick_thread_shards(void)
+{
+  for (unsigned int i = 0; i < num_tick_threads; ++i)
+    tick_threads[i].num_universes = 0;
+
+  size_t num_sources = get_num_sources();
+  for (size_t i = 0; i < num_sources; ++i)
+  {
+    SacnSource* source = get_source(i);
+    for (size_t j = 0; SACN_ASSERT_VERIFY(source) && (j < source->num_universes); ++j)
+    {
+      SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_AT(source, j);
+      if (universe->tick_thread_assigned && SACN_ASSERT_VERIFY(universe->tick_thread < num_tick_threads))
+      {
+        // Each universe goes back to its old position, so the shards don't grow.
+        SourceShardUniverse* entry = &tick_threads[universe->tick_thread].universes[universe->shard_index];
+        entry->source              = source;
+        entry->universe            = universe;
+        ++tick_threads[universe->tick_thread].num_universes;
+      }
+    }
+  }
 }
 
 void sleep_until_time_elapsed(const EtcPalTimer* timer, uint32_t target_elapsed_ms)
@@ -167,30 +552,34 @@ void sleep_until_time_elapsed(const EtcPalTimer* timer, uint32_t target_elapsed_
 // Takes lock
 void source_thread_function(void* arg)
 {
-  ETCPAL_UNUSED_ARG(arg);
+  if (!SACN_ASSERT_VERIFY(arg))
+    return;
 
-  bool keep_running_thread      = true;
-  int  num_thread_based_sources = 0;
+  const SourceTickThread* thread = (const SourceTickThread*)arg;
+
+  sacn_apply_thread_config(kSacnSourceTickThread, thread->index);
+
+  bool keep_running_thread = true;
+  int  num_remaining       = 0;
 
   EtcPalTimer interval_timer;
   etcpal_timer_start(&interval_timer, SOURCE_THREAD_INTERVAL);
 
   // This thread will keep running as long as sACN is initialized (while keep_running_thread is true). On
-  // deinitialization, the thread keeps running until there are no more thread-based sources (while
-  // num_thread_based_sources > 0).
-  while (keep_running_thread || (num_thread_based_sources > 0))
+  // deinitialization, the first thread keeps running until there are no more thread-based sources, and each other
+  // thread keeps running until its shard has no more universes (while num_remaining > 0).
+  while (keep_running_thread || (num_remaining > 0))
   {
     // Space out sending of levels & PAP as follows:
     // |------------------------------- 23ms -------------------------------|
     // |--- Send Levels ---|              |--- Send PAP ---|
     //
     // This is to help reduce packet dropping when sending hundreds of universes.
-    take_lock_and_process_sources(kProcessThreadedSources, kSacnSourceTickModeProcessLevelsOnly);
+    take_lock_and_process_tick_thread(thread->index, kSacnSourceTickModeProcessLevelsOnly);
 
     sleep_until_time_elapsed(&interval_timer, SOURCE_THREAD_INTERVAL / 2);
 
-    num_thread_based_sources =
-        take_lock_and_process_sources(kProcessThreadedSources, kSacnSourceTickModeProcessPapOnly);
+    num_remaining = take_lock_and_process_tick_thread(thread->index, kSacnSourceTickModeProcessPapOnly);
 
     sleep_until_time_elapsed(&interval_timer, SOURCE_THREAD_INTERVAL);
     etcpal_timer_reset(&interval_timer);
@@ -206,15 +595,559 @@ void source_thread_function(void* arg)
 // Takes lock
 int take_lock_and_process_sources(sacn_process_sources_behavior_t behavior, sacn_source_tick_mode_t tick_mode)
 {
-  int num_sources_tracked = 0;
+  int num_sources = 0;
+
+  // Packets are queued under the source lock, but sent after it's released so that API calls aren't blocked by the
+  // network stack. The queue stays locked until the results are applied, which keeps networking from being reset while
+  // packets are in flight.
+  SourceSendQueue* queue = lock_send_queue(&caller_send_queue);
 
   if (sacn_source_lock())
   {
-    num_sources_tracked = process_sources(behavior, tick_mode);
+    num_sources = process_sources(behavior, tick_mode, false, queue);
     sacn_source_unlock();
   }
 
-  return num_sources_tracked;
+  send_queued_packets(queue);
+  finish_queued_packets(queue);
+  unlock_send_queue(queue);
+
+  return num_sources;
+}
+
+// Takes the thread's shard lock, and the source lock on the first thread or when there's cleanup to do
+int take_lock_and_process_tick_thread(unsigned int thread_index, sacn_source_tick_mode_t tick_mode)
+{
+  if (!SACN_ASSERT_VERIFY(thread_index < num_tick_thread_slots) || !tick_state_initialized)
+    return 0;
+
+  SourceTickThread* thread        = &tick_threads[thread_index];
+  int               num_remaining = 0;
+
+  // The queue stays locked until the results are applied, which keeps networking from being reset while packets are in
+  // flight.
+  SourceSendQueue* queue = lock_send_queue(&thread->send_queue);
+
+  // The first thread does the per-source work and reports the number of thread-based sources.
+  if ((thread_index == 0) && sacn_source_lock())
+  {
+    num_remaining = process_sources(kProcessThreadedSources, tick_mode, true, queue);
+    sacn_source_unlock();
+  }
+
+  // The shard is processed under its own lock, so the tick threads don't take turns on the source lock.
+  if (etcpal_mutex_lock(&thread->lock))
+  {
+    process_shard(thread, tick_mode, queue);
+
+    // The other threads report the size of their shard.
+    if (thread_index > 0)
+      num_remaining = (int)thread->num_universes;
+
+    etcpal_mutex_unlock(&thread->lock);
+  }
+
+  send_queued_packets(queue);
+  finish_shard_packets(thread, queue);
+  unlock_send_queue(queue);
+
+  return num_remaining;
+}
+
+// Takes send queue locks
+bool lock_source_send_queues(void)
+{
+  if (!tick_state_initialized)
+    return true;
+
+  if (!etcpal_mutex_lock(&caller_send_queue.lock))
+    return false;
+
+  for (unsigned int i = 0; i < num_tick_thread_slots; ++i)
+  {
+    if (!etcpal_mutex_lock(&tick_threads[i].send_queue.lock))
+    {
+      for (unsigned int j = 0; j < i; ++j)
+        etcpal_mutex_unlock(&tick_threads[i - 1 - j].send_queue.lock);
+
+      etcpal_mutex_unlock(&caller_send_queue.lock);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Releases send queue locks
+void unlock_source_send_queues(void)
+{
+  if (!tick_state_initialized)
+    return;
+
+  for (unsigned int i = 0; i < num_tick_thread_slots; ++i)
+    etcpal_mutex_unlock(&tick_threads[num_tick_thread_slots - 1 - i].send_queue.lock);
+
+  etcpal_mutex_unlock(&caller_send_queue.lock);
+}
+
+// The queue's share of the reservation is split evenly between the num_shards queues that process the same sources.
+etcpal_error_t init_send_queue(SourceSendQueue* queue, unsigned int num_shards)
+{
+  if (!SACN_ASSERT_VERIFY(queue) || !SACN_ASSERT_VERIFY(num_shards > 0))
+    return kEtcPalErrSys;
+
+  if (!etcpal_mutex_create(&queue->lock))
+    return kEtcPalErrSys;
+
+  queue->num_packets = 0;
+  queue->num_dests   = 0;
+
+#if SACN_DYNAMIC_MEM
+  // Make room for everything the reserved sources could queue in one tick, matching the room each universe and
+  // universe discovery page reserves when it's processed.
+  const SacnReserveConfig* reserve   = sacn_mem_get_reservation();
+  size_t                   universes = reserve->sources * reserve->universes;
+  size_t                   pages     = reserve->sources * (1 + (reserve->universes / SACN_MAX_UNIVERSES_PER_PAGE));
+  size_t packets = (universes * (reserve->unicast_dests + 2)) + pages;
+  size_t dests   = (universes * ((2 * reserve->netints) + (3 * reserve->unicast_dests))) + (pages * reserve->netints);
+  size_t packets_capacity = sacn_mem_reserved_capacity((packets + num_shards - 1) / num_shards);
+  size_t dests_capacity   = sacn_mem_reserved_capacity((dests + num_shards - 1) / num_shards);
+
+  // NOLINTBEGIN(cppcoreguidelines-no-malloc)
+  queue->packets          = SACN_CALLOC(packets_capacity, sizeof(SourceSendPacket));
+  queue->packets_capacity = queue->packets ? packets_capacity : 0;
+  queue->dests            = SACN_CALLOC(dests_capacity, sizeof(SourceSendDest));
+  queue->dests_capacity   = queue->dests ? dests_capacity : 0;
+
+  if (!queue->packets || !queue->dests)
+  {
+    SACN_FREE(queue->packets);
+    SACN_FREE(queue->dests);
+    etcpal_mutex_destroy(&queue->lock);
+    return kEtcPalErrNoMem;
+  }
+  // NOLINTEND(cppcoreguidelines-no-malloc)
+#endif
+
+  return kEtcPalErrOk;
+}
+
+void deinit_send_queue(SourceSendQueue* queue)
+{
+  if (!SACN_ASSERT_VERIFY(queue))
+    return;
+
+#if SACN_DYNAMIC_MEM
+  // NOLINTBEGIN(cppcoreguidelines-no-malloc)
+  SACN_FREE(queue->packets);
+  SACN_FREE(queue->dests);
+  // NOLINTEND(cppcoreguidelines-no-malloc)
+  queue->packets          = NULL;
+  queue->packets_capacity = 0;
+  queue->dests            = NULL;
+  queue->dests_capacity   = 0;
+#endif
+  queue->num_packets = 0;
+  queue->num_dests   = 0;
+
+  etcpal_mutex_destroy(&queue->lock);
+}
+
+// Takes send queue lock. Returns NULL if packets must be sent while holding the tick's locks instead.
+SourceSendQueue* lock_send_queue(SourceSendQueue* queue)
+{
+  if (!SACN_ASSERT_VERIFY(queue))
+    return NULL;
+
+  return (tick_state_initialized && etcpal_mutex_lock(&queue->lock)) ? queue : NULL;
+}
+
+// Releases send queue lock
+void unlock_send_queue(SourceSendQueue* queue)
+{
+  if (queue)
+    etcpal_mutex_unlock(&queue->lock);
+}
+
+// Needs lock, takes the lock of the universe's shard. Must be held to change the universe outside of its own tick.
+// Returns true if there's nothing to lock.
+bool lock_source_universe_shard(const SacnSourceUniverse* universe)
+{
+  if (!SACN_ASSERT_VERIFY(universe))
+    return false;
+
+  if (!tick_state_initialized || !universe->tick_thread_assigned)
+    return true;
+
+  return etcpal_mutex_lock(&tick_threads[universe->tick_thread].lock);
+}
+
+// Needs lock, releases the lock of the universe's shard
+void unlock_source_universe_shard(const SacnSourceUniverse* universe)
+{
+  if (!SACN_ASSERT_VERIFY(universe))
+    return;
+
+  if (tick_state_initialized && universe->tick_thread_assigned)
+    etcpal_mutex_unlock(&tick_threads[universe->tick_thread].lock);
+}
+
+// Needs lock, takes every shard's lock. Must be held to add or remove sources or universes that can be in a shard.
+// Returns false if they couldn't be taken.
+bool lock_all_source_shards(void)
+{
+  if (!tick_state_initialized)
+    return true;
+
+  for (unsigned int i = 0; i < num_tick_thread_slots; ++i)
+  {
+    if (!etcpal_mutex_lock(&tick_threads[i].lock))
+    {
+      for (unsigned int j = 0; j < i; ++j)
+        etcpal_mutex_unlock(&tick_threads[i - 1 - j].lock);
+
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Needs lock, releases every shard's lock
+void unlock_all_source_shards(void)
+{
+  if (!tick_state_initialized)
+    return;
+
+  for (unsigned int i = 0; i < num_tick_thread_slots; ++i)
+    etcpal_mutex_unlock(&tick_threads[num_tick_thread_slots - 1 - i].lock);
+}
+
+// Needs send queue lock. Returns NULL if the queue can't hold the given number of additional packets and destinations,
+// in which case they should be sent right away.
+SourceSendQueue* reserve_send_queue(SourceSendQueue* queue, size_t num_packets, size_t num_dests)
+{
+  if (!queue)
+    return NULL;
+
+  CHECK_CAPACITY(queue, queue->num_packets + num_packets, packets, SourceSendPacket, SACN_SOURCE_SEND_QUEUE_SIZE, NULL);
+  CHECK_CAPACITY(queue, queue->num_dests + num_dests, dests, SourceSendDest, SEND_QUEUE_MAX_DESTS, NULL);
+
+  return queue;
+}
+
+// Needs the universe's shard lock, or lock for universe discovery. Space must have been reserved with
+// reserve_send_queue(). The universe is NULL for universe discovery.
+SourceSendPacket* queue_packet(SourceSendQueue*          queue,
+                               const SacnSource*         source,
+                               const SacnSourceUniverse* universe,
+                               const uint8_t*            send_buf)
+{
+  if (!SACN_ASSERT_VERIFY(queue) || !SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(send_buf))
+    return NULL;
+
+  SourceSendPacket* packet = &queue->packets[queue->num_packets++];
+  packet->source_handle    = source->handle;
+  packet->universe_id      = universe ? universe->universe_id : kSacnDiscoveryUniverse;
+  packet->universe_handle  = universe ? universe->handle : kSacnSourceUniverseInvalid;
+  packet->shard_index      = (universe && universe->tick_thread_assigned) ? universe->shard_index : 0;
+  packet->ip_supported     = source->ip_supported;
+  packet->first_dest       = queue->num_dests;
+  packet->num_dests        = 0;
+
+  pack_queued_packet(packet, send_buf);
+
+  return packet;
+}
+
+// Needs the universe's shard lock, or lock for universe discovery
+void pack_queued_packet(SourceSendPacket* packet, const uint8_t* send_buf)
+{
+  if (!SACN_ASSERT_VERIFY(packet) || !SACN_ASSERT_VERIFY(send_buf))
+    return;
+
+  // Only copy as much of the buffer as is in use
+  size_t packet_length = (size_t)ACN_UDP_PREAMBLE_SIZE + (size_t)ACN_PDU_LENGTH((&send_buf[ACN_UDP_PREAMBLE_SIZE]));
+  if (SACN_ASSERT_VERIFY(packet_length <= sizeof(packet->send_buf)))
+    memcpy(packet->send_buf, send_buf, packet_length);
+}
+
+// Needs send queue lock. Must be called right after queue_packet() for the same packet.
+void queue_multicast_dest(SourceSendQueue* queue, SourceSendPacket* packet, const EtcPalMcastNetintId* netint)
+{
+  if (!SACN_ASSERT_VERIFY(queue) || !SACN_ASSERT_VERIFY(packet) || !SACN_ASSERT_VERIFY(netint))
+    return;
+
+  SourceSendDest* dest = &queue->dests[queue->num_dests++];
+  dest->multicast      = true;
+  dest->netint         = *netint;
+  dest->result         = kEtcPalErrOk;
+  ++packet->num_dests;
+}
+
+// Needs send queue lock. Must be called right after queue_packet() for the same packet.
+void queue_unicast_dest(SourceSendQueue* queue, SourceSendPacket* packet, const SacnUnicastDestination* dest)
+{
+  if (!SACN_ASSERT_VERIFY(queue) || !SACN_ASSERT_VERIFY(packet) || !SACN_ASSERT_VERIFY(dest))
+    return;
+
+  SourceSendDest* queued_dest  = &queue->dests[queue->num_dests++];
+  queued_dest->multicast       = false;
+  queued_dest->addr            = dest->dest_addr;
+  queued_dest->last_send_error = dest->last_send_error;
+  queued_dest->result          = kEtcPalErrOk;
+  ++packet->num_dests;
+}
+
+// Needs the universe's shard lock. Queued packets are considered sent - failures are recorded once the queue is
+// finished.
+bool queue_universe_multicast(SourceSendQueue*    queue,
+                              const SacnSource*   source,
+                              SacnSourceUniverse* universe,
+                              const uint8_t*      send_buf)
+{
+  if (!queue)
+    return send_universe_multicast(source, universe, send_buf);
+
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe) || !SACN_ASSERT_VERIFY(send_buf))
+    return false;
+
+  if (!universe->send_unicast_only && (universe->netints.num_netints > 0))
+  {
+    SourceSendPacket* packet = queue_packet(queue, source, universe, send_buf);
+    for (size_t i = 0; packet && (i < universe->netints.num_netints); ++i)
+      queue_multicast_dest(queue, packet, &universe->netints.netints[i]);
+
+    handle_data_packet_sent(send_buf, universe);
+  }
+
+  return true;
+}
+
+// Needs the universe's shard lock. Queued packets are considered sent - failures are recorded once the queue is
+// finished.
+bool queue_universe_unicast(SourceSendQueue*    queue,
+                            const SacnSource*   source,
+                            SacnSourceUniverse* universe,
+                            const uint8_t*      send_buf)
+{
+  if (!queue)
+    return send_universe_unicast(source, universe, send_buf);
+
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe) || !SACN_ASSERT_VERIFY(send_buf))
+    return false;
+
+  SourceSendPacket* packet = NULL;
+  for (size_t i = 0; i < universe->num_unicast_dests; ++i)
+  {
+    if (universe->unicast_dests[i].termination_state == kNotTerminating)
+    {
+      if (!packet)
+        packet = queue_packet(queue, source, universe, send_buf);
+
+      queue_unicast_dest(queue, packet, &universe->unicast_dests[i]);
+    }
+  }
+
+  if (packet)
+    handle_data_packet_sent(send_buf, universe);
+
+  return true;
+}
+
+// Needs send queue lock, must NOT hold the source lock or any shard's lock
+void send_queued_packets(SourceSendQueue* queue)
+{
+  if (!queue)
+    return;
+
+  for (size_t i = 0; i < queue->num_packets; ++i)
+  {
+    const SourceSendPacket* packet = &queue->packets[i];
+    for (size_t j = packet->first_dest; j < (packet->first_dest + packet->num_dests); ++j)
+    {
+      SourceSendDest* dest = &queue->dests[j];
+      if (dest->multicast)
+      {
+        dest->result = sacn_send_multicast(packet->universe_id, packet->ip_supported, packet->send_buf, &dest->netint);
+      }
+      else
+      {
+        dest->result =
+            sacn_send_unicast(packet->ip_supported, packet->send_buf, &dest->addr, &dest->last_send_error);
+      }
+    }
+  }
+}
+
+// Needs send queue lock, takes lock and the shard lock of each universe that was sent
+void finish_queued_packets(SourceSendQueue* queue)
+{
+  if (!queue || (queue->num_packets == 0))
+    return;
+
+  if (sacn_source_lock())
+  {
+    for (size_t i = 0; i < queue->num_packets; ++i)
+    {
+      const SourceSendPacket* packet = &queue->packets[i];
+
+      // The source or universe may have been removed while the packets were being sent. The universe is found by its
+      // handle, so a universe that was removed and re-added with the same ID in the meantime isn't updated.
+      SacnSource*         source   = NULL;
+      SacnSourceUniverse* universe = NULL;
+      if ((lookup_source(packet->source_handle, &source) == kEtcPalErrOk) &&
+          (packet->universe_handle != kSacnSourceUniverseInvalid))
+      {
+        lookup_universe_by_handle(source, packet->universe_handle, &universe);
+      }
+
+      bool universe_locked = universe && lock_source_universe_shard(universe);
+
+      for (size_t j = packet->first_dest; source && (j < (packet->first_dest + packet->num_dests)); ++j)
+      {
+        const SourceSendDest* dest = &queue->dests[j];
+        if (dest->result != kEtcPalErrOk)
+        {
+          source->deferred_send_failed = true;
+          if (universe_locked)
+            universe->last_send_error = dest->result;
+        }
+
+        SacnUnicastDestination* unicast_dest = NULL;
+        if (universe_locked && !dest->multicast &&
+            (lookup_unicast_dest(universe, &dest->addr, &unicast_dest) == kEtcPalErrOk))
+        {
+          unicast_dest->last_send_error = dest->last_send_error;
+        }
+      }
+
+      if (universe_locked)
+        unlock_source_universe_shard(universe);
+    }
+
+    sacn_source_unlock();
+  }
+
+  queue->num_packets = 0;
+  queue->num_dests   = 0;
+}
+
+// Needs send queue lock, takes the shard's lock. Also takes lock, but only when sends failed or universes need to be
+// cleaned up.
+void finish_shard_packets(SourceTickThread* thread, SourceSendQueue* queue)
+{
+  if (!SACN_ASSERT_VERIFY(thread))
+    return;
+
+  bool any_send_failed = false;
+  if (queue && (queue->num_packets > 0) && etcpal_mutex_lock(&thread->lock))
+  {
+    for (size_t i = 0; i < queue->num_packets; ++i)
+    {
+      const SourceSendPacket* packet   = &queue->packets[i];
+      SacnSourceUniverse*     universe = lookup_shard_universe(thread, packet);
+
+      for (size_t j = packet->first_dest; j < (packet->first_dest + packet->num_dests); ++j)
+      {
+        const SourceSendDest* dest = &queue->dests[j];
+        if (dest->result != kEtcPalErrOk)
+        {
+          any_send_failed = true;
+          if (universe)
+            universe->last_send_error = dest->result;
+        }
+
+        SacnUnicastDestination* unicast_dest = NULL;
+        if (universe && !dest->multicast && (lookup_unicast_dest(universe, &dest->addr, &unicast_dest) == kEtcPalErrOk))
+          unicast_dest->last_send_error = dest->last_send_error;
+      }
+    }
+
+    etcpal_mutex_unlock(&thread->lock);
+  }
+
+  // Failed sends are counted in their sources' stats, and universes that finished terminating are removed. Both need
+  // the source lock, which a typical tick never takes.
+  if ((any_send_failed || thread->cleanup_needed) && sacn_source_lock())
+  {
+    for (size_t i = 0; any_send_failed && (i < queue->num_packets); ++i)
+    {
+      const SourceSendPacket* packet = &queue->packets[i];
+      for (size_t j = packet->first_dest; j < (packet->first_dest + packet->num_dests); ++j)
+      {
+        SacnSource* source = NULL;
+        if ((queue->dests[j].result != kEtcPalErrOk) && (lookup_source(packet->source_handle, &source) == kEtcPalErrOk))
+          source->deferred_send_failed = true;
+      }
+    }
+
+    if (thread->cleanup_needed && lock_all_source_shards())
+    {
+      clean_up_shard(thread);
+      unlock_all_source_shards();
+    }
+
+    sacn_source_unlock();
+  }
+
+  if (queue)
+  {
+    queue->num_packets = 0;
+    queue->num_dests   = 0;
+  }
+}
+
+// Needs the shard's lock. Returns the universe a packet was queued for if it's still in the same place in the shard,
+// or NULL (always for universe discovery).
+SacnSourceUniverse* lookup_shard_universe(const SourceTickThread* thread, const SourceSendPacket* packet)
+{
+  if (!SACN_ASSERT_VERIFY(thread) || !SACN_ASSERT_VERIFY(packet))
+    return NULL;
+
+  if ((packet->universe_handle == kSacnSourceUniverseInvalid) || (packet->shard_index >= thread->num_universes))
+    return NULL;
+
+  const SourceShardUniverse* entry = &thread->universes[packet->shard_index];
+  if ((entry->source->handle != packet->source_handle) || (entry->universe->handle != packet->universe_handle))
+    return NULL;
+
+  return entry->universe;
+}
+
+// Needs lock and every shard's lock
+void clean_up_shard(SourceTickThread* thread)
+{
+  if (!SACN_ASSERT_VERIFY(thread))
+    return;
+
+  thread->cleanup_needed = false;
+
+  // Iterate in reverse, since finishing a termination removes the universe from the shard. That can also rebalance the
+  // shard's last universe into another shard, so the index is checked on every iteration.
+  for (size_t i = thread->num_universes; i > 0; --i)
+  {
+    if ((i - 1) >= thread->num_universes)
+      continue;
+
+    SourceShardUniverse* entry    = &thread->universes[i - 1];
+    SacnSource*          source   = entry->source;
+    SacnSourceUniverse*  universe = entry->universe;
+
+    if (entry->send_failed)
+    {
+      source->deferred_send_failed = true;  // Picked up by the first thread's stats log
+      entry->send_failed           = false;
+    }
+
+    if (universe->termination_complete)
+    {
+      bool   found = false;
+      size_t index = get_source_universe_index(source, universe->universe_id, &found);
+      if (SACN_ASSERT_VERIFY(found))
+        finish_source_universe_termination(source, index);
+    }
+  }
 }
 
 // Needs lock
@@ -224,7 +1157,7 @@ etcpal_error_t initialize_source_thread()
 
   if (!thread_initialized)
   {
-    result = start_tick_thread();
+    result = start_tick_threads();
 
     if (result == kEtcPalErrOk)
       thread_initialized = true;
@@ -239,8 +1172,11 @@ sacn_source_t get_next_source_handle()
   return (sacn_source_t)get_next_int_handle(&source_handle_mgr);
 }
 
-// Needs lock
-int process_sources(sacn_process_sources_behavior_t behavior, sacn_source_tick_mode_t tick_mode)
+// Needs lock. On a tick thread, only the per-source work is done here - the universes are processed with their shards.
+int process_sources(sacn_process_sources_behavior_t behavior,
+                    sacn_source_tick_mode_t         tick_mode,
+                    bool                            on_tick_thread,
+                    SourceSendQueue*                queue)
 {
   int num_sources_tracked = 0;
 
@@ -254,20 +1190,27 @@ int process_sources(sacn_process_sources_behavior_t behavior, sacn_source_tick_m
       bool process_manual = (behavior == kProcessManualSources);
       if (source->process_manually == process_manual)
       {
+        // Count the sources of the kind being processed by this function
+        ++num_sources_tracked;
+
         // If the Source API is shutting down, cause this source to terminate (if thread-based)
         if (!process_manual && shutting_down)
           set_source_terminating(source);
 
-        // Count the sources of the kind being processed by this function
-        ++num_sources_tracked;
-
         // Universe processing
-        bool all_sends_succeeded = process_universe_discovery(source) && process_universes(source, tick_mode);
+        bool all_sends_succeeded = process_universe_discovery(source, queue);
+        if (!on_tick_thread)
+          all_sends_succeeded = process_universes(source, tick_mode, queue) && all_sends_succeeded;
+
         process_stats_log(source, all_sends_succeeded);
 
-        // Clean up this source if needed
-        if (source->terminating && (source->num_universes == 0))
+        // Clean up this source if needed. This moves the sources after it, so the shards are refreshed.
+        if (source->terminating && (source->num_universes == 0) && lock_all_source_shards())
+        {
           remove_sacn_source(initial_num_sources - 1 - i);
+          refresh_tick_thread_shards();
+          unlock_all_source_shards();
+        }
       }
     }
   }
@@ -276,7 +1219,7 @@ int process_sources(sacn_process_sources_behavior_t behavior, sacn_source_tick_m
 }
 
 // Needs lock
-bool process_universe_discovery(SacnSource* source)
+bool process_universe_discovery(SacnSource* source, SourceSendQueue* queue)
 {
   if (!SACN_ASSERT_VERIFY(source))
     return false;
@@ -285,15 +1228,15 @@ bool process_universe_discovery(SacnSource* source)
   bool all_sends_succeeded = true;
   if (!source->terminating && etcpal_timer_is_expired(&source->universe_discovery_timer))
   {
-    all_sends_succeeded = send_universe_discovery(source);
+    all_sends_succeeded = send_universe_discovery(source, queue);
     etcpal_timer_reset(&source->universe_discovery_timer);
   }
 
   return all_sends_succeeded;
 }
 
-// Needs lock
-bool process_universes(SacnSource* source, sacn_source_tick_mode_t tick_mode)
+// Needs lock, takes the shard lock of each universe
+bool process_universes(SacnSource* source, sacn_source_tick_mode_t tick_mode, SourceSendQueue* queue)
 {
   if (!SACN_ASSERT_VERIFY(source))
     return false;
@@ -303,27 +1246,82 @@ bool process_universes(SacnSource* source, sacn_source_tick_mode_t tick_mode)
   size_t initial_num_universes = source->num_universes;  // Actual may change, so keep initial for iteration.
   for (size_t i = 0; i < initial_num_universes; ++i)
   {
-    SacnSourceUniverse* universe = &source->universes[initial_num_universes - 1 - i];
+    size_t              index                = initial_num_universes - 1 - i;
+    SacnSourceUniverse* universe             = SACN_SOURCE_UNIVERSE_AT(source, index);
+    bool                termination_complete = false;
 
-    // Unicast destination-specific processing
-    bool unicast_terminating = false;
-    if (tick_mode != kSacnSourceTickModeProcessPapOnly)  // Only do termination if processing levels
-      all_sends_succeeded = process_unicast_termination(source, universe, &unicast_terminating);
-
-    // Either transmit start codes 0x00 and/or 0xDD, or terminate and clean up universe
-    if (universe->termination_state == kNotTerminating)
+    if (lock_source_universe_shard(universe))
     {
-      all_sends_succeeded = all_sends_succeeded && transmit_levels_and_pap_when_needed(source, universe, tick_mode);
+      if (!process_universe(source, universe, tick_mode, queue))
+        all_sends_succeeded = false;
+
+      termination_complete = universe->termination_complete;
+      unlock_source_universe_shard(universe);
     }
-    else if (tick_mode != kSacnSourceTickModeProcessPapOnly)  // Only do termination if processing levels
+
+    if (termination_complete && lock_all_source_shards())
     {
-      all_sends_succeeded = all_sends_succeeded &&
-                            process_multicast_termination(source, initial_num_universes - 1 - i, unicast_terminating);
+      finish_source_universe_termination(source, index);
+      unlock_all_source_shards();
     }
+  }
+
+  return all_sends_succeeded;
+}
 
-    increment_sequence_number(universe);
+// Needs the shard's lock
+void process_shard(SourceTickThread* thread, sacn_source_tick_mode_t tick_mode, SourceSendQueue* queue)
+{
+  if (!SACN_ASSERT_VERIFY(thread))
+    return;
+
+  for (size_t i = 0; i < thread->num_universes; ++i)
+  {
+    SourceShardUniverse* entry = &thread->universes[i];
+    if (!process_universe(entry->source, entry->universe, tick_mode, queue))
+      entry->send_failed = true;
+
+    if (entry->send_failed || entry->universe->termination_complete)
+      thread->cleanup_needed = true;
+  }
+}
+
+// Needs the universe's shard lock
+bool process_universe(SacnSource*             source,
+                      SacnSourceUniverse*     universe,
+                      sacn_source_tick_mode_t tick_mode,
+                      SourceSendQueue*        queue)
+{
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
+    return false;
+
+  // Make room to queue everything this universe could send this tick, or else send it right away.
+  size_t           max_packets    = universe->num_unicast_dests + 2;
+  size_t           max_dests      = (2 * universe->netints.num_netints) + (3 * universe->num_unicast_dests);
+  SourceSendQueue* universe_queue = reserve_send_queue(queue, max_packets, max_dests);
+
+  bool all_sends_succeeded = true;
+
+  // Unicast destination-specific processing
+  bool unicast_terminating = false;
+  if (tick_mode != kSacnSourceTickModeProcessPapOnly)  // Only do termination if processing levels
+    all_sends_succeeded = process_unicast_termination(source, universe, &unicast_terminating, universe_queue);
+
+  // Either transmit start codes 0x00 and/or 0xDD, or terminate and clean up universe
+  if (universe->termination_state == kNotTerminating)
+  {
+    all_sends_succeeded =
+        all_sends_succeeded && transmit_levels_and_pap_when_needed(source, universe, tick_mode, universe_queue);
+  }
+  else if (tick_mode != kSacnSourceTickModeProcessPapOnly)  // Only do termination if processing levels
+  {
+    all_sends_succeeded =
+        all_sends_succeeded && process_multicast_termination(source, universe, unicast_terminating, universe_queue);
   }
 
+  // The queued packets are copies, so the sequence number can advance for the next tick right away.
+  increment_sequence_number(universe);
+
   return all_sends_succeeded;
 }
 
@@ -334,9 +1332,11 @@ void process_stats_log(SacnSource* source, bool all_sends_succeeded)
     return;
 
   ++source->total_tick_count;
-  if (!all_sends_succeeded)
+  if (!all_sends_succeeded || source->deferred_send_failed)
     ++source->failed_tick_count;
 
+  source->deferred_send_failed = false;
+
   if (etcpal_timer_is_expired(&source->stats_log_timer))
   {
 #if SACN_LOGGING_ENABLED
@@ -360,8 +1360,11 @@ void process_stats_log(SacnSource* source, bool all_sends_succeeded)
   }
 }
 
-// Needs lock
-bool process_unicast_termination(SacnSource* source, SacnSourceUniverse* universe, bool* terminating)
+// Needs the universe's shard lock
+bool process_unicast_termination(SacnSource*         source,
+                                 SacnSourceUniverse* universe,
+                                 bool*               terminating,
+                                 SourceSendQueue*    queue)
 {
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe) || !SACN_ASSERT_VERIFY(terminating))
     return false;
@@ -379,7 +1382,7 @@ bool process_unicast_termination(SacnSource* source, SacnSourceUniverse* univers
     if (dest->termination_state != kNotTerminating)
     {
       if ((dest->num_terminations_sent < 3) && universe->has_level_data)
-        all_sends_succeeded = all_sends_succeeded && send_termination_unicast(source, universe, dest);
+        all_sends_succeeded = all_sends_succeeded && send_termination_unicast(source, universe, dest, queue);
 
       if ((dest->num_terminations_sent >= 3) || !universe->has_level_data)
         finish_unicast_dest_termination(universe, initial_num_unicast_dests - 1 - i);
@@ -391,29 +1394,32 @@ bool process_unicast_termination(SacnSource* source, SacnSourceUniverse* univers
   return all_sends_succeeded;
 }
 
-// Needs lock
-bool process_multicast_termination(SacnSource* source, size_t index, bool unicast_terminating)
+// Needs the universe's shard lock. A universe that has finished terminating is marked to be cleaned up under the source
+// lock.
+bool process_multicast_termination(SacnSource*         source,
+                                   SacnSourceUniverse* universe,
+                                   bool                unicast_terminating,
+                                   SourceSendQueue*    queue)
 {
-  if (!SACN_ASSERT_VERIFY(source))
+  if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
     return false;
 
   bool all_sends_succeeded = true;
 
-  SacnSourceUniverse* universe = &source->universes[index];
-
   if ((universe->num_terminations_sent < 3) && universe->has_level_data)
-    all_sends_succeeded = send_termination_multicast(source, universe);
+    all_sends_succeeded = send_termination_multicast(source, universe, queue);
 
   if (((universe->num_terminations_sent >= 3) && !unicast_terminating) || !universe->has_level_data)
-    finish_source_universe_termination(source, index);
+    universe->termination_complete = true;
 
   return all_sends_succeeded;
 }
 
-// Needs lock
+// Needs the universe's shard lock
 bool transmit_levels_and_pap_when_needed(SacnSource*             source,
                                          SacnSourceUniverse*     universe,
-                                         sacn_source_tick_mode_t tick_mode)
+                                         sacn_source_tick_mode_t tick_mode,
+                                         SourceSendQueue*        queue)
 {
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
     return false;
@@ -425,14 +1431,15 @@ bool transmit_levels_and_pap_when_needed(SacnSource*             source,
 
   bool all_sends_succeeded = true;
 
-  // If 0x00 data is ready to send
-  if (can_process_levels && universe->has_level_data &&
+  // If 0x00 data is ready to send. Levels the application is writing in place wait until they are committed.
+  if (can_process_levels && universe->has_level_data && !universe->levels_leased &&
       ((universe->level_packets_sent_before_suppression < NUM_PRE_SUPPRESSION_PACKETS) ||
        etcpal_timer_is_expired(&universe->level_keep_alive_timer)))
   {
     // Send 0x00 data & reset the keep-alive timer
-    all_sends_succeeded = send_universe_multicast(source, universe, universe->level_send_buf);
-    all_sends_succeeded = all_sends_succeeded && send_universe_unicast(source, universe, universe->level_send_buf);
+    all_sends_succeeded = queue_universe_multicast(queue, source, universe, universe->level_send_buf);
+    all_sends_succeeded =
+        all_sends_succeeded && queue_universe_unicast(queue, source, universe, universe->level_send_buf);
 
     if (universe->level_packets_sent_before_suppression < NUM_PRE_SUPPRESSION_PACKETS)
       ++universe->level_packets_sent_before_suppression;
@@ -453,8 +1460,10 @@ bool transmit_levels_and_pap_when_needed(SacnSource*             source,
       pack_sequence_number(universe->pap_send_buf, universe->next_seq_num + 1);
 
     // Send 0xDD data & reset the keep-alive timer
-    all_sends_succeeded = all_sends_succeeded && send_universe_multicast(source, universe, universe->pap_send_buf);
-    all_sends_succeeded = all_sends_succeeded && send_universe_unicast(source, universe, universe->pap_send_buf);
+    all_sends_succeeded =
+        all_sends_succeeded && queue_universe_multicast(queue, source, universe, universe->pap_send_buf);
+    all_sends_succeeded =
+        all_sends_succeeded && queue_universe_unicast(queue, source, universe, universe->pap_send_buf);
 
     if (universe->pap_packets_sent_before_suppression < NUM_PRE_SUPPRESSION_PACKETS)
       ++universe->pap_packets_sent_before_suppression;
@@ -475,7 +1484,7 @@ void pack_sequence_number(uint8_t* buf, uint8_t seq_num)
   buf[SACN_SEQ_OFFSET] = seq_num;
 }
 
-// Needs lock
+// Needs the universe's shard lock
 void increment_sequence_number(SacnSourceUniverse* universe)
 {
   if (!SACN_ASSERT_VERIFY(universe))
@@ -505,12 +1514,13 @@ void increment_sequence_number(SacnSourceUniverse* universe)
   // Pack defaults for the next tick (PAP's seq_num will end up being one higher if sent in the same tick as levels)
   pack_sequence_number(universe->level_send_buf, universe->next_seq_num);
 #if SACN_ETC_PRIORITY_EXTENSION
-  pack_sequence_number(universe->pap_send_buf, universe->next_seq_num);
+  if (SACN_SOURCE_UNIVERSE_HAS_PAP_BUF(universe))
+    pack_sequence_number(universe->pap_send_buf, universe->next_seq_num);
 #endif
 }
 
-// Needs lock
-bool send_termination_multicast(const SacnSource* source, SacnSourceUniverse* universe)
+// Needs the universe's shard lock
+bool send_termination_multicast(const SacnSource* source, SacnSourceUniverse* universe, SourceSendQueue* queue)
 {
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
     return false;
@@ -520,7 +1530,7 @@ bool send_termination_multicast(const SacnSource* source, SacnSourceUniverse* un
   SET_TERMINATED_OPT(universe->level_send_buf, true);
 
   // Send the termination packet on multicast only
-  bool all_sends_succeeded = send_universe_multicast(source, universe, universe->level_send_buf);
+  bool all_sends_succeeded = queue_universe_multicast(queue, source, universe, universe->level_send_buf);
 
   // Increment the termination counter
   ++universe->num_terminations_sent;
@@ -531,8 +1541,11 @@ bool send_termination_multicast(const SacnSource* source, SacnSourceUniverse* un
   return all_sends_succeeded;
 }
 
-// Needs lock
-bool send_termination_unicast(const SacnSource* source, SacnSourceUniverse* universe, SacnUnicastDestination* dest)
+// Needs the universe's shard lock
+bool send_termination_unicast(const SacnSource*       source,
+                              SacnSourceUniverse*     universe,
+                              SacnUnicastDestination* dest,
+                              SourceSendQueue*        queue)
 {
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe) || !SACN_ASSERT_VERIFY(dest))
     return false;
@@ -543,8 +1556,14 @@ bool send_termination_unicast(const SacnSource* source, SacnSourceUniverse* univ
 
   // Send the termination packet on unicast only
   bool res = true;
-  if (sacn_send_unicast(source->ip_supported, universe->level_send_buf, &dest->dest_addr, &dest->last_send_error) ==
-      kEtcPalErrOk)
+  if (queue)
+  {
+    SourceSendPacket* packet = queue_packet(queue, source, universe, universe->level_send_buf);
+    queue_unicast_dest(queue, packet, dest);
+    handle_data_packet_sent(universe->level_send_buf, universe);
+  }
+  else if (sacn_send_unicast(source->ip_supported, universe->level_send_buf, &dest->dest_addr,
+                             &dest->last_send_error) == kEtcPalErrOk)
   {
     handle_data_packet_sent(universe->level_send_buf, universe);
   }
@@ -562,7 +1581,7 @@ bool send_termination_unicast(const SacnSource* source, SacnSourceUniverse* univ
 }
 
 // Needs lock
-bool send_universe_discovery(SacnSource* source)
+bool send_universe_discovery(SacnSource* source, SourceSendQueue* queue)
 {
   if (!SACN_ASSERT_VERIFY(source))
     return false;
@@ -580,17 +1599,30 @@ bool send_universe_discovery(SacnSource* source)
     while (pack_universe_discovery_page(source, &total_universes_processed, page_number) > 0)
     {
       // Send multicast on IPv4 and/or IPv6
-      bool at_least_one_send_worked = false;
-      for (size_t i = 0; i < source->num_netints; ++i)
+      bool             at_least_one_send_worked = false;
+      SourceSendQueue* page_queue               = reserve_send_queue(queue, 1, source->num_netints);
+      if (page_queue)
       {
-        if (sacn_send_multicast(kSacnDiscoveryUniverse, source->ip_supported, source->universe_discovery_send_buf,
-                                &source->netints[i].id) == kEtcPalErrOk)
-        {
-          at_least_one_send_worked = true;
-        }
-        else
+        SourceSendPacket* packet =
+            queue_packet(page_queue, source, NULL, source->universe_discovery_send_buf);
+        for (size_t i = 0; packet && (i < source->num_netints); ++i)
+          queue_multicast_dest(page_queue, packet, &source->netints[i].id);
+
+        at_least_one_send_worked = true;  // Failures are recorded once the queue is finished
+      }
+      else
+      {
+        for (size_t i = 0; i < source->num_netints; ++i)
         {
-          all_sends_succeeded = false;
+          if (sacn_send_multicast(kSacnDiscoveryUniverse, source->ip_supported, source->universe_discovery_send_buf,
+                                  &source->netints[i].id) == kEtcPalErrOk)
+          {
+            at_least_one_send_worked = true;
+          }
+          else
+          {
+            all_sends_succeeded = false;
+          }
         }
       }
 
@@ -604,7 +1636,7 @@ bool send_universe_discovery(SacnSource* source)
   return all_sends_succeeded;
 }
 
-// Needs lock
+// Needs the universe's shard lock
 bool send_universe_multicast(const SacnSource* source, SacnSourceUniverse* universe, const uint8_t* send_buf)
 {
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe) || !SACN_ASSERT_VERIFY(send_buf))
@@ -636,7 +1668,7 @@ bool send_universe_multicast(const SacnSource* source, SacnSourceUniverse* unive
   return all_sends_succeeded;
 }
 
-// Needs lock
+// Needs the universe's shard lock
 bool send_universe_unicast(const SacnSource* source, SacnSourceUniverse* universe, const uint8_t* send_buf)
 {
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe) || !SACN_ASSERT_VERIFY(send_buf))
@@ -684,7 +1716,7 @@ int pack_universe_discovery_page(SacnSource* source, size_t* total_universes_pro
   {
     // Iterate universes array in reverse to pack universes lowest to highest
     size_t                    index    = (source->num_universes - 1) - (*total_universes_processed);
-    const SacnSourceUniverse* universe = &source->universes[index];
+    const SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_AT(source, index);
 
     // If this universe has level data at a bare minimum & is not unicast-only
     if (IS_PART_OF_UNIVERSE_DISCOVERY(universe))
@@ -717,7 +1749,7 @@ int pack_universe_discovery_page(SacnSource* source, size_t* total_universes_pro
   return num_universes_packed;
 }
 
-// Needs lock
+// Needs lock and the universe's shard lock
 void update_levels(SacnSource*                source_state,
                    SacnSourceUniverse*        universe_state,
                    const uint8_t*             new_levels,
@@ -734,6 +1766,10 @@ void update_levels(SacnSource*                source_state,
 
   cancel_termination_if_not_removing(universe_state);
 
+  // Levels written in place by the application are applied from the send buffer itself, which ends the lease.
+  if (new_levels == &universe_state->level_send_buf[SACN_DATA_HEADER_SIZE])
+    universe_state->levels_leased = false;
+
   update_send_buf_data(universe_state->level_send_buf, new_levels, (uint16_t)new_levels_size, force_sync);
   universe_state->has_level_data = true;
 #if SACN_ETC_PRIORITY_EXTENSION
@@ -748,7 +1784,7 @@ void update_levels(SacnSource*                source_state,
 }
 
 #if SACN_ETC_PRIORITY_EXTENSION
-// Needs lock
+// Needs lock and the universe's shard lock
 void update_pap(SacnSource*                source_state,
                 SacnSourceUniverse*        universe_state,
                 const uint8_t*             new_priorities,
@@ -761,12 +1797,15 @@ void update_pap(SacnSource*                source_state,
     return;
   }
 
+  if (!SACN_ASSERT_VERIFY(SACN_SOURCE_UNIVERSE_HAS_PAP_BUF(universe_state)))
+    return;
+
   update_send_buf_data(universe_state->pap_send_buf, new_priorities, (uint16_t)new_priorities_size, force_sync);
   universe_state->has_pap_data = true;
   reset_transmission_suppression(source_state, universe_state, kResetPap);
 }
 
-// Needs lock
+// Needs lock and the universe's shard lock
 void zero_levels_where_pap_is_zero(SacnSourceUniverse* universe_state)
 {
   if (!SACN_ASSERT_VERIFY(universe_state))
@@ -782,7 +1821,7 @@ void zero_levels_where_pap_is_zero(SacnSourceUniverse* universe_state)
 }
 #endif
 
-// Needs lock
+// Needs lock, takes the universe's shard lock
 void update_levels_and_or_pap(SacnSource*                source,
                               SacnSourceUniverse*        universe,
                               const uint8_t*             new_levels,
@@ -794,13 +1833,34 @@ void update_levels_and_or_pap(SacnSource*                source,
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
     return;
 
+  if (!lock_source_universe_shard(universe))
+    return;
+
 #if SACN_ETC_PRIORITY_EXTENSION
+  // The levels are zeroed wherever the PAP is 0, so they aren't applied without their PAP either.
+  if (new_priorities && (init_source_universe_pap(source, universe) != kEtcPalErrOk))
+  {
+#if SACN_DYNAMIC_MEM
+    if (!universe->pap_alloc_failure_logged)
+    {
+      SACN_LOG_ERR("Could not allocate memory for the PAP of universe %u - dropping its level and PAP updates.",
+                   universe->universe_id);
+      universe->pap_alloc_failure_logged = true;
+    }
+#endif
+
+    unlock_source_universe_shard(universe);
+    return;
+  }
+
   // Make sure PAP is updated before levels.
   if (new_priorities)
     update_pap(source, universe, new_priorities, new_priorities_size, force_sync);
 #endif
   if (new_levels)
     update_levels(source, universe, new_levels, new_levels_size, force_sync);
+
+  unlock_source_universe_shard(universe);
 }
 
 // Needs lock
@@ -817,19 +1877,25 @@ void set_source_terminating(SacnSource* source)
 
     // Set terminating for the removal of each universe of this source
     for (size_t i = 0; i < source->num_universes; ++i)
-      set_universe_terminating(&source->universes[i], kTerminateAndRemove);
+      set_universe_terminating(SACN_SOURCE_UNIVERSE_AT(source, i), kTerminateAndRemove);
   }
 }
 
-// Needs lock
+// Needs lock, takes the universe's shard lock
 void set_universe_terminating(SacnSourceUniverse* universe, sacn_set_terminating_behavior_t behavior)
 {
   if (!SACN_ASSERT_VERIFY(universe))
     return;
 
+  if (!lock_source_universe_shard(universe))
+    return;
+
   // Initialize the universe's termination state
   if (universe->termination_state == kNotTerminating)
+  {
     universe->num_terminations_sent = 0;
+    universe->termination_complete  = false;
+  }
 
   switch (behavior)
   {
@@ -845,9 +1911,11 @@ void set_universe_terminating(SacnSourceUniverse* universe, sacn_set_terminating
   // Set terminating for each unicast destination of this universe
   for (size_t i = 0; i < universe->num_unicast_dests; ++i)
     set_unicast_dest_terminating(&universe->unicast_dests[i], behavior);
+
+  unlock_source_universe_shard(universe);
 }
 
-// Needs lock
+// Needs the universe's shard lock
 void set_unicast_dest_terminating(SacnUnicastDestination* dest, sacn_set_terminating_behavior_t behavior)
 {
   if (!SACN_ASSERT_VERIFY(dest))
@@ -869,7 +1937,7 @@ void set_unicast_dest_terminating(SacnUnicastDestination* dest, sacn_set_termina
   }
 }
 
-// Needs lock
+// Needs lock and the universe's shard lock
 void reset_transmission_suppression(const SacnSource*                              source,
                                     SacnSourceUniverse*                            universe,
                                     sacn_reset_transmission_suppression_behavior_t behavior)
@@ -909,16 +1977,22 @@ void set_source_name(SacnSource* source, const char* new_name)
   // For each universe:
   for (size_t i = 0; i < source->num_universes; ++i)
   {
-    SacnSourceUniverse* universe = &source->universes[i];
+    SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_AT(source, i);
 
     // Update the source name in this universe's send buffers
-    strncpy((char*)(&universe->level_send_buf[SACN_SOURCE_NAME_OFFSET]), new_name, kSacnSourceNameMaxLen);
+    if (lock_source_universe_shard(universe))
+    {
+      strncpy((char*)(&universe->level_send_buf[SACN_SOURCE_NAME_OFFSET]), new_name, kSacnSourceNameMaxLen);
 #if SACN_ETC_PRIORITY_EXTENSION
-    strncpy((char*)(&universe->pap_send_buf[SACN_SOURCE_NAME_OFFSET]), new_name, kSacnSourceNameMaxLen);
+      if (SACN_SOURCE_UNIVERSE_HAS_PAP_BUF(universe))
+        strncpy((char*)(&universe->pap_send_buf[SACN_SOURCE_NAME_OFFSET]), new_name, kSacnSourceNameMaxLen);
 #endif
 
-    // Reset transmission suppression for start codes 0x00 and 0xDD
-    reset_transmission_suppression(source, universe, kResetLevelAndPap);
+      // Reset transmission suppression for start codes 0x00 and 0xDD
+      reset_transmission_suppression(source, universe, kResetLevelAndPap);
+
+      unlock_source_universe_shard(universe);
+    }
   }
 }
 
@@ -932,10 +2006,10 @@ size_t get_source_universes(const SacnSource* source, uint16_t* universes, size_
   size_t num_non_removed_universes = 0;
   for (int read = (int)source->num_universes - 1; read >= 0; --read)
   {
-    if (source->universes[read].termination_state != kTerminatingAndRemoving)
+    if (SACN_SOURCE_UNIVERSE_AT(source, read)->termination_state != kTerminatingAndRemoving)
     {
       if (universes && (num_non_removed_universes < universes_size))
-        universes[num_non_removed_universes] = source->universes[read].universe_id;
+        universes[num_non_removed_universes] = SACN_SOURCE_UNIVERSE_AT(source, read)->universe_id;
 
       ++num_non_removed_universes;
     }
@@ -944,7 +2018,7 @@ size_t get_source_universes(const SacnSource* source, uint16_t* universes, size_
   return num_non_removed_universes;
 }
 
-// Needs lock
+// Needs the universe's shard lock
 size_t get_source_unicast_dests(const SacnSourceUniverse* universe,
                                 EtcPalIpAddr*             destinations,
                                 size_t                    destinations_size)
@@ -981,14 +2055,18 @@ size_t get_source_universe_netints(const SacnSourceUniverse* universe,
   return universe->netints.num_netints;
 }
 
-// Needs lock
+// Needs lock, takes the universe's shard lock
 void disable_pap_data(SacnSourceUniverse* universe)
 {
   if (!SACN_ASSERT_VERIFY(universe))
     return;
 
 #if SACN_ETC_PRIORITY_EXTENSION
-  universe->has_pap_data = false;
+  if (lock_source_universe_shard(universe))
+  {
+    universe->has_pap_data = false;
+    unlock_source_universe_shard(universe);
+  }
 #endif
 }
 
@@ -1001,7 +2079,7 @@ void clear_source_netints(SacnSource* source)
   source->num_netints = 0;  // Clear source netints, will be reconstructed when netints are re-added.
 }
 
-// Needs lock
+// Needs lock and every send queue lock, which keeps the tick threads out of the universe's shard
 etcpal_error_t reset_source_universe_networking(SacnSource*             source,
                                                 SacnSourceUniverse*     universe,
                                                 const SacnNetintConfig* netint_config)
@@ -1020,13 +2098,14 @@ etcpal_error_t reset_source_universe_networking(SacnSource*             source,
   return result;
 }
 
-// Needs lock
+// Needs lock, and every shard's lock if the universe is in a shard
 void finish_source_universe_termination(SacnSource* source, size_t index)
 {
   if (!SACN_ASSERT_VERIFY(source))
     return;
 
-  SacnSourceUniverse* universe = &source->universes[index];
+  SacnSourceUniverse* universe = SACN_SOURCE_UNIVERSE_AT(source, index);
+  universe->termination_complete = false;
 
   // Handle unicast destinations first
   size_t initial_num_unicast_dests = universe->num_unicast_dests;  // Actual may change, so keep initial for iteration.
@@ -1043,6 +2122,7 @@ void finish_source_universe_termination(SacnSource* source, size_t index)
     for (size_t i = 0; i < universe->netints.num_netints; ++i)
       remove_from_source_netints(source, &universe->netints.netints[i]);
 
+    unassign_universe_from_tick_thread(universe);
     remove_sacn_source_universe(source, index);
   }
   else
@@ -1051,7 +2131,7 @@ void finish_source_universe_termination(SacnSource* source, size_t index)
   }
 }
 
-// Needs lock
+// Needs the universe's shard lock
 void finish_unicast_dest_termination(SacnSourceUniverse* universe, size_t index)
 {
   if (!SACN_ASSERT_VERIFY(universe))
@@ -1071,12 +2151,18 @@ void set_universe_priority(const SacnSource* source, SacnSourceUniverse* univers
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
     return;
 
+  if (!lock_source_universe_shard(universe))
+    return;
+
   universe->priority                        = priority;
   universe->level_send_buf[SACN_PRI_OFFSET] = priority;
 #if SACN_ETC_PRIORITY_EXTENSION
-  universe->pap_send_buf[SACN_PRI_OFFSET] = priority;
+  if (SACN_SOURCE_UNIVERSE_HAS_PAP_BUF(universe))
+    universe->pap_send_buf[SACN_PRI_OFFSET] = priority;
 #endif
   reset_transmission_suppression(source, universe, kResetLevelAndPap);
+
+  unlock_source_universe_shard(universe);
 }
 
 // Needs lock
@@ -1085,12 +2171,18 @@ void set_preview_flag(const SacnSource* source, SacnSourceUniverse* universe, bo
   if (!SACN_ASSERT_VERIFY(source) || !SACN_ASSERT_VERIFY(universe))
     return;
 
+  if (!lock_source_universe_shard(universe))
+    return;
+
   universe->send_preview = preview;
   SET_PREVIEW_OPT(universe->level_send_buf, preview);
 #if SACN_ETC_PRIORITY_EXTENSION
-  SET_PREVIEW_OPT(universe->pap_send_buf, preview);
+  if (SACN_SOURCE_UNIVERSE_HAS_PAP_BUF(universe))
+    SET_PREVIEW_OPT(universe->pap_send_buf, preview);
 #endif
   reset_transmission_suppression(source, universe, kResetLevelAndPap);
+
+  unlock_source_universe_shard(universe);
 }
 
 void remove_from_source_netints(SacnSource* source, const EtcPalMcastNetintId* netint_id)
@@ -1111,7 +2203,7 @@ void remove_from_source_netints(SacnSource* source, const EtcPalMcastNetintId* n
   }
 }
 
-// Needs lock
+// Needs the universe's shard lock
 void reset_unicast_dest(SacnUnicastDestination* dest)
 {
   if (!SACN_ASSERT_VERIFY(dest))
@@ -1121,7 +2213,7 @@ void reset_unicast_dest(SacnUnicastDestination* dest)
   dest->num_terminations_sent = 0;
 }
 
-// Needs lock
+// Needs the universe's shard lock
 void reset_universe(SacnSourceUniverse* universe)
 {
   if (!SACN_ASSERT_VERIFY(universe))
@@ -1129,13 +2221,14 @@ void reset_universe(SacnSourceUniverse* universe)
 
   universe->termination_state     = kNotTerminating;
   universe->num_terminations_sent = 0;
+  universe->termination_complete  = false;
   universe->has_level_data        = false;
 #if SACN_ETC_PRIORITY_EXTENSION
   universe->has_pap_data = false;
 #endif
 }
 
-// Needs lock
+// Needs the universe's shard lock
 void cancel_termination_if_not_removing(SacnSourceUniverse* universe)
 {
   if (!SACN_ASSERT_VERIFY(universe))
@@ -1145,6 +2238,7 @@ void cancel_termination_if_not_removing(SacnSourceUniverse* universe)
   {
     universe->termination_state     = kNotTerminating;
     universe->num_terminations_sent = 0;
+    universe->termination_complete  = false;
 
     for (size_t i = 0; i < universe->num_unicast_dests; ++i)
     {
@@ -1159,7 +2253,7 @@ void cancel_termination_if_not_removing(SacnSourceUniverse* universe)
   }
 }
 
-// Needs lock
+// Needs the universe's shard lock
 void handle_data_packet_sent(const uint8_t* send_buf, SacnSourceUniverse* universe)
 {
   if (!SACN_ASSERT_VERIFY(send_buf) || !SACN_ASSERT_VERIFY(universe))
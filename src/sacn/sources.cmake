@@ -41,10 +41,16 @@ set(SACN_MEM_HEADERS
   ${SACN_SRC}/sacn/private/mem/source_detector/source_detector.h
   ${SACN_SRC}/sacn/private/mem/source_detector/source_detector_expired_source.h
   ${SACN_SRC}/sacn/private/mem/source_detector/universe_discovery_source.h
+  ${SACN_SRC}/sacn/private/mem/alloc.h
+  ${SACN_SRC}/sacn/private/mem/arena.h
   ${SACN_SRC}/sacn/private/mem/common.h
+  ${SACN_SRC}/sacn/private/mem/handle_index.h
+  ${SACN_SRC}/sacn/private/mem/handle_table.h
+  ${SACN_SRC}/sacn/private/mem/slab.h
 )
 set(SACN_PRIVATE_HEADERS
   ${SACN_MEM_HEADERS}
+  ${SACN_SRC}/sacn/private/atomic.h
   ${SACN_SRC}/sacn/private/common.h
   ${SACN_SRC}/sacn/private/source_loss.h
   ${SACN_SRC}/sacn/private/dmx_merger.h
@@ -56,6 +62,8 @@ set(SACN_PRIVATE_HEADERS
   ${SACN_SRC}/sacn/private/receiver_state.h
   ${SACN_SRC}/sacn/private/source_detector_state.h
   ${SACN_SRC}/sacn/private/util.h
+  ${SACN_SRC}/sacn/private/uring.h
+  ${SACN_SRC}/sacn/private/packet_ring.h
   ${SACN_SRC}/sacn/private/source_detector.h
 )
 set(SACN_MEM_SOURCES
@@ -83,7 +91,12 @@ set(SACN_MEM_SOURCES
   ${SACN_SRC}/sacn/mem/source_detector/source_detector.c
   ${SACN_SRC}/sacn/mem/source_detector/source_detector_expired_source.c
   ${SACN_SRC}/sacn/mem/source_detector/universe_discovery_source.c
+  ${SACN_SRC}/sacn/mem/alloc.c
+  ${SACN_SRC}/sacn/mem/arena.c
   ${SACN_SRC}/sacn/mem/common.c
+  ${SACN_SRC}/sacn/mem/handle_index.c
+  ${SACN_SRC}/sacn/mem/handle_table.c
+  ${SACN_SRC}/sacn/mem/slab.c
 )
 set(SACN_API_SOURCES
   ${SACN_MEM_SOURCES}
@@ -105,6 +118,8 @@ set(SACN_MOCKABLE_SOURCES
   ${SACN_SRC}/sacn/receiver_state.c
   ${SACN_SRC}/sacn/source_detector_state.c
   ${SACN_SRC}/sacn/sockets.c
+  ${SACN_SRC}/sacn/uring.c
+  ${SACN_SRC}/sacn/packet_ring.c
 )
 
 set(SACN_SOURCES
@@ -0,0 +1,701 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+/*
+ * The io_uring receive backend used by the receive threads on Linux, in place of polling their sockets. Each thread
+ * owns one ring, which is only ever touched from that thread.
+ *
+ * Every socket gets one multishot recvmsg request, which keeps receiving packets into buffers taken from a ring of
+ * buffers the thread provides. Each packet comes back as one completion, and its buffer is handed back to the kernel
+ * once the packet has been processed. Requests are submitted one at a time, straight away, so the submission queue
+ * never holds more than one entry.
+ *
+ * Each handle the ring watches has a slot, and requests carry their slot and its generation. A handle's requests are
+ * re-armed whenever the kernel ends them, until the handle is removed, and completions that arrive after that (or
+ * for an earlier handle that had the same slot) are dropped. A socket whose receives keep failing falls back to a
+ * multishot poll, and the thread reads it with recvmsg() when it becomes readable.
+ *
+ * The ring is driven through the raw system calls, so there is no dependency on liburing.
+ */
+
+#include "sacn/private/uring.h"
+#include "sacn/private/mem/common.h"
+#include "sacn/private/sockets.h"
+
+#if SACN_RECEIVER_USE_IO_URING
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+#include "etcpal/inet.h"
+
+/****************************** Private macros *******************************/
+
+#define URING_QUEUE_ENTRIES 8
+#define URING_BUF_GROUP     0
+#define URING_BUF_MASK      (SACN_RECEIVER_IO_URING_BUFFERS - 1)
+
+// Each buffer holds the recvmsg header, the source address, the ancillary data and then the packet. The address space
+// is padded past sizeof(struct sockaddr_in6) so the ancillary data is aligned.
+#define URING_NAME_SIZE      32
+#define URING_CONTROL_SIZE   SACN_RECV_CONTROL_SIZE
+#define URING_PAYLOAD_OFFSET (sizeof(struct io_uring_recvmsg_out) + URING_NAME_SIZE + URING_CONTROL_SIZE)
+#define URING_BUF_SIZE       (URING_PAYLOAD_OFFSET + kSacnMtu)
+
+// Each request's user data holds its type in the top byte, its slot's generation in the rest of the upper half, and
+// its slot in the lower half.
+#define URING_GENERATION_MASK          0xffffffu
+#define URING_REQUEST_TYPE(data)       ((uint32_t)((data) >> 56))
+#define URING_REQUEST_GENERATION(data) ((uint32_t)((data) >> 32) & URING_GENERATION_MASK)
+#define URING_REQUEST_SLOT(data)       ((size_t)(uint32_t)(data))
+#define URING_USER_DATA(type, gen, slot) \
+  (((uint64_t)(type) << 56) | ((uint64_t)((gen) & URING_GENERATION_MASK) << 32) | (uint32_t)(slot))
+
+// A socket falls back to polling after this many receive errors in a row.
+#define URING_MAX_RECV_ERRORS 3
+
+/****************************** Private types ********************************/
+
+typedef enum
+{
+  kUringRecv = 1,
+  kUringWakeup,
+  kUringPoll,
+  kUringCancel
+} uring_request_t;
+
+/**************************** Private variables ******************************/
+
+// Only the lengths are used by multishot recvmsg. The kernel reads this when each request is submitted.
+static const struct msghdr kRecvMsgHdr = {.msg_namelen = URING_NAME_SIZE, .msg_controllen = URING_CONTROL_SIZE};
+
+/*********************** Private function prototypes *************************/
+
+static int uring_setup(unsigned entries, struct io_uring_params* params);
+static int uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags, const void* arg, size_t size);
+static int uring_register(int fd, unsigned opcode, const void* arg, unsigned nr_args);
+
+static bool                 recvmsg_multishot_supported(int fd);
+static void                 release_ring(SacnUring* ring);
+static struct io_uring_sqe* get_sqe(SacnUring* ring);
+static etcpal_error_t       submit_sqe(SacnUring* ring);
+static etcpal_error_t       add_socket(SacnUring* ring, int fd, bool wakeup);
+static SacnUringSocket*     find_socket(SacnUring* ring, int fd);
+static SacnUringSocket*     lookup_request(SacnUring* ring, uint64_t user_data);
+static void                 arm_socket(SacnUring* ring, SacnUringSocket* sock);
+static void                 arm_pending_sockets(SacnUring* ring);
+static void                 request_ended(SacnUring* ring, SacnUringSocket* sock);
+static etcpal_error_t       arm_recv(SacnUring* ring, const SacnUringSocket* sock);
+static etcpal_error_t       arm_poll(SacnUring* ring, const SacnUringSocket* sock, uring_request_t type);
+static void                 provide_buf(SacnUring* ring, uint16_t bid);
+static bool                 next_cqe(SacnUring* ring, struct io_uring_cqe* cqe);
+static bool                 handle_cqe(SacnUring* ring, const struct io_uring_cqe* cqe, SacnUringEvent* event);
+static bool                 handle_recv(SacnUring*                 ring,
+                                        SacnUringSocket*           sock,
+                                        const struct io_uring_cqe* cqe,
+                                        SacnUringEvent*            event);
+static bool                 parse_recvmsg(SacnUring* ring, uint16_t bid, int len, SacnUringEvent* event);
+
+/*************************** Function definitions ****************************/
+
+/*
+ * Sets up the thread's ring and provides its buffers to the kernel.
+ *
+ * [out] ring The ring to initialize.
+ * Returns kEtcPalErrOk on success, kEtcPalErrNotImpl if the kernel doesn't support everything this needs, or
+ * kEtcPalErrSys or kEtcPalErrNoMem on other failures.
+ */
+etcpal_error_t sacn_uring_init(SacnUring* ring)
+{
+  if (!SACN_ASSERT_VERIFY(ring))
+    return kEtcPalErrSys;
+
+  memset(ring, 0, sizeof(SacnUring));
+
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  params.flags      = IORING_SETUP_CQSIZE;
+  params.cq_entries = SACN_RECEIVER_IO_URING_BUFFERS * 2;  // Room for a completion per buffer, plus control requests.
+
+  ring->fd = uring_setup(URING_QUEUE_ENTRIES, &params);
+  if (ring->fd < 0)
+    return kEtcPalErrNotImpl;  // Not built into the kernel, or disabled through kernel.io_uring_disabled.
+
+  if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_EXT_ARG) ||
+      !recvmsg_multishot_supported(ring->fd))
+  {
+    release_ring(ring);
+    return kEtcPalErrNotImpl;
+  }
+
+  // Map the submission and completion queues.
+  size_t sq_size   = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+  size_t cq_size   = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+  ring->rings_size = (sq_size > cq_size) ? sq_size : cq_size;
+  ring->sqes_size  = params.sq_entries * sizeof(struct io_uring_sqe);
+
+  void* rings = mmap(NULL, ring->rings_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                     IORING_OFF_SQ_RING);
+  void* sqes  = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                     IORING_OFF_SQES);
+  ring->rings = (rings == MAP_FAILED) ? NULL : rings;
+  ring->sqes  = (sqes == MAP_FAILED) ? NULL : sqes;
+  if (!ring->rings || !ring->sqes)
+  {
+    release_ring(ring);
+    return kEtcPalErrNoMem;
+  }
+
+  uint8_t* ring_base = (uint8_t*)ring->rings;
+  ring->sq_head      = (unsigned*)(ring_base + params.sq_off.head);
+  ring->sq_tail      = (unsigned*)(ring_base + params.sq_off.tail);
+  ring->sq_array     = (unsigned*)(ring_base + params.sq_off.array);
+  ring->sq_mask      = *(unsigned*)(ring_base + params.sq_off.ring_mask);
+  ring->sq_entries   = params.sq_entries;
+  ring->cq_head      = (unsigned*)(ring_base + params.cq_off.head);
+  ring->cq_tail      = (unsigned*)(ring_base + params.cq_off.tail);
+  ring->cqes         = ring_base + params.cq_off.cqes;
+  ring->cq_mask      = *(unsigned*)(ring_base + params.cq_off.ring_mask);
+
+  // Map the provided buffer ring, which must be page-aligned, with the buffers right behind it.
+  size_t buf_ring_size = SACN_RECEIVER_IO_URING_BUFFERS * sizeof(struct io_uring_buf);
+  ring->buf_mem_size   = buf_ring_size + (SACN_RECEIVER_IO_URING_BUFFERS * URING_BUF_SIZE);
+
+  void* buf_mem = mmap(NULL, ring->buf_mem_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buf_mem == MAP_FAILED)
+  {
+    release_ring(ring);
+    return kEtcPalErrNoMem;
+  }
+  ring->buf_mem = (uint8_t*)buf_mem;
+  ring->bufs    = ring->buf_mem + buf_ring_size;
+
+  struct io_uring_buf_reg reg;
+  memset(&reg, 0, sizeof(reg));
+  reg.ring_addr    = (uint64_t)(uintptr_t)ring->buf_mem;
+  reg.ring_entries = SACN_RECEIVER_IO_URING_BUFFERS;
+  reg.bgid         = URING_BUF_GROUP;
+  if (uring_register(ring->fd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+  {
+    release_ring(ring);
+    return kEtcPalErrNotImpl;
+  }
+
+  for (uint16_t bid = 0; bid < SACN_RECEIVER_IO_URING_BUFFERS; ++bid)
+    provide_buf(ring, bid);
+
+  return kEtcPalErrOk;
+}
+
+/*
+ * Tears down the thread's ring. Any outstanding requests are cancelled by the kernel.
+ *
+ * [in,out] ring The ring to deinitialize.
+ */
+void sacn_uring_deinit(SacnUring* ring)
+{
+  if (!SACN_ASSERT_VERIFY(ring))
+    return;
+
+  release_ring(ring);
+}
+
+/*
+ * Starts receiving packets from a socket into the ring's buffers.
+ *
+ * [in,out] ring The thread's ring.
+ * [in] socket The socket to receive from.
+ * Returns kEtcPalErrOk on success, or kEtcPalErrSys if the request couldn't be submitted.
+ */
+etcpal_error_t sacn_uring_add_socket(SacnUring* ring, etcpal_socket_t socket)
+{
+  if (!SACN_ASSERT_VERIFY(ring) || !SACN_ASSERT_VERIFY(socket != ETCPAL_SOCKET_INVALID))
+    return kEtcPalErrSys;
+
+  return add_socket(ring, socket, false);
+}
+
+/*
+ * Starts watching the thread's wakeup handle, so sacn_uring_wait() returns a wakeup event when it becomes readable.
+ *
+ * [in,out] ring The thread's ring.
+ * [in] wakeup The thread's wakeup handle.
+ * Returns kEtcPalErrOk on success, or kEtcPalErrSys if the request couldn't be submitted.
+ */
+etcpal_error_t sacn_uring_add_wakeup(SacnUring* ring, etcpal_socket_t wakeup)
+{
+  if (!SACN_ASSERT_VERIFY(ring) || !SACN_ASSERT_VERIFY(wakeup != ETCPAL_SOCKET_INVALID))
+    return kEtcPalErrSys;
+
+  return add_socket(ring, wakeup, true);
+}
+
+/*
+ * Cancels all of the ring's requests on a socket or wakeup handle. This must be called before the handle is closed.
+ * Packets the kernel had already completed for it are dropped, and the handle is never re-armed, even if a new handle
+ * with the same descriptor is added before the cancellation completes.
+ *
+ * [in,out] ring The thread's ring.
+ * [in] socket The socket or wakeup handle to stop watching.
+ */
+void sacn_uring_remove(SacnUring* ring, etcpal_socket_t socket)
+{
+  if (!SACN_ASSERT_VERIFY(ring))
+    return;
+
+  SacnUringSocket* sock = find_socket(ring, socket);
+  if (!sock)
+    return;
+
+  sock->removed   = true;
+  sock->needs_arm = false;
+  if (!sock->armed)
+  {
+    sock->in_use = false;
+    return;
+  }
+
+  struct io_uring_sqe* sqe = get_sqe(ring);
+  if (sqe)
+  {
+    sqe->opcode       = IORING_OP_ASYNC_CANCEL;
+    sqe->fd           = socket;
+    sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+    sqe->user_data    = URING_USER_DATA(kUringCancel, 0, 0);
+    submit_sqe(ring);
+  }
+}
+
+/*
+ * Waits for the next packet, wakeup or receive error on the ring. The buffer of the packet returned by the previous
+ * call is given back to the kernel first.
+ *
+ * [in,out] ring The thread's ring.
+ * [out] event Filled in with what happened.
+ * [in] timeout_ms How long to wait for something to happen.
+ * Returns kEtcPalErrOk if event was filled in, kEtcPalErrTimedOut if nothing happened before the timeout, or
+ * kEtcPalErrSys if waiting failed.
+ */
+etcpal_error_t sacn_uring_wait(SacnUring* ring, SacnUringEvent* event, int timeout_ms)
+{
+  if (!SACN_ASSERT_VERIFY(ring) || !SACN_ASSERT_VERIFY(event))
+    return kEtcPalErrSys;
+
+  if (ring->holding_buf)
+  {
+    provide_buf(ring, ring->held_buf);
+    ring->holding_buf = false;
+  }
+
+  if (ring->arm_pending)
+    arm_pending_sockets(ring);
+
+  struct __kernel_timespec timeout;
+  timeout.tv_sec  = timeout_ms / 1000;
+  timeout.tv_nsec = (timeout_ms % 1000) * 1000000;
+
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.ts = (uint64_t)(uintptr_t)&timeout;
+
+  bool waited = false;
+  while (true)
+  {
+    struct io_uring_cqe cqe;
+    if (next_cqe(ring, &cqe))
+    {
+      if (handle_cqe(ring, &cqe, event))
+        return kEtcPalErrOk;
+    }
+    else if (waited)
+    {
+      return kEtcPalErrTimedOut;
+    }
+    else
+    {
+      // Check the queue once more after waiting, whether or not the wait timed out.
+      waited = true;
+      if ((uring_enter(ring->fd, 0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg)) < 0) &&
+          (errno != ETIME) && (errno != EINTR))
+      {
+        return kEtcPalErrSys;
+      }
+    }
+  }
+}
+
+int uring_setup(unsigned entries, struct io_uring_params* params)
+{
+  return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+int uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags, const void* arg, size_t size)
+{
+  return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, size);
+}
+
+int uring_register(int fd, unsigned opcode, const void* arg, unsigned nr_args)
+{
+  return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/*
+ * The kernel can't be asked about multishot recvmsg directly. It arrived in Linux 6.0 along with the zero-copy send
+ * opcode, which can be probed for.
+ */
+bool recvmsg_multishot_supported(int fd)
+{
+  union
+  {
+    struct io_uring_probe probe;
+    uint8_t               storage[sizeof(struct io_uring_probe) + (256 * sizeof(struct io_uring_probe_op))];
+  } probe;
+  memset(&probe, 0, sizeof(probe));
+
+  if (uring_register(fd, IORING_REGISTER_PROBE, &probe.probe, 256) != 0)
+    return false;
+
+  return (probe.probe.ops_len > IORING_OP_SEND_ZC) &&
+         (probe.probe.ops[IORING_OP_SEND_ZC].flags & IO_URING_OP_SUPPORTED) &&
+         (probe.probe.ops[IORING_OP_RECVMSG].flags & IO_URING_OP_SUPPORTED);
+}
+
+void release_ring(SacnUring* ring)
+{
+  // Closing the ring cancels its requests and unregisters the buffer ring.
+  if (ring->fd >= 0)
+    close(ring->fd);
+  if (ring->rings)
+    munmap(ring->rings, ring->rings_size);
+  if (ring->sqes)
+    munmap(ring->sqes, ring->sqes_size);
+  if (ring->buf_mem)
+    munmap(ring->buf_mem, ring->buf_mem_size);
+#if SACN_DYNAMIC_MEM
+  if (ring->sockets)
+    SACN_FREE(ring->sockets);
+#endif
+
+  memset(ring, 0, sizeof(SacnUring));
+  ring->fd = -1;
+}
+
+struct io_uring_sqe* get_sqe(SacnUring* ring)
+{
+  unsigned tail = *ring->sq_tail;  // Only this thread moves the tail.
+  if ((tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE)) >= ring->sq_entries)
+    return NULL;
+
+  struct io_uring_sqe* sqe = &((struct io_uring_sqe*)ring->sqes)[tail & ring->sq_mask];
+  memset(sqe, 0, sizeof(struct io_uring_sqe));
+  return sqe;
+}
+
+etcpal_error_t submit_sqe(SacnUring* ring)
+{
+  unsigned tail                          = *ring->sq_tail;
+  ring->sq_array[tail & ring->sq_mask] = tail & ring->sq_mask;
+  __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+  int res = 0;
+  do
+  {
+    res = uring_enter(ring->fd, 1, 0, 0, NULL, 0);
+  } while ((res < 0) && (errno == EINTR));
+
+  return (res == 1) ? kEtcPalErrOk : kEtcPalErrSys;
+}
+
+/*
+ * Gives a handle a slot and arms its first request. Slots of removed handles are reused once their requests have
+ * ended.
+ */
+etcpal_error_t add_socket(SacnUring* ring, int fd, bool wakeup)
+{
+  SacnUringSocket* sock = NULL;
+  for (size_t i = 0; i < ring->num_sockets; ++i)
+  {
+    if (!ring->sockets[i].in_use)
+    {
+      sock = &ring->sockets[i];
+      break;
+    }
+  }
+
+  if (!sock)
+  {
+    CHECK_ROOM_FOR_ONE_MORE(ring, sockets, SacnUringSocket, SACN_URING_MAX_SOCKETS, kEtcPalErrNoMem);
+    sock             = &ring->sockets[ring->num_sockets++];
+    sock->generation = 0;
+  }
+
+  uint32_t generation = sock->generation + 1;
+  memset(sock, 0, sizeof(SacnUringSocket));
+  sock->fd         = fd;
+  sock->generation = generation;
+  sock->in_use     = true;
+  sock->wakeup     = wakeup;
+
+  arm_socket(ring, sock);
+  if (!sock->armed)
+  {
+    sock->in_use = false;
+    return kEtcPalErrSys;
+  }
+
+  return kEtcPalErrOk;
+}
+
+// Finds the slot of a handle that hasn't been removed.
+SacnUringSocket* find_socket(SacnUring* ring, int fd)
+{
+  for (size_t i = 0; i < ring->num_sockets; ++i)
+  {
+    SacnUringSocket* sock = &ring->sockets[i];
+    if (sock->in_use && !sock->removed && (sock->fd == fd))
+      return sock;
+  }
+  return NULL;
+}
+
+// Finds the slot a completion belongs to, or returns NULL if the slot has since been freed or reused.
+SacnUringSocket* lookup_request(SacnUring* ring, uint64_t user_data)
+{
+  size_t slot = URING_REQUEST_SLOT(user_data);
+  if (slot >= ring->num_sockets)
+    return NULL;
+
+  SacnUringSocket* sock = &ring->sockets[slot];
+  if (!sock->in_use || ((sock->generation & URING_GENERATION_MASK) != URING_REQUEST_GENERATION(user_data)))
+    return NULL;
+
+  return sock;
+}
+
+// Submits the handle's request. If that fails, it's retried on the next wait.
+void arm_socket(SacnUring* ring, SacnUringSocket* sock)
+{
+  etcpal_error_t res = kEtcPalErrOk;
+  if (sock->wakeup)
+    res = arm_poll(ring, sock, kUringWakeup);
+  else if (sock->polling)
+    res = arm_poll(ring, sock, kUringPoll);
+  else
+    res = arm_recv(ring, sock);
+
+  sock->armed     = (res == kEtcPalErrOk);
+  sock->needs_arm = !sock->armed;
+  if (sock->needs_arm)
+    ring->arm_pending = true;
+}
+
+void arm_pending_sockets(SacnUring* ring)
+{
+  ring->arm_pending = false;
+  for (size_t i = 0; i < ring->num_sockets; ++i)
+  {
+    SacnUringSocket* sock = &ring->sockets[i];
+    if (sock->in_use && sock->needs_arm)
+      arm_socket(ring, sock);
+  }
+}
+
+/*
+ * Called when the kernel ends a handle's request, whether it was cancelled, ran out of buffers, failed, or was
+ * multishot and stopped for some other reason. Re-arms the handle unless it's been removed.
+ */
+void request_ended(SacnUring* ring, SacnUringSocket* sock)
+{
+  sock->armed = false;
+  if (sock->removed)
+    sock->in_use = false;
+  else
+    arm_socket(ring, sock);
+}
+
+etcpal_error_t arm_recv(SacnUring* ring, const SacnUringSocket* sock)
+{
+  struct io_uring_sqe* sqe = get_sqe(ring);
+  if (!sqe)
+    return kEtcPalErrSys;
+
+  sqe->opcode    = IORING_OP_RECVMSG;
+  sqe->fd        = sock->fd;
+  sqe->addr      = (uint64_t)(uintptr_t)&kRecvMsgHdr;
+  sqe->len       = 1;
+  sqe->ioprio    = IORING_RECV_MULTISHOT;
+  sqe->flags     = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = URING_BUF_GROUP;
+  sqe->user_data = URING_USER_DATA(kUringRecv, sock->generation, sock - ring->sockets);
+  return submit_sqe(ring);
+}
+
+etcpal_error_t arm_poll(SacnUring* ring, const SacnUringSocket* sock, uring_request_t type)
+{
+  struct io_uring_sqe* sqe = get_sqe(ring);
+  if (!sqe)
+    return kEtcPalErrSys;
+
+  sqe->opcode        = IORING_OP_POLL_ADD;
+  sqe->fd            = sock->fd;
+  sqe->len           = IORING_POLL_ADD_MULTI;
+  sqe->poll32_events = POLLIN;
+  sqe->user_data     = URING_USER_DATA(type, sock->generation, sock - ring->sockets);
+  return submit_sqe(ring);
+}
+
+void provide_buf(SacnUring* ring, uint16_t bid)
+{
+  struct io_uring_buf_ring* buf_ring = (struct io_uring_buf_ring*)ring->buf_mem;
+  struct io_uring_buf*      buf      = &buf_ring->bufs[ring->buf_ring_tail & URING_BUF_MASK];
+
+  buf->addr = (uint64_t)(uintptr_t)(ring->bufs + ((size_t)bid * URING_BUF_SIZE));
+  buf->len  = (uint32_t)URING_BUF_SIZE;
+  buf->bid  = bid;
+
+  ++ring->buf_ring_tail;
+  __atomic_store_n(&buf_ring->tail, ring->buf_ring_tail, __ATOMIC_RELEASE);
+}
+
+bool next_cqe(SacnUring* ring, struct io_uring_cqe* cqe)
+{
+  unsigned head = *ring->cq_head;  // Only this thread moves the head.
+  if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE))
+    return false;
+
+  *cqe = ((const struct io_uring_cqe*)ring->cqes)[head & ring->cq_mask];
+  __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+/*
+ * Returns true if the completion should be reported to the caller, or false if it was handled here.
+ */
+bool handle_cqe(SacnUring* ring, const struct io_uring_cqe* cqe, SacnUringEvent* event)
+{
+  uint32_t         type = URING_REQUEST_TYPE(cqe->user_data);
+  SacnUringSocket* sock = (type == kUringCancel) ? NULL : lookup_request(ring, cqe->user_data);
+  if (!sock || sock->removed)
+  {
+    // A cancellation, or a straggler for a handle that has been removed. Its buffer goes straight back.
+    if (cqe->flags & IORING_CQE_F_BUFFER)
+      provide_buf(ring, (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT));
+    if (sock && !(cqe->flags & IORING_CQE_F_MORE))
+      request_ended(ring, sock);
+    return false;
+  }
+
+  bool report = false;
+  switch (type)
+  {
+    case kUringRecv:
+      report = handle_recv(ring, sock, cqe, event);
+      break;
+    case kUringWakeup:
+    case kUringPoll:
+      if (cqe->res >= 0)
+      {
+        event->type   = (type == kUringWakeup) ? kSacnUringWakeup : kSacnUringReadable;
+        event->socket = sock->fd;
+        report        = true;
+      }
+      break;
+    default:
+      break;
+  }
+
+  // Multishot requests are ended by the kernel from time to time, for example when the completion queue fills up, the
+  // buffers run out or a receive fails. Re-arm so the handle keeps being watched.
+  if (!(cqe->flags & IORING_CQE_F_MORE))
+    request_ended(ring, sock);
+
+  return report;
+}
+
+bool handle_recv(SacnUring* ring, SacnUringSocket* sock, const struct io_uring_cqe* cqe, SacnUringEvent* event)
+{
+  if ((cqe->res >= 0) && (cqe->flags & IORING_CQE_F_BUFFER))
+  {
+    uint16_t bid      = (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+    sock->recv_errors = 0;
+
+    if (parse_recvmsg(ring, bid, cqe->res, event))
+    {
+      event->socket     = sock->fd;
+      ring->holding_buf = true;
+      ring->held_buf    = bid;
+      return true;
+    }
+
+    provide_buf(ring, bid);
+    return false;
+  }
+
+  // Every buffer is waiting in the completion queue, or the request was cancelled by something other than removal.
+  // Neither says anything about the socket.
+  if ((cqe->res == -ENOBUFS) || (cqe->res == -ECANCELED) || (cqe->res >= 0))
+    return false;
+
+  // Report the error so the caller backs off, and re-arm. If the socket keeps failing, watch it with a poll instead,
+  // so the caller reads it with recvmsg() like the poll path does.
+  if (++sock->recv_errors >= URING_MAX_RECV_ERRORS)
+    sock->polling = true;
+
+  event->type   = kSacnUringError;
+  event->socket = sock->fd;
+  event->err    = kEtcPalErrSys;
+  return true;
+}
+
+bool parse_recvmsg(SacnUring* ring, uint16_t bid, int len, SacnUringEvent* event)
+{
+  if ((bid >= SACN_RECEIVER_IO_URING_BUFFERS) || (len < (int)URING_PAYLOAD_OFFSET))
+    return false;
+
+  uint8_t*                           buf = ring->bufs + ((size_t)bid * URING_BUF_SIZE);
+  const struct io_uring_recvmsg_out* out = (const struct io_uring_recvmsg_out*)buf;
+
+  memset(event, 0, sizeof(SacnUringEvent));
+  event->type = kSacnUringPacket;
+
+  if (out->namelen <= URING_NAME_SIZE)
+  {
+    sockaddr_os_to_etcpal((const etcpal_os_sockaddr_t*)(buf + sizeof(struct io_uring_recvmsg_out)),
+                          &event->msg.name);
+  }
+
+  event->msg.control    = buf + sizeof(struct io_uring_recvmsg_out) + URING_NAME_SIZE;
+  event->msg.controllen = out->controllen;
+  event->msg.buf        = buf + URING_PAYLOAD_OFFSET;
+  event->msg.buflen     = (size_t)len - URING_PAYLOAD_OFFSET;
+
+  if (out->flags & MSG_TRUNC)
+    event->msg.flags |= ETCPAL_MSG_TRUNC;
+  if (out->flags & MSG_CTRUNC)
+    event->msg.flags |= ETCPAL_MSG_CTRUNC;
+
+  return true;
+}
+
+#endif  // SACN_RECEIVER_USE_IO_URING
@@ -17,8 +17,66 @@
  * https://github.com/ETCLabs/sACN
  *****************************************************************************/
 
+// Enables clock_gettime() on POSIX platforms, and the thread affinity functions on Linux.
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#elif !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__)) && !defined(_POSIX_C_SOURCE) && \
+    !defined(_GNU_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include "sacn/private/util.h"
 
+#include <string.h>
+#include "sacn/private/common.h"
+#include "sacn/opts.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#else
+#include "etcpal/timer.h"
+#endif
+
+/****************************** Private types ********************************/
+
+/* The fixed properties of each kind of configurable library thread. */
+typedef struct ThreadTypeInfo
+{
+  unsigned int max_threads;
+  unsigned int default_num_threads;
+  int          default_priority;
+  unsigned int default_stack_size;
+  const char*  name;
+  int*         cpus;  // Storage for the copy of SacnThreadConfig::cpus, sized max_threads.
+} ThreadTypeInfo;
+
+/**************************** Private variables ******************************/
+
+static int receive_thread_cpus[SACN_RECEIVER_MAX_THREADS];
+static int source_tick_thread_cpus[SACN_SOURCE_MAX_TICK_THREADS];
+
+// Indexed by sacn_thread_type_t.
+static const ThreadTypeInfo thread_type_info[] = {
+    {SACN_RECEIVER_MAX_THREADS, 1, SACN_RECEIVER_THREAD_PRIORITY, SACN_RECEIVER_THREAD_STACK, SACN_RECEIVER_THREAD_NAME,
+     receive_thread_cpus},
+    {SACN_SOURCE_MAX_TICK_THREADS, SACN_SOURCE_TICK_THREADS, SACN_SOURCE_THREAD_PRIORITY, SACN_SOURCE_THREAD_STACK,
+     SACN_SOURCE_THREAD_NAME, source_tick_thread_cpus}};
+
+static SacnThreadConfig thread_configs[] = {{SACN_THREAD_CONFIG_DEFAULT_VALUES}, {SACN_THREAD_CONFIG_DEFAULT_VALUES}};
+
+/*********************** Private function prototypes *************************/
+
+static bool           thread_config_valid(const SacnThreadConfig* config, unsigned int max_threads);
+static void           copy_thread_config(sacn_thread_type_t type, const SacnThreadConfig* config);
+static etcpal_error_t set_current_thread_affinity(int cpu);
+static etcpal_error_t set_current_thread_sched(sacn_thread_sched_policy_t policy, int priority);
+
+/*************************** Function definitions ****************************/
+
 bool supports_ipv4(sacn_ip_support_t support)
 {
   return ((support == kSacnIpV4Only) || (support == kSacnIpV4AndIpV6));
@@ -28,3 +86,233 @@ bool supports_ipv6(sacn_ip_support_t support)
 {
   return ((support == kSacnIpV6Only) || (support == kSacnIpV4AndIpV6));
 }
+
+/*
+ * Gets a monotonic timestamp in microseconds for measuring short durations. The value wraps, so only differences
+ * between two timestamps are meaningful. Falls back to the millisecond EtcPal clock where no finer clock is known.
+ */
+uint32_t sacn_get_time_us(void)
+{
+#if defined(_WIN32)
+  static LARGE_INTEGER frequency = {0};
+  if (frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+
+  LARGE_INTEGER count;
+  QueryPerformanceCounter(&count);
+  return (uint32_t)(((count.QuadPart / frequency.QuadPart) * 1000000) +
+                    (((count.QuadPart % frequency.QuadPart) * 1000000) / frequency.QuadPart));
+#elif defined(__unix__) || defined(__APPLE__)
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)(((uint64_t)now.tv_sec * 1000000u) + ((uint64_t)now.tv_nsec / 1000u));
+#else
+  return etcpal_getms() * 1000u;
+#endif
+}
+
+/*
+ * Gets the current time in nanoseconds on the clock that packet receive timestamps are taken from. On Unix-like
+ * platforms that is the monotonic clock, so that arrival times aren't thrown off when the wall clock is stepped. Only
+ * differences between two timestamps are meaningful.
+ */
+uint64_t sacn_get_receive_time_ns(void)
+{
+#if defined(_WIN32)
+  static LARGE_INTEGER frequency = {0};
+  if (frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+
+  LARGE_INTEGER count;
+  QueryPerformanceCounter(&count);
+  return ((uint64_t)(count.QuadPart / frequency.QuadPart) * 1000000000u) +
+         (uint64_t)(((count.QuadPart % frequency.QuadPart) * 1000000000) / frequency.QuadPart);
+#elif defined(__unix__) || defined(__APPLE__)
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+#else
+  return (uint64_t)etcpal_getms() * 1000000u;
+#endif
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+/*
+ * Converts a packet timestamp taken by the kernel, which is always on the real-time clock, to the clock of
+ * sacn_get_receive_time_ns(). The packet's age is measured against the real-time clock and then taken off the current
+ * monotonic time, so a wall clock step only affects packets that were already queued when it happened.
+ */
+uint64_t sacn_receive_time_from_realtime_ns(uint64_t realtime_ns)
+{
+  struct timespec real_now;
+  clock_gettime(CLOCK_REALTIME, &real_now);
+  uint64_t real_now_ns = ((uint64_t)real_now.tv_sec * 1000000000u) + (uint64_t)real_now.tv_nsec;
+  uint64_t now_ns      = sacn_get_receive_time_ns();
+
+  uint64_t age_ns = (real_now_ns > realtime_ns) ? (real_now_ns - realtime_ns) : 0u;
+  return (now_ns > age_ns) ? (now_ns - age_ns) : 0u;
+}
+#endif
+
+/*
+ * Validates and stores the application's threading configuration, or restores the defaults if config is NULL. Must be
+ * called before the receive and source tick threads are sized and started.
+ */
+etcpal_error_t sacn_set_thread_configs(const SacnThreadingConfig* config)
+{
+  if (!config)
+  {
+    sacn_reset_thread_configs();
+    return kEtcPalErrOk;
+  }
+
+  if (!thread_config_valid(&config->receive_threads, thread_type_info[kSacnReceiveThread].max_threads) ||
+      !thread_config_valid(&config->source_tick_threads, thread_type_info[kSacnSourceTickThread].max_threads))
+  {
+    return kEtcPalErrInvalid;
+  }
+
+  copy_thread_config(kSacnReceiveThread, &config->receive_threads);
+  copy_thread_config(kSacnSourceTickThread, &config->source_tick_threads);
+  return kEtcPalErrOk;
+}
+
+void sacn_reset_thread_configs(void)
+{
+  SacnThreadConfig default_config = SACN_THREAD_CONFIG_DEFAULT_INIT;
+  copy_thread_config(kSacnReceiveThread, &default_config);
+  copy_thread_config(kSacnSourceTickThread, &default_config);
+}
+
+unsigned int sacn_get_num_configured_threads(sacn_thread_type_t type)
+{
+  unsigned int num_threads = thread_configs[type].num_threads;
+  return (num_threads > 0) ? num_threads : thread_type_info[type].default_num_threads;
+}
+
+/*
+ * Fills in the parameters to create a thread of the given type with.
+ */
+void sacn_get_thread_params(sacn_thread_type_t type, EtcPalThreadParams* params)
+{
+  if (!SACN_ASSERT_VERIFY(params))
+    return;
+
+  const ThreadTypeInfo*   info   = &thread_type_info[type];
+  const SacnThreadConfig* config = &thread_configs[type];
+
+  params->priority      = info->default_priority;
+  params->stack_size    = (config->stack_size > 0) ? config->stack_size : info->default_stack_size;
+  params->thread_name   = info->name;
+  params->platform_data = NULL;
+}
+
+/*
+ * Applies the configured CPU affinity and scheduling policy to the calling thread. Called at the start of each library
+ * thread. Failures are logged, and the thread keeps running with whatever the OS gave it.
+ */
+void sacn_apply_thread_config(sacn_thread_type_t type, unsigned int thread_index)
+{
+  const SacnThreadConfig* config = &thread_configs[type];
+
+  int cpu = (config->num_cpus > 0) ? config->cpus[thread_index % config->num_cpus] : -1;
+  if (cpu >= 0)
+  {
+    etcpal_error_t res = set_current_thread_affinity(cpu);
+    if (res != kEtcPalErrOk)
+    {
+      SACN_LOG_WARNING("Couldn't pin %s %u to CPU %d: '%s'", thread_type_info[type].name, thread_index, cpu,
+                       etcpal_strerror(res));
+    }
+  }
+
+  if (config->sched_policy != kSacnThreadSchedDefault)
+  {
+    etcpal_error_t res = set_current_thread_sched(config->sched_policy, config->priority);
+    if (res != kEtcPalErrOk)
+    {
+      SACN_LOG_WARNING("Couldn't set the scheduling policy of %s %u: '%s'", thread_type_info[type].name, thread_index,
+                       etcpal_strerror(res));
+    }
+  }
+}
+
+bool thread_config_valid(const SacnThreadConfig* config, unsigned int max_threads)
+{
+  if ((config->num_threads > max_threads) || ((config->cpus == NULL) != (config->num_cpus == 0)))
+    return false;
+
+  if (((int)config->sched_policy < (int)kSacnThreadSchedDefault) ||
+      ((int)config->sched_policy > (int)kSacnThreadSchedRoundRobin))
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < config->num_cpus; ++i)
+  {
+    if (config->cpus[i] < -1)
+      return false;
+  }
+
+  return true;
+}
+
+// Copies the CPU list into library storage, since the application's array may not outlive initialization. Entries
+// past the maximum number of threads would never be used.
+void copy_thread_config(sacn_thread_type_t type, const SacnThreadConfig* config)
+{
+  const ThreadTypeInfo* info     = &thread_type_info[type];
+  size_t                num_cpus = (config->num_cpus < info->max_threads) ? config->num_cpus : info->max_threads;
+
+  if (num_cpus > 0)
+    memcpy(info->cpus, config->cpus, num_cpus * sizeof(int));
+
+  thread_configs[type]          = *config;
+  thread_configs[type].cpus     = (num_cpus > 0) ? info->cpus : NULL;
+  thread_configs[type].num_cpus = num_cpus;
+}
+
+etcpal_error_t set_current_thread_affinity(int cpu)
+{
+#if defined(__linux__)
+  if (cpu >= CPU_SETSIZE)
+    return kEtcPalErrInvalid;
+
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu, &cpu_set);
+  return (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0) ? kEtcPalErrOk : kEtcPalErrSys;
+#elif defined(_WIN32)
+  if (cpu >= (int)(sizeof(DWORD_PTR) * 8))
+    return kEtcPalErrInvalid;
+
+  return (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) != 0) ? kEtcPalErrOk : kEtcPalErrSys;
+#else
+  ETCPAL_UNUSED_ARG(cpu);
+  return kEtcPalErrNotImpl;
+#endif
+}
+
+etcpal_error_t set_current_thread_sched(sacn_thread_sched_policy_t policy, int priority)
+{
+#if defined(_WIN32)
+  ETCPAL_UNUSED_ARG(policy);
+  return SetThreadPriority(GetCurrentThread(), priority) ? kEtcPalErrOk : kEtcPalErrSys;
+#elif defined(__unix__) || defined(__APPLE__)
+  int os_policy = SCHED_OTHER;
+  if (policy == kSacnThreadSchedFifo)
+    os_policy = SCHED_FIFO;
+  else if (policy == kSacnThreadSchedRoundRobin)
+    os_policy = SCHED_RR;
+
+  struct sched_param param;
+  memset(&param, 0, sizeof(param));
+  param.sched_priority = (os_policy == SCHED_OTHER) ? 0 : priority;  // SCHED_OTHER only accepts 0.
+
+  return (pthread_setschedparam(pthread_self(), os_policy, &param) == 0) ? kEtcPalErrOk : kEtcPalErrSys;
+#else
+  ETCPAL_UNUSED_ARG(policy);
+  ETCPAL_UNUSED_ARG(priority);
+  return kEtcPalErrNotImpl;
+#endif
+}
@@ -21,6 +21,7 @@
 
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_dmx_merger_init);
 DEFINE_FAKE_VOID_FUNC(sacn_dmx_merger_deinit);
+DEFINE_FAKE_VOID_FUNC(sacn_dmx_merger_add_mem_stats, SacnModuleMemoryStats*);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_dmx_merger_create, const SacnDmxMergerConfig*, sacn_dmx_merger_t*);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_dmx_merger_destroy, sacn_dmx_merger_t);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_dmx_merger_add_source, sacn_dmx_merger_t, sacn_dmx_merger_source_t*);
@@ -84,6 +85,7 @@ void sacn_dmx_merger_reset_all_fakes(void)
 {
   RESET_FAKE(sacn_dmx_merger_init);
   RESET_FAKE(sacn_dmx_merger_deinit);
+  RESET_FAKE(sacn_dmx_merger_add_mem_stats);
   RESET_FAKE(sacn_dmx_merger_create);
   RESET_FAKE(sacn_dmx_merger_destroy);
   RESET_FAKE(sacn_dmx_merger_add_source);
@@ -30,6 +30,7 @@ extern "C" {
 
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_dmx_merger_init);
 DECLARE_FAKE_VOID_FUNC(sacn_dmx_merger_deinit);
+DECLARE_FAKE_VOID_FUNC(sacn_dmx_merger_add_mem_stats, SacnModuleMemoryStats*);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_dmx_merger_create, const SacnDmxMergerConfig*, sacn_dmx_merger_t*);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_dmx_merger_destroy, sacn_dmx_merger_t);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_dmx_merger_add_source, sacn_dmx_merger_t, sacn_dmx_merger_source_t*);
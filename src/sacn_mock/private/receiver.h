@@ -63,6 +63,13 @@ DECLARE_FAKE_VALUE_FUNC(size_t, sacn_receiver_get_network_interfaces, sacn_recei
 
 DECLARE_FAKE_VOID_FUNC(sacn_receiver_set_expired_wait, uint32_t);
 DECLARE_FAKE_VALUE_FUNC(uint32_t, sacn_receiver_get_expired_wait);
+DECLARE_FAKE_VALUE_FUNC(uint64_t, sacn_receiver_get_num_discarded_packets);
+DECLARE_FAKE_VALUE_FUNC(uint64_t, sacn_receiver_get_time_ns);
+DECLARE_FAKE_VALUE_FUNC(etcpal_error_t,
+                        sacn_receiver_get_source_timing,
+                        sacn_receiver_t,
+                        sacn_remote_source_t,
+                        SacnRecvSourceTiming*);
 
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t,
                         create_sacn_receiver,
@@ -33,6 +33,7 @@ DECLARE_FAKE_VALUE_FUNC(sacn_receiver_t, get_next_receiver_handle);
 DECLARE_FAKE_VALUE_FUNC(size_t, get_receiver_netints, const SacnReceiver*, EtcPalMcastNetintId*, size_t);
 DECLARE_FAKE_VOID_FUNC(set_expired_wait, uint32_t);
 DECLARE_FAKE_VALUE_FUNC(uint32_t, get_expired_wait);
+DECLARE_FAKE_VALUE_FUNC(uint64_t, get_num_discarded_packets);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, clear_term_sets_and_sources, SacnReceiver*);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, assign_receiver_to_thread, SacnReceiver*);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, assign_source_detector_to_thread, SacnSourceDetector*);
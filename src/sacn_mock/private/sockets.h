@@ -66,11 +66,19 @@ DECLARE_FAKE_VOID_FUNC(sacn_remove_receiver_socket,
                        const EtcPalMcastNetintId*,
                        size_t,
                        sacn_socket_cleanup_behavior_t);
+DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_init_thread_uring, SacnRecvThreadContext*);
+DECLARE_FAKE_VOID_FUNC(sacn_deinit_thread_uring, SacnRecvThreadContext*);
+DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_init_thread_packet_ring, SacnRecvThreadContext*);
+DECLARE_FAKE_VOID_FUNC(sacn_deinit_thread_packet_ring, SacnRecvThreadContext*);
+DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_init_thread_wakeup, SacnRecvThreadContext*);
+DECLARE_FAKE_VOID_FUNC(sacn_deinit_thread_wakeup, SacnRecvThreadContext*);
 DECLARE_FAKE_VOID_FUNC(sacn_add_pending_sockets, SacnRecvThreadContext*);
 DECLARE_FAKE_VOID_FUNC(sacn_cleanup_dead_sockets, SacnRecvThreadContext*);
 DECLARE_FAKE_VOID_FUNC(sacn_subscribe_sockets, SacnRecvThreadContext*);
 DECLARE_FAKE_VOID_FUNC(sacn_unsubscribe_sockets, SacnRecvThreadContext*);
+DECLARE_FAKE_VOID_FUNC(sacn_update_socket_filters, SacnRecvThreadContext*);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_read, SacnRecvThreadContext*, SacnReadResult*);
+DECLARE_FAKE_VOID_FUNC(sacn_wake_receive_thread, SacnRecvThreadContext*);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t,
                         sacn_send_multicast,
                         uint16_t,
@@ -81,6 +81,17 @@ DECLARE_FAKE_VOID_FUNC(sacn_source_update_levels_and_pap_and_force_sync,
                        size_t,
                        const uint8_t*,
                        size_t);
+DECLARE_FAKE_VOID_FUNC(sacn_source_update_universes, sacn_source_t, const SacnSourceUniverseUpdate*, size_t);
+DECLARE_FAKE_VALUE_FUNC(sacn_source_universe_t, sacn_source_get_universe_handle, sacn_source_t, uint16_t);
+DECLARE_FAKE_VOID_FUNC(sacn_source_update_universe,
+                       sacn_source_t,
+                       sacn_source_universe_t,
+                       const uint8_t*,
+                       size_t,
+                       const uint8_t*,
+                       size_t);
+DECLARE_FAKE_VALUE_FUNC(uint8_t*, sacn_source_begin_levels, sacn_source_t, uint16_t);
+DECLARE_FAKE_VOID_FUNC(sacn_source_commit_levels, sacn_source_t, uint16_t, size_t);
 
 DECLARE_FAKE_VALUE_FUNC(int, sacn_source_process_manual, sacn_source_tick_mode_t);
 
@@ -29,6 +29,7 @@ extern "C" {
 
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_source_loss_init);
 DECLARE_FAKE_VOID_FUNC(sacn_source_loss_deinit);
+DECLARE_FAKE_VOID_FUNC(sacn_source_loss_add_mem_stats, SacnModuleMemoryStats*);
 
 DECLARE_FAKE_VOID_FUNC(mark_sources_online, uint16_t, const SacnRemoteSourceInternal*, size_t, TerminationSet**);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t,
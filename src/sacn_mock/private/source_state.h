@@ -31,7 +31,16 @@ DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_source_state_init);
 DECLARE_FAKE_VOID_FUNC(sacn_source_state_deinit);
 
 DECLARE_FAKE_VALUE_FUNC(int, take_lock_and_process_sources, sacn_process_sources_behavior_t, sacn_source_tick_mode_t);
+DECLARE_FAKE_VALUE_FUNC(int, take_lock_and_process_tick_thread, unsigned int, sacn_source_tick_mode_t);
 DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, initialize_source_thread);
+DECLARE_FAKE_VALUE_FUNC(etcpal_error_t, assign_universe_to_tick_thread, SacnSource*, SacnSourceUniverse*);
+DECLARE_FAKE_VOID_FUNC(refresh_tick_thread_shards);
+DECLARE_FAKE_VALUE_FUNC(bool, lock_source_send_queues);
+DECLARE_FAKE_VOID_FUNC(unlock_source_send_queues);
+DECLARE_FAKE_VALUE_FUNC(bool, lock_source_universe_shard, const SacnSourceUniverse*);
+DECLARE_FAKE_VOID_FUNC(unlock_source_universe_shard, const SacnSourceUniverse*);
+DECLARE_FAKE_VALUE_FUNC(bool, lock_all_source_shards);
+DECLARE_FAKE_VOID_FUNC(unlock_all_source_shards);
 DECLARE_FAKE_VALUE_FUNC(sacn_source_t, get_next_source_handle);
 DECLARE_FAKE_VOID_FUNC(update_levels_and_or_pap,
                        SacnSource*,
@@ -52,6 +52,13 @@ DEFINE_FAKE_VALUE_FUNC(size_t, sacn_receiver_get_network_interfaces, sacn_receiv
 
 DEFINE_FAKE_VOID_FUNC(sacn_receiver_set_expired_wait, uint32_t);
 DEFINE_FAKE_VALUE_FUNC(uint32_t, sacn_receiver_get_expired_wait);
+DEFINE_FAKE_VALUE_FUNC(uint64_t, sacn_receiver_get_num_discarded_packets);
+DEFINE_FAKE_VALUE_FUNC(uint64_t, sacn_receiver_get_time_ns);
+DEFINE_FAKE_VALUE_FUNC(etcpal_error_t,
+                       sacn_receiver_get_source_timing,
+                       sacn_receiver_t,
+                       sacn_remote_source_t,
+                       SacnRecvSourceTiming*);
 
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t,
                        create_sacn_receiver,
@@ -79,6 +86,9 @@ void sacn_receiver_reset_all_fakes(void)
   RESET_FAKE(sacn_receiver_get_network_interfaces);
   RESET_FAKE(sacn_receiver_set_expired_wait);
   RESET_FAKE(sacn_receiver_get_expired_wait);
+  RESET_FAKE(sacn_receiver_get_num_discarded_packets);
+  RESET_FAKE(sacn_receiver_get_time_ns);
+  RESET_FAKE(sacn_receiver_get_source_timing);
   RESET_FAKE(create_sacn_receiver);
   RESET_FAKE(destroy_sacn_receiver);
   RESET_FAKE(change_sacn_receiver_universe);
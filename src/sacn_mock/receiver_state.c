@@ -25,6 +25,7 @@ DEFINE_FAKE_VALUE_FUNC(sacn_receiver_t, get_next_receiver_handle);
 DEFINE_FAKE_VALUE_FUNC(size_t, get_receiver_netints, const SacnReceiver*, EtcPalMcastNetintId*, size_t);
 DEFINE_FAKE_VOID_FUNC(set_expired_wait, uint32_t);
 DEFINE_FAKE_VALUE_FUNC(uint32_t, get_expired_wait);
+DEFINE_FAKE_VALUE_FUNC(uint64_t, get_num_discarded_packets);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, clear_term_sets_and_sources, SacnReceiver*);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, assign_receiver_to_thread, SacnReceiver*);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, assign_source_detector_to_thread, SacnSourceDetector*);
@@ -50,6 +51,7 @@ void sacn_receiver_state_reset_all_fakes(void)
   RESET_FAKE(get_receiver_netints);
   RESET_FAKE(set_expired_wait);
   RESET_FAKE(get_expired_wait);
+  RESET_FAKE(get_num_discarded_packets);
   RESET_FAKE(clear_term_sets_and_sources);
   RESET_FAKE(assign_receiver_to_thread);
   RESET_FAKE(assign_source_detector_to_thread);
@@ -58,11 +58,19 @@ DEFINE_FAKE_VOID_FUNC(sacn_remove_receiver_socket,
                       const EtcPalMcastNetintId*,
                       size_t,
                       sacn_socket_cleanup_behavior_t);
+DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_init_thread_uring, SacnRecvThreadContext*);
+DEFINE_FAKE_VOID_FUNC(sacn_deinit_thread_uring, SacnRecvThreadContext*);
+DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_init_thread_packet_ring, SacnRecvThreadContext*);
+DEFINE_FAKE_VOID_FUNC(sacn_deinit_thread_packet_ring, SacnRecvThreadContext*);
+DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_init_thread_wakeup, SacnRecvThreadContext*);
+DEFINE_FAKE_VOID_FUNC(sacn_deinit_thread_wakeup, SacnRecvThreadContext*);
 DEFINE_FAKE_VOID_FUNC(sacn_add_pending_sockets, SacnRecvThreadContext*);
 DEFINE_FAKE_VOID_FUNC(sacn_cleanup_dead_sockets, SacnRecvThreadContext*);
 DEFINE_FAKE_VOID_FUNC(sacn_subscribe_sockets, SacnRecvThreadContext*);
 DEFINE_FAKE_VOID_FUNC(sacn_unsubscribe_sockets, SacnRecvThreadContext*);
+DEFINE_FAKE_VOID_FUNC(sacn_update_socket_filters, SacnRecvThreadContext*);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_read, SacnRecvThreadContext*, SacnReadResult*);
+DEFINE_FAKE_VOID_FUNC(sacn_wake_receive_thread, SacnRecvThreadContext*);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t,
                        sacn_send_multicast,
                        uint16_t,
@@ -90,11 +98,19 @@ void sacn_sockets_reset_all_fakes(void)
   RESET_FAKE(sacn_get_mcast_addr);
   RESET_FAKE(sacn_add_receiver_socket);
   RESET_FAKE(sacn_remove_receiver_socket);
+  RESET_FAKE(sacn_init_thread_uring);
+  RESET_FAKE(sacn_deinit_thread_uring);
+  RESET_FAKE(sacn_init_thread_packet_ring);
+  RESET_FAKE(sacn_deinit_thread_packet_ring);
+  RESET_FAKE(sacn_init_thread_wakeup);
+  RESET_FAKE(sacn_deinit_thread_wakeup);
   RESET_FAKE(sacn_add_pending_sockets);
   RESET_FAKE(sacn_cleanup_dead_sockets);
   RESET_FAKE(sacn_subscribe_sockets);
   RESET_FAKE(sacn_unsubscribe_sockets);
+  RESET_FAKE(sacn_update_socket_filters);
   RESET_FAKE(sacn_read);
+  RESET_FAKE(sacn_wake_receive_thread);
   RESET_FAKE(sacn_send_multicast);
   RESET_FAKE(sacn_send_unicast);
 }
@@ -70,6 +70,17 @@ DEFINE_FAKE_VOID_FUNC(sacn_source_update_levels_and_pap_and_force_sync,
                       size_t,
                       const uint8_t*,
                       size_t);
+DEFINE_FAKE_VOID_FUNC(sacn_source_update_universes, sacn_source_t, const SacnSourceUniverseUpdate*, size_t);
+DEFINE_FAKE_VALUE_FUNC(sacn_source_universe_t, sacn_source_get_universe_handle, sacn_source_t, uint16_t);
+DEFINE_FAKE_VOID_FUNC(sacn_source_update_universe,
+                      sacn_source_t,
+                      sacn_source_universe_t,
+                      const uint8_t*,
+                      size_t,
+                      const uint8_t*,
+                      size_t);
+DEFINE_FAKE_VALUE_FUNC(uint8_t*, sacn_source_begin_levels, sacn_source_t, uint16_t);
+DEFINE_FAKE_VOID_FUNC(sacn_source_commit_levels, sacn_source_t, uint16_t, size_t);
 
 DEFINE_FAKE_VALUE_FUNC(int, sacn_source_process_manual, sacn_source_tick_mode_t);
 
@@ -111,6 +122,11 @@ void sacn_source_reset_all_fakes(void)
   RESET_FAKE(sacn_source_update_levels_and_pap);
   RESET_FAKE(sacn_source_update_levels_and_force_sync);
   RESET_FAKE(sacn_source_update_levels_and_pap_and_force_sync);
+  RESET_FAKE(sacn_source_update_universes);
+  RESET_FAKE(sacn_source_get_universe_handle);
+  RESET_FAKE(sacn_source_update_universe);
+  RESET_FAKE(sacn_source_begin_levels);
+  RESET_FAKE(sacn_source_commit_levels);
   RESET_FAKE(sacn_source_process_manual);
   RESET_FAKE(sacn_source_reset_networking);
   RESET_FAKE(sacn_source_reset_networking_per_universe);
@@ -21,6 +21,7 @@
 
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_source_loss_init);
 DEFINE_FAKE_VOID_FUNC(sacn_source_loss_deinit);
+DEFINE_FAKE_VOID_FUNC(sacn_source_loss_add_mem_stats, SacnModuleMemoryStats*);
 DEFINE_FAKE_VOID_FUNC(mark_sources_online, uint16_t, const SacnRemoteSourceInternal*, size_t, TerminationSet**);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t,
                        mark_sources_offline,
@@ -38,6 +39,7 @@ void sacn_source_loss_reset_all_fakes(void)
 {
   RESET_FAKE(sacn_source_loss_init);
   RESET_FAKE(sacn_source_loss_deinit);
+  RESET_FAKE(sacn_source_loss_add_mem_stats);
   RESET_FAKE(mark_sources_online);
   RESET_FAKE(mark_sources_offline);
   RESET_FAKE(get_expired_sources);
@@ -23,7 +23,16 @@ DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, sacn_source_state_init);
 DEFINE_FAKE_VOID_FUNC(sacn_source_state_deinit);
 
 DEFINE_FAKE_VALUE_FUNC(int, take_lock_and_process_sources, sacn_process_sources_behavior_t, sacn_source_tick_mode_t);
+DEFINE_FAKE_VALUE_FUNC(int, take_lock_and_process_tick_thread, unsigned int, sacn_source_tick_mode_t);
 DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, initialize_source_thread);
+DEFINE_FAKE_VALUE_FUNC(etcpal_error_t, assign_universe_to_tick_thread, SacnSource*, SacnSourceUniverse*);
+DEFINE_FAKE_VOID_FUNC(refresh_tick_thread_shards);
+DEFINE_FAKE_VALUE_FUNC(bool, lock_source_send_queues);
+DEFINE_FAKE_VOID_FUNC(unlock_source_send_queues);
+DEFINE_FAKE_VALUE_FUNC(bool, lock_source_universe_shard, const SacnSourceUniverse*);
+DEFINE_FAKE_VOID_FUNC(unlock_source_universe_shard, const SacnSourceUniverse*);
+DEFINE_FAKE_VALUE_FUNC(bool, lock_all_source_shards);
+DEFINE_FAKE_VOID_FUNC(unlock_all_source_shards);
 DEFINE_FAKE_VALUE_FUNC(sacn_source_t, get_next_source_handle);
 DEFINE_FAKE_VOID_FUNC(update_levels_and_or_pap,
                       SacnSource*,
@@ -65,7 +74,16 @@ void sacn_source_state_reset_all_fakes(void)
   RESET_FAKE(sacn_source_state_init);
   RESET_FAKE(sacn_source_state_deinit);
   RESET_FAKE(take_lock_and_process_sources);
+  RESET_FAKE(take_lock_and_process_tick_thread);
   RESET_FAKE(initialize_source_thread);
+  RESET_FAKE(assign_universe_to_tick_thread);
+  RESET_FAKE(refresh_tick_thread_shards);
+  RESET_FAKE(lock_source_send_queues);
+  RESET_FAKE(unlock_source_send_queues);
+  RESET_FAKE(lock_source_universe_shard);
+  RESET_FAKE(unlock_source_universe_shard);
+  RESET_FAKE(lock_all_source_shards);
+  RESET_FAKE(unlock_all_source_shards);
   RESET_FAKE(get_next_source_handle);
   RESET_FAKE(update_levels_and_or_pap);
   RESET_FAKE(pack_sequence_number);
@@ -87,4 +105,8 @@ void sacn_source_state_reset_all_fakes(void)
   RESET_FAKE(reset_source_universe_networking);
   RESET_FAKE(finish_source_universe_termination);
   RESET_FAKE(finish_unicast_dest_termination);
+
+  lock_source_send_queues_fake.return_val    = true;
+  lock_source_universe_shard_fake.return_val = true;
+  lock_all_source_shards_fake.return_val     = true;
 }
@@ -6,3 +6,6 @@
 #define SACN_RECEIVER_MAX_SUBS_PER_SOCKET 10
 
 #define SACN_DMX_MERGER_MAX_SLOTS 500
+
+// Exercise the receive timing statistics in one of the configurations.
+#define SACN_RECEIVER_ENABLE_TIMESTAMPS 1
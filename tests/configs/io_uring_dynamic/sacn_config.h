@@ -0,0 +1,10 @@
+#include "sacn_config_common.h"
+
+#define SACN_DYNAMIC_MEM 1
+
+// Tests indicate that the Linux runner only supports up to 10 subscriptions per socket.
+#define SACN_RECEIVER_MAX_SUBS_PER_SOCKET 10
+
+// Read through io_uring, with few enough buffers that the tests can run the ring out of them.
+#define SACN_RECEIVER_ENABLE_IO_URING  1
+#define SACN_RECEIVER_IO_URING_BUFFERS 4
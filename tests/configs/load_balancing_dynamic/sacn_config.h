@@ -0,0 +1,9 @@
+#include "sacn_config_common.h"
+
+#define SACN_DYNAMIC_MEM 1
+
+// Tests indicate that the Linux runner only supports up to 10 subscriptions per socket.
+#define SACN_RECEIVER_MAX_SUBS_PER_SOCKET 10
+
+// Dynamic builds allow more than one receive thread, which load balancing needs.
+#define SACN_RECEIVER_ENABLE_LOAD_BALANCING 1
@@ -0,0 +1,7 @@
+#include "sacn_config_common.h"
+
+#define SACN_DYNAMIC_MEM 1
+#define SACN_MEM_ARENA   1
+
+// Tests indicate that the Linux runner only supports up to 10 subscriptions per socket.
+#define SACN_RECEIVER_MAX_SUBS_PER_SOCKET 10
@@ -0,0 +1,11 @@
+#include "sacn_config_common.h"
+
+#define SACN_DYNAMIC_MEM 1
+
+// Tests indicate that the Linux runner only supports up to 10 subscriptions per socket.
+#define SACN_RECEIVER_MAX_SUBS_PER_SOCKET 10
+
+// Read through a packet ring, with small blocks so the tests don't map much memory.
+#define SACN_RECEIVER_ENABLE_PACKET_RING     1
+#define SACN_RECEIVER_PACKET_RING_BLOCK_SIZE 4096
+#define SACN_RECEIVER_PACKET_RING_BLOCKS     2
@@ -0,0 +1,37 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "gtest/gtest.h"
+#include "fff.h"
+
+DEFINE_FFF_GLOBALS;
+
+extern "C" bool SacnTestingAssertHandler(const char* expression, const char* file, const char* func, unsigned int line)
+{
+  ADD_FAILURE() << "Assertion failure from inside sACN library. Expression: " << expression << " File: " << file
+                << " Function: " << func << " Line: " << line;
+
+  return false;
+}
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
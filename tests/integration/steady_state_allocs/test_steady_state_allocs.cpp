@@ -0,0 +1,316 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "sacn/cpp/receiver.h"
+#include "sacn/cpp/merge_receiver.h"
+#include "sacn/cpp/source.h"
+#include "sacn/cpp/common.h"
+
+#include <array>
+#include <string>
+#include <vector>
+#include <gsl/span>
+#include "etcpal/cpp/uuid.h"
+#include "etcpal_mock/common.h"
+#include "etcpal_mock/netint.h"
+#include "etcpal_mock/socket.h"
+#include "etcpal_mock/timer.h"
+#include "sacn/private/mem/alloc.h"
+#include "sacn/private/mem/receiver/recv_thread_context.h"
+#include "sacn/private/pdu.h"
+#include "sacn/private/receiver_state.h"
+#include "sacn/private/source_state.h"
+#include "gtest/gtest.h"
+
+#if !SACN_DYNAMIC_MEM || !SACN_TRACK_ALLOCATIONS
+#error "These tests need SACN_DYNAMIC_MEM and SACN_TRACK_ALLOCATIONS enabled."
+#endif
+
+#ifdef _MSC_VER
+// disable strcpy() warnings on MSVC
+#pragma warning(disable : 4996)
+#endif
+
+using namespace sacn;
+
+static constexpr uint16_t kTestUniverse    = 1u;
+static constexpr uint8_t  kTestPriority    = 100u;
+static constexpr size_t   kTestSlotCount   = 512u;
+static constexpr int      kWarmUpCycles    = 50;
+static constexpr int      kSteadyCycles    = 500;
+static constexpr uint32_t kCycleIntervalMs = kSacnPeriodicInterval + 1u;
+
+static const etcpal::Uuid kTestRemoteCid = etcpal::Uuid::V4();
+
+static etcpal_socket_t next_socket = (etcpal_socket_t)0;
+
+class TestSteadyStateAllocs : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    etcpal_reset_all_fakes();
+
+    fake_sys_netints_.clear();
+    EtcPalNetintInfo fake_netint{};
+    fake_netint.index = 1u;
+    fake_netint.addr  = etcpal::IpAddr::FromString("10.101.20.30").get();
+    fake_netint.mask  = etcpal::IpAddr::FromString("255.255.0.0").get();
+    fake_netint.mac   = etcpal::MacAddr::FromString("00:c0:16:22:22:22").get();
+    strcpy(fake_netint.id, "eth_v4_0");
+    strcpy(fake_netint.friendly_name, "eth_v4_0");
+    fake_netint.is_default = true;
+    fake_sys_netints_.push_back(fake_netint);
+
+    etcpal_netint_get_interfaces_fake.custom_fake = [](EtcPalNetintInfo* netints, size_t* num_netints) {
+      if (!num_netints)
+        return kEtcPalErrInvalid;
+
+      gsl::span<EtcPalNetintInfo> dest(netints, netints ? *num_netints : 0u);
+      *num_netints = fake_sys_netints_.size();
+      if (fake_sys_netints_.size() > dest.size())
+        return kEtcPalErrBufSize;
+
+      std::copy(fake_sys_netints_.begin(), fake_sys_netints_.end(), dest.begin());
+      return kEtcPalErrOk;
+    };
+
+    etcpal_socket_fake.custom_fake = [](unsigned int, unsigned int, etcpal_socket_t* new_sock) {
+      EXPECT_NE(new_sock, nullptr);
+      *new_sock = next_socket++;
+      return kEtcPalErrOk;
+    };
+
+    etcpal_cmsg_to_pktinfo_fake.custom_fake = [](const EtcPalCMsgHdr*, EtcPalPktInfo*) { return true; };
+    etcpal_cmsg_firsthdr_fake.custom_fake   = [](EtcPalMsgHdr*, EtcPalCMsgHdr*) { return true; };
+
+    etcpal_poll_wait_fake.custom_fake = [](EtcPalPollContext*, EtcPalPollEvent* event, int) {
+      event->socket = (next_socket - 1);
+      event->events = ETCPAL_POLL_IN;
+      return kEtcPalErrOk;
+    };
+
+    etcpal_recvmsg_fake.custom_fake = [](etcpal_socket_t, EtcPalMsgHdr* msg, int) {
+      EXPECT_NE(msg, nullptr);
+      msg->flags = 0;
+      msg->name  = etcpal::SockAddr(etcpal::IpAddr::FromString("10.101.20.1").get(), 0).get();
+      memcpy(msg->buf, packet_.data(), packet_len_);
+      msg->buflen = packet_len_;
+      return static_cast<int>(packet_len_);
+    };
+
+    ASSERT_EQ(Init().code(), kEtcPalErrOk);
+  }
+
+  void TearDown() override { Deinit(); }
+
+  // Build the next packet from the fake remote source, alternating between levels and per-address priorities.
+  static void BuildNextPacket()
+  {
+    uint8_t start_code = (seq_num_ % 2u) ? kSacnStartcodePriority : kSacnStartcodeDmx;
+
+    std::array<uint8_t, kTestSlotCount> slots{};
+    slots.fill((start_code == kSacnStartcodePriority) ? kTestPriority : seq_num_);
+
+    packet_.fill(0u);
+    init_sacn_data_send_buf(packet_.data(), start_code, &kTestRemoteCid.get(), "Test Remote Source", kTestPriority,
+                            kTestUniverse, 0u, false);
+    update_send_buf_data(packet_.data(), slots.data(), static_cast<uint16_t>(slots.size()), kDisableForceSync);
+    packet_[SACN_SEQ_OFFSET] = seq_num_++;
+    packet_len_              = SACN_DATA_HEADER_SIZE + slots.size();
+  }
+
+  static void RunReceiveCycle()
+  {
+    BuildNextPacket();
+    read_network_and_process(get_recv_thread_context(0));
+    etcpal_getms_fake.return_val += kCycleIntervalMs;
+  }
+
+  static void RunSourceTick(Source& source)
+  {
+    std::array<uint8_t, kTestSlotCount> levels{};
+    levels.fill(seq_num_++);
+    source.UpdateLevels(kTestUniverse, levels.data(), levels.size());
+
+    take_lock_and_process_sources(kProcessThreadedSources, kSacnSourceTickModeProcessLevelsAndPap);
+    etcpal_getms_fake.return_val += kCycleIntervalMs;
+  }
+
+  static void ExpectNoAllocationsSinceReset()
+  {
+    for (int module = 0; module < kSacnNumAllocModules; ++module)
+    {
+      SCOPED_TRACE("While checking allocation module " + std::to_string(module));
+
+      SacnAllocCounts counts{};
+      sacn_alloc_get_counts(static_cast<sacn_alloc_module_t>(module), &counts);
+      EXPECT_EQ(counts.allocs, 0u);
+      EXPECT_EQ(counts.reallocs, 0u);
+      EXPECT_EQ(counts.frees, 0u);
+    }
+  }
+
+  static std::vector<EtcPalNetintInfo> fake_sys_netints_;
+  static std::array<uint8_t, kSacnMtu> packet_;
+  static size_t                        packet_len_;
+  static uint8_t                       seq_num_;
+};
+
+std::vector<EtcPalNetintInfo> TestSteadyStateAllocs::fake_sys_netints_;
+std::array<uint8_t, kSacnMtu> TestSteadyStateAllocs::packet_;
+size_t                        TestSteadyStateAllocs::packet_len_ = 0u;
+uint8_t                       TestSteadyStateAllocs::seq_num_    = 0u;
+
+class CountingReceiverNotifyHandler : public Receiver::NotifyHandler
+{
+public:
+  void HandleUniverseData(Receiver::Handle,
+                          const etcpal::SockAddr&,
+                          const SacnRemoteSource&,
+                          const SacnRecvUniverseData&) override
+  {
+    ++num_universe_data;
+  }
+
+  void HandleSourcesLost(Receiver::Handle, uint16_t, const std::vector<SacnLostSource>&) override
+  {
+    ++num_sources_lost;
+  }
+
+  int num_universe_data{0};
+  int num_sources_lost{0};
+};
+
+class CountingMergeReceiverNotifyHandler : public MergeReceiver::NotifyHandler
+{
+public:
+  void HandleMergedData(MergeReceiver::Handle, const SacnRecvMergedData&) override { ++num_merged_data; }
+
+  int num_merged_data{0};
+};
+
+TEST_F(TestSteadyStateAllocs, ReceiveMakesNoAllocationsAfterWarmUp)
+{
+  Receiver                      receiver;
+  CountingReceiverNotifyHandler notify_handler;
+  ASSERT_EQ(receiver.Startup(Receiver::Settings(kTestUniverse), notify_handler).code(), kEtcPalErrOk);
+
+  // Warm up past the sampling period, so the source is tracked and every buffer has reached its working size.
+  for (int i = 0; i < kWarmUpCycles; ++i)
+    RunReceiveCycle();
+  ASSERT_GT(notify_handler.num_universe_data, 0);
+
+  sacn_alloc_reset_counts();
+  notify_handler.num_universe_data = 0;
+
+  for (int i = 0; i < kSteadyCycles; ++i)
+    RunReceiveCycle();
+
+  EXPECT_EQ(notify_handler.num_universe_data, kSteadyCycles);
+  EXPECT_EQ(notify_handler.num_sources_lost, 0);
+  ExpectNoAllocationsSinceReset();
+
+  receiver.Shutdown();
+}
+
+TEST_F(TestSteadyStateAllocs, MergeReceiveMakesNoAllocationsAfterWarmUp)
+{
+  MergeReceiver                      merge_receiver;
+  CountingMergeReceiverNotifyHandler notify_handler;
+  ASSERT_EQ(merge_receiver.Startup(MergeReceiver::Settings(kTestUniverse), notify_handler).code(), kEtcPalErrOk);
+
+  for (int i = 0; i < kWarmUpCycles; ++i)
+    RunReceiveCycle();
+  ASSERT_GT(notify_handler.num_merged_data, 0);
+
+  sacn_alloc_reset_counts();
+  notify_handler.num_merged_data = 0;
+
+  for (int i = 0; i < kSteadyCycles; ++i)
+    RunReceiveCycle();
+
+  EXPECT_GT(notify_handler.num_merged_data, 0);
+  ExpectNoAllocationsSinceReset();
+
+  merge_receiver.Shutdown();
+}
+
+TEST_F(TestSteadyStateAllocs, SourceTickMakesNoAllocationsAfterWarmUp)
+{
+  Source source;
+  ASSERT_EQ(source.Startup(Source::Settings(etcpal::Uuid::V4(), "Test Source")).code(), kEtcPalErrOk);
+  ASSERT_EQ(source.AddUniverse(Source::UniverseSettings(kTestUniverse)).code(), kEtcPalErrOk);
+
+  // Warm up long enough to send universe discovery, so the send queue has reached its working size.
+  static constexpr int kSourceWarmUpCycles =
+      kWarmUpCycles + static_cast<int>(kSacnUniverseDiscoveryInterval / kCycleIntervalMs);
+  for (int i = 0; i < kSourceWarmUpCycles; ++i)
+    RunSourceTick(source);
+
+  sacn_alloc_reset_counts();
+  etcpal_sendto_fake.call_count = 0u;
+
+  for (int i = 0; i < kSteadyCycles; ++i)
+    RunSourceTick(source);
+
+  EXPECT_GT(etcpal_sendto_fake.call_count, 0u);
+  ExpectNoAllocationsSinceReset();
+
+  source.Shutdown();
+}
+
+TEST_F(TestSteadyStateAllocs, MemoryStatsTrackTheReceiverFootprint)
+{
+  auto baseline = GetMemoryStats();
+  ASSERT_TRUE(baseline);
+
+  Receiver                      receiver;
+  CountingReceiverNotifyHandler notify_handler;
+  ASSERT_EQ(receiver.Startup(Receiver::Settings(kTestUniverse), notify_handler).code(), kEtcPalErrOk);
+
+  for (int i = 0; i < kWarmUpCycles; ++i)
+    RunReceiveCycle();
+
+  // The receiver, its tracked source and the source's handle are all in use now.
+  auto running = GetMemoryStats();
+  ASSERT_TRUE(running);
+  EXPECT_GT(running->receiver.bytes_allocated, baseline->receiver.bytes_allocated);
+  EXPECT_GE(running->receiver.pool_in_use, baseline->receiver.pool_in_use + 3u);
+  EXPECT_GT(running->receiver.rb_nodes_in_use, baseline->receiver.rb_nodes_in_use);
+  EXPECT_LE(running->receiver.pool_in_use, running->receiver.pool_capacity);
+  EXPECT_LE(running->receiver.rb_nodes_in_use, running->receiver.rb_node_capacity);
+  ASSERT_GT(running->num_threads, 0u);
+
+  auto thread_stats = GetThreadMemoryStats(0u);
+  ASSERT_TRUE(thread_stats);
+  EXPECT_GT(thread_stats->universe_data, 0u);
+  EXPECT_GT(thread_stats->sources_lost, 0u);
+  EXPECT_GT(thread_stats->status_lists, 0u);
+  EXPECT_EQ(GetThreadMemoryStats(running->num_threads).error_code(), kEtcPalErrInvalid);
+
+  // The pools keep their capacity after shutdown, but nothing is left in use.
+  receiver.Shutdown();
+
+  auto after = GetMemoryStats();
+  ASSERT_TRUE(after);
+  EXPECT_EQ(after->receiver.pool_in_use, baseline->receiver.pool_in_use);
+  EXPECT_EQ(after->receiver.rb_nodes_in_use, baseline->receiver.rb_nodes_in_use);
+  EXPECT_GE(after->receiver.pool_capacity, running->receiver.pool_in_use);
+}
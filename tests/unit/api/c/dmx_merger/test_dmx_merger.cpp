@@ -639,6 +639,30 @@ TEST_F(TestDmxMerger, AddSourceWorks)
             0);
 }
 
+TEST_F(TestDmxMerger, AddSourceWithHandleLooksUpCollidingHandles)
+{
+  EXPECT_EQ(sacn_dmx_merger_create(&merger_config_, &merger_handle_), kEtcPalErrOk);
+
+  // Merge receivers add sources under their remote source handles, which can share their low bits.
+  static constexpr std::array<sacn_dmx_merger_source_t, 3> kHandles = {5u, 8197u, 16389u};
+  for (sacn_dmx_merger_source_t handle : kHandles)
+    EXPECT_EQ(add_sacn_dmx_merger_source_with_handle(merger_handle_, handle), kEtcPalErrOk);
+
+  for (sacn_dmx_merger_source_t handle : kHandles)
+  {
+    MergerState* merger_state = nullptr;
+    SourceState* source_state = nullptr;
+    EXPECT_EQ(lookup_state(merger_handle_, handle, &merger_state, &source_state), kEtcPalErrOk);
+    ASSERT_NE(source_state, nullptr);
+    EXPECT_EQ(source_state->handle, handle);
+  }
+
+  EXPECT_EQ(sacn_dmx_merger_remove_source(merger_handle_, kHandles[0]), kEtcPalErrOk);
+  EXPECT_EQ(sacn_dmx_merger_get_source(merger_handle_, kHandles[0]), nullptr);
+  EXPECT_NE(sacn_dmx_merger_get_source(merger_handle_, kHandles[1]), nullptr);
+  EXPECT_NE(sacn_dmx_merger_get_source(merger_handle_, kHandles[2]), nullptr);
+}
+
 TEST_F(TestDmxMerger, AddSourceErrInvalidWorks)
 {
   // Initialize a merger.
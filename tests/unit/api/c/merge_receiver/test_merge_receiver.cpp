@@ -301,11 +301,7 @@ TEST_F(TestMergeReceiver, CreateWorks)
 
   EXPECT_EQ(handle, kTestHandle);
   EXPECT_EQ(create_sacn_receiver_fake.call_count, 1u);
-#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
-  EXPECT_EQ(create_sacn_dmx_merger_fake.call_count, 2u);
-#else
-  EXPECT_EQ(create_sacn_dmx_merger_fake.call_count, 1u);
-#endif
+  EXPECT_EQ(create_sacn_dmx_merger_fake.call_count, 1u);  // The sampling merger is only created once it's needed.
 
   SacnMergeReceiver* merge_receiver = nullptr;
   ASSERT_EQ(lookup_merge_receiver(handle, &merge_receiver), kEtcPalErrOk);
@@ -796,6 +792,37 @@ TEST_F(TestMergeReceiver, UniverseDataHandlesSamplingPeriodSources)
   EXPECT_EQ(update_sacn_dmx_merger_levels_fake.call_count, 5u);
   EXPECT_EQ(universe_data_fake.call_count, 4u);
 }
+
+TEST_F(TestMergeReceiver, SamplingMergerOnlyExistsWhileSourcesAreSampling)
+{
+  static constexpr sacn_dmx_merger_t kSamplingMergerHandle = kInitialMergerHandle + 1;
+
+  sacn_merge_receiver_t handle = kSacnMergeReceiverInvalid;
+  EXPECT_EQ(sacn_merge_receiver_create(&kTestConfig, &handle, nullptr), kEtcPalErrOk);
+  EXPECT_EQ(create_sacn_dmx_merger_fake.call_count, 1u);
+
+  RunSamplingStarted();
+  EXPECT_EQ(create_sacn_dmx_merger_fake.call_count, 1u);
+
+  // The first source of the sampling period creates the sampling merger, and later ones share it.
+  RunSamplingUniverseData(1u, etcpal::Uuid::V4(), kSacnStartcodeDmx, {0x01u, 0x02u});
+  EXPECT_EQ(create_sacn_dmx_merger_fake.call_count, 2u);
+  RunSamplingUniverseData(2u, etcpal::Uuid::V4(), kSacnStartcodeDmx, {0x01u, 0x02u});
+  EXPECT_EQ(create_sacn_dmx_merger_fake.call_count, 2u);
+
+  SacnMergeReceiver* merge_receiver = nullptr;
+  ASSERT_EQ(lookup_merge_receiver(handle, &merge_receiver), kEtcPalErrOk);
+  EXPECT_EQ(merge_receiver->sampling_merger_handle, kSamplingMergerHandle);
+
+  destroy_sacn_dmx_merger_fake.custom_fake = [](sacn_dmx_merger_t merger) {
+    EXPECT_EQ(merger, kSamplingMergerHandle);
+    return kEtcPalErrOk;
+  };
+
+  RunSamplingEnded();
+  EXPECT_EQ(destroy_sacn_dmx_merger_fake.call_count, 1u);
+  EXPECT_EQ(merge_receiver->sampling_merger_handle, kSacnDmxMergerInvalid);
+}
 #endif  // SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
 
 TEST_F(TestMergeReceiver, UniverseDataHandlesSourcesLost)
@@ -1217,11 +1244,7 @@ TEST_F(TestMergeReceiver, DirectsDmxMergerOutputCorrectly)
   static constexpr uint8_t              kPriority2       = 40u;
   static constexpr sacn_receiver_t      kReceiver2Handle = kTestHandle2;
 
-#if SACN_MERGE_RECEIVER_ENABLE_SAMPLING_MERGER
-  static constexpr sacn_dmx_merger_t kReceiver2MergerHandle = kInitialMergerHandle + 2;
-#else
   static constexpr sacn_dmx_merger_t kReceiver2MergerHandle = kInitialMergerHandle + 1;
-#endif
 
   sacn_merge_receiver_t receiver_1 = kSacnMergeReceiverInvalid;
   EXPECT_EQ(sacn_merge_receiver_create(&kTestConfig, &receiver_1, nullptr), kEtcPalErrOk);
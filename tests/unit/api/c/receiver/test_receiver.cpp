@@ -146,6 +146,20 @@ TEST_F(TestReceiver, SetExpiredWaitWorks)
   // EXPECT_EQ(sacn_receiver_get_expired_wait(), std::numeric_limits<uint32_t>::max());
 }
 
+TEST_F(TestReceiver, GetNumDiscardedPacketsWorks)
+{
+  RESET_FAKE(get_num_discarded_packets);
+  get_num_discarded_packets_fake.return_val = 1234u;
+
+  EXPECT_EQ(sacn_receiver_get_num_discarded_packets(), 1234u);
+  EXPECT_EQ(get_num_discarded_packets_fake.call_count, 1u);
+  EXPECT_EQ(sacn_receiver_lock_fake.call_count, sacn_receiver_unlock_fake.call_count);
+
+  sacn_initialized_fake.return_val = false;
+  EXPECT_EQ(sacn_receiver_get_num_discarded_packets(), 0u);
+  EXPECT_EQ(get_num_discarded_packets_fake.call_count, 1u);
+}
+
 TEST_F(TestReceiver, ChangeUniverseV4Works)
 {
   // TODO: Refactor into test_receiver_state
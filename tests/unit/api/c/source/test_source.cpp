@@ -1509,6 +1509,196 @@ TEST_F(TestSource, SourceUpdateValuesAndPapAndForceSyncHandlesNotFound)
   EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 1u);
 }
 
+TEST_F(TestSource, SourceUpdateUniversesWorks)
+{
+  static std::vector<uint16_t> updated_universes;
+  updated_universes.clear();
+
+  SetUpSource(kTestHandle);
+
+  SacnSourceUniverseConfig universe_config = SACN_SOURCE_UNIVERSE_CONFIG_DEFAULT_INIT;
+  SacnNetintConfig         netint_config   = SACN_NETINT_CONFIG_DEFAULT_INIT;
+  netint_config.netints                    = test_netints.data();
+  netint_config.num_netints                = test_netints.size();
+  for (uint16_t universe = 1u; universe <= 10u; ++universe)
+  {
+    universe_config.universe = universe;
+    EXPECT_EQ(sacn_source_add_universe(kTestHandle, &universe_config, &netint_config), kEtcPalErrOk);
+  }
+
+  update_levels_and_or_pap_fake.custom_fake =
+      [](SacnSource* source, SacnSourceUniverse* universe, const uint8_t* new_levels, size_t new_levels_size,
+         const uint8_t* new_priorities, size_t new_priorities_size, sacn_force_sync_behavior_t force_sync) {
+        EXPECT_EQ(source->handle, kTestHandle);
+        EXPECT_EQ(new_levels, kTestBuffer.data());
+        EXPECT_EQ(new_levels_size, kTestBuffer.size());
+        EXPECT_EQ(new_priorities, (universe->universe_id == 4u) ? kTestBuffer2.data() : nullptr);
+        EXPECT_EQ(new_priorities_size, (universe->universe_id == 4u) ? kTestBuffer2.size() : 0u);
+        EXPECT_EQ(force_sync, kDisableForceSync);
+        updated_universes.push_back(universe->universe_id);
+      };
+
+  // Sorted runs, a universe that isn't on the source, one that's out of order, and one with an invalid size.
+  const std::vector<SacnSourceUniverseUpdate> updates = {
+      {2u, kTestBuffer.data(), kTestBuffer.size(), nullptr, 0u},
+      {4u, kTestBuffer.data(), kTestBuffer.size(), kTestBuffer2.data(), kTestBuffer2.size()},
+      {11u, kTestBuffer.data(), kTestBuffer.size(), nullptr, 0u},
+      {3u, kTestBuffer.data(), kTestBuffer.size(), nullptr, 0u},
+      {9u, kTestBuffer.data(), kTestBuffer.size(), nullptr, 0u},
+      {10u, kTestBuffer.data(), kSacnDmxAddressCount + 1u, nullptr, 0u},
+      {10u, kTestBuffer.data(), kTestBuffer.size(), nullptr, 0u},
+  };
+
+  unsigned int previous_lock_count = sacn_source_lock_fake.call_count;
+  VERIFY_LOCKING(sacn_source_update_universes(kTestHandle, updates.data(), updates.size()));
+  EXPECT_EQ(sacn_source_lock_fake.call_count, previous_lock_count + 1u);  // The whole batch is applied under one lock
+  EXPECT_EQ(updated_universes, std::vector<uint16_t>({2u, 4u, 3u, 9u, 10u}));
+}
+
+TEST_F(TestSource, SourceUpdateUniversesHandlesNotFound)
+{
+  const std::vector<SacnSourceUniverseUpdate> updates = {
+      {kTestUniverse, kTestBuffer.data(), kTestBuffer.size(), nullptr, 0u}};
+
+  VERIFY_LOCKING(sacn_source_update_universes(kTestHandle, updates.data(), updates.size()));
+  EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 0u);
+
+  SetUpSource(kTestHandle);
+
+  VERIFY_LOCKING(sacn_source_update_universes(kTestHandle, updates.data(), updates.size()));
+  EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 0u);
+
+  VERIFY_NO_LOCKING(sacn_source_update_universes(kTestHandle, nullptr, updates.size()));
+  VERIFY_NO_LOCKING(sacn_source_update_universes(kTestHandle, updates.data(), 0u));
+}
+
+TEST_F(TestSource, SourceUpdateUniverseByHandleWorks)
+{
+  SetUpSourceAndUniverse(kTestHandle, kTestUniverse);
+
+  sacn_source_universe_t universe_handle = kSacnSourceUniverseInvalid;
+  VERIFY_LOCKING(universe_handle = sacn_source_get_universe_handle(kTestHandle, kTestUniverse));
+  EXPECT_NE(universe_handle, kSacnSourceUniverseInvalid);
+  EXPECT_EQ(sacn_source_get_universe_handle(kTestHandle, kTestUniverse2), kSacnSourceUniverseInvalid);
+  EXPECT_EQ(sacn_source_get_universe_handle(kTestHandle2, kTestUniverse), kSacnSourceUniverseInvalid);
+
+  update_levels_and_or_pap_fake.custom_fake =
+      [](SacnSource* source, SacnSourceUniverse* universe, const uint8_t* new_levels, size_t new_levels_size,
+         const uint8_t* new_priorities, size_t new_priorities_size, sacn_force_sync_behavior_t force_sync) {
+        EXPECT_EQ(source->handle, kTestHandle);
+        EXPECT_EQ(universe->universe_id, kTestUniverse);
+        EXPECT_EQ(new_levels, kTestBuffer.data());
+        EXPECT_EQ(new_levels_size, kTestBuffer.size());
+        EXPECT_EQ(new_priorities, kTestBuffer2.data());
+        EXPECT_EQ(new_priorities_size, kTestBuffer2.size());
+        EXPECT_EQ(force_sync, kDisableForceSync);
+      };
+
+  VERIFY_LOCKING(sacn_source_update_universe(kTestHandle, universe_handle, kTestBuffer.data(), kTestBuffer.size(),
+                                             kTestBuffer2.data(), kTestBuffer2.size()));
+  EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 1u);
+
+  // Handles don't work with other sources, or with universes being removed.
+  SetUpSource(kTestHandle2);
+  sacn_source_update_universe(kTestHandle2, universe_handle, kTestBuffer.data(), kTestBuffer.size(),
+                              kTestBuffer2.data(), kTestBuffer2.size());
+  EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 1u);
+
+  GetUniverse(kTestHandle, kTestUniverse)->termination_state = kTerminatingAndRemoving;
+  EXPECT_EQ(sacn_source_get_universe_handle(kTestHandle, kTestUniverse), kSacnSourceUniverseInvalid);
+  sacn_source_update_universe(kTestHandle, universe_handle, kTestBuffer.data(), kTestBuffer.size(),
+                              kTestBuffer2.data(), kTestBuffer2.size());
+  EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 1u);
+
+  VERIFY_NO_LOCKING(sacn_source_update_universe(kTestHandle, kSacnSourceUniverseInvalid, kTestBuffer.data(),
+                                                kTestBuffer.size(), nullptr, 0u));
+}
+
+TEST_F(TestSource, SourceBeginAndCommitLevelsWorks)
+{
+  SetUpSourceAndUniverse(kTestHandle, kTestUniverse);
+
+  update_levels_and_or_pap_fake.custom_fake =
+      [](SacnSource* source, SacnSourceUniverse* universe, const uint8_t* new_levels, size_t new_levels_size,
+         const uint8_t* new_priorities, size_t new_priorities_size, sacn_force_sync_behavior_t force_sync) {
+        EXPECT_EQ(source->handle, kTestHandle);
+        EXPECT_EQ(universe->universe_id, kTestUniverse);
+        EXPECT_EQ(new_levels, &universe->level_send_buf[SACN_DATA_HEADER_SIZE]);
+        EXPECT_EQ(memcmp(new_levels, kTestBuffer.data(), kTestBuffer.size()), 0);
+        EXPECT_EQ(new_levels_size, kTestBuffer.size());
+        EXPECT_EQ(new_priorities, nullptr);
+        EXPECT_EQ(new_priorities_size, 0u);
+        EXPECT_EQ(force_sync, kDisableForceSync);
+      };
+
+  // The levels are written straight into the outgoing packet, which isn't sent until they are committed.
+  SacnSourceUniverse* universe_state = GetUniverse(kTestHandle, kTestUniverse);
+  memcpy(&universe_state->level_send_buf[SACN_DATA_HEADER_SIZE], kTestBuffer2.data(), kTestBuffer2.size());
+
+  uint8_t* levels = nullptr;
+  VERIFY_LOCKING(levels = sacn_source_begin_levels(kTestHandle, kTestUniverse));
+  ASSERT_NE(levels, nullptr);
+  EXPECT_EQ(levels, &universe_state->level_send_buf[SACN_DATA_HEADER_SIZE]);
+  EXPECT_TRUE(universe_state->levels_leased);
+
+  // Only one writer can have the levels at a time.
+  VERIFY_LOCKING_AND_RETURN_VALUE(sacn_source_begin_levels(kTestHandle, kTestUniverse), nullptr);
+
+  memcpy(levels, kTestBuffer.data(), kTestBuffer.size());
+  VERIFY_LOCKING(sacn_source_commit_levels(kTestHandle, kTestUniverse, kTestBuffer.size()));
+
+  EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 1u);
+}
+
+TEST_F(TestSource, SourceApiCanBeCalledBetweenBeginAndCommitLevels)
+{
+  SetUpSourceAndUniverse(kTestHandle, kTestUniverse);
+
+  uint8_t* levels = nullptr;
+  VERIFY_LOCKING(levels = sacn_source_begin_levels(kTestHandle, kTestUniverse));
+  ASSERT_NE(levels, nullptr);
+
+  // The source lock isn't held while the levels are written, so other calls can take it.
+  VERIFY_LOCKING(sacn_source_change_priority(kTestHandle, kTestUniverse, kTestPriority));
+  VERIFY_LOCKING(sacn_source_send_now(kTestHandle, kTestUniverse, kTestStartCode, kTestBuffer2.data(),
+                                      kTestBuffer2.size()));
+  EXPECT_EQ(set_universe_priority_fake.call_count, 1u);
+
+  memcpy(levels, kTestBuffer.data(), kTestBuffer.size());
+  VERIFY_LOCKING(sacn_source_commit_levels(kTestHandle, kTestUniverse, kTestBuffer.size()));
+
+  EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 1u);
+  EXPECT_EQ(update_levels_and_or_pap_fake.arg2_val, levels);
+}
+
+TEST_F(TestSource, SourceBeginLevelsHandlesNotFound)
+{
+  uint8_t* levels = nullptr;
+  VERIFY_LOCKING(levels = sacn_source_begin_levels(kTestHandle, kTestUniverse));
+  EXPECT_EQ(levels, nullptr);
+
+  SetUpSourceAndUniverse(kTestHandle, kTestUniverse);
+  GetUniverse(kTestHandle, kTestUniverse)->termination_state = kTerminatingAndRemoving;
+
+  VERIFY_LOCKING(levels = sacn_source_begin_levels(kTestHandle, kTestUniverse));
+  EXPECT_EQ(levels, nullptr);
+}
+
+TEST_F(TestSource, SourceCommitLevelsHandlesInvalid)
+{
+  SetUpSourceAndUniverse(kTestHandle, kTestUniverse);
+
+  ASSERT_NE(sacn_source_begin_levels(kTestHandle, kTestUniverse), nullptr);
+  VERIFY_NO_LOCKING(sacn_source_commit_levels(kTestHandle, kTestUniverse, kSacnDmxAddressCount + 1u));
+  VERIFY_NO_LOCKING(sacn_source_commit_levels(kTestHandle, kTestUniverse, 0u));
+
+  // The universe may have been removed after the levels were handed out.
+  GetUniverse(kTestHandle, kTestUniverse)->termination_state = kTerminatingAndRemoving;
+  VERIFY_LOCKING(sacn_source_commit_levels(kTestHandle, kTestUniverse, kTestBuffer.size()));
+
+  EXPECT_EQ(update_levels_and_or_pap_fake.call_count, 0u);
+}
+
 TEST_F(TestSource, SourceProcessManualWorks)
 {
   take_lock_and_process_sources_fake.custom_fake = [](sacn_process_sources_behavior_t behavior,
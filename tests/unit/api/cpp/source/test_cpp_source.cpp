@@ -591,6 +591,87 @@ TEST_F(TestSource, UpdateValuesAndPapAndForceSyncWorks)
   EXPECT_EQ(sacn_source_update_levels_and_pap_and_force_sync_fake.call_count, 1u);
 }
 
+TEST_F(TestSource, UpdateUniversesWorks)
+{
+  static const SacnSourceUniverseUpdate kTestUpdates[] = {
+      {kTestUniverse, kTestBuffer.data(), kTestBuffer.size(), kTestBuffer2.data(), kTestBuffer2.size()}};
+
+  sacn_source_update_universes_fake.custom_fake = [](sacn_source_t handle, const SacnSourceUniverseUpdate* updates,
+                                                     size_t num_updates) {
+    EXPECT_EQ(handle, kTestHandle);
+    EXPECT_EQ(updates, kTestUpdates);
+    EXPECT_EQ(num_updates, 1u);
+  };
+
+  sacn::Source source;
+  source.Startup(sacn::Source::Settings(kTestLocalCid, kTestLocalName));
+
+  source.UpdateUniverses(kTestUpdates, 1u);
+  EXPECT_EQ(sacn_source_update_universes_fake.call_count, 1u);
+}
+
+TEST_F(TestSource, GetUniverseHandleWorks)
+{
+  static constexpr sacn_source_universe_t kTestUniverseHandle = 0x10002u;
+
+  sacn_source_get_universe_handle_fake.custom_fake = [](sacn_source_t handle, uint16_t universe) {
+    EXPECT_EQ(handle, kTestHandle);
+    EXPECT_EQ(universe, kTestUniverse);
+    return kTestUniverseHandle;
+  };
+
+  sacn::Source source;
+  source.Startup(sacn::Source::Settings(kTestLocalCid, kTestLocalName));
+
+  EXPECT_EQ(source.GetUniverseHandle(kTestUniverse), kTestUniverseHandle);
+  EXPECT_EQ(sacn_source_get_universe_handle_fake.call_count, 1u);
+}
+
+TEST_F(TestSource, UpdateUniverseWorks)
+{
+  static constexpr sacn_source_universe_t kTestUniverseHandle = 0x10002u;
+
+  sacn_source_update_universe_fake.custom_fake = [](sacn_source_t handle, sacn_source_universe_t universe_handle,
+                                                    const uint8_t* new_levels, size_t new_levels_size,
+                                                    const uint8_t* new_priorities, size_t new_priorities_size) {
+    EXPECT_EQ(handle, kTestHandle);
+    EXPECT_EQ(universe_handle, kTestUniverseHandle);
+    EXPECT_EQ(new_levels, kTestBuffer.data());
+    EXPECT_EQ(new_levels_size, kTestBuffer.size());
+    EXPECT_EQ(new_priorities, kTestBuffer2.data());
+    EXPECT_EQ(new_priorities_size, kTestBuffer2.size());
+  };
+
+  sacn::Source source;
+  source.Startup(sacn::Source::Settings(kTestLocalCid, kTestLocalName));
+
+  source.UpdateUniverse(kTestUniverseHandle, kTestBuffer.data(), kTestBuffer.size(), kTestBuffer2.data(),
+                        kTestBuffer2.size());
+  EXPECT_EQ(sacn_source_update_universe_fake.call_count, 1u);
+}
+
+TEST_F(TestSource, BeginAndCommitLevelsWork)
+{
+  static uint8_t test_levels[kSacnDmxAddressCount] = {0};
+
+  sacn_source_begin_levels_fake.custom_fake = [](sacn_source_t, uint16_t universe) {
+    EXPECT_EQ(universe, kTestUniverse);
+    return test_levels;
+  };
+  sacn_source_commit_levels_fake.custom_fake = [](sacn_source_t, uint16_t universe, size_t new_levels_size) {
+    EXPECT_EQ(universe, kTestUniverse);
+    EXPECT_EQ(new_levels_size, kTestBuffer.size());
+  };
+
+  sacn::Source source;
+  source.Startup(sacn::Source::Settings(kTestLocalCid, kTestLocalName));
+
+  EXPECT_EQ(source.BeginLevels(kTestUniverse), test_levels);
+  source.CommitLevels(kTestUniverse, kTestBuffer.size());
+  EXPECT_EQ(sacn_source_begin_levels_fake.call_count, 1u);
+  EXPECT_EQ(sacn_source_commit_levels_fake.call_count, 1u);
+}
+
 TEST_F(TestSource, ProcessManualWorks)
 {
   sacn::Source source;
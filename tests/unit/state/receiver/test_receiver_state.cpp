@@ -19,10 +19,13 @@
 
 #include "sacn/private/receiver_state.h"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <gsl/span>
 #include <limits>
 #include <optional>
+#include <string>
 #include "etcpal/cpp/inet.h"
 #include "etcpal/cpp/uuid.h"
 #include "etcpal_mock/common.h"
@@ -34,6 +37,7 @@
 #include "sacn/private/mem.h"
 #include "sacn/opts.h"
 #include "sacn/private/pdu.h"
+#include "sacn/private/util.h"
 #include "gtest/gtest.h"
 #include "etc_fff_wrapper.h"
 
@@ -299,7 +303,9 @@ protected:
 
     begin_sampling_period(test_receiver_);
 
-    seq_num_ = 0u;
+    seq_num_           = 0u;
+    test_timestamp_ns_ = 0u;
+    test_data_mcast_   = true;
 
     test_data_.fill(0u);
   }
@@ -336,10 +342,12 @@ protected:
     test_data_netint_              = netint;
 
     sacn_read_fake.custom_fake = [](SacnRecvThreadContext*, SacnReadResult* read_result) {
-      read_result->from_addr = kTestSockAddr;
-      read_result->data      = test_data_.data();
-      read_result->data_len  = kSacnMtu;
-      read_result->netint    = test_data_netint_;
+      read_result->from_addr             = kTestSockAddr;
+      read_result->data                  = test_data_.data();
+      read_result->data_len              = kSacnMtu;
+      read_result->netint                = test_data_netint_;
+      read_result->timestamp_ns          = test_timestamp_ns_;
+      read_result->copied_to_all_threads = test_data_mcast_;
       return kEtcPalErrOk;
     };
   }
@@ -424,11 +432,15 @@ protected:
   static uint8_t                       seq_num_;
   static std::array<uint8_t, kSacnMtu> test_data_;
   static EtcPalMcastNetintId           test_data_netint_;
+  static uint64_t                      test_timestamp_ns_;
+  static bool                          test_data_mcast_;
 };
 
-uint8_t                       TestReceiverThread::seq_num_          = 0u;
-std::array<uint8_t, kSacnMtu> TestReceiverThread::test_data_        = {};
-EtcPalMcastNetintId           TestReceiverThread::test_data_netint_ = test_netints[0].iface;
+uint8_t                       TestReceiverThread::seq_num_           = 0u;
+std::array<uint8_t, kSacnMtu> TestReceiverThread::test_data_         = {};
+EtcPalMcastNetintId           TestReceiverThread::test_data_netint_  = test_netints[0].iface;
+uint64_t                      TestReceiverThread::test_timestamp_ns_ = 0u;
+bool                          TestReceiverThread::test_data_mcast_   = true;
 
 TEST_F(TestReceiverState, RespectsMaxReceiverLimit)
 {
@@ -1334,6 +1346,223 @@ TEST_F(TestReceiverThread, UniverseDataFiltersUnknownUniverses)
   }
 }
 
+TEST_F(TestReceiverThread, UnknownUniversesAreDiscardedBeforeParsing)
+{
+  InitTestData(kSacnStartcodeDmx, kTestUniverse + 1u, kTestBuffer.data(), kTestBuffer.size());
+  RunThreadCycle();
+  EXPECT_EQ(get_num_discarded_packets(), 1u);
+  EXPECT_EQ(universe_data_fake.call_count, 0u);
+
+  InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size());
+  RunThreadCycle();
+  EXPECT_EQ(get_num_discarded_packets(), 1u);
+  EXPECT_EQ(universe_data_fake.call_count, 1u);
+
+  // The early check follows the receiver to its new universe.
+  EXPECT_EQ(update_receiver_universe(test_receiver_, kTestUniverse + 1u), kEtcPalErrOk);
+  EXPECT_TRUE(receiver_universe_subscribed(kTestUniverse + 1u));
+  EXPECT_FALSE(receiver_universe_subscribed(kTestUniverse));
+
+  RunThreadCycle();
+  EXPECT_EQ(get_num_discarded_packets(), 2u);
+  EXPECT_EQ(universe_data_fake.call_count, 1u);
+}
+
+TEST_F(TestReceiverThread, OnlyTheOwningThreadProcessesMulticastCopies)
+{
+  InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size());
+  RunThreadCycle();
+  EXPECT_EQ(universe_data_fake.call_count, 1u);
+  EXPECT_EQ(test_receiver_->load.window_packets, 1u);
+
+  // This thread's copy of a multicast packet for another thread's universe is ignored.
+  set_receiver_universe_thread(kTestUniverse, test_receiver_->thread_id + 1u);
+  RunThreadCycle();
+  EXPECT_EQ(universe_data_fake.call_count, 1u);
+  EXPECT_EQ(test_receiver_->load.window_packets, 1u);
+  EXPECT_EQ(get_num_discarded_packets(), 0u);
+
+  // Unicast only reaches one thread's socket, so it's processed wherever it arrives.
+  test_data_mcast_ = false;
+  RunThreadCycle();
+  EXPECT_EQ(universe_data_fake.call_count, 2u);
+  EXPECT_EQ(test_receiver_->load.window_packets, 2u);
+
+  // The owning thread always processes it.
+  test_data_mcast_ = true;
+  set_receiver_universe_thread(kTestUniverse, test_receiver_->thread_id);
+  RunThreadCycle();
+  EXPECT_EQ(universe_data_fake.call_count, 3u);
+  EXPECT_EQ(test_receiver_->load.window_packets, 3u);
+}
+
+TEST_F(TestReceiverThread, TracksReceiveLoadPerReceiver)
+{
+  SacnRecvThreadContext* context = get_recv_thread_context(0u);
+
+  InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size());
+  for (int i = 0; i < 3; ++i)
+    RunThreadCycle();
+  EXPECT_EQ(test_receiver_->load.window_packets, 3u);
+
+  // The first periodic pass starts the stats window.
+  etcpal_getms_fake.return_val += (kSacnPeriodicInterval + 1u);
+  RunThreadCycle();
+  EXPECT_EQ(test_receiver_->load.window_packets, 4u);
+  EXPECT_EQ(test_receiver_->load.packets_per_sec, 0u);
+
+  // Packets for other universes don't count against the receiver.
+  InitTestData(kSacnStartcodeDmx, kTestUniverse + 1u, kTestBuffer.data(), kTestBuffer.size());
+  RunThreadCycle();
+  EXPECT_EQ(test_receiver_->load.window_packets, 4u);
+
+  InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size());
+  etcpal_getms_fake.return_val += kSacnLoadStatsInterval;
+  RunThreadCycle();
+  EXPECT_EQ(test_receiver_->load.window_packets, 0u);
+  EXPECT_EQ(test_receiver_->load.window_processing_us, 0u);
+  EXPECT_EQ(test_receiver_->load.packets_per_sec, 5u);
+  EXPECT_EQ(context->load.packets_per_sec, 5u);
+  EXPECT_EQ(context->load.processing_us_per_sec, test_receiver_->load.processing_us_per_sec);
+}
+
+#if SACN_RECEIVER_ENABLE_LOAD_BALANCING && (SACN_RECEIVER_MAX_THREADS > 1)
+class TestReceiverLoadBalancing : public TestReceiverState
+{
+protected:
+  void SetUp() override
+  {
+    TestReceiverState::SetUp();
+
+    // Restart with two receive threads. Receivers alternate between them as they're added.
+    sacn_receiver_state_deinit();
+    sacn_receiver_mem_deinit();
+    ASSERT_EQ(sacn_receiver_mem_init(2), kEtcPalErrOk);
+    ASSERT_EQ(sacn_receiver_state_init(), kEtcPalErrOk);
+
+    busy_receiver_  = AddReceiver(kTestUniverse);
+    idle_receiver_  = AddReceiver(kTestUniverse + 1u);
+    light_receiver_ = AddReceiver(kTestUniverse + 2u);
+    ASSERT_NE(busy_receiver_, nullptr);
+    ASSERT_NE(idle_receiver_, nullptr);
+    ASSERT_NE(light_receiver_, nullptr);
+    ASSERT_EQ(busy_receiver_->thread_id, 0u);
+    ASSERT_EQ(idle_receiver_->thread_id, 1u);
+    ASSERT_EQ(light_receiver_->thread_id, 0u);
+  }
+
+  // Runs thread 0 through one stats window in which its receivers spent the given time processing packets.
+  void RunLoadWindow(uint32_t busy_us, uint32_t light_us)
+  {
+    SacnRecvThreadContext* context = get_recv_thread_context(0u);
+
+    read_network_and_process(context);
+    etcpal_getms_fake.return_val += (kSacnPeriodicInterval + 1u);
+    read_network_and_process(context);  // Starts the stats window.
+
+    busy_receiver_->load.window_processing_us  = busy_us;
+    light_receiver_->load.window_processing_us = light_us;
+
+    etcpal_getms_fake.return_val += kSacnLoadStatsInterval;
+    read_network_and_process(context);
+  }
+
+  static bool InThreadList(const SacnRecvThreadContext* context, const SacnReceiver* receiver)
+  {
+    for (const SacnReceiver* entry = context->receivers; entry; entry = entry->next)
+    {
+      if (entry == receiver)
+        return true;
+    }
+    return false;
+  }
+
+  SacnReceiver* busy_receiver_{nullptr};
+  SacnReceiver* idle_receiver_{nullptr};
+  SacnReceiver* light_receiver_{nullptr};
+};
+
+TEST_F(TestReceiverLoadBalancing, MovesReceiverToLeastBusyThread)
+{
+  RunLoadWindow(30000u, 5000u);
+
+  EXPECT_EQ(busy_receiver_->thread_id, 1u);
+  EXPECT_TRUE(InThreadList(get_recv_thread_context(1u), busy_receiver_));
+  EXPECT_FALSE(InThreadList(get_recv_thread_context(0u), busy_receiver_));
+  EXPECT_EQ(get_recv_thread_context(0u)->load.processing_us_per_sec, 5000u);
+  EXPECT_EQ(get_recv_thread_context(1u)->load.processing_us_per_sec, 30000u);
+}
+
+TEST_F(TestReceiverLoadBalancing, RollsBackWhenMoveFails)
+{
+  // Thread 1 can't take any more sockets.
+  sacn_add_receiver_socket_fake.custom_fake = [](sacn_thread_id_t thread_id, etcpal_iptype_t, uint16_t,
+                                                 const EtcPalMcastNetintId*, size_t, etcpal_socket_t* socket) {
+    if (thread_id == 1u)
+      return kEtcPalErrNoMem;
+
+    WriteNextSocket(socket);
+    return kEtcPalErrOk;
+  };
+
+  RunLoadWindow(30000u, 5000u);
+
+  // The receiver is back on its original thread, and neither thread's load was moved.
+  EXPECT_EQ(busy_receiver_->thread_id, 0u);
+  EXPECT_TRUE(InThreadList(get_recv_thread_context(0u), busy_receiver_));
+  EXPECT_FALSE(InThreadList(get_recv_thread_context(1u), busy_receiver_));
+  EXPECT_EQ(get_recv_thread_context(0u)->num_receivers, 2u);
+  EXPECT_EQ(get_recv_thread_context(1u)->num_receivers, 1u);
+  EXPECT_EQ(get_recv_thread_context(0u)->load.processing_us_per_sec, 35000u);
+  EXPECT_EQ(get_recv_thread_context(1u)->load.processing_us_per_sec, 0u);
+}
+#endif  // SACN_RECEIVER_ENABLE_LOAD_BALANCING && (SACN_RECEIVER_MAX_THREADS > 1)
+
+TEST_F(TestReceiverThread, UniverseDataCarriesTimestamp)
+{
+  universe_data_fake.custom_fake = [](sacn_receiver_t, const EtcPalSockAddr*, const SacnRemoteSource*,
+                                      const SacnRecvUniverseData* universe_data, void*) {
+    EXPECT_EQ(universe_data->timestamp_ns, 123456789u);
+  };
+
+  test_timestamp_ns_ = 123456789u;
+  InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size());
+
+  RunThreadCycle();
+  EXPECT_EQ(universe_data_fake.call_count, 1u);
+}
+
+#if SACN_RECEIVER_ENABLE_TIMESTAMPS
+TEST_F(TestReceiverThread, TracksSourceJitterAndLatency)
+{
+  // DMX packets 20 ms, 20 ms and then 10 ms apart, which arrived a second ago.
+  const uint64_t                first_arrival_ns = sacn_get_receive_time_ns() - 1000000000u;
+  const std::array<uint64_t, 4> arrival_ms       = {0u, 20u, 40u, 50u};
+  InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size());
+  for (uint64_t ms : arrival_ms)
+  {
+    test_timestamp_ns_ = first_arrival_ns + (ms * 1000000u);
+    RunThreadCycle();
+  }
+
+  EtcPalRbIter iter;
+  etcpal_rbiter_init(&iter);
+  const auto* src = reinterpret_cast<SacnTrackedSource*>(etcpal_rbiter_first(&iter, &test_receiver_->sources));
+  ASSERT_NE(src, nullptr);
+
+  // The interval didn't change, and then changed by 10 ms.
+  EXPECT_EQ(src->timing.jitter.count, 2u);
+  EXPECT_EQ(src->timing.jitter.buckets[0], 1u);
+  EXPECT_EQ(src->timing.jitter.buckets[14], 1u);  // [8192, 16384) us
+  EXPECT_EQ(src->timing.jitter.max_us, 10000u);
+
+  // Latency is credited with the thread's next packet, so the last packet's is still pending.
+  EXPECT_EQ(src->timing.latency.count, 3u);
+  EXPECT_EQ(src->timing.latency.buckets[SACN_RECV_TIMING_HISTOGRAM_BUCKETS - 1], 3u);
+  EXPECT_GE(src->timing.latency.max_us, 1000000u);
+}
+#endif  // SACN_RECEIVER_ENABLE_TIMESTAMPS
+
 TEST_F(TestReceiverThread, PapNotifiesCorrectlyDuringSamplingPeriod)
 {
   universe_data_fake.custom_fake = [](sacn_receiver_t, const EtcPalSockAddr*, const SacnRemoteSource*,
@@ -1752,6 +1981,52 @@ TEST_F(TestReceiverThread, SourcesLostWorks)
   EXPECT_EQ(etcpal_rbtree_size(&test_receiver_->sources), 0u);
 }
 
+TEST_F(TestReceiverThread, SourcesPastTheInlineTableAreTracked)
+{
+  static constexpr size_t                    kNumSources = SACN_RECEIVER_INLINE_SOURCES + 2u;
+  static std::array<EtcPalUuid, kNumSources> source_cids;
+
+  for (size_t i = 0u; i < kNumSources; ++i)
+  {
+    source_cids.at(i) = etcpal::Uuid::V4().get();
+    InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size(), 0u, source_cids.at(i));
+    RunThreadCycle();
+  }
+
+  EXPECT_EQ(etcpal_rbtree_size(&test_receiver_->sources), kNumSources);
+  EXPECT_EQ(test_receiver_->inline_sources.num_sources, static_cast<size_t>(SACN_RECEIVER_INLINE_SOURCES));
+
+  // Packets from every source, including the ones that spilled over to the tree, should be delivered without the
+  // source being tracked again.
+  for (size_t i = 0u; i < kNumSources; ++i)
+  {
+    InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size(), 0u, source_cids.at(i));
+    RunThreadCycle();
+
+    const SacnTrackedSource* src = find_receiver_source(test_receiver_, GetHandle(source_cids.at(i)));
+    ASSERT_NE(src, nullptr);
+    EXPECT_EQ(src->handle, GetHandle(source_cids.at(i)));
+  }
+
+  EXPECT_EQ(universe_data_fake.call_count, 2u * kNumSources);
+  EXPECT_EQ(etcpal_rbtree_size(&test_receiver_->sources), kNumSources);
+
+  // Removing a source from the inline table lets a spilled source take its place.
+  sacn_remote_source_t removed_handle = test_receiver_->inline_sources.handles[0];
+  EXPECT_EQ(remove_receiver_source(test_receiver_, removed_handle), kEtcPalErrOk);
+  EXPECT_EQ(find_receiver_source(test_receiver_, removed_handle), nullptr);
+  for (const auto& cid : source_cids)
+  {
+    if (GetHandle(cid) != removed_handle)
+      EXPECT_NE(find_receiver_source(test_receiver_, GetHandle(cid)), nullptr);
+  }
+  EXPECT_EQ(test_receiver_->inline_sources.num_sources, static_cast<size_t>(SACN_RECEIVER_INLINE_SOURCES));
+
+  EXPECT_EQ(clear_receiver_sources(test_receiver_), kEtcPalErrOk);
+  EXPECT_EQ(test_receiver_->inline_sources.num_sources, 0u);
+  EXPECT_EQ(find_receiver_source(test_receiver_, GetHandle(source_cids.at(0))), nullptr);
+}
+
 TEST_F(TestReceiverThread, SamplingPeriodStartedWorks)
 {
   sampling_period_started_fake.custom_fake = [](sacn_receiver_t handle, uint16_t universe, void* context) {
@@ -2088,3 +2363,54 @@ TEST_F(TestReceiverThread, PapCreatesNoInternalSourcesAfterSamplingPeriod)
 }
 
 #endif  // SACN_ETC_PRIORITY_EXTENSION
+
+// Times the per-packet path for sources that are already being tracked, e.g. to compare layouts of SacnReceiver and
+// SacnTrackedSource. Not run by default - pass --gtest_also_run_disabled_tests and compare the recorded
+// ns_per_packet between builds of the same configuration.
+TEST_F(TestReceiverThread, DISABLED_BenchmarkKnownSourcePackets)
+{
+  static constexpr size_t kNumSources = std::min<size_t>(SACN_RECEIVER_MAX_SOURCES_PER_UNIVERSE, 8u);
+  static constexpr size_t kNumPackets = 1000000u;
+
+  static std::array<std::array<uint8_t, kSacnMtu>, kNumSources> packets;
+  static size_t                                                 next_packet = 0u;
+
+  for (size_t i = 0u; i < kNumSources; ++i)
+  {
+    InitTestData(kSacnStartcodeDmx, kTestUniverse, kTestBuffer.data(), kTestBuffer.size(), 0u,
+                 etcpal::Uuid::V4().get());
+    packets.at(i) = test_data_;
+  }
+
+  sacn_read_fake.custom_fake = [](SacnRecvThreadContext*, SacnReadResult* read_result) {
+    std::array<uint8_t, kSacnMtu>& packet = packets.at(next_packet);
+    next_packet                           = (next_packet + 1u) % kNumSources;
+    ++packet.at(SACN_SEQ_OFFSET);
+
+    read_result->from_addr             = kTestSockAddr;
+    read_result->data                  = packet.data();
+    read_result->data_len              = kSacnMtu;
+    read_result->netint                = test_netints[0].iface;
+    read_result->timestamp_ns          = 0u;
+    read_result->copied_to_all_threads = true;
+    return kEtcPalErrOk;
+  };
+
+  // Start tracking every source, then let the sampling period and the wait for PAP run out so that each packet is
+  // notified like it would be in a steady-state show.
+  for (size_t i = 0u; i < kNumSources; ++i)
+    read_network_and_process(get_recv_thread_context(0u));
+  etcpal_getms_fake.return_val += (std::max<uint32_t>(kSacnSampleTime, kSacnWaitForPriority) + 1u);
+  for (size_t i = 0u; i < kNumSources; ++i)
+    read_network_and_process(get_recv_thread_context(0u));
+  ASSERT_EQ(etcpal_rbtree_size(&test_receiver_->sources), kNumSources);
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kNumPackets; ++i)
+    read_network_and_process(get_recv_thread_context(0u));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(etcpal_rbtree_size(&test_receiver_->sources), kNumSources);
+  RecordProperty("ns_per_packet",
+                 std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / kNumPackets));
+}
@@ -36,6 +36,7 @@
 #include "sacn/private/mem.h"
 #include "sacn/opts.h"
 #include "sacn/private/pdu.h"
+#include "sacn/private/util.h"
 #include "gtest/gtest.h"
 #include "fff.h"
 
@@ -99,17 +100,18 @@ static constexpr uint8_t  kTestPriority    = 123u;
 static const std::string  kTestName        = "Test Name";
 
 // Some of the tests use these variables to communicate with their custom_fake lambdas.
-static unsigned int num_universe_discovery_sends = 0u;
-static unsigned int num_universe_data_sends      = 0u;
-static unsigned int num_level_multicast_sends    = 0u;
-static unsigned int num_pap_multicast_sends      = 0u;
-static unsigned int num_level_unicast_sends      = 0u;
-static unsigned int num_pap_unicast_sends        = 0u;
-static unsigned int num_invalid_sends            = 0u;
-static int          current_test_iteration       = 0;
-static int          current_remote_addr_index    = 0;
-static int          current_universe             = 0;
-static int          current_netint_index         = 0;
+static unsigned int  num_universe_discovery_sends = 0u;
+static unsigned int  num_universe_data_sends      = 0u;
+static unsigned int  num_level_multicast_sends    = 0u;
+static unsigned int  num_pap_multicast_sends      = 0u;
+static unsigned int  num_level_unicast_sends      = 0u;
+static unsigned int  num_pap_unicast_sends        = 0u;
+static unsigned int  num_invalid_sends            = 0u;
+static int           current_test_iteration       = 0;
+static int           current_remote_addr_index    = 0;
+static int           current_universe             = 0;
+static int           current_netint_index         = 0;
+static sacn_source_t current_source_handle        = kSacnSourceInvalid;
 
 class TestSourceState : public ::testing::Test
 {
@@ -447,6 +449,179 @@ TEST_F(TestSourceState, DeinitDoesNotJoinFailedThread)
   EXPECT_EQ(etcpal_thread_join_fake.call_count, 0u);
 }
 
+TEST_F(TestSourceState, DeinitJoinsEachTickThread)
+{
+  EXPECT_EQ(initialize_source_thread(), kEtcPalErrOk);
+  EXPECT_EQ(etcpal_thread_create_fake.call_count, static_cast<unsigned int>(SACN_SOURCE_TICK_THREADS));
+
+  sacn_source_state_deinit();
+
+  EXPECT_EQ(etcpal_thread_join_fake.call_count, static_cast<unsigned int>(SACN_SOURCE_TICK_THREADS));
+}
+
+TEST_F(TestSourceState, StartsConfiguredTickThreads)
+{
+  static constexpr unsigned int kTestStackSize = 0x10000u;
+
+  // Reinitialize with a threading configuration, as sacn_init_features_with_config() does.
+  sacn_source_state_deinit();
+
+  SacnThreadingConfig config             = SACN_THREADING_CONFIG_DEFAULT_INIT;
+  config.source_tick_threads.num_threads = SACN_SOURCE_MAX_TICK_THREADS + 1;
+  EXPECT_EQ(sacn_set_thread_configs(&config), kEtcPalErrInvalid);
+
+  config.source_tick_threads.num_threads = SACN_SOURCE_MAX_TICK_THREADS;
+  config.source_tick_threads.stack_size  = kTestStackSize;
+  ASSERT_EQ(sacn_set_thread_configs(&config), kEtcPalErrOk);
+  ASSERT_EQ(sacn_source_state_init(), kEtcPalErrOk);
+
+  etcpal_thread_create_fake.custom_fake = [](etcpal_thread_t*, const EtcPalThreadParams* params, void (*)(void*),
+                                             void*) {
+    EXPECT_EQ(params->stack_size, kTestStackSize);
+    return kEtcPalErrOk;
+  };
+
+  EXPECT_EQ(initialize_source_thread(), kEtcPalErrOk);
+  EXPECT_EQ(etcpal_thread_create_fake.call_count, static_cast<unsigned int>(SACN_SOURCE_MAX_TICK_THREADS));
+
+  sacn_source_state_deinit();
+  EXPECT_EQ(etcpal_thread_join_fake.call_count, static_cast<unsigned int>(SACN_SOURCE_MAX_TICK_THREADS));
+
+  sacn_reset_thread_configs();
+  ASSERT_EQ(sacn_source_state_init(), kEtcPalErrOk);
+}
+
+TEST_F(TestSourceState, UniversesAreSpreadEvenlyAcrossTickThreads)
+{
+  EXPECT_EQ(initialize_source_thread(), kEtcPalErrOk);
+
+  sacn_source_t source = AddSource(kTestSourceConfig);
+
+  SacnSourceUniverseConfig universe_config = kTestUniverseConfig;
+  for (int i = 0; i < (2 * SACN_SOURCE_TICK_THREADS); ++i)
+  {
+    AddUniverse(source, universe_config);
+    EXPECT_EQ(assign_universe_to_tick_thread(GetSource(source), GetUniverse(source, universe_config.universe)),
+              kEtcPalErrOk);
+    ++universe_config.universe;
+  }
+
+  std::vector<int> universes_per_thread(SACN_SOURCE_TICK_THREADS, 0);
+  for (size_t i = 0; i < GetSource(source)->num_universes; ++i)
+  {
+    const SacnSourceUniverse& universe = *SACN_SOURCE_UNIVERSE_AT(GetSource(source), i);
+    EXPECT_TRUE(universe.tick_thread_assigned);
+    ASSERT_LT(universe.tick_thread, static_cast<unsigned int>(SACN_SOURCE_TICK_THREADS));
+    ++universes_per_thread[universe.tick_thread];
+  }
+
+  for (int count : universes_per_thread)
+    EXPECT_EQ(count, 2);
+}
+
+#if SACN_SOURCE_MAX_TICK_THREADS > 1
+TEST_F(TestSourceState, TickThreadsProcessTheirShardsWithoutTheSourceLock)
+{
+  static constexpr unsigned int kNumTestTickThreads = 2u;
+  static constexpr int          kNumTestUniverses   = 4;
+
+  sacn_source_state_deinit();
+
+  SacnThreadingConfig config             = SACN_THREADING_CONFIG_DEFAULT_INIT;
+  config.source_tick_threads.num_threads = kNumTestTickThreads;
+  ASSERT_EQ(sacn_set_thread_configs(&config), kEtcPalErrOk);
+  ASSERT_EQ(sacn_source_state_init(), kEtcPalErrOk);
+  EXPECT_EQ(initialize_source_thread(), kEtcPalErrOk);
+
+  sacn_send_multicast_fake.custom_fake = [](uint16_t universe_id, sacn_ip_support_t, const uint8_t* send_buf,
+                                            const EtcPalMcastNetintId*) {
+    EXPECT_EQ(sacn_source_lock_fake.call_count, sacn_source_unlock_fake.call_count);
+    if (IS_UNIVERSE_DATA(send_buf))
+    {
+      // Each universe is sent by its own shard, which is processed without the source lock.
+      EXPECT_EQ(GetUniverse(current_source_handle, universe_id)->tick_thread,
+                static_cast<unsigned int>(current_test_iteration));
+      EXPECT_EQ(send_buf[SACN_SEQ_OFFSET], 0u);
+      EXPECT_EQ(memcmp(&send_buf[SACN_DATA_HEADER_SIZE], kTestBuffer.data(), kTestBuffer.size()), 0);
+      ++num_universe_data_sends;
+    }
+    return kEtcPalErrOk;
+  };
+
+  current_source_handle                    = AddSource(kTestSourceConfig);
+  SacnSourceUniverseConfig universe_config = kTestUniverseConfig;
+  for (int i = 0; i < kNumTestUniverses; ++i)
+  {
+    AddUniverse(current_source_handle, universe_config);
+    EXPECT_EQ(assign_universe_to_tick_thread(GetSource(current_source_handle),
+                                             GetUniverse(current_source_handle, universe_config.universe)),
+              kEtcPalErrOk);
+    InitTestData(current_source_handle, universe_config.universe, kTestBuffer);
+    ++universe_config.universe;
+  }
+
+  for (current_test_iteration = 0; current_test_iteration < static_cast<int>(kNumTestTickThreads);
+       ++current_test_iteration)
+  {
+    // Only the first thread takes the source lock, for the per-source work.
+    unsigned int initial_lock_count = sacn_source_lock_fake.call_count;
+    take_lock_and_process_tick_thread(static_cast<unsigned int>(current_test_iteration),
+                                      kSacnSourceTickModeProcessLevelsOnly);
+    EXPECT_EQ(sacn_source_lock_fake.call_count, sacn_source_unlock_fake.call_count);
+    if (current_test_iteration > 0)
+      EXPECT_EQ(sacn_source_lock_fake.call_count, initial_lock_count);
+  }
+
+  EXPECT_EQ(num_universe_data_sends, kNumTestUniverses * test_netints.size());
+  for (size_t i = 0; i < GetSource(current_source_handle)->num_universes; ++i)
+    EXPECT_EQ(SACN_SOURCE_UNIVERSE_AT(GetSource(current_source_handle), i)->next_seq_num, 1u);
+
+  sacn_source_state_deinit();
+  sacn_reset_thread_configs();
+  ASSERT_EQ(sacn_source_state_init(), kEtcPalErrOk);
+}
+
+TEST_F(TestSourceState, TickThreadsRemoveTheirTerminatedUniverses)
+{
+  static constexpr unsigned int kNumTestTickThreads = 2u;
+  static constexpr int          kNumTestUniverses   = 4;
+
+  sacn_source_state_deinit();
+
+  SacnThreadingConfig config             = SACN_THREADING_CONFIG_DEFAULT_INIT;
+  config.source_tick_threads.num_threads = kNumTestTickThreads;
+  ASSERT_EQ(sacn_set_thread_configs(&config), kEtcPalErrOk);
+  ASSERT_EQ(sacn_source_state_init(), kEtcPalErrOk);
+  EXPECT_EQ(initialize_source_thread(), kEtcPalErrOk);
+
+  sacn_source_t            source          = AddSource(kTestSourceConfig);
+  SacnSourceUniverseConfig universe_config = kTestUniverseConfig;
+  for (int i = 0; i < kNumTestUniverses; ++i)
+  {
+    AddUniverse(source, universe_config);
+    EXPECT_EQ(assign_universe_to_tick_thread(GetSource(source), GetUniverse(source, universe_config.universe)),
+              kEtcPalErrOk);
+    InitTestData(source, universe_config.universe, kTestBuffer);
+    set_universe_terminating(GetUniverse(source, universe_config.universe), kTerminateAndRemove);
+    ++universe_config.universe;
+  }
+
+  // Each shard sends its universes' three terminations, then removes them under the source lock.
+  for (int i = 0; i < 3; ++i)
+  {
+    for (unsigned int thread = 0; thread < kNumTestTickThreads; ++thread)
+      take_lock_and_process_tick_thread(thread, kSacnSourceTickModeProcessLevelsOnly);
+  }
+
+  EXPECT_EQ(GetSource(source)->num_universes, 0u);
+  EXPECT_EQ(sacn_source_lock_fake.call_count, sacn_source_unlock_fake.call_count);
+
+  sacn_source_state_deinit();
+  sacn_reset_thread_configs();
+  ASSERT_EQ(sacn_source_state_init(), kEtcPalErrOk);
+}
+#endif  // SACN_SOURCE_MAX_TICK_THREADS > 1
+
 TEST_F(TestSourceState, ProcessSourcesCountsSources)
 {
   SacnSourceConfig config = kTestSourceConfig;
@@ -510,6 +685,109 @@ TEST_F(TestSourceState, ProcessSourcesMarksTerminatingOnDeinit)
   EXPECT_EQ((GetSource(threaded_source_2))->terminating, true);
 }
 
+TEST_F(TestSourceState, PacketsAreSentWithoutHoldingLock)
+{
+  sacn_send_multicast_fake.custom_fake = [](uint16_t, sacn_ip_support_t, const uint8_t*, const EtcPalMcastNetintId*) {
+    EXPECT_EQ(sacn_source_lock_fake.call_count, sacn_source_unlock_fake.call_count);
+    return kEtcPalErrOk;
+  };
+  sacn_send_unicast_fake.custom_fake = [](sacn_ip_support_t, const uint8_t*, const EtcPalIpAddr*, etcpal_error_t*) {
+    EXPECT_EQ(sacn_source_lock_fake.call_count, sacn_source_unlock_fake.call_count);
+    return kEtcPalErrOk;
+  };
+
+  sacn_source_t source_handle = AddSource(kTestSourceConfig);
+  AddUniverse(source_handle, kTestUniverseConfig);
+  AddTestUnicastDests(source_handle, kTestUniverseConfig.universe);
+  InitTestData(source_handle, kTestUniverseConfig.universe, kTestBuffer);
+
+  VERIFY_LOCKING(RunThreadCycle());
+
+  EXPECT_GT(sacn_send_multicast_fake.call_count, 0u);
+  EXPECT_GT(sacn_send_unicast_fake.call_count, 0u);
+  EXPECT_EQ(GetUniverse(source_handle, kTestUniverseConfig.universe)->next_seq_num, 1u);
+}
+
+TEST_F(TestSourceState, FailedQueuedSendsAreRecorded)
+{
+  sacn_send_multicast_fake.return_val = kEtcPalErrNoNetints;
+  sacn_send_unicast_fake.custom_fake  = [](sacn_ip_support_t, const uint8_t*, const EtcPalIpAddr*,
+                                          etcpal_error_t* last_send_error) {
+    *last_send_error = kEtcPalErrNoMem;
+    return kEtcPalErrNoMem;
+  };
+
+  sacn_source_t source_handle = AddSource(kTestSourceConfig);
+  AddUniverse(source_handle, kTestUniverseConfig);
+  AddTestUnicastDests(source_handle, kTestUniverseConfig.universe);
+  InitTestData(source_handle, kTestUniverseConfig.universe, kTestBuffer);
+
+  VERIFY_LOCKING(take_lock_and_process_sources(kProcessThreadedSources, kSacnSourceTickModeProcessLevelsOnly));
+
+  const SacnSourceUniverse* universe = GetUniverse(source_handle, kTestUniverseConfig.universe);
+  EXPECT_EQ(universe->last_send_error, kEtcPalErrNoMem);  // Unicast is sent after multicast
+  for (size_t i = 0; i < universe->num_unicast_dests; ++i)
+    EXPECT_EQ(universe->unicast_dests[i].last_send_error, kEtcPalErrNoMem);
+  EXPECT_TRUE(GetSource(source_handle)->deferred_send_failed);
+}
+
+TEST_F(TestSourceState, SequenceNumberAdvancesBeforeQueuedPacketsAreSent)
+{
+  sacn_send_multicast_fake.custom_fake = [](uint16_t universe_id, sacn_ip_support_t, const uint8_t* send_buf,
+                                            const EtcPalMcastNetintId*) {
+    if (IS_UNIVERSE_DATA(send_buf))
+    {
+      EXPECT_EQ(send_buf[SACN_SEQ_OFFSET], 0u);
+      EXPECT_EQ(GetUniverse(current_source_handle, universe_id)->next_seq_num, 1u);
+    }
+    return kEtcPalErrOk;
+  };
+
+  current_source_handle = AddSource(kTestSourceConfig);
+  AddUniverse(current_source_handle, kTestUniverseConfig);
+  InitTestData(current_source_handle, kTestUniverseConfig.universe, kTestBuffer);
+
+  VERIFY_LOCKING(take_lock_and_process_sources(kProcessThreadedSources, kSacnSourceTickModeProcessLevelsOnly));
+
+  EXPECT_GT(sacn_send_multicast_fake.call_count, 0u);
+}
+
+TEST_F(TestSourceState, QueuedPacketsDontUpdateReaddedUniverse)
+{
+  sacn_send_unicast_fake.custom_fake = [](sacn_ip_support_t, const uint8_t*, const EtcPalIpAddr*,
+                                          etcpal_error_t* last_send_error) {
+    // Remove the universe and add it back with the same ID while its packets are in flight.
+    if (sacn_send_unicast_fake.call_count == 1u)
+    {
+      bool found = false;
+      remove_sacn_source_universe(GetSource(current_source_handle),
+                                  get_source_universe_index(GetSource(current_source_handle),
+                                                            kTestUniverseConfig.universe, &found));
+      EXPECT_TRUE(found);
+      AddUniverse(current_source_handle, kTestUniverseConfig);
+    }
+
+    *last_send_error = kEtcPalErrNoMem;
+    return kEtcPalErrNoMem;
+  };
+
+  current_source_handle = AddSource(kTestSourceConfig);
+  AddUniverse(current_source_handle, kTestUniverseConfig);
+  AddTestUnicastDests(current_source_handle, kTestUniverseConfig.universe);
+  InitTestData(current_source_handle, kTestUniverseConfig.universe, kTestBuffer);
+
+  sacn_source_universe_t old_handle = GetUniverse(current_source_handle, kTestUniverseConfig.universe)->handle;
+
+  VERIFY_LOCKING(take_lock_and_process_sources(kProcessThreadedSources, kSacnSourceTickModeProcessLevelsOnly));
+
+  const SacnSourceUniverse* universe = GetUniverse(current_source_handle, kTestUniverseConfig.universe);
+  ASSERT_NE(universe, nullptr);
+  EXPECT_NE(universe->handle, old_handle);
+  EXPECT_EQ(universe->last_send_error, kEtcPalErrOk);
+  EXPECT_EQ(universe->next_seq_num, 0u);
+  EXPECT_TRUE(GetSource(current_source_handle)->deferred_send_failed);
+}
+
 TEST_F(TestSourceState, UniverseDiscoveryTimingIsCorrect)
 {
   etcpal_getms_fake.return_val = 0u;
@@ -1752,6 +2030,30 @@ TEST_F(TestSourceState, LevelsZeroWhereverPapAreZeroed)
   }
 }
 
+TEST_F(TestSourceState, LeasedLevelsAreNotSentUntilCommitted)
+{
+  sacn_source_t source   = AddSource(kTestSourceConfig);
+  uint16_t      universe = AddUniverse(source, kTestUniverseConfig);
+  InitTestData(source, universe, kTestBuffer);
+
+  SacnSourceUniverse* universe_state = GetUniverse(source, universe);
+  universe_state->levels_leased      = true;
+
+  RunThreadCycle();
+  EXPECT_EQ(sacn_send_multicast_fake.call_count, 0u);
+
+  // Committing updates the levels from the send buffer itself.
+  memcpy(&universe_state->level_send_buf[SACN_DATA_HEADER_SIZE], kTestBuffer2.data(), kTestBuffer2.size());
+  update_levels_and_or_pap(GetSource(source), universe_state, &universe_state->level_send_buf[SACN_DATA_HEADER_SIZE],
+                           kTestBuffer2.size(), nullptr, 0u, kDisableForceSync);
+  EXPECT_FALSE(universe_state->levels_leased);
+
+  RunThreadCycle();
+  EXPECT_EQ(sacn_send_multicast_fake.call_count, static_cast<unsigned int>(test_netints.size()));
+  EXPECT_EQ(memcmp(&universe_state->level_send_buf[SACN_DATA_HEADER_SIZE], kTestBuffer2.data(), kTestBuffer2.size()),
+            0);
+}
+
 TEST_F(TestSourceState, UpdateLevelsIncrementsActiveUniversesCorrectly)
 {
   sacn_source_t source   = AddSource(kTestSourceConfig);
@@ -1786,6 +2088,8 @@ TEST_F(TestSourceState, IncrementSequenceNumberWorks)
   sacn_source_t source   = AddSource(kTestSourceConfig);
   uint16_t      universe = AddUniverse(source, kTestUniverseConfig);
 
+  InitTestData(source, universe, kTestBuffer, kTestBuffer2);
+
   SacnSource*         source_state   = nullptr;
   SacnSourceUniverse* universe_state = nullptr;
   lookup_source_and_universe(source, universe, &source_state, &universe_state);
@@ -1819,6 +2123,36 @@ TEST_F(TestSourceState, IncrementSequenceNumberWorks)
   EXPECT_FALSE(universe_state->levels_sent_this_tick);
 }
 
+#if SACN_DYNAMIC_MEM && SACN_ETC_PRIORITY_EXTENSION
+TEST_F(TestSourceState, PapSendBufIsAllocatedWithTheFirstPap)
+{
+  sacn_source_t source   = AddSource(kTestSourceConfig);
+  uint16_t      universe = AddUniverse(source, kTestUniverseConfig);
+
+  InitTestData(source, universe, kTestBuffer);
+  EXPECT_EQ(GetUniverse(source, universe)->pap_send_buf, nullptr);
+
+  // Settings changed before the first PAP must still make it into the PAP packet.
+  static constexpr uint8_t kNewPriority = 42u;
+  set_universe_priority(GetSource(source), GetUniverse(source, universe), kNewPriority);
+  set_preview_flag(GetSource(source), GetUniverse(source, universe), true);
+  GetUniverse(source, universe)->levels_sent_this_tick = true;
+  increment_sequence_number(GetUniverse(source, universe));
+
+  InitTestData(source, universe, kTestBuffer, kTestBuffer2);
+
+  SacnSourceUniverse* universe_state = GetUniverse(source, universe);
+  ASSERT_NE(universe_state->pap_send_buf, nullptr);
+  EXPECT_TRUE(universe_state->has_pap_data);
+  EXPECT_EQ(universe_state->pap_send_buf[SACN_START_CODE_OFFSET], kSacnStartcodePriority);
+  EXPECT_EQ(universe_state->pap_send_buf[SACN_PRI_OFFSET], kNewPriority);
+  EXPECT_NE(universe_state->pap_send_buf[SACN_OPTS_OFFSET] & SACN_OPTVAL_PREVIEW, 0x00u);
+  EXPECT_EQ(universe_state->pap_send_buf[SACN_SEQ_OFFSET], universe_state->next_seq_num);
+  EXPECT_EQ(memcmp(&universe_state->pap_send_buf[SACN_DATA_HEADER_SIZE], kTestBuffer2.data(), kTestBuffer2.size()), 0);
+}
+
+#endif  // SACN_DYNAMIC_MEM && SACN_ETC_PRIORITY_EXTENSION
+
 TEST_F(TestSourceState, SendUniverseUnicastWorks)
 {
   static std::vector<uint8_t> test_send_buf = kTestBuffer;
@@ -2392,6 +2726,53 @@ TEST_F(TestSourceState, UpdateLevelsAndPapWorksWithLargestBuffers)
             0);
 }
 
+TEST_F(TestSourceState, UniversesStayInTheirSlots)
+{
+  sacn_source_t source = AddSource(kTestSourceConfig);
+
+  SacnSourceUniverseConfig universe_config = kTestUniverseConfig;
+  for (uint16_t universe = 1u; universe <= 3u; ++universe)
+  {
+    universe_config.universe = universe;
+    AddUniverse(source, universe_config);
+  }
+
+  SacnSourceUniverse*    universe_1 = GetUniverse(source, 1u);
+  SacnSourceUniverse*    universe_3 = GetUniverse(source, 3u);
+  sacn_source_universe_t handle_2   = GetUniverse(source, 2u)->handle;
+
+  // Removing a universe doesn't move the others.
+  bool found = false;
+  remove_sacn_source_universe(GetSource(source), get_source_universe_index(GetSource(source), 2u, &found));
+  EXPECT_TRUE(found);
+  EXPECT_EQ(GetUniverse(source, 1u), universe_1);
+  EXPECT_EQ(GetUniverse(source, 3u), universe_3);
+
+  SacnSourceUniverse* universe_state = nullptr;
+  EXPECT_EQ(lookup_universe_by_handle(GetSource(source), universe_1->handle, &universe_state), kEtcPalErrOk);
+  EXPECT_EQ(universe_state, universe_1);
+  EXPECT_EQ(lookup_universe_by_handle(GetSource(source), handle_2, &universe_state), kEtcPalErrNotFound);
+  EXPECT_EQ(universe_state, nullptr);
+  EXPECT_EQ(lookup_universe_by_handle(GetSource(source), kSacnSourceUniverseInvalid, &universe_state),
+            kEtcPalErrNotFound);
+
+  // The next universe reuses the free slot, but handles to the universe that was there before stay invalid.
+  universe_config.universe = 4u;
+  AddUniverse(source, universe_config);
+  EXPECT_EQ(GetSource(source)->num_universe_slots, 3u);
+  EXPECT_EQ(GetSource(source)->num_free_universe_slots, 0u);
+  EXPECT_NE(GetUniverse(source, 4u)->handle, handle_2);
+  EXPECT_EQ(lookup_universe_by_handle(GetSource(source), handle_2, &universe_state), kEtcPalErrNotFound);
+  EXPECT_EQ(lookup_universe_by_handle(GetSource(source), GetUniverse(source, 4u)->handle, &universe_state),
+            kEtcPalErrOk);
+
+  // The universes are still sorted highest to lowest.
+  ASSERT_EQ(GetSource(source)->num_universes, 3u);
+  EXPECT_EQ(SACN_SOURCE_UNIVERSE_AT(GetSource(source), 0)->universe_id, 4u);
+  EXPECT_EQ(SACN_SOURCE_UNIVERSE_AT(GetSource(source), 1)->universe_id, 3u);
+  EXPECT_EQ(SACN_SOURCE_UNIVERSE_AT(GetSource(source), 2)->universe_id, 1u);
+}
+
 TEST_F(TestSourceState, AddUniverseCleansUpOnFailure)
 {
   sacn_source_t source = AddSource(kTestSourceConfig);
@@ -2419,7 +2800,8 @@ TEST_F(TestSourceState, AddUniverseCleansUpOnFailure)
 
   ASSERT_EQ(src_state.num_universes, 1u);
 
-  auto& univ_state = src_state.universes[0];
+  auto& univ_state = *SACN_SOURCE_UNIVERSE_AT(&src_state, 0);
   EXPECT_EQ(univ_state.universe_id, lesser_universe_config.universe);
   EXPECT_GT(univ_state.netints.num_netints, 0u);
+  EXPECT_EQ(src_state.num_free_universe_slots, 1u);  // The failed universe's slot is ready for reuse.
 }
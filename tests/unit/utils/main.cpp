@@ -17,11 +17,40 @@
  * https://github.com/ETCLabs/sACN
  *****************************************************************************/
 
+#include <cstdint>
+#include <vector>
+#include "sacn/opts.h"
+#include "sacn/private/mem/arena.h"
 #include "gtest/gtest.h"
 #include "fff.h"
 
 DEFINE_FFF_GLOBALS;
 
+#if SACN_MEM_ARENA
+// Every allocation comes from the arena in this configuration, so one is set for the whole test program.
+class MemArenaEnvironment : public ::testing::Environment
+{
+public:
+  void SetUp() override
+  {
+    block_.resize(kBlockSize);
+    ASSERT_EQ(sacn_arena_set(block_.data(), block_.size()), kEtcPalErrOk);
+    ASSERT_EQ(sacn_arena_init(), kEtcPalErrOk);
+  }
+
+  void TearDown() override
+  {
+    sacn_arena_deinit();
+    sacn_arena_set(nullptr, 0u);
+  }
+
+private:
+  static constexpr size_t kBlockSize = 16u * 1024u * 1024u;
+
+  std::vector<uint8_t> block_;
+};
+#endif  // SACN_MEM_ARENA
+
 extern "C" bool SacnTestingAssertHandler(const char* expression, const char* file, const char* func, unsigned int line)
 {
   ADD_FAILURE() << "Assertion failure from inside sACN library. Expression: " << expression << " File: " << file
@@ -33,5 +62,8 @@ extern "C" bool SacnTestingAssertHandler(const char* expression, const char* fil
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
+#if SACN_MEM_ARENA
+  ::testing::AddGlobalTestEnvironment(new MemArenaEnvironment);
+#endif
   return RUN_ALL_TESTS();
 }
@@ -19,7 +19,11 @@
 
 #include "sacn/private/mem.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <string>
+#include <vector>
 #include "etcpal/cpp/uuid.h"
 #include "etcpal_mock/common.h"
 #include "sacn/private/common.h"
@@ -29,9 +33,13 @@
 #include "fff.h"
 
 #if SACN_DYNAMIC_MEM
-#define TestMem TestMemDynamic
+#define TestMem         TestMemDynamic
+#define TestHandleTable TestHandleTableDynamic
+#define TestHandleIndex TestHandleIndexDynamic
 #else
-#define TestMem TestMemStatic
+#define TestMem         TestMemStatic
+#define TestHandleTable TestHandleTableStatic
+#define TestHandleIndex TestHandleIndexStatic
 #endif
 
 static constexpr sacn_merge_receiver_t   kTestMergeReceiverHandle = 1;
@@ -48,7 +56,7 @@ static constexpr SacnMergeReceiverConfig kTestMergeReceiverConfig = {
 class TestMem : public ::testing::Test
 {
 protected:
-  static constexpr unsigned int kTestNumThreads = 1;  // TODO: Set back to 4 if/when SACN_RECEIVER_MAX_THREADS increases
+  static constexpr unsigned int kTestNumThreads = (SACN_RECEIVER_MAX_THREADS < 4) ? SACN_RECEIVER_MAX_THREADS : 4;
   static constexpr intptr_t     kMagicPointerValue = 0xdeadbeef;
 
   void SetUp() override
@@ -67,6 +75,9 @@ protected:
     sacn_merge_receiver_mem_deinit();
     sacn_receiver_mem_deinit();
     sacn_source_mem_deinit();
+
+    SacnReserveConfig no_reservation = SACN_RESERVE_CONFIG_DEFAULT_INIT;
+    sacn_mem_set_reservation(&no_reservation);
   }
 
   static void DoForEachThread(const std::function<void(sacn_thread_id_t)>& func)
@@ -824,6 +835,28 @@ TEST_F(TestMem, AddSacnMergeReceiverWorks)
   EXPECT_EQ(merge_receiver->callbacks.source_limit_exceeded, nullptr);
 }
 
+TEST_F(TestMem, MemStatsCountTheBytesOfEachPool)
+{
+  SacnModuleMemoryStats before{};
+  add_merge_receiver_mem_stats(&before);
+
+  SacnMergeReceiver* merge_receiver = nullptr;
+  ASSERT_EQ(add_sacn_merge_receiver(kTestMergeReceiverHandle, &kTestMergeReceiverConfig, &merge_receiver),
+            kEtcPalErrOk);
+
+  SacnModuleMemoryStats after{};
+  add_merge_receiver_mem_stats(&after);
+#if SACN_DYNAMIC_MEM
+  // Merge receivers are allocated one at a time, each with its rb-tree node.
+  EXPECT_EQ(after.bytes_allocated, before.bytes_allocated + sizeof(SacnMergeReceiver) + sizeof(EtcPalRbNode));
+#else
+  // The static pools take up the same bytes whether or not they're in use.
+  EXPECT_EQ(after.bytes_allocated, before.bytes_allocated);
+  EXPECT_EQ(after.bytes_allocated,
+            (after.pool_capacity * sizeof(SacnMergeReceiver)) + (after.rb_node_capacity * sizeof(EtcPalRbNode)));
+#endif
+}
+
 TEST_F(TestMem, AddSacnMergeReceiverSourceWorks)
 {
   static constexpr size_t kNumSources = 5u;
@@ -951,3 +984,573 @@ TEST_F(TestMem, RespectsMaxSourceDetectorSourceLimit)
     EXPECT_EQ(add_sacn_universe_discovery_source(&cid, "name", &state), kEtcPalErrOk);
   }
 }
+
+class TestHandleTable : public TestMem
+{
+protected:
+  static constexpr size_t kBandSlots    = 4u;
+  static constexpr int    kMaxHandle    = 63;
+  static constexpr size_t kMinFreeSlots = 2u;
+#if SACN_DYNAMIC_MEM
+  // The first band gets half of the 64 handles (8 generations), a second band of 8 slots gets 2 generations, and a last
+  // band of 16 slots gets the other 16 handles.
+  static constexpr size_t kMaxSlots              = 28u;
+  static constexpr size_t kFirstBandGenerations  = 8u;
+  static constexpr int    kSecondBandFirstHandle = 32;
+  static constexpr int    kLastBandFirstHandle   = 48;
+#else
+  static constexpr size_t kMaxSlots             = kBandSlots;
+  static constexpr size_t kFirstBandGenerations = 16u;
+#endif
+
+  void SetUp() override
+  {
+    TestMem::SetUp();
+#if SACN_DYNAMIC_MEM
+    sacn_handle_table_init(&table_, kSacnAllocModuleReceiver, nullptr, kBandSlots, kMaxHandle, kMinFreeSlots);
+#else
+    sacn_handle_table_init(&table_, kSacnAllocModuleReceiver, slots_.data(), kBandSlots, kMaxHandle, kMinFreeSlots);
+#endif
+  }
+
+  void TearDown() override
+  {
+    sacn_handle_table_deinit(&table_);
+    TestMem::TearDown();
+  }
+
+  SacnHandleTable                        table_{};
+  std::array<SacnHandleSlot, kBandSlots> slots_{};
+  std::array<int, kMaxSlots + 1u>        objects_{};
+};
+
+TEST_F(TestHandleTable, HandlesLookUpTheirObjects)
+{
+  for (size_t i = 0u; i < kBandSlots; ++i)
+  {
+    int handle = -1;
+    ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(i), &handle), kEtcPalErrOk);
+    EXPECT_EQ(handle, static_cast<int>(i));
+    EXPECT_EQ(sacn_handle_table_get(&table_, handle), &objects_.at(i));
+  }
+
+  EXPECT_EQ(sacn_handle_table_size(&table_), kBandSlots);
+  EXPECT_EQ(sacn_handle_table_get(&table_, -1), nullptr);
+  EXPECT_EQ(sacn_handle_table_get(&table_, kMaxHandle), nullptr);
+  EXPECT_EQ(sacn_handle_table_get(&table_, kMaxHandle + 1), nullptr);
+}
+
+TEST_F(TestHandleTable, RespectsMaxSlots)
+{
+  int handle = -1;
+  for (size_t i = 0u; i < kMaxSlots; ++i)
+    ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(i), &handle), kEtcPalErrOk);
+
+  EXPECT_EQ(sacn_handle_table_add(&table_, &objects_.at(kMaxSlots), &handle), kEtcPalErrNoMem);
+}
+
+#if SACN_DYNAMIC_MEM
+TEST_F(TestHandleTable, GrowsIntoLargerBands)
+{
+  std::array<int, kMaxSlots> handles{};
+  for (size_t i = 0u; i < kMaxSlots; ++i)
+    ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(i), &handles.at(i)), kEtcPalErrOk);
+
+  // The second band's slots take their handles from its own range of the handle space.
+  EXPECT_EQ(handles.at(kBandSlots), kSecondBandFirstHandle);
+  EXPECT_EQ(handles.at(kBandSlots * 3u), kLastBandFirstHandle);
+  for (size_t i = 0u; i < kMaxSlots; ++i)
+  {
+    EXPECT_LE(handles.at(i), kMaxHandle);
+    EXPECT_EQ(sacn_handle_table_get(&table_, handles.at(i)), &objects_.at(i));
+  }
+}
+#endif
+
+TEST_F(TestHandleTable, StaleHandlesDontLookUpNewObjects)
+{
+  int first_handle  = -1;
+  int second_handle = -1;
+  ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(0), &first_handle), kEtcPalErrOk);
+  ASSERT_EQ(sacn_handle_table_remove(&table_, first_handle), kEtcPalErrOk);
+  EXPECT_EQ(sacn_handle_table_get(&table_, first_handle), nullptr);
+  EXPECT_EQ(sacn_handle_table_remove(&table_, first_handle), kEtcPalErrNotFound);
+
+  ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(1), &second_handle), kEtcPalErrOk);
+  EXPECT_NE(second_handle, first_handle);
+  EXPECT_EQ(sacn_handle_table_get(&table_, second_handle), &objects_.at(1));
+  EXPECT_EQ(sacn_handle_table_get(&table_, first_handle), nullptr);
+}
+
+TEST_F(TestHandleTable, FreedSlotsWaitForMinFreeSlots)
+{
+  int handle = -1;
+  ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(0), &handle), kEtcPalErrOk);
+  ASSERT_EQ(sacn_handle_table_remove(&table_, handle), kEtcPalErrOk);
+
+  // Fresh slots are used until more than kMinFreeSlots slots are free.
+  std::array<int, kMinFreeSlots> handles{};
+  for (size_t i = 0u; i < kMinFreeSlots; ++i)
+  {
+    ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(i + 1u), &handles.at(i)), kEtcPalErrOk);
+    EXPECT_EQ(handles.at(i), static_cast<int>(i + 1u));
+  }
+  for (int freed : handles)
+    ASSERT_EQ(sacn_handle_table_remove(&table_, freed), kEtcPalErrOk);
+
+  ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(0), &handle), kEtcPalErrOk);
+  EXPECT_EQ(handle, static_cast<int>(kBandSlots));  // Slot 0, next generation
+}
+
+TEST_F(TestHandleTable, FreedSlotsAreReusedOldestFirst)
+{
+  std::array<int, kMaxSlots> handles{};
+  for (size_t i = 0u; i < kMaxSlots; ++i)
+    ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(i), &handles.at(i)), kEtcPalErrOk);
+
+  ASSERT_EQ(sacn_handle_table_remove(&table_, handles.at(2)), kEtcPalErrOk);
+  ASSERT_EQ(sacn_handle_table_remove(&table_, handles.at(1)), kEtcPalErrOk);
+
+  // With no fresh slots left, the oldest free slot is reused without waiting for kMinFreeSlots.
+  int handle = -1;
+  ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(kMaxSlots), &handle), kEtcPalErrOk);
+  EXPECT_EQ(static_cast<size_t>(handle) % kBandSlots, 2u);
+}
+
+TEST_F(TestHandleTable, HandlesArentReissuedUntilGenerationsRunOut)
+{
+  // Churning one object cycles through kMinFreeSlots + 1 slots, each of which runs through its generations.
+  std::vector<int> handles;
+  int              handle = -1;
+  for (size_t i = 0u; i < (kMinFreeSlots + 1u) * kFirstBandGenerations; ++i)
+  {
+    ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(0), &handle), kEtcPalErrOk);
+    EXPECT_EQ(std::find(handles.begin(), handles.end(), handle), handles.end());
+    handles.push_back(handle);
+    ASSERT_EQ(sacn_handle_table_remove(&table_, handle), kEtcPalErrOk);
+  }
+
+  ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(0), &handle), kEtcPalErrOk);
+  EXPECT_EQ(handle, handles.front());
+}
+
+TEST_F(TestHandleTable, GenerationsWrapWithinMaxHandle)
+{
+  int handle = -1;
+  ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(0), &handle), kEtcPalErrOk);
+
+  for (int i = 0; i < 100; ++i)
+  {
+    ASSERT_EQ(sacn_handle_table_remove(&table_, handle), kEtcPalErrOk);
+    ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(0), &handle), kEtcPalErrOk);
+    EXPECT_LE(handle, kMaxHandle);
+    EXPECT_EQ(sacn_handle_table_get(&table_, handle), &objects_.at(0));
+  }
+}
+
+TEST_F(TestHandleTable, ClearWithCbFreesEveryObject)
+{
+  static int num_freed = 0;
+  num_freed            = 0;
+
+  std::array<int, kBandSlots> handles{};
+  for (size_t i = 0u; i < kBandSlots; ++i)
+    ASSERT_EQ(sacn_handle_table_add(&table_, &objects_.at(i), &handles.at(i)), kEtcPalErrOk);
+  ASSERT_EQ(sacn_handle_table_remove(&table_, handles.at(1)), kEtcPalErrOk);
+
+  sacn_handle_table_clear_with_cb(&table_, [](void*) { ++num_freed; });
+
+  EXPECT_EQ(num_freed, static_cast<int>(kBandSlots) - 1);
+  EXPECT_EQ(sacn_handle_table_size(&table_), 0u);
+  for (int handle : handles)
+    EXPECT_EQ(sacn_handle_table_get(&table_, handle), nullptr);
+}
+
+class TestHandleIndex : public TestMem
+{
+protected:
+  static constexpr size_t kMaxObjects = 4u;
+
+  void SetUp() override
+  {
+    TestMem::SetUp();
+#if SACN_DYNAMIC_MEM
+    sacn_handle_index_init(&index_, kSacnAllocModuleDmxMerger, nullptr, 0u);
+#else
+    sacn_handle_index_init(&index_, kSacnAllocModuleDmxMerger, entries_.data(), entries_.size());
+#endif
+  }
+
+  void TearDown() override
+  {
+    sacn_handle_index_deinit(&index_);
+    TestMem::TearDown();
+  }
+
+  SacnHandleIndex                                    index_{};
+  std::array<SacnHandleIndexEntry, kMaxObjects * 2u> entries_{};
+  std::array<int, kMaxObjects>                       objects_{};
+};
+
+TEST_F(TestHandleIndex, HandlesLookUpTheirObjects)
+{
+  // These handles share their low bits, as remote source handles from different generations can.
+  static constexpr std::array<int, kMaxObjects> kHandles = {3, 8195, 16387, 7};
+
+  for (size_t i = 0u; i < kMaxObjects; ++i)
+    ASSERT_EQ(sacn_handle_index_add(&index_, kHandles.at(i), &objects_.at(i)), kEtcPalErrOk);
+
+  EXPECT_EQ(sacn_handle_index_size(&index_), kMaxObjects);
+  for (size_t i = 0u; i < kMaxObjects; ++i)
+    EXPECT_EQ(sacn_handle_index_get(&index_, kHandles.at(i)), &objects_.at(i));
+
+  EXPECT_EQ(sacn_handle_index_get(&index_, 11), nullptr);
+  EXPECT_EQ(sacn_handle_index_add(&index_, kHandles.at(0), &objects_.at(1)), kEtcPalErrExists);
+}
+
+TEST_F(TestHandleIndex, RemovalKeepsCollidingHandlesReachable)
+{
+  static constexpr std::array<int, 3> kHandles = {0, 8, 16};
+
+  for (size_t i = 0u; i < kHandles.size(); ++i)
+    ASSERT_EQ(sacn_handle_index_add(&index_, kHandles.at(i), &objects_.at(i)), kEtcPalErrOk);
+
+  ASSERT_EQ(sacn_handle_index_remove(&index_, kHandles.at(1)), kEtcPalErrOk);
+  EXPECT_EQ(sacn_handle_index_remove(&index_, kHandles.at(1)), kEtcPalErrNotFound);
+  EXPECT_EQ(sacn_handle_index_get(&index_, kHandles.at(1)), nullptr);
+  EXPECT_EQ(sacn_handle_index_get(&index_, kHandles.at(2)), &objects_.at(2));
+
+  ASSERT_EQ(sacn_handle_index_remove(&index_, kHandles.at(0)), kEtcPalErrOk);
+  EXPECT_EQ(sacn_handle_index_get(&index_, kHandles.at(2)), &objects_.at(2));
+  EXPECT_EQ(sacn_handle_index_size(&index_), 1u);
+}
+
+#if SACN_DYNAMIC_MEM
+TEST_F(TestMem, SlabGrowsInChunks)
+{
+  static constexpr size_t kItemsPerChunk = 4u;
+
+  SacnSlab slab{};
+  sacn_slab_init(&slab, kSacnAllocModuleReceiver, sizeof(EtcPalRbNode), kItemsPerChunk);
+
+  std::vector<void*> items;
+  for (size_t i = 0; i < (kItemsPerChunk * 2u) + 1u; ++i)
+  {
+    items.push_back(sacn_slab_alloc(&slab));
+    ASSERT_NE(items.back(), nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(items.back()) % alignof(EtcPalRbNode), 0u);
+  }
+
+  SacnSlabStats stats{};
+  sacn_slab_get_stats(&slab, &stats);
+  EXPECT_EQ(stats.in_use, items.size());
+  EXPECT_EQ(stats.high_water, items.size());
+  EXPECT_EQ(stats.num_chunks, 3u);
+  EXPECT_EQ(stats.capacity, kItemsPerChunk * 3u);
+
+  for (void* item : items)
+    sacn_slab_free(&slab, item);
+
+  sacn_slab_get_stats(&slab, &stats);
+  EXPECT_EQ(stats.in_use, 0u);
+  EXPECT_EQ(stats.high_water, items.size());
+  EXPECT_EQ(stats.num_chunks, 3u);
+
+  sacn_slab_deinit(&slab);
+  sacn_slab_get_stats(&slab, &stats);
+  EXPECT_EQ(stats.num_chunks, 0u);
+  EXPECT_EQ(stats.capacity, 0u);
+}
+
+TEST_F(TestMem, SlabReusesFreedItemsWithoutGrowing)
+{
+  SacnSlab slab{};
+  sacn_slab_init(&slab, kSacnAllocModuleReceiver, sizeof(SacnTrackedSource), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+
+  void* first = sacn_slab_alloc(&slab);
+  ASSERT_NE(first, nullptr);
+  sacn_slab_free(&slab, first);
+
+  // Churn through the same item repeatedly - the slab should never need another chunk.
+  for (int i = 0; i < 100; ++i)
+  {
+    void* item = sacn_slab_alloc(&slab);
+    EXPECT_EQ(item, first);
+    sacn_slab_free(&slab, item);
+  }
+
+  SacnSlabStats stats{};
+  sacn_slab_get_stats(&slab, &stats);
+  EXPECT_EQ(stats.in_use, 0u);
+  EXPECT_EQ(stats.high_water, 1u);
+  EXPECT_EQ(stats.num_chunks, 1u);
+
+  sacn_slab_deinit(&slab);
+}
+
+TEST_F(TestMem, SlabReleasesChunksWhenLastItemFreedAfterDeinit)
+{
+  SacnSlab slab{};
+  sacn_slab_init(&slab, kSacnAllocModuleReceiver, sizeof(EtcPalRbNode), SACN_SLAB_DEFAULT_CHUNK_ITEMS);
+
+  void* item = sacn_slab_alloc(&slab);
+  ASSERT_NE(item, nullptr);
+
+  sacn_slab_deinit(&slab);
+
+  SacnSlabStats stats{};
+  sacn_slab_get_stats(&slab, &stats);
+  EXPECT_EQ(stats.num_chunks, 1u);
+
+  sacn_slab_free(&slab, item);
+  sacn_slab_get_stats(&slab, &stats);
+  EXPECT_EQ(stats.num_chunks, 0u);
+}
+
+TEST_F(TestMem, SlabReserveGrowsByTheShortfallInOneChunk)
+{
+  SacnSlab slab{};
+  sacn_slab_init(&slab, kSacnAllocModuleReceiver, sizeof(EtcPalRbNode), 4u);
+
+  EXPECT_EQ(sacn_slab_reserve(&slab, 10u), kEtcPalErrOk);
+
+  SacnSlabStats stats{};
+  sacn_slab_get_stats(&slab, &stats);
+  EXPECT_EQ(stats.capacity, 10u);
+  EXPECT_EQ(stats.num_chunks, 1u);
+
+  // Reserving less than the current capacity is a no-op.
+  EXPECT_EQ(sacn_slab_reserve(&slab, 5u), kEtcPalErrOk);
+  sacn_slab_get_stats(&slab, &stats);
+  EXPECT_EQ(stats.capacity, 10u);
+  EXPECT_EQ(stats.num_chunks, 1u);
+
+  sacn_slab_deinit(&slab);
+}
+
+TEST_F(TestMem, ReservationSizesReceiverBuffers)
+{
+  static constexpr size_t kReservedReceivers = 1000u;
+  static constexpr size_t kReservedNetints   = 2u;
+#if SACN_RECEIVER_SOCKET_PER_NIC
+  static constexpr size_t kReservedSockets =
+      (((kReservedReceivers - 1) / SACN_RECEIVER_MAX_SUBS_PER_SOCKET) + 1) * 2 * kReservedNetints;
+#else
+  static constexpr size_t kReservedSockets = (((kReservedReceivers - 1) / SACN_RECEIVER_MAX_SUBS_PER_SOCKET) + 1) * 2;
+#endif
+
+  SacnReserveConfig reservation = SACN_RESERVE_CONFIG_DEFAULT_INIT;
+  reservation.receivers         = kReservedReceivers;
+  reservation.netints           = kReservedNetints;
+  sacn_mem_set_reservation(&reservation);
+
+  sacn_merge_receiver_mem_deinit();
+  sacn_receiver_mem_deinit();
+  ASSERT_EQ(sacn_receiver_mem_init(kTestNumThreads), kEtcPalErrOk);
+  ASSERT_EQ(sacn_merge_receiver_mem_init(kTestNumThreads), kEtcPalErrOk);
+
+  DoForEachThread([](sacn_thread_id_t thread) {
+    SacnRecvThreadContext* recv_thread_context = get_recv_thread_context(thread);
+    ASSERT_NE(recv_thread_context, nullptr);
+    EXPECT_EQ(recv_thread_context->dead_sockets_capacity, std::max<size_t>(kReservedSockets, kSacnInitialCapacity));
+    EXPECT_EQ(recv_thread_context->socket_refs_capacity, std::max<size_t>(kReservedSockets, kSacnInitialCapacity));
+    EXPECT_EQ(recv_thread_context->subscribes_capacity, kReservedReceivers * kReservedNetints);
+
+    size_t        initial_growth_count = sacn_mem_get_growth_count();
+    ReceiveSocket socket               = RECV_SOCKET_DEFAULT_INIT;
+    for (size_t i = 0; i < kReservedSockets; ++i)
+      ASSERT_TRUE(add_dead_socket(recv_thread_context, &socket));
+    EXPECT_EQ(sacn_mem_get_growth_count(), initial_growth_count);
+  });
+}
+
+TEST_F(TestMem, BufferGrowthIsCounted)
+{
+  DoForEachThread([](sacn_thread_id_t thread) {
+    SacnRecvThreadContext* recv_thread_context = get_recv_thread_context(thread);
+    ASSERT_NE(recv_thread_context, nullptr);
+
+    size_t        initial_capacity     = recv_thread_context->dead_sockets_capacity;
+    size_t        initial_growth_count = sacn_mem_get_growth_count();
+    ReceiveSocket socket               = RECV_SOCKET_DEFAULT_INIT;
+    for (size_t i = 0; i <= initial_capacity; ++i)
+      ASSERT_TRUE(add_dead_socket(recv_thread_context, &socket));
+
+    EXPECT_GT(recv_thread_context->dead_sockets_capacity, initial_capacity);
+    EXPECT_EQ(sacn_mem_get_growth_count(), initial_growth_count + 1u);
+  });
+}
+
+// With SACN_MEM_ARENA, these run on the arena that the whole test program allocates from. Otherwise they set one up.
+class TestArena : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+#if !SACN_MEM_ARENA
+    ASSERT_EQ(sacn_arena_set(block_.data(), block_.size()), kEtcPalErrOk);
+    ASSERT_EQ(sacn_arena_init(), kEtcPalErrOk);
+#endif
+    sacn_arena_get_stats(&initial_stats_);
+  }
+
+  void TearDown() override
+  {
+#if !SACN_MEM_ARENA
+    sacn_arena_deinit();
+    EXPECT_EQ(sacn_arena_set(nullptr, 0u), kEtcPalErrOk);
+#endif
+  }
+
+  alignas(16) std::array<uint8_t, 65536> block_{};
+
+  SacnArenaStats initial_stats_{};
+};
+
+TEST_F(TestArena, AllocTakesTheSmallestBlockThatFits)
+{
+  void* small = sacn_arena_alloc(100u);
+  void* large = sacn_arena_alloc(1000u);
+  ASSERT_NE(small, nullptr);
+  ASSERT_NE(large, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(small) % 16u, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(large) % 16u, 0u);
+
+  SacnArenaStats stats{};
+  sacn_arena_get_stats(&stats);
+  EXPECT_EQ(stats.num_blocks, initial_stats_.num_blocks + 2u);
+  EXPECT_EQ(stats.in_use, initial_stats_.in_use + 128u + 1024u);
+  EXPECT_GE(stats.high_water, stats.in_use);
+
+  // The most recently freed block of a size is the next one handed out.
+  sacn_arena_free(small);
+  EXPECT_EQ(sacn_arena_alloc(65u), small);
+
+  sacn_arena_free(small);
+  sacn_arena_free(large);
+  sacn_arena_get_stats(&stats);
+  EXPECT_EQ(stats.num_blocks, initial_stats_.num_blocks);
+  EXPECT_EQ(stats.in_use, initial_stats_.in_use);
+}
+
+TEST_F(TestArena, AllocFailsAboveTheLargestBlock)
+{
+  void* largest = sacn_arena_alloc(initial_stats_.max_alloc_size);
+  EXPECT_NE(largest, nullptr);
+  sacn_arena_free(largest);
+
+  EXPECT_EQ(sacn_arena_alloc(initial_stats_.max_alloc_size + 1u), nullptr);
+}
+
+TEST_F(TestArena, ReallocMovesOnlyWhenTheBlockIsOutgrown)
+{
+  auto* first = static_cast<uint8_t*>(sacn_arena_alloc(65u));
+  ASSERT_NE(first, nullptr);
+  memset(first, 0xab, 65u);
+
+  // The 65 bytes were given a 128-byte block, so growing to 128 bytes stays in place.
+  EXPECT_EQ(sacn_arena_realloc(first, 128u), first);
+
+  auto* moved = static_cast<uint8_t*>(sacn_arena_realloc(first, 129u));
+  ASSERT_NE(moved, nullptr);
+  EXPECT_NE(moved, first);
+  for (size_t i = 0; i < 65u; ++i)
+    EXPECT_EQ(moved[i], 0xab);
+
+  SacnArenaStats stats{};
+  sacn_arena_get_stats(&stats);
+  EXPECT_EQ(stats.num_blocks, initial_stats_.num_blocks + 1u);
+  EXPECT_EQ(stats.in_use, initial_stats_.in_use + 256u);
+
+  // A failed realloc leaves the original allocation in place.
+  EXPECT_EQ(sacn_arena_realloc(moved, initial_stats_.max_alloc_size + 1u), nullptr);
+  sacn_arena_get_stats(&stats);
+  EXPECT_EQ(stats.num_blocks, initial_stats_.num_blocks + 1u);
+
+  sacn_arena_free(moved);
+}
+
+TEST_F(TestArena, BlockCantBeReplacedWhileInitialized)
+{
+  EXPECT_EQ(sacn_arena_set(nullptr, 0u), kEtcPalErrBusy);
+  EXPECT_TRUE(sacn_arena_is_set());
+}
+
+#if !SACN_MEM_ARENA
+TEST_F(TestArena, BlockIsCarvedIntoEqualPools)
+{
+  alignas(16) static std::array<uint8_t, 512> small_block;
+
+  sacn_arena_deinit();
+  ASSERT_EQ(sacn_arena_set(nullptr, 0u), kEtcPalErrOk);
+  EXPECT_FALSE(sacn_arena_is_set());
+  EXPECT_EQ(sacn_arena_init(), kEtcPalErrNoMem);
+
+  EXPECT_EQ(sacn_arena_set(small_block.data(), 32u), kEtcPalErrInvalid);
+  ASSERT_EQ(sacn_arena_set(small_block.data(), small_block.size()), kEtcPalErrOk);
+  ASSERT_EQ(sacn_arena_init(), kEtcPalErrOk);
+
+  // Two pools fit in 512 bytes: four 64-byte blocks and two 128-byte blocks.
+  SacnArenaStats stats{};
+  sacn_arena_get_stats(&stats);
+  EXPECT_EQ(stats.size, 512u);
+  EXPECT_EQ(stats.max_alloc_size, 128u);
+
+  std::array<void*, 6> blocks{};
+  for (size_t i = 0; i < blocks.size(); ++i)
+  {
+    blocks[i] = sacn_arena_alloc(16u);
+    ASSERT_NE(blocks[i], nullptr);
+    EXPECT_EQ(blocks[i], small_block.data() + ((i < 4u) ? (i * 64u) : (256u + ((i - 4u) * 128u))));
+  }
+
+  // Once the larger pool is used up as well, there's nothing left.
+  EXPECT_EQ(sacn_arena_alloc(16u), nullptr);
+
+  sacn_arena_get_stats(&stats);
+  EXPECT_EQ(stats.num_blocks, blocks.size());
+  EXPECT_EQ(stats.in_use, stats.size);
+
+  for (void* block : blocks)
+    sacn_arena_free(block);
+}
+
+TEST_F(TestArena, BlockIsCarvedIntoTheGivenPools)
+{
+  alignas(16) static std::array<uint8_t, 512> small_block;
+
+  sacn_arena_deinit();
+  ASSERT_EQ(sacn_arena_set(nullptr, 0u), kEtcPalErrOk);
+
+  // Out of order, or too big for the block.
+  const std::array<SacnMemArenaPool, 2> out_of_order = {{{128u, 1u}, {64u, 1u}}};
+  EXPECT_EQ(sacn_arena_set_pools(small_block.data(), small_block.size(), out_of_order.data(), out_of_order.size()),
+            kEtcPalErrInvalid);
+  const std::array<SacnMemArenaPool, 2> too_big = {{{32u, 8u}, {256u, 1u}}};
+  EXPECT_EQ(sacn_arena_set_pools(small_block.data(), 480u, too_big.data(), too_big.size()), kEtcPalErrInvalid);
+  EXPECT_FALSE(sacn_arena_is_set());
+
+  // Block sizes are rounded up to the alignment: eight 32-byte blocks and one 256-byte block.
+  const std::array<SacnMemArenaPool, 2> config = {{{30u, 8u}, {256u, 1u}}};
+  ASSERT_EQ(sacn_arena_set_pools(small_block.data(), small_block.size(), config.data(), config.size()), kEtcPalErrOk);
+  ASSERT_EQ(sacn_arena_init(), kEtcPalErrOk);
+
+  SacnArenaStats stats{};
+  sacn_arena_get_stats(&stats);
+  EXPECT_EQ(stats.size, 512u);
+  EXPECT_EQ(stats.max_alloc_size, 256u);
+
+  std::array<void*, 9> blocks{};
+  for (size_t i = 0; i < blocks.size(); ++i)
+  {
+    blocks[i] = sacn_arena_alloc(32u);
+    ASSERT_NE(blocks[i], nullptr);
+    EXPECT_EQ(blocks[i], small_block.data() + (i * 32u));
+  }
+  EXPECT_EQ(sacn_arena_alloc(1u), nullptr);
+
+  for (void* block : blocks)
+    sacn_arena_free(block);
+}
+#endif  // !SACN_MEM_ARENA
+#endif  // SACN_DYNAMIC_MEM
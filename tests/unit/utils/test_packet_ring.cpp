@@ -0,0 +1,287 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "sacn/private/packet_ring.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "etcpal/acn_rlp.h"
+#include "etcpal/pack.h"
+#include "sacn/private/pdu.h"
+#include "sacn/opts.h"
+#include "gtest/gtest.h"
+
+#if SACN_RECEIVER_USE_PACKET_RING
+
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static constexpr uint32_t kTestNetOffset  = 128u;
+static constexpr int      kTestIfindex    = 4;
+static constexpr uint16_t kTestSourcePort = 12345u;
+static constexpr size_t   kTestDataSize   = 50u;
+static constexpr int      kTestWaitMs     = 100;
+
+// Builds frames as the kernel places them in the ring: the frame header, then the link-layer address, then the packet
+// starting at the IP header.
+class TestPacketRing : public ::testing::Test
+{
+protected:
+  static std::vector<uint8_t> MakeUdp(uint16_t dest_port = 5568u, size_t data_size = kTestDataSize)
+  {
+    std::vector<uint8_t> udp(8u + data_size, 0xaau);
+    etcpal_pack_u16b(&udp[0], kTestSourcePort);
+    etcpal_pack_u16b(&udp[2], dest_port);
+    etcpal_pack_u16b(&udp[4], static_cast<uint16_t>(udp.size()));
+    etcpal_pack_u16b(&udp[6], 0u);
+    return udp;
+  }
+
+  static std::vector<uint8_t> MakeIpv4(const std::vector<uint8_t>& udp, uint8_t protocol = 17u, uint16_t frag = 0u)
+  {
+    std::vector<uint8_t> packet(20u, 0u);
+    packet[0] = 0x45u;
+    etcpal_pack_u16b(&packet[2], static_cast<uint16_t>(20u + udp.size()));
+    etcpal_pack_u16b(&packet[6], frag);
+    packet[8] = 64u;
+    packet[9] = protocol;
+    etcpal_pack_u32b(&packet[12], 0xc0a80102u);  // 192.168.1.2
+    etcpal_pack_u32b(&packet[16], 0xefff0001u);  // 239.255.0.1
+    packet.insert(packet.end(), udp.begin(), udp.end());
+    return packet;
+  }
+
+  static std::vector<uint8_t> MakeIpv6(const std::vector<uint8_t>& udp)
+  {
+    std::vector<uint8_t> packet(40u, 0u);
+    packet[0] = 0x60u;
+    etcpal_pack_u16b(&packet[4], static_cast<uint16_t>(udp.size()));
+    packet[6]  = 17u;
+    packet[7]  = 64u;
+    packet[8]  = 0xfeu;
+    packet[9]  = 0x80u;
+    packet[23] = 0x02u;  // fe80::2
+    packet.insert(packet.end(), udp.begin(), udp.end());
+    return packet;
+  }
+
+  // Places a packet in frame_, captured in full unless snaplen is given.
+  const tpacket3_hdr* MakeFrame(const std::vector<uint8_t>& packet,
+                                uint16_t                    protocol,
+                                unsigned char               pkttype = PACKET_MULTICAST,
+                                size_t                      snaplen = SIZE_MAX)
+  {
+    frame_.fill(0u);
+    auto* frame       = reinterpret_cast<tpacket3_hdr*>(frame_.data());
+    frame->tp_len     = static_cast<uint32_t>(packet.size());
+    frame->tp_snaplen = static_cast<uint32_t>(std::min(snaplen, packet.size()));
+    frame->tp_mac     = static_cast<uint16_t>(kTestNetOffset);
+    frame->tp_net     = static_cast<uint16_t>(kTestNetOffset);
+    frame->tp_status  = TP_STATUS_USER;
+
+    auto* link = reinterpret_cast<sockaddr_ll*>(frame_.data() + TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+    link->sll_family   = AF_PACKET;
+    link->sll_protocol = htons(protocol);
+    link->sll_ifindex  = kTestIfindex;
+    link->sll_pkttype  = pkttype;
+
+    memcpy(&frame_[kTestNetOffset], packet.data(), frame->tp_snaplen);
+    return frame;
+  }
+
+  tpacket3_hdr* frame() { return reinterpret_cast<tpacket3_hdr*>(frame_.data()); }
+
+  alignas(tpacket3_hdr) std::array<uint8_t, 2048> frame_{};
+  SacnReadResult read_result_{};
+};
+
+TEST_F(TestPacketRing, ParsesIpv4Datagram)
+{
+  ASSERT_TRUE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(MakeUdp()), ETH_P_IP), &read_result_));
+
+  EXPECT_EQ(read_result_.netint.ip_type, kEtcPalIpTypeV4);
+  EXPECT_EQ(read_result_.netint.index, static_cast<unsigned int>(kTestIfindex));
+  EXPECT_EQ(ETCPAL_IP_V4_ADDRESS(&read_result_.from_addr.ip), 0xc0a80102u);
+  EXPECT_EQ(read_result_.from_addr.port, kTestSourcePort);
+  EXPECT_EQ(read_result_.data, &frame_[kTestNetOffset + 28u]);
+  EXPECT_EQ(read_result_.data_len, kTestDataSize);
+  EXPECT_TRUE(read_result_.copied_to_all_threads);
+}
+
+TEST_F(TestPacketRing, ParsesIpv6Datagram)
+{
+  ASSERT_TRUE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv6(MakeUdp()), ETH_P_IPV6), &read_result_));
+
+  EXPECT_EQ(read_result_.netint.ip_type, kEtcPalIpTypeV6);
+  EXPECT_EQ(read_result_.netint.index, static_cast<unsigned int>(kTestIfindex));
+  EXPECT_EQ(ETCPAL_IP_V6_ADDRESS(&read_result_.from_addr.ip)[0], 0xfeu);
+  EXPECT_EQ(ETCPAL_IP_V6_ADDRESS(&read_result_.from_addr.ip)[15], 0x02u);
+  EXPECT_EQ(read_result_.from_addr.port, kTestSourcePort);
+  EXPECT_EQ(read_result_.data, &frame_[kTestNetOffset + 48u]);
+  EXPECT_EQ(read_result_.data_len, kTestDataSize);
+}
+
+TEST_F(TestPacketRing, SkipsFramesNotAddressedToThisHost)
+{
+  for (unsigned char pkttype : {PACKET_HOST, PACKET_BROADCAST, PACKET_MULTICAST})
+  {
+    EXPECT_TRUE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(MakeUdp()), ETH_P_IP, pkttype), &read_result_))
+        << "Test failed on packet type " << static_cast<int>(pkttype) << ".";
+  }
+
+  // Another host's traffic seen while the interface is promiscuous, and this host's own transmissions
+  for (unsigned char pkttype : {PACKET_OTHERHOST, PACKET_OUTGOING})
+  {
+    EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(MakeUdp()), ETH_P_IP, pkttype), &read_result_))
+        << "Test failed on packet type " << static_cast<int>(pkttype) << ".";
+  }
+}
+
+TEST_F(TestPacketRing, SkipsTruncatedFrames)
+{
+  for (const std::vector<uint8_t>& packet : {MakeIpv4(MakeUdp()), MakeIpv6(MakeUdp())})
+  {
+    uint16_t protocol = (packet[0] == 0x45u) ? ETH_P_IP : ETH_P_IPV6;
+
+    // Cut short by the capture length
+    EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(packet, protocol, PACKET_MULTICAST, packet.size() - 1u),
+                                              &read_result_));
+    EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(packet, protocol, PACKET_MULTICAST, 10u), &read_result_));
+
+    // Cut short, with the frame claiming it wasn't
+    std::vector<uint8_t> short_packet(packet.begin(), packet.end() - 10);
+    EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(short_packet, protocol), &read_result_));
+  }
+
+  // The UDP length runs past the end of the IP packet.
+  std::vector<uint8_t> udp = MakeUdp();
+  etcpal_pack_u16b(&udp[4], static_cast<uint16_t>(udp.size() + 1u));
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(udp), ETH_P_IP), &read_result_));
+
+  // The network header is past the captured data.
+  MakeFrame(MakeIpv4(MakeUdp()), ETH_P_IP);
+  frame()->tp_mac = 0u;
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(frame(), &read_result_));
+}
+
+TEST_F(TestPacketRing, SkipsVlanTaggedFrames)
+{
+  // A tag still in the frame, whose priority bits would make it look like an IPv4 header
+  std::vector<uint8_t> tagged = {0x45u, 0x00u, 0x08u, 0x00u};
+  std::vector<uint8_t> packet = MakeIpv4(MakeUdp());
+  tagged.insert(tagged.end(), packet.begin(), packet.end());
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(tagged, ETH_P_8021Q), &read_result_));
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(tagged, ETH_P_8021AD), &read_result_));
+
+  // A tag stripped into the frame's metadata
+  MakeFrame(packet, ETH_P_IP);
+  frame()->tp_status |= TP_STATUS_VLAN_VALID;
+  frame()->hv1.tp_vlan_tci = 5u;
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(frame(), &read_result_));
+}
+
+TEST_F(TestPacketRing, SkipsFramesThatArentSacnUdp)
+{
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(MakeUdp(), 6u), ETH_P_IP), &read_result_));  // TCP
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(MakeUdp(5569u)), ETH_P_IP), &read_result_));
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(MakeUdp(), 17u, 0x2000u), ETH_P_IP), &read_result_));
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(MakeUdp()), ETH_P_ARP), &read_result_));
+
+  // The IP version doesn't match the link-layer protocol.
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv4(MakeUdp()), ETH_P_IPV6), &read_result_));
+  EXPECT_FALSE(sacn_packet_ring_parse_frame(MakeFrame(MakeIpv6(MakeUdp()), ETH_P_IP), &read_result_));
+}
+
+// This runs against the kernel over loopback, and needs CAP_NET_RAW.
+TEST_F(TestPacketRing, ReceivesOnlyItsNetintsAndUniverses)
+{
+  const unsigned int      loopback = if_nametoindex("lo");
+  const SacnUniverseRange universe = {1u, 1u};
+
+  std::vector<SacnBpfInsn> filter(SACN_RING_FILTER_SIZE(1u, 1u));
+  ASSERT_EQ(sacn_build_ring_filter(nullptr, 0u, nullptr, 0u, filter.data(), filter.size()),
+            SACN_RING_FILTER_SIZE(0u, 0u));
+
+  SacnPacketRing ring{};
+  etcpal_error_t res = sacn_packet_ring_init(&ring, filter.data(), SACN_RING_FILTER_SIZE(0u, 0u));
+  if ((res == kEtcPalErrPerm) || (res == kEtcPalErrNotImpl))
+    GTEST_SKIP() << "Packet sockets aren't available to this process.";
+  ASSERT_EQ(res, kEtcPalErrOk);
+
+  int tx = socket(AF_INET, SOCK_DGRAM, 0);
+  ASSERT_GE(tx, 0);
+  sockaddr_in to{};
+  to.sin_family      = AF_INET;
+  to.sin_port        = htons(5568u);
+  to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  auto send_data = [&](uint16_t universe_id) {
+    std::vector<uint8_t> data(SACN_DATA_HEADER_SIZE, 0u);
+    etcpal_pack_u32b(&data[SACN_ROOT_VECTOR_OFFSET], ACN_VECTOR_ROOT_E131_DATA);
+    etcpal_pack_u16b(&data[SACN_UNIVERSE_OFFSET], universe_id);
+    EXPECT_EQ(sendto(tx, data.data(), data.size(), 0, reinterpret_cast<const sockaddr*>(&to), sizeof(to)),
+              static_cast<ssize_t>(data.size()));
+  };
+  auto next_universe = [&]() -> int {
+    pollfd pfd = {ring.fd, POLLIN, 0};
+    for (int waited = 0; waited < kTestWaitMs; waited += 10)
+    {
+      if (sacn_packet_ring_next(&ring, &read_result_))
+        return etcpal_unpack_u16b(&read_result_.data[SACN_UNIVERSE_OFFSET]);
+      poll(&pfd, 1, 10);
+    }
+    return -1;
+  };
+
+  // Not on any interfaces yet
+  send_data(1u);
+  EXPECT_EQ(next_universe(), -1);
+
+  ASSERT_EQ(sacn_packet_ring_set_netints(&ring, &loopback, 1u), kEtcPalErrOk);
+  size_t filter_len =
+      sacn_build_ring_filter(ring.netints, ring.num_netints, &universe, 1u, filter.data(), filter.size());
+  ASSERT_EQ(sacn_packet_ring_set_filter(&ring, filter.data(), filter_len), kEtcPalErrOk);
+
+  send_data(2u);
+  send_data(1u);
+  EXPECT_EQ(next_universe(), 1);
+  EXPECT_EQ(read_result_.netint.index, loopback);
+  EXPECT_EQ(next_universe(), -1);
+
+  // Off the interface again
+  ASSERT_EQ(sacn_packet_ring_set_netints(&ring, nullptr, 0u), kEtcPalErrOk);
+  EXPECT_EQ(ring.num_netints, 0u);
+  filter_len = sacn_build_ring_filter(ring.netints, ring.num_netints, &universe, 1u, filter.data(), filter.size());
+  ASSERT_EQ(sacn_packet_ring_set_filter(&ring, filter.data(), filter_len), kEtcPalErrOk);
+
+  send_data(1u);
+  EXPECT_EQ(next_universe(), -1);
+
+  close(tx);
+  sacn_packet_ring_deinit(&ring);
+}
+
+#endif  // SACN_RECEIVER_USE_PACKET_RING
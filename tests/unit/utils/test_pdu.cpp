@@ -491,6 +491,24 @@ TEST_F(TestPdu, ParseSacnDataPacketHandlesInvalid)
                                       &terminated_out, &universe_data_out));
 }
 
+TEST_F(TestPdu, PeekSacnDataPacketUniverseWorks)
+{
+  static const std::vector<uint8_t> kData         = {1u, 2u, 3u};
+  static const SacnRemoteSource     kSourceInfo   = {1u, kEtcPalNullUuid, "Test Name"};
+  static const SacnRecvUniverseData kUniverseData = {
+      0x1234u, 100u, true, false, 0u, 0u, 0u, kSacnStartcodeDmx, {1, 3}, kData.data()};
+  static const size_t     kBufferLength   = (SACN_DATA_HEADER_SIZE + kData.size() - SACN_FRAMING_OFFSET);
+  static constexpr size_t kBufLenTooShort = 87u;
+
+  std::array<uint8_t, kSacnMtu> data{};
+  InitDataPacket(data, kSourceInfo, kUniverseData, 1u, false);
+
+  uint16_t universe = 0u;
+  EXPECT_TRUE(peek_sacn_data_packet_universe(&data.at(SACN_FRAMING_OFFSET), kBufferLength, &universe));
+  EXPECT_EQ(universe, kUniverseData.universe_id);
+  EXPECT_FALSE(peek_sacn_data_packet_universe(&data.at(SACN_FRAMING_OFFSET), kBufLenTooShort, &universe));
+}
+
 TEST_F(TestPdu, PackSacnRootLayerWorks)
 {
   TestPackRootLayer(1234u, false, etcpal::Uuid::V4().get());
@@ -19,16 +19,20 @@
 
 #include "sacn/private/sockets.h"
 
+#include <algorithm>
 #include <array>
 #include <gsl/span>
 #include <gsl/util>
+#include <optional>
 #include <vector>
 #include "etcpal_mock/common.h"
 #include "etcpal_mock/netint.h"
 #include "etcpal_mock/socket.h"
 #include "etcpal/cpp/inet.h"
 #include "etcpal/acn_rlp.h"
+#include "etcpal/pack.h"
 #include "sacn/private/mem.h"
+#include "sacn/private/pdu.h"
 #include "sacn/opts.h"
 #include "sacn_mock/private/common.h"
 #include "gtest/gtest.h"
@@ -790,6 +794,44 @@ TEST_F(TestSockets, SubscribeAndUnsubscribeQueueCorrectly)
   EXPECT_EQ(context->num_unsubscribes, v6_subs.size() * fake_v6_netints_.size());
 }
 
+TEST_F(TestSockets, QueuedSocketOperationsWakeTheThread)
+{
+  static constexpr sacn_thread_id_t kThreadId = 0u;
+
+  SacnRecvThreadContext* context = get_recv_thread_context(kThreadId);
+  ASSERT_NE(context, nullptr);
+
+#if !defined(__linux__)
+  etcpal_sendto_fake.return_val = 1;  // Elsewhere the wakeup is a (mocked) loopback socket.
+#endif
+
+  context->poll_context_initialized = true;
+  ASSERT_EQ(sacn_init_thread_wakeup(context), kEtcPalErrOk);
+  EXPECT_NE(context->wakeup_socket, ETCPAL_SOCKET_INVALID);
+  EXPECT_EQ(etcpal_poll_add_socket_fake.call_count, 1u);
+  EXPECT_FALSE(context->wakeup_pending);
+
+  std::vector<etcpal_socket_t> sockets;
+  EXPECT_EQ(AddReceiverSockets(kThreadId, kEtcPalIpTypeV4, 1u, fake_netint_ids_, sockets), kEtcPalErrOk);
+  EXPECT_TRUE(context->wakeup_pending);
+
+  // The wakeup is reported like a timeout, so the caller applies the queued operations and polls again.
+  etcpal_poll_wait_fake.custom_fake = [](EtcPalPollContext*, EtcPalPollEvent* event, int) {
+    event->socket = get_recv_thread_context(kThreadId)->wakeup_socket;
+    event->events = ETCPAL_POLL_IN;
+    return kEtcPalErrOk;
+  };
+
+  SacnReadResult read_result;
+  EXPECT_EQ(sacn_read(context, &read_result), kEtcPalErrTimedOut);
+  EXPECT_EQ(etcpal_recvmsg_fake.call_count, 0u);
+
+  sacn_deinit_thread_wakeup(context);
+  EXPECT_EQ(context->wakeup_socket, ETCPAL_SOCKET_INVALID);
+  EXPECT_EQ(etcpal_poll_remove_socket_fake.call_count, 1u);
+  context->poll_context_initialized = false;
+}
+
 TEST_F(TestSockets, InitializeInternalNetintsWorks)
 {
   std::vector<SacnMcastInterface> sys_netints = {
@@ -1130,3 +1172,475 @@ TEST_F(TestSockets, InitNetintsHandlesDuplicates)
   DeinitInternalNetintArray(internal_netint_array);
   DeinitSamplingPeriodNetints(sampling_period_netints);
 }
+
+// Runs the subset of classic BPF emitted by the sockets module's program builders over a packet, which came in on the
+// interface with index ifindex.
+static uint32_t RunSocketFilter(const std::vector<SacnBpfInsn>& prog,
+                                const std::vector<uint8_t>&     packet,
+                                unsigned int                    ifindex = 0u)
+{
+  uint32_t acc = 0u;
+  uint32_t x   = 0u;
+  for (size_t pc = 0u; pc < prog.size(); ++pc)
+  {
+    const SacnBpfInsn insn = prog[pc];
+    switch (insn.code)
+    {
+      case SACN_BPF_LD_W_ABS:
+        if (insn.k == SACN_BPF_AD_IFINDEX)
+        {
+          acc = ifindex;
+          break;
+        }
+        if (insn.k + 4u > packet.size())
+          return SACN_BPF_REJECT;
+        acc = etcpal_unpack_u32b(&packet[insn.k]);
+        break;
+      case SACN_BPF_LD_IMM:
+        acc = insn.k;
+        break;
+      case SACN_BPF_MOD_K:
+        acc %= insn.k;
+        break;
+      case SACN_BPF_LD_H_ABS:
+        if (insn.k + 2u > packet.size())
+          return SACN_BPF_REJECT;
+        acc = etcpal_unpack_u16b(&packet[insn.k]);
+        break;
+      case SACN_BPF_LD_B_ABS:
+        if (insn.k + 1u > packet.size())
+          return SACN_BPF_REJECT;
+        acc = packet[insn.k];
+        break;
+      case SACN_BPF_LD_W_IND:
+        if (x + insn.k + 4u > packet.size())
+          return SACN_BPF_REJECT;
+        acc = etcpal_unpack_u32b(&packet[x + insn.k]);
+        break;
+      case SACN_BPF_LD_H_IND:
+        if (x + insn.k + 2u > packet.size())
+          return SACN_BPF_REJECT;
+        acc = etcpal_unpack_u16b(&packet[x + insn.k]);
+        break;
+      case SACN_BPF_LDX_IMM:
+        x = insn.k;
+        break;
+      case SACN_BPF_LDX_B_MSH:
+        if (insn.k + 1u > packet.size())
+          return SACN_BPF_REJECT;
+        x = (packet[insn.k] & 0x0fu) * 4u;
+        break;
+      case SACN_BPF_AND_K:
+        acc &= insn.k;
+        break;
+      case SACN_BPF_JA:
+        pc += insn.k;
+        break;
+      case SACN_BPF_JEQ_K:
+        pc += (acc == insn.k) ? insn.jt : insn.jf;
+        break;
+      case SACN_BPF_JGT_K:
+        pc += (acc > insn.k) ? insn.jt : insn.jf;
+        break;
+      case SACN_BPF_JGE_K:
+        pc += (acc >= insn.k) ? insn.jt : insn.jf;
+        break;
+      case SACN_BPF_JSET_K:
+        pc += (acc & insn.k) ? insn.jt : insn.jf;
+        break;
+      case SACN_BPF_RET_K:
+        return insn.k;
+      default:
+        ADD_FAILURE() << "Unexpected BPF opcode " << insn.code;
+        return SACN_BPF_REJECT;
+    }
+  }
+
+  ADD_FAILURE() << "BPF program ran off the end";
+  return SACN_BPF_REJECT;
+}
+
+static std::vector<uint8_t> MakeUdpPayload(uint32_t root_vector, uint16_t universe)
+{
+  std::vector<uint8_t> payload(SACN_DATA_HEADER_SIZE + 1u, 0u);
+  etcpal_pack_u32b(&payload[SACN_ROOT_VECTOR_OFFSET], root_vector);
+  etcpal_pack_u16b(&payload[SACN_UNIVERSE_OFFSET], universe);
+  return payload;
+}
+
+static std::vector<uint8_t> MakeUdpDatagram(uint32_t root_vector, uint16_t universe)
+{
+  std::vector<uint8_t> packet(SACN_BPF_UDP_HEADER_SIZE, 0u);
+  std::vector<uint8_t> payload = MakeUdpPayload(root_vector, universe);
+  packet.insert(packet.end(), payload.begin(), payload.end());
+  return packet;
+}
+
+TEST_F(TestSockets, UniverseFilterPassesOnlyListedUniverses)
+{
+  const std::vector<SacnUniverseRange> ranges = {{1u, 4u}, {10u, 10u}, {12u, 20u}, {300u, 301u}, {63999u, 63999u}};
+
+  std::vector<SacnBpfInsn> prog(SACN_UNIVERSE_FILTER_SIZE(ranges.size()));
+  ASSERT_EQ(sacn_build_universe_filter(ranges.data(), ranges.size(), prog.data(), prog.size()), prog.size());
+
+  for (uint32_t universe = 0u; universe <= UINT16_MAX; ++universe)
+  {
+    bool listened = std::any_of(ranges.begin(), ranges.end(), [&](const SacnUniverseRange& range) {
+      return (universe >= range.first) && (universe <= range.last);
+    });
+    EXPECT_EQ(RunSocketFilter(prog, MakeUdpDatagram(ACN_VECTOR_ROOT_E131_DATA, static_cast<uint16_t>(universe))),
+              listened ? SACN_BPF_ACCEPT : SACN_BPF_REJECT)
+        << "Test failed on universe " << universe << ".";
+  }
+
+  // Universe discovery and sync packets are always passed through.
+  EXPECT_EQ(RunSocketFilter(prog, MakeUdpDatagram(ACN_VECTOR_ROOT_E131_EXTENDED, 5u)), SACN_BPF_ACCEPT);
+}
+
+TEST_F(TestSockets, UniverseFilterRejectsAllDataWithNoUniverses)
+{
+  std::vector<SacnBpfInsn> prog(SACN_UNIVERSE_FILTER_SIZE(0u));
+  ASSERT_EQ(sacn_build_universe_filter(nullptr, 0u, prog.data(), prog.size()), prog.size());
+
+  EXPECT_EQ(RunSocketFilter(prog, MakeUdpDatagram(ACN_VECTOR_ROOT_E131_DATA, 1u)), SACN_BPF_REJECT);
+  EXPECT_EQ(RunSocketFilter(prog, MakeUdpDatagram(ACN_VECTOR_ROOT_E131_EXTENDED, 1u)), SACN_BPF_ACCEPT);
+}
+
+TEST_F(TestSockets, UniverseFilterFailsWhenTooLarge)
+{
+  std::vector<SacnUniverseRange> ranges;
+  for (uint16_t universe = 1u; ranges.size() < SACN_BPF_MAX_INSNS / 5u; universe += 2u)
+    ranges.push_back({universe, universe});
+
+  std::vector<SacnBpfInsn> prog(SACN_UNIVERSE_FILTER_SIZE(ranges.size()));
+  EXPECT_EQ(sacn_build_universe_filter(ranges.data(), ranges.size(), prog.data(), prog.size()), 0u);
+  EXPECT_EQ(sacn_build_universe_filter(ranges.data(), 2u, prog.data(), SACN_UNIVERSE_FILTER_SIZE(1u)), 0u);
+}
+
+TEST_F(TestSockets, SteeringFilterSelectsOwningThreadsSocket)
+{
+  static constexpr unsigned int kNumThreads = 3u;
+
+  // Group order as the kernel would have it: thread 1 bound first, then thread 2 twice (old socket not closed yet).
+  const std::vector<sacn_thread_id_t> group_threads = {1u, 2u, 2u};
+
+  std::vector<SacnBpfInsn> prog(SACN_STEERING_FILTER_SIZE(kNumThreads));
+  size_t num_insns = sacn_build_steering_filter(group_threads.data(), group_threads.size(), kNumThreads, prog.data(),
+                                                prog.size());
+  ASSERT_GT(num_insns, 0u);
+  prog.resize(num_insns);
+
+  for (uint16_t universe = 1u; universe < 100u; ++universe)
+  {
+    uint32_t index = RunSocketFilter(prog, MakeUdpPayload(ACN_VECTOR_ROOT_E131_DATA, universe));
+    switch (SACN_STEERED_THREAD(universe, kNumThreads))
+    {
+      case 0u:
+        EXPECT_GE(index, group_threads.size()) << "Test failed on universe " << universe << ".";  // Kernel's choice
+        break;
+      case 1u:
+        EXPECT_EQ(index, 0u) << "Test failed on universe " << universe << ".";
+        break;
+      default:
+        EXPECT_EQ(index, 2u) << "Test failed on universe " << universe << ".";  // Newest socket for the thread
+        break;
+    }
+  }
+
+  // Universe discovery goes to thread 0, which has no socket here.
+  EXPECT_GE(RunSocketFilter(prog, MakeUdpPayload(ACN_VECTOR_ROOT_E131_EXTENDED, 1u)), group_threads.size());
+}
+
+// An IP packet as a cooked packet socket sees it. Only the fields the ring filter looks at are filled in.
+static std::vector<uint8_t> MakeIpPacket(etcpal_iptype_t ip_type,
+                                         uint8_t         protocol,
+                                         uint16_t        dest_port,
+                                         size_t          ipv4_header_size = 20u,
+                                         uint16_t        ipv4_frag        = 0u,
+                                         uint32_t        root_vector      = ACN_VECTOR_ROOT_E131_DATA,
+                                         uint16_t        universe         = 1u)
+{
+  size_t header_size = (ip_type == kEtcPalIpTypeV4) ? ipv4_header_size : 40u;
+
+  std::vector<uint8_t> packet(header_size + SACN_BPF_UDP_HEADER_SIZE, 0u);
+  if (ip_type == kEtcPalIpTypeV4)
+  {
+    packet[0] = static_cast<uint8_t>(0x40u | (ipv4_header_size / 4u));
+    etcpal_pack_u16b(&packet[6], ipv4_frag);
+    packet[9] = protocol;
+  }
+  else
+  {
+    packet[0] = 0x60u;
+    packet[6] = protocol;
+  }
+  etcpal_pack_u16b(&packet[header_size + 2u], dest_port);
+
+  std::vector<uint8_t> payload = MakeUdpPayload(root_vector, universe);
+  packet.insert(packet.end(), payload.begin(), payload.end());
+  return packet;
+}
+
+static constexpr unsigned int      kTestRingNetint   = 3u;
+static constexpr SacnUniverseRange kTestAllUniverses = {0u, 0xffffu};
+
+TEST_F(TestSockets, RingFilterPassesOnlySacnUdp)
+{
+  std::vector<SacnBpfInsn> prog(SACN_RING_FILTER_SIZE(1u, 1u));
+  ASSERT_EQ(sacn_build_ring_filter(&kTestRingNetint, 1u, &kTestAllUniverses, 1u, prog.data(), prog.size()),
+            prog.size());
+
+  for (etcpal_iptype_t ip_type : {kEtcPalIpTypeV4, kEtcPalIpTypeV6})
+  {
+    EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(ip_type, 17u, 5568u), kTestRingNetint), SACN_BPF_ACCEPT);
+    EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(ip_type, 17u, 5569u), kTestRingNetint), SACN_BPF_REJECT);
+    EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(ip_type, 6u, 5568u), kTestRingNetint), SACN_BPF_REJECT);  // TCP
+  }
+
+  // IPv4 options move the UDP header.
+  EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(kEtcPalIpTypeV4, 17u, 5568u, 24u), kTestRingNetint), SACN_BPF_ACCEPT);
+  EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(kEtcPalIpTypeV4, 17u, 5569u, 24u), kTestRingNetint), SACN_BPF_REJECT);
+
+  // The first fragment carries the UDP header, later ones don't.
+  EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(kEtcPalIpTypeV4, 17u, 5568u, 20u, 0x2000u), kTestRingNetint),
+            SACN_BPF_ACCEPT);
+  EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(kEtcPalIpTypeV4, 17u, 5568u, 20u, 0x00b9u), kTestRingNetint),
+            SACN_BPF_REJECT);
+
+  // Not IP
+  std::vector<uint8_t> arp = MakeIpPacket(kEtcPalIpTypeV4, 17u, 5568u);
+  arp[0]                   = 0x00u;
+  EXPECT_EQ(RunSocketFilter(prog, arp, kTestRingNetint), SACN_BPF_REJECT);
+}
+
+TEST_F(TestSockets, RingFilterPassesOnlyListedNetints)
+{
+  const std::vector<unsigned int> netints = {2u, 5u, 9u};
+
+  std::vector<SacnBpfInsn> prog(SACN_RING_FILTER_SIZE(netints.size(), 1u));
+  ASSERT_EQ(sacn_build_ring_filter(netints.data(), netints.size(), &kTestAllUniverses, 1u, prog.data(), prog.size()),
+            prog.size());
+
+  for (unsigned int ifindex = 0u; ifindex < 12u; ++ifindex)
+  {
+    bool listed = (std::find(netints.begin(), netints.end(), ifindex) != netints.end());
+    for (etcpal_iptype_t ip_type : {kEtcPalIpTypeV4, kEtcPalIpTypeV6})
+    {
+      EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(ip_type, 17u, 5568u), ifindex),
+                listed ? SACN_BPF_ACCEPT : SACN_BPF_REJECT)
+          << "Test failed on interface " << ifindex << ".";
+    }
+  }
+
+  // A ring on no interfaces passes nothing.
+  std::vector<SacnBpfInsn> empty_prog(SACN_RING_FILTER_SIZE(0u, 0u));
+  ASSERT_EQ(sacn_build_ring_filter(nullptr, 0u, nullptr, 0u, empty_prog.data(), empty_prog.size()), empty_prog.size());
+  EXPECT_EQ(RunSocketFilter(empty_prog, MakeIpPacket(kEtcPalIpTypeV4, 17u, 5568u, 20u, 0u,
+                                                     ACN_VECTOR_ROOT_E131_EXTENDED),
+                            kTestRingNetint),
+            SACN_BPF_REJECT);
+}
+
+TEST_F(TestSockets, RingFilterPassesOnlyListedUniverses)
+{
+  const std::vector<SacnUniverseRange> ranges = {{1u, 4u}, {10u, 10u}, {300u, 301u}};
+
+  std::vector<SacnBpfInsn> prog(SACN_RING_FILTER_SIZE(1u, ranges.size()));
+  ASSERT_EQ(sacn_build_ring_filter(&kTestRingNetint, 1u, ranges.data(), ranges.size(), prog.data(), prog.size()),
+            prog.size());
+
+  for (etcpal_iptype_t ip_type : {kEtcPalIpTypeV4, kEtcPalIpTypeV6})
+  {
+    for (uint16_t universe = 1u; universe < 400u; ++universe)
+    {
+      bool listened = std::any_of(ranges.begin(), ranges.end(), [&](const SacnUniverseRange& range) {
+        return (universe >= range.first) && (universe <= range.last);
+      });
+      EXPECT_EQ(RunSocketFilter(prog,
+                                MakeIpPacket(ip_type, 17u, 5568u, 20u, 0u, ACN_VECTOR_ROOT_E131_DATA, universe),
+                                kTestRingNetint),
+                listened ? SACN_BPF_ACCEPT : SACN_BPF_REJECT)
+          << "Test failed on universe " << universe << ".";
+    }
+
+    // Universe discovery and sync packets are always passed through.
+    EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(ip_type, 17u, 5568u, 20u, 0u, ACN_VECTOR_ROOT_E131_EXTENDED, 5u),
+                              kTestRingNetint),
+              SACN_BPF_ACCEPT);
+  }
+
+  // IPv4 options move the sACN payload too.
+  EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(kEtcPalIpTypeV4, 17u, 5568u, 24u, 0u, ACN_VECTOR_ROOT_E131_DATA, 10u),
+                            kTestRingNetint),
+            SACN_BPF_ACCEPT);
+  EXPECT_EQ(RunSocketFilter(prog, MakeIpPacket(kEtcPalIpTypeV4, 17u, 5568u, 24u, 0u, ACN_VECTOR_ROOT_E131_DATA, 11u),
+                            kTestRingNetint),
+            SACN_BPF_REJECT);
+}
+
+TEST_F(TestSockets, RingFilterFailsWhenTooLarge)
+{
+  std::vector<SacnBpfInsn> prog(SACN_RING_FILTER_SIZE(1u, 1u) - 1u);
+  EXPECT_EQ(sacn_build_ring_filter(&kTestRingNetint, 1u, &kTestAllUniverses, 1u, prog.data(), prog.size()), 0u);
+
+  std::vector<unsigned int> netints(SACN_RING_FILTER_MAX_NETINTS + 1u, kTestRingNetint);
+  prog.resize(SACN_RING_FILTER_SIZE(netints.size(), 1u));
+  EXPECT_EQ(sacn_build_ring_filter(netints.data(), netints.size(), &kTestAllUniverses, 1u, prog.data(), prog.size()),
+            0u);
+}
+
+#if SACN_RECEIVER_USE_UDP_GRO
+
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+// Control data as recvmsg() would leave it for a read: the packet info, then the UDP_GRO segment size if there is one.
+class GroControl
+{
+public:
+  explicit GroControl(std::optional<int> segment_size, size_t gro_data_size = sizeof(int))
+  {
+    msghdr hdr{};
+    hdr.msg_control    = buf_.data();
+    hdr.msg_controllen = buf_.size();
+
+    cmsghdr* cmsg    = CMSG_FIRSTHDR(&hdr);
+    cmsg->cmsg_level = IPPROTO_IP;
+    cmsg->cmsg_type  = IP_PKTINFO;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+    size_t len       = CMSG_SPACE(sizeof(in_pktinfo));
+
+    if (segment_size)
+    {
+      cmsg             = reinterpret_cast<cmsghdr*>(buf_.data() + len);
+      cmsg->cmsg_level = SOL_UDP;
+      cmsg->cmsg_type  = UDP_GRO;
+      cmsg->cmsg_len   = CMSG_LEN(gro_data_size);
+      memcpy(CMSG_DATA(cmsg), &*segment_size, std::min(gro_data_size, sizeof(int)));
+      len += CMSG_SPACE(gro_data_size);
+    }
+
+    msg_.control    = buf_.data();
+    msg_.controllen = len;
+  }
+
+  const EtcPalMsgHdr* msg() const { return &msg_; }
+
+private:
+  alignas(cmsghdr) std::array<uint8_t, 128> buf_{};
+  EtcPalMsgHdr msg_{};
+};
+
+class TestGroBatch : public TestSockets
+{
+protected:
+  // Fills in read_result_ as if a read of data_len bytes had just been made into data_.
+  void Read(size_t data_len)
+  {
+    for (size_t i = 0; i < data_.size(); ++i)
+      data_[i] = static_cast<uint8_t>(i);
+
+    read_result_.data     = data_.data();
+    read_result_.data_len = data_len;
+    ETCPAL_IP_SET_V4_ADDRESS(&read_result_.from_addr.ip, 0x0a650203u);
+    read_result_.from_addr.port = 5568u;
+    read_result_.netint.ip_type = kEtcPalIpTypeV4;
+    read_result_.netint.index   = 2u;
+    read_result_.timestamp_ns   = 123456789u;
+  }
+
+  // Checks that the next datagram from the batch is at offset in the read and is len long.
+  void ExpectSegment(size_t offset, size_t len)
+  {
+    SacnReadResult segment{};
+    ASSERT_TRUE(sacn_next_gro_segment(&batch_, &segment));
+    EXPECT_EQ(segment.data, &data_[offset]);
+    EXPECT_EQ(segment.data_len, len);
+    EXPECT_EQ(ETCPAL_IP_V4_ADDRESS(&segment.from_addr.ip), 0x0a650203u);
+    EXPECT_EQ(segment.from_addr.port, 5568u);
+    EXPECT_EQ(segment.netint.index, 2u);
+    EXPECT_EQ(segment.timestamp_ns, 123456789u);
+  }
+
+  void ExpectBatchEmpty()
+  {
+    SacnReadResult segment{};
+    EXPECT_FALSE(sacn_next_gro_segment(&batch_, &segment));
+  }
+
+  std::array<uint8_t, 1024> data_{};
+  SacnReadResult            read_result_{};
+  SacnGroBatch              batch_{};
+};
+
+TEST_F(TestGroBatch, SplitsCoalescedRead)
+{
+  Read(300u);
+  sacn_start_gro_batch(&batch_, GroControl(100).msg(), &read_result_);
+
+  EXPECT_EQ(read_result_.data, data_.data());
+  EXPECT_EQ(read_result_.data_len, 100u);
+  ExpectSegment(100u, 100u);
+  ExpectSegment(200u, 100u);
+  ExpectBatchEmpty();
+}
+
+TEST_F(TestGroBatch, LastSegmentCanBeShort)
+{
+  Read(250u);
+  sacn_start_gro_batch(&batch_, GroControl(100).msg(), &read_result_);
+
+  EXPECT_EQ(read_result_.data_len, 100u);
+  ExpectSegment(100u, 100u);
+  ExpectSegment(200u, 50u);
+  ExpectBatchEmpty();
+}
+
+TEST_F(TestGroBatch, LeavesReadAloneWithoutGroControl)
+{
+  Read(300u);
+  sacn_start_gro_batch(&batch_, GroControl(std::nullopt).msg(), &read_result_);
+
+  EXPECT_EQ(read_result_.data, data_.data());
+  EXPECT_EQ(read_result_.data_len, 300u);
+  ExpectBatchEmpty();
+}
+
+TEST_F(TestGroBatch, LeavesReadAloneWithUnusableGroControl)
+{
+  // Too short to hold the segment size
+  Read(300u);
+  sacn_start_gro_batch(&batch_, GroControl(100, 2u).msg(), &read_result_);
+  EXPECT_EQ(read_result_.data_len, 300u);
+  ExpectBatchEmpty();
+
+  // Not a valid segment size
+  for (int segment_size : {0, -1})
+  {
+    sacn_start_gro_batch(&batch_, GroControl(segment_size).msg(), &read_result_);
+    EXPECT_EQ(read_result_.data_len, 300u);
+    ExpectBatchEmpty();
+  }
+}
+
+TEST_F(TestGroBatch, LeavesSingleDatagramAlone)
+{
+  // The kernel can report a segment size for a read that holds just one datagram.
+  for (size_t data_len : {100u, 60u})
+  {
+    Read(data_len);
+    sacn_start_gro_batch(&batch_, GroControl(100).msg(), &read_result_);
+
+    EXPECT_EQ(read_result_.data_len, data_len);
+    ExpectBatchEmpty();
+  }
+}
+
+#endif  // SACN_RECEIVER_USE_UDP_GRO
@@ -0,0 +1,207 @@
+/******************************************************************************
+ * Copyright 2024 ETC Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************
+ * This file is a part of sACN. For more information, go to:
+ * https://github.com/ETCLabs/sACN
+ *****************************************************************************/
+
+#include "sacn/private/uring.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "sacn/opts.h"
+#include "gtest/gtest.h"
+
+#if SACN_RECEIVER_USE_IO_URING
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static constexpr int    kTestWaitMs     = 100;
+static constexpr int    kTestIdleWaitMs = 10;
+static constexpr size_t kTestPacketSize = 100u;
+
+// These run against the kernel's io_uring, over loopback.
+class TestUring : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    if (sacn_uring_init(&ring_) != kEtcPalErrOk)
+      GTEST_SKIP() << "io_uring isn't available on this system.";
+
+    ring_initialized_ = true;
+    tx_               = socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(tx_, 0);
+  }
+
+  void TearDown() override
+  {
+    if (tx_ >= 0)
+      close(tx_);
+    if (ring_initialized_)
+      sacn_uring_deinit(&ring_);
+  }
+
+  // Opens a loopback socket on an ephemeral port, or on addr's port if it has one.
+  static int OpenSocket(sockaddr_in& addr)
+  {
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    EXPECT_GE(sock, 0);
+
+    int reuse = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    EXPECT_EQ(bind(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+
+    socklen_t addr_len = sizeof(addr);
+    EXPECT_EQ(getsockname(sock, reinterpret_cast<sockaddr*>(&addr), &addr_len), 0);
+    return sock;
+  }
+
+  void SendPacket(const sockaddr_in& to, uint8_t value)
+  {
+    std::array<uint8_t, kTestPacketSize> packet;
+    packet.fill(value);
+    EXPECT_EQ(sendto(tx_, packet.data(), packet.size(), 0, reinterpret_cast<const sockaddr*>(&to), sizeof(to)),
+              static_cast<ssize_t>(packet.size()));
+  }
+
+  void ExpectPacket(int sock, uint8_t value)
+  {
+    SacnUringEvent event;
+    ASSERT_EQ(sacn_uring_wait(&ring_, &event, kTestWaitMs), kEtcPalErrOk);
+    EXPECT_EQ(event.type, kSacnUringPacket);
+    EXPECT_EQ(event.socket, sock);
+    ASSERT_EQ(event.msg.buflen, kTestPacketSize);
+    EXPECT_EQ(static_cast<const uint8_t*>(event.msg.buf)[0], value);
+  }
+
+  void ExpectIdle()
+  {
+    SacnUringEvent event;
+    EXPECT_EQ(sacn_uring_wait(&ring_, &event, kTestIdleWaitMs), kEtcPalErrTimedOut);
+  }
+
+  SacnUring ring_{};
+  bool      ring_initialized_{false};
+  int       tx_{-1};
+};
+
+TEST_F(TestUring, ReceivesPacketsFromAddedSocket)
+{
+  sockaddr_in addr{};
+  int         rx = OpenSocket(addr);
+  ASSERT_EQ(sacn_uring_add_socket(&ring_, rx), kEtcPalErrOk);
+
+  SendPacket(addr, 1u);
+  ExpectPacket(rx, 1u);
+  ExpectIdle();
+
+  sacn_uring_remove(&ring_, rx);
+  close(rx);
+}
+
+TEST_F(TestUring, KeepsReceivingAfterRunningOutOfBuffers)
+{
+  sockaddr_in addr{};
+  int         rx = OpenSocket(addr);
+  ASSERT_EQ(sacn_uring_add_socket(&ring_, rx), kEtcPalErrOk);
+
+  // More packets than buffers arrive before any are processed, which ends the receive with ENOBUFS. The rest wait in
+  // the socket until the receive is re-armed.
+  constexpr uint8_t kNumPackets = (SACN_RECEIVER_IO_URING_BUFFERS * 2) - 1;
+  for (uint8_t i = 0; i < kNumPackets; ++i)
+    SendPacket(addr, i);
+  for (uint8_t i = 0; i < kNumPackets; ++i)
+    ExpectPacket(rx, i);
+  ExpectIdle();
+
+  SendPacket(addr, kNumPackets);
+  ExpectPacket(rx, kNumPackets);
+
+  sacn_uring_remove(&ring_, rx);
+  close(rx);
+}
+
+TEST_F(TestUring, RemovedSocketIsNotReArmed)
+{
+  sockaddr_in addr{};
+  int         rx = OpenSocket(addr);
+  ASSERT_EQ(sacn_uring_add_socket(&ring_, rx), kEtcPalErrOk);
+
+  // A packet already received for the socket is dropped with it.
+  SendPacket(addr, 1u);
+  sacn_uring_remove(&ring_, rx);
+  close(rx);
+  ExpectIdle();
+
+  // A new socket that gets the same descriptor only sees its own packets.
+  sockaddr_in new_addr{};
+  int         new_rx = OpenSocket(new_addr);
+  ASSERT_EQ(sacn_uring_add_socket(&ring_, new_rx), kEtcPalErrOk);
+
+  SendPacket(new_addr, 2u);
+  ExpectPacket(new_rx, 2u);
+  ExpectIdle();
+
+  sacn_uring_remove(&ring_, new_rx);
+  close(new_rx);
+}
+
+TEST_F(TestUring, ReArmsAfterReceiveErrorsAndFallsBackToPolling)
+{
+  // Connect the socket to a closed port, so each send comes back as a port unreachable error on its next receive.
+  sockaddr_in peer_addr{};
+  close(OpenSocket(peer_addr));
+
+  sockaddr_in addr{};
+  int         rx = OpenSocket(addr);
+  ASSERT_EQ(connect(rx, reinterpret_cast<const sockaddr*>(&peer_addr), sizeof(peer_addr)), 0);
+  ASSERT_EQ(sacn_uring_add_socket(&ring_, rx), kEtcPalErrOk);
+
+  constexpr int kErrorsBeforePolling = 3;  // URING_MAX_RECV_ERRORS in uring.c
+
+  SacnUringEvent event;
+  for (int i = 0; i < kErrorsBeforePolling; ++i)
+  {
+    ASSERT_EQ(send(rx, "x", 1, 0), 1);
+    ASSERT_EQ(sacn_uring_wait(&ring_, &event, kTestWaitMs), kEtcPalErrOk);
+    EXPECT_EQ(event.type, kSacnUringError);
+    EXPECT_EQ(event.socket, rx);
+    ExpectIdle();
+  }
+
+  // After repeated errors the socket is polled instead, and the caller reads it.
+  int peer = OpenSocket(peer_addr);
+  ASSERT_EQ(sendto(peer, "y", 1, 0, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)), 1);
+  ASSERT_EQ(sacn_uring_wait(&ring_, &event, kTestWaitMs), kEtcPalErrOk);
+  EXPECT_EQ(event.type, kSacnUringReadable);
+  EXPECT_EQ(event.socket, rx);
+
+  char buf[4];
+  EXPECT_EQ(recv(rx, buf, sizeof(buf), 0), 1);
+  ExpectIdle();
+
+  sacn_uring_remove(&ring_, rx);
+  close(rx);
+  close(peer);
+}
+
+#endif  // SACN_RECEIVER_USE_IO_URING